@@ -25,9 +25,12 @@
 
 #include <lyra/lyra.hpp>
 
+#include "msgpack_rpc/clients/batch_future.h"
+#include "msgpack_rpc/clients/call_batch.h"
 #include "msgpack_rpc/clients/call_future.h"
 #include "msgpack_rpc/clients/client.h"
 #include "msgpack_rpc/clients/client_builder.h"
+#include "msgpack_rpc/clients/prepared_call.h"
 #include "msgpack_rpc/clients/server_exception.h"
 #include "msgpack_rpc/config/client_config.h"
 #include "msgpack_rpc/config/config_parser.h"
@@ -147,6 +150,47 @@ int main(int argc, char** argv) {
         }
     }
 
+    /* ************************************************************************
+     * Prepared calls.
+     **************************************************************************/
+    {
+        // Prepare calls of a frequently called method.
+        // Specify the signature of the method in the template parameter.
+        msgpack_rpc::clients::PreparedCall<int(int, int)> add =
+            client.prepare<int(int, int)>("add");
+
+        // Call the method synchronously.
+        int result = add.call(2, 3);
+
+        // Call the method asynchronously.
+        result = add.async_call(2, 3).get_result();
+
+        MSGPACK_RPC_INFO(logger, "Result of add(2, 3): {}", result);
+    }
+
+    /* ************************************************************************
+     * Batches of calls.
+     **************************************************************************/
+    {
+        // Create a batch to send many calls at once.
+        msgpack_rpc::clients::CallBatch batch = client.batch();
+
+        // Add calls. Requests are not sent yet.
+        msgpack_rpc::clients::CallFuture<int> future1 =
+            batch.add<int>("add", 2, 3);
+        msgpack_rpc::clients::CallFuture<int> future2 =
+            batch.add<int>("add", 4, 5);
+
+        // Send all the requests with one write.
+        msgpack_rpc::clients::BatchFuture batch_future = batch.send();
+
+        // Wait for all the calls.
+        batch_future.wait_all();
+
+        MSGPACK_RPC_INFO(logger, "Results of add in a batch: {}, {}",
+            future1.get_result(), future2.get_result());
+    }
+
     /* ************************************************************************
      * Notifications.
      **************************************************************************/
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of BatchFuture class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "msgpack_rpc/clients/impl/i_batch_future_impl.h"
+
+namespace msgpack_rpc::clients {
+
+/*!
+ * \brief Class of future objects to wait for batches of RPCs.
+ *
+ * Objects of this class are created by CallBatch::send function.
+ *
+ * \note Results of individual RPCs are obtained from CallFuture objects
+ * returned by CallBatch::add function.
+ */
+class BatchFuture {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] impl Object of the internal implementation.
+     *
+     * \warning Users should create objects of this class using
+     * CallBatch::send function.
+     */
+    explicit BatchFuture(std::shared_ptr<impl::IBatchFutureImpl> impl)
+        : impl_(std::move(impl)) {}
+
+    /*!
+     * \brief Wait until all RPCs in the batch finish.
+     *
+     * \throw MsgpackRPCException Timeout.
+     *
+     * \note RPCs finish with results, errors, timeouts, or cancellation.
+     */
+    void wait_all() { impl_->wait_all(); }
+
+    /*!
+     * \brief Wait until all RPCs in the batch finish within a timeout.
+     *
+     * \param[in] timeout Timeout.
+     *
+     * \throw MsgpackRPCException Timeout.
+     */
+    void wait_all_within(std::chrono::nanoseconds timeout) {
+        impl_->wait_all_within(timeout);
+    }
+
+    /*!
+     * \brief Wait until any RPC in the batch finishes.
+     *
+     * \throw MsgpackRPCException Timeout.
+     */
+    void wait_any() { impl_->wait_any(); }
+
+    /*!
+     * \brief Wait until any RPC in the batch finishes within a timeout.
+     *
+     * \param[in] timeout Timeout.
+     *
+     * \throw MsgpackRPCException Timeout.
+     */
+    void wait_any_within(std::chrono::nanoseconds timeout) {
+        impl_->wait_any_within(timeout);
+    }
+
+    /*!
+     * \brief Get the number of RPCs in the batch.
+     *
+     * \return Number of RPCs.
+     */
+    [[nodiscard]] std::size_t num_calls() const noexcept {
+        return impl_->num_calls();
+    }
+
+    /*!
+     * \brief Get the number of finished RPCs in the batch.
+     *
+     * \return Number of finished RPCs.
+     */
+    [[nodiscard]] std::size_t num_finished_calls() {
+        return impl_->num_finished_calls();
+    }
+
+private:
+    //! Object of the internal implementation.
+    std::shared_ptr<impl::IBatchFutureImpl> impl_;
+};
+
+}  // namespace msgpack_rpc::clients
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of CallBatch class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "msgpack_rpc/clients/batch_future.h"
+#include "msgpack_rpc/clients/call_future.h"
+#include "msgpack_rpc/clients/impl/i_call_batch_impl.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+
+namespace msgpack_rpc::clients {
+
+/*!
+ * \brief Class of batches of RPCs.
+ *
+ * Objects of this class are created by Client::batch function.
+ *
+ * Requests added to a batch are serialized into one buffer, registered at
+ * once, and sent with one write when send function is called. This reduces
+ * overhead of many small RPCs issued at the same time.
+ *
+ * \note Deadlines of RPCs in a batch are determined when send function is
+ * called.
+ *
+ * \note Functions of this class are not thread-safe.
+ */
+class CallBatch {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] impl Object of the internal implementation.
+     *
+     * \warning Users should create objects of this class using Client::batch
+     * function.
+     */
+    explicit CallBatch(std::shared_ptr<impl::ICallBatchImpl> impl)
+        : impl_(std::move(impl)) {}
+
+    /*!
+     * \brief Add a call of a method.
+     *
+     * \tparam Result Type of the result.
+     * \tparam Parameters Types of parameters.
+     * \param[in] method_name Name of the method.
+     * \param[in] parameters Parameters.
+     * \return Future object to get the result of the RPC.
+     *
+     * \note The request is not sent until send function is called.
+     */
+    template <typename Result, typename... Parameters>
+    [[nodiscard]] CallFuture<std::decay_t<Result>> add(
+        messages::MethodNameView method_name, const Parameters&... parameters) {
+        return CallFuture<std::decay_t<Result>>{impl_->add(
+            method_name, impl::make_parameters_serializer(parameters...))};
+    }
+
+    /*!
+     * \brief Send all the requests in this batch.
+     *
+     * \return Future object to wait for the RPCs in this batch.
+     *
+     * \note A batch can be sent only once.
+     */
+    [[nodiscard]] BatchFuture send() { return BatchFuture(impl_->send()); }
+
+    /*!
+     * \brief Get the number of calls in this batch.
+     *
+     * \return Number of calls.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return impl_->size(); }
+
+private:
+    //! Object of the internal implementation.
+    std::shared_ptr<impl::ICallBatchImpl> impl_;
+};
+
+}  // namespace msgpack_rpc::clients
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <utility>
 
@@ -82,6 +83,32 @@ public:
         return get_from_call_result(call_result);
     }
 
+    /*!
+     * \brief Cancel the RPC.
+     *
+     * This function stops waiting for the result of the RPC, and notifies the
+     * server so that the server can skip or stop the processing of the
+     * request.
+     *
+     * \note After cancellation, functions to get the result throw
+     * MsgpackRPCException with msgpack_rpc::StatusCode::OPERATION_ABORTED
+     * unless the result has already been received.
+     */
+    void cancel() { impl_->cancel(); }
+
+    /*!
+     * \brief Add a function called when the RPC finishes.
+     *
+     * \param[in] handler Function.
+     *
+     * \note The function is called in the thread which sets the result or the
+     * error of the RPC, so it must not block. If the RPC has already finished,
+     * the function is called immediately in this thread.
+     */
+    void add_completion_handler(std::function<void()> handler) {
+        impl_->add_completion_handler(std::move(handler));
+    }
+
 private:
     /*!
      * \brief Get the result from CallResult object.
@@ -143,6 +170,32 @@ public:
         get_from_call_result(call_result);
     }
 
+    /*!
+     * \brief Cancel the RPC.
+     *
+     * This function stops waiting for the result of the RPC, and notifies the
+     * server so that the server can skip or stop the processing of the
+     * request.
+     *
+     * \note After cancellation, functions to get the result throw
+     * MsgpackRPCException with msgpack_rpc::StatusCode::OPERATION_ABORTED
+     * unless the result has already been received.
+     */
+    void cancel() { impl_->cancel(); }
+
+    /*!
+     * \brief Add a function called when the RPC finishes.
+     *
+     * \param[in] handler Function.
+     *
+     * \note The function is called in the thread which sets the result or the
+     * error of the RPC, so it must not block. If the RPC has already finished,
+     * the function is called immediately in this thread.
+     */
+    void add_completion_handler(std::function<void()> handler) {
+        impl_->add_completion_handler(std::move(handler));
+    }
+
 private:
     /*!
      * \brief Get the result from CallResult object.
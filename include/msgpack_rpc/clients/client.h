@@ -20,14 +20,21 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
+#include "msgpack_rpc/clients/call_batch.h"
 #include "msgpack_rpc/clients/call_future.h"
 #include "msgpack_rpc/clients/impl/i_client_impl.h"
 #include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/clients/prepared_call.h"
+#include "msgpack_rpc/clients/response_cache_statistics.h"
+#include "msgpack_rpc/clients/stream_reader.h"
+#include "msgpack_rpc/clients/upload_writer.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
 
 namespace msgpack_rpc::clients {
 
@@ -65,6 +72,9 @@ public:
      * \param[in] method_name Name of the method.
      * \param[in] parameters Parameters.
      * \return Future object to get the result of the RPC.
+     *
+     * \note This function doesn't block. When too many messages are waiting to
+     * be sent, the returned future fails with StatusCode::OVERLOADED.
      */
     template <typename Result, typename... Parameters>
     [[nodiscard]] CallFuture<std::decay_t<Result>> async_call(
@@ -91,6 +101,94 @@ public:
         return async_call<Result>(method_name, parameters...).get_result();
     }
 
+    /*!
+     * \brief Call a method with a streaming response.
+     *
+     * \tparam Chunk Type of chunks.
+     * \tparam Parameters Types of parameters.
+     * \param[in] method_name Name of the method.
+     * \param[in] parameters Parameters.
+     * \return Reader of the stream.
+     *
+     * \note Methods with streaming responses are added to servers using
+     * msgpack_rpc::servers::ServerBuilder::add_streaming_method function.
+     * \note The timeout of RPCs applies to the time without progress of the
+     * stream, and is restarted whenever a chunk is received or read.
+     * \note Reading of the connection is paused while too many chunks are not
+     * read, so readers should be read or destroyed promptly.
+     */
+    template <typename Chunk, typename... Parameters>
+    [[nodiscard]] StreamReader<std::decay_t<Chunk>> call_stream(
+        messages::MethodNameView method_name, const Parameters&... parameters) {
+        return StreamReader<std::decay_t<Chunk>>{impl_->async_call_stream(
+            method_name, impl::make_parameters_serializer(parameters...))};
+    }
+
+    /*!
+     * \brief Asynchronously call a method with an upload.
+     *
+     * \tparam Result Type of the result.
+     * \tparam Chunk Type of chunks.
+     * \tparam Parameters Types of parameters.
+     * \param[in] method_name Name of the method.
+     * \param[in] parameters Parameters.
+     * \return Writer of the upload.
+     *
+     * \note Methods with uploads are added to servers using
+     * msgpack_rpc::servers::ServerBuilder::add_upload_method function.
+     * \note The timeout of RPCs applies to the whole upload.
+     */
+    template <typename Result, typename Chunk, typename... Parameters>
+    [[nodiscard]] UploadWriter<std::decay_t<Chunk>, std::decay_t<Result>>
+    async_call_upload(
+        messages::MethodNameView method_name, const Parameters&... parameters) {
+        return UploadWriter<std::decay_t<Chunk>, std::decay_t<Result>>{
+            impl_->async_call_upload(
+                method_name, impl::make_parameters_serializer(parameters...))};
+    }
+
+    /*!
+     * \brief Prepare calls of a method.
+     *
+     * \tparam Signature Signature of the method (for example,
+     * `int(std::string)`).
+     * \param[in] method_name Name of the method.
+     * \return Object to call the method.
+     *
+     * \note Prepared calls are faster than async_call function and call
+     * function for frequently called methods.
+     */
+    template <typename Signature>
+    [[nodiscard]] PreparedCall<Signature> prepare(
+        messages::MethodNameView method_name) const {
+        return PreparedCall<Signature>(impl_, method_name);
+    }
+
+    /*!
+     * \brief Get the statistics of the cache of responses of a method.
+     *
+     * \param[in] method_name Name of the method.
+     * \return Statistics.
+     *
+     * \note Caches of responses are configured by
+     * config::ClientConfig::add_response_cache function.
+     */
+    [[nodiscard]] ResponseCacheStatistics response_cache_statistics(
+        messages::MethodNameView method_name) const {
+        return impl_->response_cache_statistics(method_name);
+    }
+
+    /*!
+     * \brief Create a batch of RPCs.
+     *
+     * \return Batch.
+     *
+     * \note Batches reduce the overhead of many small RPCs issued at once,
+     * because requests in a batch are registered at once and sent with one
+     * write.
+     */
+    [[nodiscard]] CallBatch batch() { return CallBatch(impl_->create_batch()); }
+
     /*!
      * \brief Notify to a method.
      *
@@ -100,6 +198,8 @@ public:
      *
      * \note Notifications are always processed asynchronously because a
      * notification doesn't have a response.
+     * \note This function throws an exception with StatusCode::OVERLOADED when
+     * too many messages are waiting to be sent.
      */
     template <typename... Parameters>
     void notify(
@@ -108,6 +208,30 @@ public:
             method_name, impl::make_parameters_serializer(parameters...));
     }
 
+    /*!
+     * \brief Subscribe to a topic in the server.
+     *
+     * Messages published to the topic are received as notifications whose
+     * method name is the name of the topic, so handlers of them must be added
+     * using msgpack_rpc::clients::ClientBuilder::add_notification_handler.
+     *
+     * \param[in] topic Topic.
+     *
+     * \note This function waits until the server registers the subscription.
+     */
+    void subscribe(std::string_view topic) {
+        call<void>(messages::SUBSCRIBE_TOPIC_METHOD_NAME, topic);
+    }
+
+    /*!
+     * \brief Unsubscribe from a topic in the server.
+     *
+     * \param[in] topic Topic.
+     */
+    void unsubscribe(std::string_view topic) {
+        call<void>(messages::UNSUBSCRIBE_TOPIC_METHOD_NAME, topic);
+    }
+
     /*!
      * \brief Get the executor.
      *
@@ -31,6 +31,8 @@
 #include "msgpack_rpc/clients/impl/i_client_builder_impl.h"
 #include "msgpack_rpc/config/client_config.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/methods/functional_method.h"
 
 namespace msgpack_rpc::clients {
 
@@ -103,6 +105,62 @@ public:
             addresses::URI(addresses::TCP_SCHEME, host, port_number));
     }
 
+    /*!
+     * \brief Add a method called by servers.
+     *
+     * \param[in] method Method.
+     * \return This.
+     *
+     * \note This overload should not be used in most applications.
+     */
+    ClientBuilder& add_method(std::unique_ptr<methods::IMethod> method) {
+        impl_->add_method(std::move(method));
+        return *this;
+    }
+
+    /*!
+     * \brief Add a method called by servers, implemented by a function object.
+     *
+     * Servers call methods in clients over the connections from the clients
+     * using msgpack_rpc::servers::Server::async_call, so that clients don't
+     * need to listen to any address.
+     *
+     * \tparam Signature Signature of the method.
+     * \tparam Function Type of the function implementing the method.
+     * \param[in] name Name of the method.
+     * \param[in] function Function implementing the method.
+     * \return This.
+     *
+     * \note Methods are called in threads for callbacks.
+     */
+    template <typename Signature, typename Function>
+    ClientBuilder& add_method(messages::MethodName name, Function&& function) {
+        return add_method(
+            methods::create_functional_method<Signature>(std::move(name),
+                std::forward<Function>(function), impl_->logger()));
+    }
+
+    /*!
+     * \brief Add a handler of notifications from servers.
+     *
+     * \tparam Signature Signature of the handler. Return values are ignored.
+     * \tparam Function Type of the function implementing the handler.
+     * \param[in] name Name of the method in notifications.
+     * \param[in] function Function implementing the handler.
+     * \return This.
+     *
+     * \note Handlers are called in threads for callbacks. Notifications of
+     * methods without handlers are ignored.
+     * \note Handlers of notifications are methods called by servers, so this
+     * function is equivalent to add_method.
+     */
+    template <typename Signature, typename Function>
+    ClientBuilder& add_notification_handler(
+        messages::MethodName name, Function&& function) {
+        return add_method<Signature>(
+            std::move(name), std::forward<Function>(function));
+    }
+
     /*!
      * \brief Build a client.
      *
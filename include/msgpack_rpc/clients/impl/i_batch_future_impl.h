@@ -0,0 +1,90 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of IBatchFutureImpl class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Interface of internal implementation of future objects to wait for
+ * batches of RPCs.
+ */
+class IBatchFutureImpl {
+public:
+    /*!
+     * \brief Wait until all RPCs in the batch finish.
+     *
+     * \note This function throws an exception when the RPCs don't finish
+     * until the deadline of the batch.
+     */
+    virtual void wait_all() = 0;
+
+    /*!
+     * \brief Wait until all RPCs in the batch finish within a timeout.
+     *
+     * \param[in] timeout Timeout.
+     */
+    virtual void wait_all_within(std::chrono::nanoseconds timeout) = 0;
+
+    /*!
+     * \brief Wait until any RPC in the batch finishes.
+     *
+     * \note This function throws an exception when no RPC finishes until the
+     * deadline of the batch.
+     */
+    virtual void wait_any() = 0;
+
+    /*!
+     * \brief Wait until any RPC in the batch finishes within a timeout.
+     *
+     * \param[in] timeout Timeout.
+     */
+    virtual void wait_any_within(std::chrono::nanoseconds timeout) = 0;
+
+    /*!
+     * \brief Get the number of RPCs in the batch.
+     *
+     * \return Number of RPCs.
+     */
+    [[nodiscard]] virtual std::size_t num_calls() const noexcept = 0;
+
+    /*!
+     * \brief Get the number of finished RPCs in the batch.
+     *
+     * \return Number of finished RPCs.
+     */
+    [[nodiscard]] virtual std::size_t num_finished_calls() = 0;
+
+    IBatchFutureImpl(const IBatchFutureImpl&) = delete;
+    IBatchFutureImpl(IBatchFutureImpl&&) = delete;
+    IBatchFutureImpl& operator=(const IBatchFutureImpl&) = delete;
+    IBatchFutureImpl& operator=(IBatchFutureImpl&&) = delete;
+
+    //! Destructor.
+    virtual ~IBatchFutureImpl() noexcept = default;
+
+protected:
+    //! Constructor.
+    IBatchFutureImpl() noexcept = default;
+};
+
+}  // namespace msgpack_rpc::clients::impl
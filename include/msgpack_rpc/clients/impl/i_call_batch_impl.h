@@ -0,0 +1,78 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of ICallBatchImpl class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "msgpack_rpc/clients/impl/i_batch_future_impl.h"
+#include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Interface of internal implementation of batches of RPCs.
+ */
+class ICallBatchImpl {
+public:
+    /*!
+     * \brief Add a call of a method.
+     *
+     * \param[in] method_name Name of the method.
+     * \param[in] parameters Parameters.
+     * \return Future object to wait the result of the call.
+     *
+     * \note Requests are serialized in this function, but not sent until
+     * send function is called.
+     */
+    [[nodiscard]] virtual std::shared_ptr<ICallFutureImpl> add(
+        messages::MethodNameView method_name,
+        const IParametersSerializer& parameters) = 0;
+
+    /*!
+     * \brief Send all the requests in this batch.
+     *
+     * \return Future object to wait the results of the calls.
+     */
+    [[nodiscard]] virtual std::shared_ptr<IBatchFutureImpl> send() = 0;
+
+    /*!
+     * \brief Get the number of calls in this batch.
+     *
+     * \return Number of calls.
+     */
+    [[nodiscard]] virtual std::size_t size() const noexcept = 0;
+
+    ICallBatchImpl(const ICallBatchImpl&) = delete;
+    ICallBatchImpl(ICallBatchImpl&&) = delete;
+    ICallBatchImpl& operator=(const ICallBatchImpl&) = delete;
+    ICallBatchImpl& operator=(ICallBatchImpl&&) = delete;
+
+    //! Destructor.
+    virtual ~ICallBatchImpl() noexcept = default;
+
+protected:
+    //! Constructor.
+    ICallBatchImpl() noexcept = default;
+};
+
+}  // namespace msgpack_rpc::clients::impl
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 
 #include "msgpack_rpc/messages/call_result.h"
 
@@ -52,6 +53,25 @@ public:
     [[nodiscard]] virtual messages::CallResult get_result_within(
         std::chrono::nanoseconds timeout) = 0;
 
+    /*!
+     * \brief Cancel the RPC.
+     *
+     * \note After cancellation, functions to get the result throw exceptions
+     * with msgpack_rpc::StatusCode::OPERATION_ABORTED unless the result has
+     * already been received.
+     */
+    virtual void cancel() = 0;
+
+    /*!
+     * \brief Add a function called when the result or an error is set.
+     *
+     * \param[in] handler Function.
+     *
+     * \note If the result or an error has already been set, the function is
+     * called immediately.
+     */
+    virtual void add_completion_handler(std::function<void()> handler) = 0;
+
     ICallFutureImpl(const ICallFutureImpl&) = delete;
     ICallFutureImpl(ICallFutureImpl&&) = delete;
     ICallFutureImpl& operator=(const ICallFutureImpl&) = delete;
@@ -27,6 +27,7 @@
 #include "msgpack_rpc/executors/i_async_executor.h"
 #include "msgpack_rpc/impl/msgpack_rpc_export.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/methods/i_method.h"
 #include "msgpack_rpc/transport/i_backend.h"
 
 namespace msgpack_rpc::clients::impl {
@@ -51,6 +52,13 @@ public:
      */
     virtual void connect_to(addresses::URI uri) = 0;
 
+    /*!
+     * \brief Add a method called by servers.
+     *
+     * \param[in] method Method.
+     */
+    virtual void add_method(std::unique_ptr<methods::IMethod> method) = 0;
+
     /*!
      * \brief Build a client.
      *
@@ -59,6 +67,13 @@ public:
     [[nodiscard]] virtual std::shared_ptr<clients::impl::IClientImpl>
     build() = 0;
 
+    /*!
+     * \brief Get the logger in this builder.
+     *
+     * \return Logger.
+     */
+    [[nodiscard]] virtual std::shared_ptr<logging::Logger> logger() = 0;
+
     IClientBuilderImpl(const IClientBuilderImpl&) = delete;
     IClientBuilderImpl(IClientBuilderImpl&&) = delete;
     IClientBuilderImpl& operator=(const IClientBuilderImpl&) = delete;
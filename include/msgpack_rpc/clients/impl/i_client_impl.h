@@ -21,8 +21,12 @@
 
 #include <memory>
 
+#include "msgpack_rpc/clients/impl/i_call_batch_impl.h"
 #include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/clients/impl/i_stream_reader_impl.h"
+#include "msgpack_rpc/clients/impl/i_upload_writer_impl.h"
 #include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/clients/response_cache_statistics.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/messages/method_name_view.h"
 
@@ -49,6 +53,44 @@ public:
         messages::MethodNameView method_name,
         const IParametersSerializer& parameters) = 0;
 
+    /*!
+     * \brief Asynchronously call a method with a streaming response.
+     *
+     * \param[in] method_name Name of the method.
+     * \param[in] parameters Parameters.
+     * \return Reader of the stream.
+     */
+    [[nodiscard]] virtual std::shared_ptr<IStreamReaderImpl>
+    async_call_stream(messages::MethodNameView method_name,
+        const IParametersSerializer& parameters) = 0;
+
+    /*!
+     * \brief Asynchronously call a method with an upload.
+     *
+     * \param[in] method_name Name of the method.
+     * \param[in] parameters Parameters.
+     * \return Writer of the upload.
+     */
+    [[nodiscard]] virtual std::shared_ptr<IUploadWriterImpl>
+    async_call_upload(messages::MethodNameView method_name,
+        const IParametersSerializer& parameters) = 0;
+
+    /*!
+     * \brief Get the statistics of the cache of responses of a method.
+     *
+     * \param[in] method_name Name of the method.
+     * \return Statistics.
+     */
+    [[nodiscard]] virtual ResponseCacheStatistics response_cache_statistics(
+        messages::MethodNameView method_name) = 0;
+
+    /*!
+     * \brief Create a batch of RPCs.
+     *
+     * \return Batch.
+     */
+    [[nodiscard]] virtual std::shared_ptr<ICallBatchImpl> create_batch() = 0;
+
     /*!
      * \brief Notify to a method.
      *
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of IStreamReaderImpl class.
+ */
+#pragma once
+
+#include <optional>
+
+#include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/parsed_parameters.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Interface of internal implementation of readers of streaming
+ * responses.
+ */
+class IStreamReaderImpl {
+public:
+    /*!
+     * \brief Get the next chunk.
+     *
+     * \return Parameters of the notification of the chunk, or std::nullopt if
+     * the stream has ended.
+     *
+     * \note This function will wait for the next chunk if not received, and
+     * throw an exception when the RPC times out.
+     */
+    [[nodiscard]] virtual std::optional<messages::ParsedParameters>
+    next() = 0;
+
+    /*!
+     * \brief Get the result of the RPC after the stream has ended.
+     *
+     * \return Result.
+     */
+    [[nodiscard]] virtual messages::CallResult result() = 0;
+
+    /*!
+     * \brief Cancel the RPC.
+     *
+     * \note After cancellation, functions to get chunks throw exceptions
+     * with msgpack_rpc::StatusCode::OPERATION_ABORTED.
+     */
+    virtual void cancel() = 0;
+
+    IStreamReaderImpl(const IStreamReaderImpl&) = delete;
+    IStreamReaderImpl(IStreamReaderImpl&&) = delete;
+    IStreamReaderImpl& operator=(const IStreamReaderImpl&) = delete;
+    IStreamReaderImpl& operator=(IStreamReaderImpl&&) = delete;
+
+    //! Destructor.
+    virtual ~IStreamReaderImpl() noexcept = default;
+
+protected:
+    //! Constructor.
+    IStreamReaderImpl() noexcept = default;
+};
+
+}  // namespace msgpack_rpc::clients::impl
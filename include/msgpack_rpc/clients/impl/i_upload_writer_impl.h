@@ -0,0 +1,77 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of IUploadWriterImpl class.
+ */
+#pragma once
+
+#include <memory>
+
+#include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Interface of internal implementation of writers of uploads.
+ */
+class IUploadWriterImpl {
+public:
+    /*!
+     * \brief Get the message ID of the request.
+     *
+     * \return Message ID.
+     */
+    [[nodiscard]] virtual messages::MessageID request_id() const noexcept = 0;
+
+    /*!
+     * \brief Write a chunk.
+     *
+     * \param[in] chunk Serialized notification of the chunk.
+     *
+     * \note This function waits while too many chunks are not consumed in the
+     * server.
+     */
+    virtual void write(messages::SerializedMessage chunk) = 0;
+
+    /*!
+     * \brief Finish the upload.
+     *
+     * \return Future object to get the result of the RPC.
+     */
+    [[nodiscard]] virtual std::shared_ptr<ICallFutureImpl> finish() = 0;
+
+    /*!
+     * \brief Cancel the RPC.
+     */
+    virtual void cancel() = 0;
+
+    IUploadWriterImpl(const IUploadWriterImpl&) = delete;
+    IUploadWriterImpl(IUploadWriterImpl&&) = delete;
+    IUploadWriterImpl& operator=(const IUploadWriterImpl&) = delete;
+    IUploadWriterImpl& operator=(IUploadWriterImpl&&) = delete;
+
+    //! Destructor.
+    virtual ~IUploadWriterImpl() noexcept = default;
+
+protected:
+    //! Constructor.
+    IUploadWriterImpl() noexcept = default;
+};
+
+}  // namespace msgpack_rpc::clients::impl
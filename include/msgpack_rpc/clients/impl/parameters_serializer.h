@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <tuple>
 #include <utility>
@@ -26,6 +27,7 @@
 #include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/message_serializer.h"
 #include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/prepared_method_name.h"
 #include "msgpack_rpc/messages/serialized_message.h"
 
 namespace msgpack_rpc::clients::impl {
@@ -46,6 +48,21 @@ public:
         messages::MethodNameView method_name,
         messages::MessageID request_id) const = 0;
 
+    /*!
+     * \brief Create a serialized request data with the remaining budget of
+     * time.
+     *
+     * \param[in] method_name Name of the method to call with the request.
+     * \param[in] request_id Message ID of the request.
+     * \param[in] remaining_budget Remaining budget of time to process the
+     * request.
+     * \return Serialized request data.
+     */
+    [[nodiscard]] virtual messages::SerializedMessage
+    create_serialized_request_with_budget(messages::MethodNameView method_name,
+        messages::MessageID request_id,
+        std::chrono::nanoseconds remaining_budget) const = 0;
+
     /*!
      * \brief Create a serialized notification data.
      *
@@ -104,6 +121,16 @@ public:
             method_name, request_id, std::index_sequence_for<Parameters...>());
     }
 
+    //! \copydoc msgpack_rpc::clients::impl::IParametersSerializer::create_serialized_request_with_budget
+    [[nodiscard]] messages::SerializedMessage
+    create_serialized_request_with_budget(messages::MethodNameView method_name,
+        messages::MessageID request_id,
+        std::chrono::nanoseconds remaining_budget) const override {
+        return create_serialized_request_with_budget_impl(method_name,
+            request_id, remaining_budget,
+            std::index_sequence_for<Parameters...>());
+    }
+
     //! \copydoc msgpack_rpc::clients::impl::IParametersSerializer::create_serialized_notification
     [[nodiscard]] messages::SerializedMessage create_serialized_notification(
         messages::MethodNameView method_name) const override {
@@ -146,6 +173,28 @@ private:
             method_name, request_id, std::get<Indices>(parameters_)...);
     }
 
+    /*!
+     * \brief Create a serialized request data with the remaining budget of
+     * time.
+     *
+     * \tparam Indices Sequential indices of parameters.
+     * \param[in] method_name Name of the method to call with the request.
+     * \param[in] request_id Message ID of the request.
+     * \param[in] remaining_budget Remaining budget of time to process the
+     * request.
+     * \return Serialized request data.
+     */
+    template <std::size_t... Indices>
+    [[nodiscard]] messages::SerializedMessage
+    create_serialized_request_with_budget_impl(
+        messages::MethodNameView method_name, messages::MessageID request_id,
+        std::chrono::nanoseconds remaining_budget,
+        std::index_sequence<Indices...> /*indices*/) const {
+        return messages::MessageSerializer::serialize_request_with_budget(
+            method_name, request_id, remaining_budget,
+            std::get<Indices>(parameters_)...);
+    }
+
     /*!
      * \brief Create a serialized notification data.
      *
@@ -178,4 +227,118 @@ template <typename... Parameters>
     return ParametersSerializer<Parameters...>(parameters...);
 }
 
+/*!
+ * \brief Class of serializer of parameters of prepared methods.
+ *
+ * \tparam Parameters Types of parameters.
+ *
+ * Method names given to functions of this class are ignored, and the prepared
+ * method name given to the constructor is used instead.
+ */
+template <typename... Parameters>
+class PreparedParametersSerializer final : public IParametersSerializer {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] method_name Prepared method name.
+     * \param[in] parameters Parameters.
+     */
+    explicit PreparedParametersSerializer(
+        const messages::PreparedMethodName& method_name,
+        const Parameters&... parameters)
+        : method_name_(method_name), parameters_(parameters...) {}
+
+    //! \copydoc msgpack_rpc::clients::impl::IParametersSerializer::create_serialized_request
+    [[nodiscard]] messages::SerializedMessage create_serialized_request(
+        messages::MethodNameView /*method_name*/,
+        messages::MessageID request_id) const override {
+        return create_serialized_request_impl(
+            request_id, std::index_sequence_for<Parameters...>());
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IParametersSerializer::create_serialized_request_with_budget
+    [[nodiscard]] messages::SerializedMessage
+    create_serialized_request_with_budget(
+        messages::MethodNameView /*method_name*/,
+        messages::MessageID request_id,
+        std::chrono::nanoseconds remaining_budget) const override {
+        return create_serialized_request_with_budget_impl(request_id,
+            remaining_budget, std::index_sequence_for<Parameters...>());
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IParametersSerializer::create_serialized_notification
+    [[nodiscard]] messages::SerializedMessage create_serialized_notification(
+        messages::MethodNameView /*method_name*/) const override {
+        return create_serialized_notification_impl(
+            std::index_sequence_for<Parameters...>());
+    }
+
+    PreparedParametersSerializer(const PreparedParametersSerializer&) = delete;
+    PreparedParametersSerializer& operator=(
+        const PreparedParametersSerializer&) = delete;
+    PreparedParametersSerializer(PreparedParametersSerializer&&) = delete;
+    PreparedParametersSerializer& operator=(
+        PreparedParametersSerializer&&) = delete;
+
+    //! Destructor.
+    ~PreparedParametersSerializer() = default;
+
+private:
+    /*!
+     * \brief Create a serialized request data.
+     *
+     * \tparam Indices Sequential indices of parameters.
+     * \param[in] request_id Message ID of the request.
+     * \return Serialized request data.
+     */
+    template <std::size_t... Indices>
+    [[nodiscard]] messages::SerializedMessage create_serialized_request_impl(
+        messages::MessageID request_id,
+        std::index_sequence<Indices...> /*indices*/) const {
+        return messages::MessageSerializer::serialize_request(
+            method_name_, request_id, std::get<Indices>(parameters_)...);
+    }
+
+    /*!
+     * \brief Create a serialized request data with the remaining budget of
+     * time.
+     *
+     * \tparam Indices Sequential indices of parameters.
+     * \param[in] request_id Message ID of the request.
+     * \param[in] remaining_budget Remaining budget of time to process the
+     * request.
+     * \return Serialized request data.
+     */
+    template <std::size_t... Indices>
+    [[nodiscard]] messages::SerializedMessage
+    create_serialized_request_with_budget_impl(messages::MessageID request_id,
+        std::chrono::nanoseconds remaining_budget,
+        std::index_sequence<Indices...> /*indices*/) const {
+        return messages::MessageSerializer::serialize_request_with_budget(
+            method_name_, request_id, remaining_budget,
+            std::get<Indices>(parameters_)...);
+    }
+
+    /*!
+     * \brief Create a serialized notification data.
+     *
+     * \tparam Indices Sequential indices of parameters.
+     * \return Serialized notification data.
+     */
+    template <std::size_t... Indices>
+    [[nodiscard]] messages::SerializedMessage
+    create_serialized_notification_impl(
+        std::index_sequence<Indices...> /*indices*/) const {
+        return messages::MessageSerializer::serialize_notification(
+            method_name_.name(), std::get<Indices>(parameters_)...);
+    }
+
+    //! Prepared method name.
+    const messages::PreparedMethodName& method_name_;
+
+    //! Parameters.
+    std::tuple<const Parameters&...> parameters_;
+};
+
 }  // namespace msgpack_rpc::clients::impl
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of PreparedCall class.
+ */
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "msgpack_rpc/clients/call_future.h"
+#include "msgpack_rpc/clients/impl/i_client_impl.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/prepared_method_name.h"
+
+namespace msgpack_rpc::clients {
+
+/*!
+ * \brief Class of prepared calls of methods.
+ *
+ * \tparam Signature Signature of the method.
+ *
+ * Objects of this class are created by Client::prepare function.
+ */
+template <typename Signature>
+class PreparedCall;
+
+/*!
+ * \brief Class of prepared calls of methods.
+ *
+ * \tparam Result Type of the result.
+ * \tparam Parameters Types of parameters.
+ *
+ * Objects of this class are created by Client::prepare function.
+ *
+ * Prepared calls serialize requests using the method name encoded in advance
+ * and buffers sized from previous requests, so they are faster than
+ * Client::async_call function for frequently called methods.
+ */
+template <typename Result, typename... Parameters>
+class PreparedCall<Result(Parameters...)> {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] client_impl Object of the internal implementation of the
+     * client.
+     * \param[in] method_name Name of the method.
+     *
+     * \warning Users should create objects of this class using
+     * Client::prepare function.
+     */
+    PreparedCall(std::shared_ptr<impl::IClientImpl> client_impl,
+        messages::MethodNameView method_name)
+        : client_impl_(std::move(client_impl)),
+          method_name_(
+              std::make_shared<messages::PreparedMethodName>(method_name)) {}
+
+    /*!
+     * \brief Asynchronously call the method.
+     *
+     * \param[in] parameters Parameters.
+     * \return Future object to get the result of the RPC.
+     */
+    [[nodiscard]] CallFuture<std::decay_t<Result>> async_call(
+        const std::decay_t<Parameters>&... parameters) {
+        return CallFuture<std::decay_t<Result>>{client_impl_->async_call(
+            method_name_->name(),
+            impl::PreparedParametersSerializer<std::decay_t<Parameters>...>(
+                *method_name_, parameters...))};
+    }
+
+    /*!
+     * \brief Synchronously call the method.
+     *
+     * \param[in] parameters Parameters.
+     * \return Result of the RPC.
+     *
+     * \throw ServerException Errors in the server.
+     * \throw MsgpackRPCException Other errors.
+     */
+    std::decay_t<Result> call(const std::decay_t<Parameters>&... parameters) {
+        return async_call(parameters...).get_result();
+    }
+
+    /*!
+     * \brief Get the name of the method.
+     *
+     * \return Name of the method.
+     */
+    [[nodiscard]] messages::MethodNameView method_name() const noexcept {
+        return method_name_->name();
+    }
+
+private:
+    //! Object of the internal implementation of the client.
+    std::shared_ptr<impl::IClientImpl> client_impl_;
+
+    //! Prepared method name.
+    std::shared_ptr<messages::PreparedMethodName> method_name_;
+};
+
+}  // namespace msgpack_rpc::clients
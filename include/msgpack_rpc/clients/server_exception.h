@@ -34,6 +34,11 @@ namespace msgpack_rpc::clients {
  *
  * Exceptions of this class can be thrown by Client::call,
  * CallFuture::get_result, and CallFuture::get_result_within functions.
+ *
+ * Status codes of the exceptions are StatusCode::SERVER_ERROR, except for
+ * requests rejected by admission control of servers which have
+ * StatusCode::OVERLOADED. (Errors thrown in methods of servers always have
+ * StatusCode::SERVER_ERROR.)
  */
 class MSGPACK_RPC_EXPORT ServerException : public MsgpackRPCException {
 public:
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of StreamReader class.
+ */
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "msgpack_rpc/clients/impl/i_stream_reader_impl.h"
+#include "msgpack_rpc/clients/server_exception.h"
+#include "msgpack_rpc/messages/message_id.h"
+
+namespace msgpack_rpc::clients {
+
+/*!
+ * \brief Class of readers of streaming responses.
+ *
+ * \tparam Chunk Type of chunks.
+ *
+ * Objects of this class are created by Client::call_stream function.
+ */
+template <typename Chunk>
+class StreamReader {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] impl Object of the internal implementation.
+     *
+     * \warning Users should create objects of this class using
+     * Client::call_stream function.
+     */
+    explicit StreamReader(std::shared_ptr<impl::IStreamReaderImpl> impl)
+        : impl_(std::move(impl)) {}
+
+    /*!
+     * \brief Get the next chunk.
+     *
+     * \return Chunk, or std::nullopt if the stream has successfully ended.
+     *
+     * \throw ServerException Errors in the server.
+     * \throw MsgpackRPCException Other errors.
+     *
+     * \note This function will wait for the next chunk if not received,
+     * within the timeout of RPCs from the last progress of the stream.
+     */
+    [[nodiscard]] std::optional<Chunk> next() {
+        auto parameters = impl_->next();
+        if (parameters) {
+            return std::get<1>(parameters->as<messages::MessageID, Chunk>());
+        }
+        const auto call_result = impl_->result();
+        if (call_result.is_success()) {
+            return std::nullopt;
+        }
+        throw ServerException(call_result.object(), call_result.zone());
+    }
+
+    /*!
+     * \brief Cancel the RPC.
+     *
+     * This function stops waiting for chunks, and notifies the server so that
+     * the server can stop the processing of the request.
+     */
+    void cancel() { impl_->cancel(); }
+
+private:
+    //! Object of the internal implementation.
+    std::shared_ptr<impl::IStreamReaderImpl> impl_;
+};
+
+}  // namespace msgpack_rpc::clients
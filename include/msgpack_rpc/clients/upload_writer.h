@@ -0,0 +1,92 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of UploadWriter class.
+ */
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "msgpack_rpc/clients/call_future.h"
+#include "msgpack_rpc/clients/impl/i_upload_writer_impl.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+
+namespace msgpack_rpc::clients {
+
+/*!
+ * \brief Class of writers of uploads.
+ *
+ * \tparam Chunk Type of chunks.
+ * \tparam Result Type of the result.
+ *
+ * Objects of this class are created by Client::async_call_upload function.
+ */
+template <typename Chunk, typename Result>
+class UploadWriter {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] impl Object of the internal implementation.
+     *
+     * \warning Users should create objects of this class using
+     * Client::async_call_upload function.
+     */
+    explicit UploadWriter(std::shared_ptr<impl::IUploadWriterImpl> impl)
+        : impl_(std::move(impl)) {}
+
+    /*!
+     * \brief Write a chunk.
+     *
+     * \param[in] chunk Chunk.
+     *
+     * \throw MsgpackRPCException Errors including timeout and the end of the
+     * RPC.
+     *
+     * \note This function waits while too many chunks
+     * (msgpack_rpc::messages::UPLOAD_WINDOW_SIZE) are not consumed in the
+     * server.
+     */
+    void write(const Chunk& chunk) {
+        impl_->write(messages::MessageSerializer::serialize_notification(
+            messages::MethodNameView(messages::UPLOAD_CHUNK_METHOD_NAME),
+            impl_->request_id(), chunk));
+    }
+
+    /*!
+     * \brief Finish the upload.
+     *
+     * \return Future object to get the result of the RPC.
+     */
+    [[nodiscard]] CallFuture<Result> finish() {
+        return CallFuture<Result>(impl_->finish());
+    }
+
+    /*!
+     * \brief Cancel the RPC.
+     */
+    void cancel() { impl_->cancel(); }
+
+private:
+    //! Object of the internal implementation.
+    std::shared_ptr<impl::IUploadWriterImpl> impl_;
+};
+
+}  // namespace msgpack_rpc::clients
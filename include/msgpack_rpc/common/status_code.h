@@ -64,6 +64,10 @@ enum class StatusCode : std::uint8_t {
     //! Error in servers.
     SERVER_ERROR,
 
+    //! Server or client is overloaded and rejected a message without processing
+    //! it.
+    OVERLOADED,
+
     //! Unexpected errors. (Maybe a bug.)
     UNEXPECTED_ERROR
 };
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of AdmissionControlConfig class.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::config {
+
+/*!
+ * \brief Class of configurations of admission control.
+ *
+ * \note Requests exceeding the limits are rejected immediately using error
+ * responses with status code "OVERLOADED" (refer to messages::ERROR_CODE_KEY),
+ * without calling methods. Zero values mean no limit.
+ */
+class MSGPACK_RPC_EXPORT AdmissionControlConfig {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    AdmissionControlConfig();
+
+    /*!
+     * \brief Set the maximum number of concurrent connections.
+     *
+     * \param[in] value Value. (Zero for no limit.)
+     * \return This.
+     */
+    AdmissionControlConfig& max_connections(std::size_t value) noexcept;
+
+    /*!
+     * \brief Get the maximum number of concurrent connections.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t max_connections() const noexcept;
+
+    /*!
+     * \brief Set the maximum number of in-flight requests in a connection.
+     *
+     * \param[in] value Value. (Zero for no limit.)
+     * \return This.
+     */
+    AdmissionControlConfig& max_in_flight_per_connection(
+        std::size_t value) noexcept;
+
+    /*!
+     * \brief Get the maximum number of in-flight requests in a connection.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t max_in_flight_per_connection() const noexcept;
+
+    /*!
+     * \brief Set the maximum number of in-flight requests in a server.
+     *
+     * \param[in] value Value. (Zero for no limit.)
+     * \return This.
+     */
+    AdmissionControlConfig& max_in_flight_requests(std::size_t value) noexcept;
+
+    /*!
+     * \brief Get the maximum number of in-flight requests in a server.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t max_in_flight_requests() const noexcept;
+
+private:
+    //! Maximum number of concurrent connections.
+    std::size_t max_connections_;
+
+    //! Maximum number of requests processed concurrently in a connection.
+    std::size_t max_in_flight_per_connection_;
+
+    //! Maximum number of requests processed concurrently in a server.
+    std::size_t max_in_flight_requests_;
+};
+
+}  // namespace msgpack_rpc::config
@@ -20,13 +20,20 @@
 #pragma once
 
 #include <chrono>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/executor_config.h"
+#include "msgpack_rpc/config/flow_control_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
 #include "msgpack_rpc/config/reconnection_config.h"
+#include "msgpack_rpc/config/response_cache_config.h"
+#include "msgpack_rpc/config/socket_config.h"
+#include "msgpack_rpc/config/traffic_capture_config.h"
 #include "msgpack_rpc/impl/msgpack_rpc_export.h"
 
 namespace msgpack_rpc::config {
@@ -83,6 +90,71 @@ public:
      */
     [[nodiscard]] std::chrono::nanoseconds call_timeout() const noexcept;
 
+    /*!
+     * \brief Set whether to propagate deadlines of RPCs to servers.
+     *
+     * \param[in] value Value.
+     * \return This.
+     *
+     * \warning Requests with deadlines have an additional element which
+     * servers without support of deadlines reject, so enable this only when
+     * servers are implemented using this library.
+     */
+    ClientConfig& propagate_deadline(bool value) noexcept;
+
+    /*!
+     * \brief Get whether to propagate deadlines of RPCs to servers.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] bool propagate_deadline() const noexcept;
+
+    /*!
+     * \brief Add a name of a method whose identical calls share an RPC.
+     *
+     * While an RPC of the method is in flight, calls with the same
+     * parameters wait for the result of the RPC instead of sending new
+     * requests.
+     *
+     * \param[in] method_name Method name.
+     * \return This.
+     *
+     * \warning Use this only for idempotent methods. Calls sharing an RPC also
+     * share its timeout and cancellation.
+     */
+    ClientConfig& add_single_flight_method(std::string_view method_name);
+
+    /*!
+     * \brief Get the names of methods whose identical calls share an RPC.
+     *
+     * \return Method names.
+     */
+    [[nodiscard]] const std::vector<std::string>& single_flight_methods()
+        const noexcept;
+
+    /*!
+     * \brief Add a cache of responses of a method.
+     *
+     * Successful results of the method are cached in clients and reused for
+     * calls with the same parameters without sending requests.
+     *
+     * \param[in] method_name Method name.
+     * \param[in] config Configuration of the cache.
+     * \return This.
+     *
+     * \warning Use this only for idempotent methods.
+     */
+    ClientConfig& add_response_cache(
+        std::string_view method_name, const ResponseCacheConfig& config);
+
+    /*!
+     * \brief Get the configurations of caches of responses.
+     *
+     * \return Map from method names to configurations of caches.
+     */
+    [[nodiscard]] const std::unordered_map<std::string, ResponseCacheConfig>&
+    response_caches() const noexcept;
+
     /*!
      * \brief Get the configuration of parsers of messages.
      *
@@ -125,6 +197,62 @@ public:
      */
     [[nodiscard]] const ReconnectionConfig& reconnection() const noexcept;
 
+    /*!
+     * \brief Get the configuration of socket options.
+     *
+     * \return Configuration of socket options.
+     */
+    [[nodiscard]] SocketConfig& socket() noexcept;
+
+    /*!
+     * \brief Get the configuration of socket options.
+     *
+     * \return Configuration of socket options.
+     */
+    [[nodiscard]] const SocketConfig& socket() const noexcept;
+
+    /*!
+     * \brief Get the configuration of compression of messages.
+     *
+     * \return Configuration of compression of messages.
+     */
+    [[nodiscard]] CompressionConfig& compression() noexcept;
+
+    /*!
+     * \brief Get the configuration of compression of messages.
+     *
+     * \return Configuration of compression of messages.
+     */
+    [[nodiscard]] const CompressionConfig& compression() const noexcept;
+
+    /*!
+     * \brief Get the configuration of capture of traffic.
+     *
+     * \return Configuration of capture of traffic.
+     */
+    [[nodiscard]] TrafficCaptureConfig& traffic_capture() noexcept;
+
+    /*!
+     * \brief Get the configuration of capture of traffic.
+     *
+     * \return Configuration of capture of traffic.
+     */
+    [[nodiscard]] const TrafficCaptureConfig& traffic_capture() const noexcept;
+
+    /*!
+     * \brief Get the configuration of flow control.
+     *
+     * \return Configuration of flow control.
+     */
+    [[nodiscard]] FlowControlConfig& flow_control() noexcept;
+
+    /*!
+     * \brief Get the configuration of flow control.
+     *
+     * \return Configuration of flow control.
+     */
+    [[nodiscard]] const FlowControlConfig& flow_control() const noexcept;
+
 private:
     //! URIs.
     std::vector<addresses::URI> uris_;
@@ -132,6 +260,15 @@ private:
     //! Duration of timeout of RPCs.
     std::chrono::nanoseconds call_timeout_;
 
+    //! Whether to propagate deadlines of RPCs to servers.
+    bool propagate_deadline_;
+
+    //! Names of methods whose identical calls share an RPC.
+    std::vector<std::string> single_flight_methods_;
+
+    //! Configurations of caches of responses.
+    std::unordered_map<std::string, ResponseCacheConfig> response_caches_;
+
     //! Configuration of parsers of messages.
     MessageParserConfig message_parser_;
 
@@ -140,6 +277,18 @@ private:
 
     //! Configuration of reconnection.
     ReconnectionConfig reconnection_;
+
+    //! Configuration of socket options.
+    SocketConfig socket_;
+
+    //! Configuration of compression of messages.
+    CompressionConfig compression_;
+
+    //! Configuration of capture of traffic.
+    TrafficCaptureConfig traffic_capture_;
+
+    //! Configuration of flow control.
+    FlowControlConfig flow_control_;
 };
 
 }  // namespace msgpack_rpc::config
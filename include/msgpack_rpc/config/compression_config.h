@@ -0,0 +1,83 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of CompressionConfig class.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::config {
+
+/*!
+ * \brief Class of configurations of compression of messages.
+ *
+ * When enabled, connections advertise support of compression to peers, and
+ * compress messages larger than a threshold using LZ4 only after peers
+ * advertise support of compression too. So connections stay compatible with
+ * peers without compression.
+ *
+ * \note Compression is applied to TCP connections.
+ */
+class MSGPACK_RPC_EXPORT CompressionConfig {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    CompressionConfig();
+
+    /*!
+     * \brief Set whether to enable compression.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    CompressionConfig& enabled(bool value) noexcept;
+
+    /*!
+     * \brief Get whether to enable compression.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] bool enabled() const noexcept;
+
+    /*!
+     * \brief Set the minimum size of messages to compress.
+     *
+     * \param[in] value Value in bytes.
+     * \return This.
+     */
+    CompressionConfig& min_message_size(std::size_t value);
+
+    /*!
+     * \brief Get the minimum size of messages to compress.
+     *
+     * \return Value in bytes.
+     */
+    [[nodiscard]] std::size_t min_message_size() const noexcept;
+
+private:
+    //! Whether to enable compression.
+    bool enabled_;
+
+    //! Minimum size of messages to compress.
+    std::size_t min_message_size_;
+};
+
+}  // namespace msgpack_rpc::config
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of FlowControlConfig class.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::config {
+
+/*!
+ * \brief Class of configurations of flow control.
+ *
+ * \note When the size of a queue of messages to be sent exceeds a high
+ * watermark, servers stop reading from the connection until the size becomes
+ * lower than or equal to the low watermark. Clients reject messages which
+ * would exceed a high watermark with StatusCode::OVERLOADED without blocking
+ * callers. Zero high watermarks mean no limit.
+ */
+class MSGPACK_RPC_EXPORT FlowControlConfig {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    FlowControlConfig();
+
+    /*!
+     * \brief Set the high watermark of the number of bytes in queues.
+     *
+     * \param[in] value Value. (Zero for no limit.)
+     * \return This.
+     */
+    FlowControlConfig& high_watermark_bytes(std::size_t value) noexcept;
+
+    /*!
+     * \brief Get the high watermark of the number of bytes in queues.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t high_watermark_bytes() const noexcept;
+
+    /*!
+     * \brief Set the low watermark of the number of bytes in queues.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    FlowControlConfig& low_watermark_bytes(std::size_t value) noexcept;
+
+    /*!
+     * \brief Get the low watermark of the number of bytes in queues.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t low_watermark_bytes() const noexcept;
+
+    /*!
+     * \brief Set the high watermark of the number of messages in queues.
+     *
+     * \param[in] value Value. (Zero for no limit.)
+     * \return This.
+     */
+    FlowControlConfig& high_watermark_messages(std::size_t value) noexcept;
+
+    /*!
+     * \brief Get the high watermark of the number of messages in queues.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t high_watermark_messages() const noexcept;
+
+    /*!
+     * \brief Set the low watermark of the number of messages in queues.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    FlowControlConfig& low_watermark_messages(std::size_t value) noexcept;
+
+    /*!
+     * \brief Get the low watermark of the number of messages in queues.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t low_watermark_messages() const noexcept;
+
+private:
+    //! High watermark of the number of bytes in queues.
+    std::size_t high_watermark_bytes_;
+
+    //! Low watermark of the number of bytes in queues.
+    std::size_t low_watermark_bytes_;
+
+    //! High watermark of the number of messages in queues.
+    std::size_t high_watermark_messages_;
+
+    //! Low watermark of the number of messages in queues.
+    std::size_t low_watermark_messages_;
+};
+
+}  // namespace msgpack_rpc::config
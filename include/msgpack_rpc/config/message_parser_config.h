@@ -50,9 +50,32 @@ public:
      */
     [[nodiscard]] std::size_t read_buffer_size() const noexcept;
 
+    /*!
+     * \brief Set the maximum size of a message.
+     *
+     * Messages exceeding this value are rejected before they are buffered
+     * completely. Compressed messages are also rejected when their
+     * decompressed sizes exceed this value, before memory for them is
+     * allocated.
+     *
+     * \param[in] value Maximum size of a message in bytes.
+     * \return This.
+     */
+    MessageParserConfig& max_message_size(std::size_t value);
+
+    /*!
+     * \brief Get the maximum size of a message.
+     *
+     * \return Maximum size of a message in bytes.
+     */
+    [[nodiscard]] std::size_t max_message_size() const noexcept;
+
 private:
     //! Buffer size to read at once.
     std::size_t read_buffer_size_;
+
+    //! Maximum size of a message.
+    std::size_t max_message_size_;
 };
 
 }  // namespace msgpack_rpc::config
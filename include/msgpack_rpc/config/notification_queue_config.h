@@ -0,0 +1,84 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of NotificationQueueConfig class.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::config {
+
+/*!
+ * \brief Class of configurations of queues of notifications.
+ *
+ * \note When the number of notifications queued to a client exceeds the
+ * limit, the client is treated as a slow consumer. Then the oldest
+ * notification is dropped, or the connection is closed if
+ * disconnect_slow_consumers is set. Zero limits mean no limit.
+ */
+class MSGPACK_RPC_EXPORT NotificationQueueConfig {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    NotificationQueueConfig();
+
+    /*!
+     * \brief Set the maximum number of notifications queued to a client.
+     *
+     * \param[in] value Value. (Zero for no limit.)
+     * \return This.
+     */
+    NotificationQueueConfig& max_queued_notifications(
+        std::size_t value) noexcept;
+
+    /*!
+     * \brief Get the maximum number of notifications queued to a client.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t max_queued_notifications() const noexcept;
+
+    /*!
+     * \brief Set whether to close connections of slow consumers instead of
+     * dropping the oldest notifications.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    NotificationQueueConfig& disconnect_slow_consumers(bool value) noexcept;
+
+    /*!
+     * \brief Get whether to close connections of slow consumers instead of
+     * dropping the oldest notifications.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] bool disconnect_slow_consumers() const noexcept;
+
+private:
+    //! Maximum number of notifications queued to a client.
+    std::size_t max_queued_notifications_;
+
+    //! Whether to close connections of slow consumers.
+    bool disconnect_slow_consumers_;
+};
+
+}  // namespace msgpack_rpc::config
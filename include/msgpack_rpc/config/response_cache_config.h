@@ -0,0 +1,102 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of ResponseCacheConfig class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::config {
+
+/*!
+ * \brief Class of configurations of caches of responses.
+ *
+ * \note Cached responses are reused for calls with the same parameters
+ * until the time to live passes, so use caches only for idempotent
+ * methods.
+ */
+class MSGPACK_RPC_EXPORT ResponseCacheConfig {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    ResponseCacheConfig();
+
+    /*!
+     * \brief Set the time to live of cached responses.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    ResponseCacheConfig& time_to_live(std::chrono::nanoseconds value);
+
+    /*!
+     * \brief Get the time to live of cached responses.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::chrono::nanoseconds time_to_live() const noexcept;
+
+    /*!
+     * \brief Set the maximum number of cached responses.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    ResponseCacheConfig& max_entries(std::size_t value);
+
+    /*!
+     * \brief Get the maximum number of cached responses.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t max_entries() const noexcept;
+
+    /*!
+     * \brief Set the maximum number of bytes of cached responses.
+     *
+     * \param[in] value Value.
+     * \return This.
+     *
+     * \note Sizes of responses are measured as the sizes of keys and results
+     * serialized in MessagePack.
+     */
+    ResponseCacheConfig& max_bytes(std::size_t value);
+
+    /*!
+     * \brief Get the maximum number of bytes of cached responses.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t max_bytes() const noexcept;
+
+private:
+    //! Time to live of cached responses.
+    std::chrono::nanoseconds time_to_live_;
+
+    //! Maximum number of cached responses.
+    std::size_t max_entries_;
+
+    //! Maximum number of bytes of cached responses.
+    std::size_t max_bytes_;
+};
+
+}  // namespace msgpack_rpc::config
@@ -19,12 +19,19 @@
  */
 #pragma once
 
+#include <chrono>
 #include <string_view>
 #include <vector>
 
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/config/admission_control_config.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/executor_config.h"
+#include "msgpack_rpc/config/flow_control_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/notification_queue_config.h"
+#include "msgpack_rpc/config/socket_config.h"
+#include "msgpack_rpc/config/traffic_capture_config.h"
 #include "msgpack_rpc/impl/msgpack_rpc_export.h"
 
 namespace msgpack_rpc::config {
@@ -65,6 +72,58 @@ public:
      */
     [[nodiscard]] const std::vector<addresses::URI>& uris() const noexcept;
 
+    /*!
+     * \brief Set the duration of timeout of waiting for each chunk of uploads
+     * from clients.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    ServerConfig& upload_idle_timeout(std::chrono::nanoseconds value);
+
+    /*!
+     * \brief Get the duration of timeout of waiting for each chunk of uploads
+     * from clients.
+     *
+     * \return Duration.
+     */
+    [[nodiscard]] std::chrono::nanoseconds upload_idle_timeout()
+        const noexcept;
+
+    /*!
+     * \brief Set the duration of timeout of RPCs to clients.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    ServerConfig& call_timeout(std::chrono::nanoseconds value);
+
+    /*!
+     * \brief Get the duration of timeout of RPCs to clients.
+     *
+     * \return Duration.
+     */
+    [[nodiscard]] std::chrono::nanoseconds call_timeout() const noexcept;
+
+    /*!
+     * \brief Set whether to propagate deadlines of RPCs to clients.
+     *
+     * \param[in] value Value.
+     * \return This.
+     *
+     * \warning Requests with deadlines have an additional element which
+     * clients without support of deadlines reject, so enable this only when
+     * clients are implemented using this library.
+     */
+    ServerConfig& propagate_deadline(bool value) noexcept;
+
+    /*!
+     * \brief Get whether to propagate deadlines of RPCs to clients.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] bool propagate_deadline() const noexcept;
+
     /*!
      * \brief Get the configuration of parsers of messages.
      *
@@ -93,15 +152,128 @@ public:
      */
     [[nodiscard]] const ExecutorConfig& executor() const noexcept;
 
+    /*!
+     * \brief Get the configuration of socket options.
+     *
+     * \return Configuration of socket options.
+     */
+    [[nodiscard]] SocketConfig& socket() noexcept;
+
+    /*!
+     * \brief Get the configuration of socket options.
+     *
+     * \return Configuration of socket options.
+     */
+    [[nodiscard]] const SocketConfig& socket() const noexcept;
+
+    /*!
+     * \brief Get the configuration of compression of messages.
+     *
+     * \return Configuration of compression of messages.
+     */
+    [[nodiscard]] CompressionConfig& compression() noexcept;
+
+    /*!
+     * \brief Get the configuration of compression of messages.
+     *
+     * \return Configuration of compression of messages.
+     */
+    [[nodiscard]] const CompressionConfig& compression() const noexcept;
+
+    /*!
+     * \brief Get the configuration of capture of traffic.
+     *
+     * \return Configuration of capture of traffic.
+     */
+    [[nodiscard]] TrafficCaptureConfig& traffic_capture() noexcept;
+
+    /*!
+     * \brief Get the configuration of capture of traffic.
+     *
+     * \return Configuration of capture of traffic.
+     */
+    [[nodiscard]] const TrafficCaptureConfig& traffic_capture() const noexcept;
+
+    /*!
+     * \brief Get the configuration of flow control.
+     *
+     * \return Configuration of flow control.
+     */
+    [[nodiscard]] FlowControlConfig& flow_control() noexcept;
+
+    /*!
+     * \brief Get the configuration of flow control.
+     *
+     * \return Configuration of flow control.
+     */
+    [[nodiscard]] const FlowControlConfig& flow_control() const noexcept;
+
+    /*!
+     * \brief Get the configuration of admission control.
+     *
+     * \return Configuration of admission control.
+     */
+    [[nodiscard]] AdmissionControlConfig& admission_control() noexcept;
+
+    /*!
+     * \brief Get the configuration of admission control.
+     *
+     * \return Configuration of admission control.
+     */
+    [[nodiscard]] const AdmissionControlConfig& admission_control()
+        const noexcept;
+
+    /*!
+     * \brief Get the configuration of queues of notifications.
+     *
+     * \return Configuration of queues of notifications.
+     */
+    [[nodiscard]] NotificationQueueConfig& notification_queue() noexcept;
+
+    /*!
+     * \brief Get the configuration of queues of notifications.
+     *
+     * \return Configuration of queues of notifications.
+     */
+    [[nodiscard]] const NotificationQueueConfig& notification_queue()
+        const noexcept;
+
 private:
     //! URIs.
     std::vector<addresses::URI> uris_;
 
+    //! Duration of timeout of waiting for each chunk of uploads from clients.
+    std::chrono::nanoseconds upload_idle_timeout_;
+
+    //! Duration of timeout of RPCs to clients.
+    std::chrono::nanoseconds call_timeout_;
+
+    //! Whether to propagate deadlines of RPCs to clients.
+    bool propagate_deadline_;
+
     //! Configuration of parsers of messages.
     MessageParserConfig message_parser_;
 
     //! Configuration of executors.
     ExecutorConfig executor_;
+
+    //! Configuration of socket options.
+    SocketConfig socket_;
+
+    //! Configuration of compression of messages.
+    CompressionConfig compression_;
+
+    //! Configuration of capture of traffic.
+    TrafficCaptureConfig traffic_capture_;
+
+    //! Configuration of flow control.
+    FlowControlConfig flow_control_;
+
+    //! Configuration of admission control.
+    AdmissionControlConfig admission_control_;
+
+    //! Configuration of queues of notifications.
+    NotificationQueueConfig notification_queue_;
 };
 
 }  // namespace msgpack_rpc::config
@@ -0,0 +1,235 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of SocketConfig class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::config {
+
+/*!
+ * \brief Class of configurations of socket options.
+ *
+ * \note Options are applied to TCP sockets. Zero values of sizes and durations
+ * mean the default values of the operating system.
+ */
+class MSGPACK_RPC_EXPORT SocketConfig {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    SocketConfig();
+
+    /*!
+     * \brief Set whether to disable Nagle's algorithm (TCP_NODELAY).
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    SocketConfig& tcp_no_delay(bool value) noexcept;
+
+    /*!
+     * \brief Get whether to disable Nagle's algorithm (TCP_NODELAY).
+     *
+     * \return Value.
+     */
+    [[nodiscard]] bool tcp_no_delay() const noexcept;
+
+    /*!
+     * \brief Set the size of the buffer to send data (SO_SNDBUF).
+     *
+     * \param[in] value Value. (Zero for the default of the operating system.)
+     * \return This.
+     */
+    SocketConfig& send_buffer_size(std::size_t value);
+
+    /*!
+     * \brief Get the size of the buffer to send data (SO_SNDBUF).
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t send_buffer_size() const noexcept;
+
+    /*!
+     * \brief Set the size of the buffer to receive data (SO_RCVBUF).
+     *
+     * \param[in] value Value. (Zero for the default of the operating system.)
+     * \return This.
+     */
+    SocketConfig& receive_buffer_size(std::size_t value);
+
+    /*!
+     * \brief Get the size of the buffer to receive data (SO_RCVBUF).
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t receive_buffer_size() const noexcept;
+
+    /*!
+     * \brief Set whether to enable keep-alive (SO_KEEPALIVE).
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    SocketConfig& keep_alive(bool value) noexcept;
+
+    /*!
+     * \brief Get whether to enable keep-alive (SO_KEEPALIVE).
+     *
+     * \return Value.
+     */
+    [[nodiscard]] bool keep_alive() const noexcept;
+
+    /*!
+     * \brief Set the idle time before keep-alive probes (TCP_KEEPIDLE).
+     *
+     * \param[in] value Value. (Zero for the default of the operating system.)
+     * \return This.
+     */
+    SocketConfig& keep_alive_idle_time(std::chrono::nanoseconds value);
+
+    /*!
+     * \brief Get the idle time before keep-alive probes (TCP_KEEPIDLE).
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::chrono::nanoseconds keep_alive_idle_time()
+        const noexcept;
+
+    /*!
+     * \brief Set the interval of keep-alive probes (TCP_KEEPINTVL).
+     *
+     * \param[in] value Value. (Zero for the default of the operating system.)
+     * \return This.
+     */
+    SocketConfig& keep_alive_interval(std::chrono::nanoseconds value);
+
+    /*!
+     * \brief Get the interval of keep-alive probes (TCP_KEEPINTVL).
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::chrono::nanoseconds keep_alive_interval()
+        const noexcept;
+
+    /*!
+     * \brief Set the number of keep-alive probes (TCP_KEEPCNT).
+     *
+     * \param[in] value Value. (Zero for the default of the operating system.)
+     * \return This.
+     */
+    SocketConfig& keep_alive_count(std::size_t value);
+
+    /*!
+     * \brief Get the number of keep-alive probes (TCP_KEEPCNT).
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t keep_alive_count() const noexcept;
+
+    /*!
+     * \brief Set whether to send ACKs immediately (TCP_QUICKACK).
+     *
+     * \param[in] value Value.
+     * \return This.
+     *
+     * \note This option is available only in Linux.
+     * \note Linux clears TCP_QUICKACK automatically, so connections set it
+     * again after each read.
+     */
+    SocketConfig& tcp_quick_ack(bool value) noexcept;
+
+    /*!
+     * \brief Get whether to send ACKs immediately (TCP_QUICKACK).
+     *
+     * \return Value.
+     */
+    [[nodiscard]] bool tcp_quick_ack() const noexcept;
+
+    /*!
+     * \brief Set the time of busy polling on receiving data (SO_BUSY_POLL).
+     *
+     * \param[in] value Value. (Zero to disable busy polling.)
+     * \return This.
+     *
+     * \note This option is available only in Linux.
+     */
+    SocketConfig& busy_poll_time(std::chrono::nanoseconds value);
+
+    /*!
+     * \brief Get the time of busy polling on receiving data (SO_BUSY_POLL).
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::chrono::nanoseconds busy_poll_time() const noexcept;
+
+    /*!
+     * \brief Set the maximum length of the queue of pending connections in
+     * acceptors.
+     *
+     * \param[in] value Value. (Zero for the maximum value of the operating
+     * system.)
+     * \return This.
+     */
+    SocketConfig& listen_backlog(std::size_t value);
+
+    /*!
+     * \brief Get the maximum length of the queue of pending connections in
+     * acceptors.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t listen_backlog() const noexcept;
+
+private:
+    //! Whether to disable Nagle's algorithm.
+    bool tcp_no_delay_;
+
+    //! Size of the buffer to send data.
+    std::size_t send_buffer_size_;
+
+    //! Size of the buffer to receive data.
+    std::size_t receive_buffer_size_;
+
+    //! Whether to enable keep-alive.
+    bool keep_alive_;
+
+    //! Idle time before keep-alive probes.
+    std::chrono::nanoseconds keep_alive_idle_time_;
+
+    //! Interval of keep-alive probes.
+    std::chrono::nanoseconds keep_alive_interval_;
+
+    //! Number of keep-alive probes.
+    std::size_t keep_alive_count_;
+
+    //! Whether to send ACKs immediately.
+    bool tcp_quick_ack_;
+
+    //! Time of busy polling.
+    std::chrono::nanoseconds busy_poll_time_;
+
+    //! Maximum length of the queue of pending connections.
+    std::size_t listen_backlog_;
+};
+
+}  // namespace msgpack_rpc::config
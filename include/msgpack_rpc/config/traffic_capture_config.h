@@ -0,0 +1,72 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of TrafficCaptureConfig class.
+ */
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::config {
+
+/*!
+ * \brief Class of configurations of capture of traffic.
+ *
+ * When a file path is set, connections write messages sent and received to
+ * the file, so that the traffic can be replayed in benchmarks later. The file
+ * is overwritten when a client or a server is created, and clients and servers
+ * in a process must use different files.
+ */
+class MSGPACK_RPC_EXPORT TrafficCaptureConfig {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    TrafficCaptureConfig();
+
+    /*!
+     * \brief Set the path of the file to write captured messages.
+     *
+     * \param[in] value Value. Empty path disables capture.
+     * \return This.
+     */
+    TrafficCaptureConfig& file_path(std::string_view value);
+
+    /*!
+     * \brief Get the path of the file to write captured messages.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::string_view file_path() const noexcept;
+
+    /*!
+     * \brief Check whether capture is enabled.
+     *
+     * \retval true Capture is enabled.
+     * \retval false Capture is disabled.
+     */
+    [[nodiscard]] bool enabled() const noexcept;
+
+private:
+    //! Path of the file to write captured messages.
+    std::string file_path_;
+};
+
+}  // namespace msgpack_rpc::config
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of BinaryView class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <msgpack.hpp>
+
+namespace msgpack_rpc::messages {
+
+/*!
+ * \brief Class of views of binary data in messages without copying.
+ *
+ * Objects of this class can be used as parameters and results of methods.
+ *
+ * - When parsed, binaries and strings in messages are accepted, and objects
+ *   of this class refer to the data in the parsed messages. Such objects are
+ *   valid only during the processing of the message (for example, in the
+ *   call of a method).
+ * - When serialized, objects of this class are serialized as binaries.
+ *
+ * \note Use std::string_view similarly for strings.
+ */
+class BinaryView {
+public:
+    /*!
+     * \brief Constructor of an empty view.
+     */
+    BinaryView() noexcept : data_(nullptr), size_(0) {}
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] data Pointer to the data.
+     * \param[in] size Size of the data in bytes.
+     */
+    BinaryView(const char* data, std::size_t size) noexcept
+        : data_(data), size_(size) {}
+
+    /*!
+     * \brief Get the pointer to the data.
+     *
+     * \return Pointer to the data.
+     */
+    [[nodiscard]] const char* data() const noexcept { return data_; }
+
+    /*!
+     * \brief Get the size of the data.
+     *
+     * \return Size of the data in bytes.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+private:
+    //! Pointer to the data.
+    const char* data_;
+
+    //! Size of the data in bytes.
+    std::size_t size_;
+};
+
+}  // namespace msgpack_rpc::messages
+
+namespace msgpack {
+MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS) {
+    namespace adaptor {
+
+    /*!
+     * \brief Specialization of msgpack::adaptor::convert for
+     * msgpack_rpc::messages::BinaryView.
+     */
+    template <>
+    struct convert<msgpack_rpc::messages::BinaryView> {
+        /*!
+         * \brief Convert an object.
+         *
+         * \param[in] object Object in msgpack library.
+         * \param[out] value Converted value.
+         * \return Object.
+         */
+        const msgpack::object& operator()(const msgpack::object& object,
+            msgpack_rpc::messages::BinaryView& value) const {
+            switch (object.type) {
+            case msgpack::type::BIN:
+                value = msgpack_rpc::messages::BinaryView(
+                    object.via.bin.ptr, object.via.bin.size);
+                break;
+            case msgpack::type::STR:
+                value = msgpack_rpc::messages::BinaryView(
+                    object.via.str.ptr, object.via.str.size);
+                break;
+            default:
+                throw msgpack::type_error();
+            }
+            return object;
+        }
+    };
+
+    /*!
+     * \brief Specialization of msgpack::adaptor::pack for
+     * msgpack_rpc::messages::BinaryView.
+     */
+    template <>
+    struct pack<msgpack_rpc::messages::BinaryView> {
+        /*!
+         * \brief Pack a value.
+         *
+         * \tparam Stream Type of the stream.
+         * \param[in] packer Packer.
+         * \param[in] value Value.
+         * \return Packer.
+         */
+        template <typename Stream>
+        msgpack::packer<Stream>& operator()(msgpack::packer<Stream>& packer,
+            const msgpack_rpc::messages::BinaryView& value) const {
+            const std::uint32_t size =
+                checked_get_container_size(value.size());
+            packer.pack_bin(size);
+            packer.pack_bin_body(value.data(), size);
+            return packer;
+        }
+    };
+
+    /*!
+     * \brief Specialization of msgpack::adaptor::object_with_zone for
+     * msgpack_rpc::messages::BinaryView.
+     */
+    template <>
+    struct object_with_zone<msgpack_rpc::messages::BinaryView> {
+        /*!
+         * \brief Create an object copying the data to the zone.
+         *
+         * \param[out] object Object.
+         * \param[in] value Value.
+         */
+        void operator()(msgpack::object::with_zone& object,
+            const msgpack_rpc::messages::BinaryView& value) const {
+            const std::uint32_t size =
+                checked_get_container_size(value.size());
+            auto* ptr = static_cast<char*>(
+                object.zone.allocate_align(size, MSGPACK_ZONE_ALIGNOF(char)));
+            if (size > 0U) {
+                std::memcpy(ptr, value.data(), size);
+            }
+            object.type = msgpack::type::BIN;
+            object.via.bin.ptr = ptr;
+            object.via.bin.size = size;
+        }
+    };
+
+    }  // namespace adaptor
+}  // MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS)
+}  // namespace msgpack
@@ -20,12 +20,15 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 #include <utility>
 
 #include <msgpack.hpp>
 
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/impl/direct_decoder.h"
+#include "msgpack_rpc/messages/impl/encoded_object.h"
 
 namespace msgpack_rpc::messages {
 
@@ -60,6 +63,30 @@ public:
         return CallResult(is_error, object, std::move(zone));
     }
 
+    /*!
+     * \brief Create an successful result kept in bytes.
+     *
+     * \param[in] encoded Encoded object of the result.
+     * \return Result.
+     */
+    [[nodiscard]] static CallResult create_result(
+        std::shared_ptr<const impl::EncodedObject> encoded) noexcept {
+        constexpr bool is_error = false;
+        return CallResult(is_error, std::move(encoded));
+    }
+
+    /*!
+     * \brief Create an error result kept in bytes.
+     *
+     * \param[in] encoded Encoded object of the error.
+     * \return Result.
+     */
+    [[nodiscard]] static CallResult create_error(
+        std::shared_ptr<const impl::EncodedObject> encoded) noexcept {
+        constexpr bool is_error = true;
+        return CallResult(is_error, std::move(encoded));
+    }
+
     /*!
      * \brief Check whether this object has an error.
      *
@@ -86,17 +113,16 @@ public:
             throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
                 "This result is not an error.");
         }
-        try {
-            return object_.as<T>();
-        } catch (const msgpack::type_error&) {
-            throw MsgpackRPCException(
-                StatusCode::TYPE_ERROR, "Invalid type of the error.");
-        }
+        return as<T>("Invalid type of the error.");
     }
 
     /*!
      * \brief Get the result.
      *
+     * Results received as bytes are decoded directly from the bytes if the
+     * type has a decoder in impl::DirectDecoder class, otherwise via the object
+     * in msgpack library.
+     *
      * \tparam T Type.
      * \return Result.
      */
@@ -106,27 +132,33 @@ public:
             throw MsgpackRPCException(
                 StatusCode::PRECONDITION_NOT_MET, "This result is an error.");
         }
-        try {
-            return object_.as<T>();
-        } catch (const msgpack::type_error&) {
-            throw MsgpackRPCException(
-                StatusCode::TYPE_ERROR, "Invalid type of the result.");
-        }
+        return as<T>("Invalid type of the result.");
     }
 
     /*!
      * \brief Get the internal object in msgpack library.
      *
      * \return Object.
+     *
+     * \note Results received as bytes are decoded at the first call of this
+     * function or zone function.
      */
-    [[nodiscard]] msgpack::object object() const noexcept { return object_; }
+    [[nodiscard]] msgpack::object object() const {
+        if (encoded_) {
+            return encoded_->object();
+        }
+        return object_;
+    }
 
     /*!
      * \brief Get the internal zone in msgpack library.
      *
      * \return Zone.
      */
-    [[nodiscard]] std::shared_ptr<msgpack::zone> zone() const noexcept {
+    [[nodiscard]] std::shared_ptr<msgpack::zone> zone() const {
+        if (encoded_) {
+            return encoded_->zone();
+        }
         return zone_;
     }
 
@@ -171,14 +203,57 @@ private:
         std::shared_ptr<msgpack::zone> zone)
         : is_error_(is_error), object_(object), zone_(std::move(zone)) {}
 
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] is_error Whether this is an error.
+     * \param[in] encoded Encoded object.
+     */
+    CallResult(bool is_error,
+        std::shared_ptr<const impl::EncodedObject> encoded) noexcept
+        : is_error_(is_error), encoded_(std::move(encoded)) {}
+
+    /*!
+     * \brief Get the object as a type.
+     *
+     * \tparam T Type.
+     * \param[in] type_error_message Error message for invalid types.
+     * \return Value.
+     */
+    template <typename T>
+    [[nodiscard]] T as(std::string_view type_error_message) const {
+        if constexpr (impl::is_directly_decodable_v<T>) {
+            if (encoded_) {
+                T value{};
+                impl::DirectDecoder<T> decoder;
+                decoder.set_target(value);
+                if (!impl::decode_directly(
+                        encoded_->data(), encoded_->size(), decoder)) {
+                    throw MsgpackRPCException(
+                        StatusCode::TYPE_ERROR, type_error_message);
+                }
+                return value;
+            }
+        }
+        try {
+            return object().as<T>();
+        } catch (const msgpack::type_error&) {
+            throw MsgpackRPCException(
+                StatusCode::TYPE_ERROR, type_error_message);
+        }
+    }
+
     //! Whether this is an error.
     bool is_error_;
 
     //! Object in msgpack library.
-    msgpack::object object_;
+    msgpack::object object_{};
 
     //! Zone in msgpack library.
-    std::shared_ptr<msgpack::zone> zone_;
+    std::shared_ptr<msgpack::zone> zone_{};
+
+    //! Encoded object. (Null if created from an object.)
+    std::shared_ptr<const impl::EncodedObject> encoded_{};
 };
 
 }  // namespace msgpack_rpc::messages
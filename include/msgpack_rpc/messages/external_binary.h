@@ -0,0 +1,149 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of ExternalBinary class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/messages/binary_view.h"
+
+namespace msgpack_rpc::messages {
+
+/*!
+ * \brief Class of binary data in buffers owned by callers, sent without
+ * copying.
+ *
+ * Objects of this class can be used as parameters of requests and
+ * notifications, and as results of methods. In such cases, only the header of
+ * the binary is serialized, and the data is written to sockets directly from
+ * the buffer. When objects of this class are nested in other objects, the data
+ * is copied as msgpack_rpc::messages::BinaryView.
+ *
+ * \note Objects of this class share the buffer. The function to release the
+ * buffer is called when all the objects referring to the buffer, including
+ * ones in messages being sent, are destroyed.
+ */
+class ExternalBinary {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] data Pointer to the data.
+     * \param[in] size Size of the data in bytes.
+     * \param[in] release Function called to release the buffer.
+     */
+    ExternalBinary(
+        const char* data, std::size_t size, std::function<void()> release)
+        : data_(data,
+              [release = std::move(release)](const char* /*data*/) {
+                  if (release) {
+                      release();
+                  }
+              }),
+          size_(size) {}
+
+    /*!
+     * \brief Get the pointer to the data.
+     *
+     * \return Pointer to the data.
+     */
+    [[nodiscard]] const char* data() const noexcept { return data_.get(); }
+
+    /*!
+     * \brief Get the size of the data.
+     *
+     * \return Size of the data in bytes.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /*!
+     * \brief Get the view of the data.
+     *
+     * \return View.
+     */
+    [[nodiscard]] BinaryView view() const noexcept {
+        return BinaryView(data(), size());
+    }
+
+private:
+    //! Pointer to the data with the function to release it.
+    std::shared_ptr<const char> data_;
+
+    //! Size of the data in bytes.
+    std::size_t size_;
+};
+
+}  // namespace msgpack_rpc::messages
+
+namespace msgpack {
+MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS) {
+    namespace adaptor {
+
+    /*!
+     * \brief Specialization of msgpack::adaptor::pack for
+     * msgpack_rpc::messages::ExternalBinary.
+     *
+     * \note This copies the data. Serialization of messages avoids this
+     * function for parameters and results.
+     */
+    template <>
+    struct pack<msgpack_rpc::messages::ExternalBinary> {
+        /*!
+         * \brief Pack a value.
+         *
+         * \tparam Stream Type of the stream.
+         * \param[in] packer Packer.
+         * \param[in] value Value.
+         * \return Packer.
+         */
+        template <typename Stream>
+        msgpack::packer<Stream>& operator()(msgpack::packer<Stream>& packer,
+            const msgpack_rpc::messages::ExternalBinary& value) const {
+            return pack<msgpack_rpc::messages::BinaryView>()(
+                packer, value.view());
+        }
+    };
+
+    /*!
+     * \brief Specialization of msgpack::adaptor::object_with_zone for
+     * msgpack_rpc::messages::ExternalBinary.
+     */
+    template <>
+    struct object_with_zone<msgpack_rpc::messages::ExternalBinary> {
+        /*!
+         * \brief Create an object copying the data to the zone.
+         *
+         * \param[out] object Object.
+         * \param[in] value Value.
+         */
+        void operator()(msgpack::object::with_zone& object,
+            const msgpack_rpc::messages::ExternalBinary& value) const {
+            object_with_zone<msgpack_rpc::messages::BinaryView>()(
+                object, value.view());
+        }
+    };
+
+    }  // namespace adaptor
+}  // MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS)
+}  // namespace msgpack
@@ -0,0 +1,872 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of classes to decode objects in msgpack directly into
+ * values.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <msgpack.hpp>
+
+namespace msgpack_rpc::messages::impl {
+
+/*!
+ * \brief Class to check whether a type can be decoded directly from bytes
+ * using DirectDecoder class.
+ *
+ * Other types are decoded via objects in msgpack library using adaptors in
+ * msgpack library.
+ *
+ * \tparam T Type.
+ */
+template <typename T, typename = void>
+struct is_directly_decodable : std::false_type {};
+
+//! Whether a type can be decoded directly from bytes.
+template <typename T>
+constexpr bool is_directly_decodable_v = is_directly_decodable<T>::value;
+
+//! \cond
+
+template <>
+struct is_directly_decodable<bool> : std::true_type {};
+
+template <typename T>
+struct is_directly_decodable<T,
+    std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+        !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> &&
+        !std::is_same_v<T, char32_t>>> : std::true_type {};
+
+template <typename T>
+struct is_directly_decodable<T, std::enable_if_t<std::is_floating_point_v<T>>>
+    : std::true_type {};
+
+template <>
+struct is_directly_decodable<std::string> : std::true_type {};
+
+// Vectors of bytes and booleans have special adaptors in msgpack library.
+template <typename T, typename Allocator>
+struct is_directly_decodable<std::vector<T, Allocator>>
+    : std::bool_constant<is_directly_decodable_v<T> &&
+          !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+          !std::is_same_v<T, signed char> &&
+          !std::is_same_v<T, unsigned char>> {};
+
+template <typename Key, typename Mapped, typename Compare, typename Allocator>
+struct is_directly_decodable<std::map<Key, Mapped, Compare, Allocator>>
+    : std::bool_constant<is_directly_decodable_v<Key> &&
+          is_directly_decodable_v<Mapped>> {};
+
+template <typename Key, typename Mapped, typename Hash, typename KeyEqual,
+    typename Allocator>
+struct is_directly_decodable<
+    std::unordered_map<Key, Mapped, Hash, KeyEqual, Allocator>>
+    : std::bool_constant<is_directly_decodable_v<Key> &&
+          is_directly_decodable_v<Mapped>> {};
+
+//! \endcond
+
+/*!
+ * \brief Class of visitors in msgpack library to decode objects directly into
+ * values.
+ *
+ * Visitor functions return false for types not matching the value, which stops
+ * parsing.
+ *
+ * \tparam T Type of values.
+ */
+template <typename T, typename = void>
+class DirectDecoder;
+
+/*!
+ * \brief Base class of DirectDecoder classes.
+ *
+ * This class rejects all objects. Derived classes hide functions for objects
+ * they accept.
+ */
+class DirectDecoderBase {
+public:
+    //! Visit nil.
+    bool visit_nil() noexcept { return false; }
+
+    //! Visit a boolean.
+    bool visit_boolean(bool /*value*/) noexcept { return false; }
+
+    //! Visit a non-negative integer.
+    bool visit_positive_integer(std::uint64_t /*value*/) noexcept {
+        return false;
+    }
+
+    //! Visit a negative integer.
+    bool visit_negative_integer(std::int64_t /*value*/) noexcept {
+        return false;
+    }
+
+    //! Visit a 32-bit floating-point number.
+    bool visit_float32(float /*value*/) noexcept { return false; }
+
+    //! Visit a 64-bit floating-point number.
+    bool visit_float64(double /*value*/) noexcept { return false; }
+
+    //! Visit a string.
+    bool visit_str(const char* /*data*/, std::uint32_t /*size*/) noexcept {
+        return false;
+    }
+
+    //! Visit a binary.
+    bool visit_bin(const char* /*data*/, std::uint32_t /*size*/) noexcept {
+        return false;
+    }
+
+    //! Visit an extension.
+    bool visit_ext(const char* /*data*/, std::uint32_t /*size*/) noexcept {
+        return false;
+    }
+
+    //! Start an array.
+    bool start_array(std::uint32_t /*num_elements*/) noexcept { return false; }
+
+    //! Start an element of an array.
+    bool start_array_item() noexcept { return false; }
+
+    //! End an element of an array.
+    bool end_array_item() noexcept { return false; }
+
+    //! End an array.
+    bool end_array() noexcept { return false; }
+
+    //! Start a map.
+    bool start_map(std::uint32_t /*num_pairs*/) noexcept { return false; }
+
+    //! Start a key of a map.
+    bool start_map_key() noexcept { return false; }
+
+    //! End a key of a map.
+    bool end_map_key() noexcept { return false; }
+
+    //! Start a value of a map.
+    bool start_map_value() noexcept { return false; }
+
+    //! End a value of a map.
+    bool end_map_value() noexcept { return false; }
+
+    //! End a map.
+    bool end_map() noexcept { return false; }
+
+    //! Handle an error of parsing.
+    void parse_error(
+        std::size_t /*parsed_offset*/, std::size_t /*error_offset*/) noexcept {}
+
+    //! Handle insufficient bytes.
+    void insufficient_bytes(
+        std::size_t /*parsed_offset*/, std::size_t /*error_offset*/) noexcept {}
+};
+
+/*!
+ * \brief Base class of DirectDecoder classes of containers.
+ *
+ * This class forwards objects in elements to decoders of the elements. Derived
+ * classes implement `forward` function to select the decoder of the current
+ * element, and functions with prefix `own_` for the container itself.
+ *
+ * \tparam Derived Type of the derived class.
+ */
+template <typename Derived>
+class ContainerDecoderBase : public DirectDecoderBase {
+public:
+    //! Visit nil.
+    bool visit_nil() {
+        return forward_element([](auto& decoder) {
+            return decoder.visit_nil();
+        });
+    }
+
+    //! Visit a boolean.
+    bool visit_boolean(bool value) {
+        return forward_element([value](auto& decoder) {
+            return decoder.visit_boolean(value);
+        });
+    }
+
+    //! Visit a non-negative integer.
+    bool visit_positive_integer(std::uint64_t value) {
+        return forward_element([value](auto& decoder) {
+            return decoder.visit_positive_integer(value);
+        });
+    }
+
+    //! Visit a negative integer.
+    bool visit_negative_integer(std::int64_t value) {
+        return forward_element([value](auto& decoder) {
+            return decoder.visit_negative_integer(value);
+        });
+    }
+
+    //! Visit a 32-bit floating-point number.
+    bool visit_float32(float value) {
+        return forward_element([value](auto& decoder) {
+            return decoder.visit_float32(value);
+        });
+    }
+
+    //! Visit a 64-bit floating-point number.
+    bool visit_float64(double value) {
+        return forward_element([value](auto& decoder) {
+            return decoder.visit_float64(value);
+        });
+    }
+
+    //! Visit a string.
+    bool visit_str(const char* data, std::uint32_t size) {
+        return forward_element([data, size](auto& decoder) {
+            return decoder.visit_str(data, size);
+        });
+    }
+
+    //! Visit a binary.
+    bool visit_bin(const char* data, std::uint32_t size) {
+        return forward_element([data, size](auto& decoder) {
+            return decoder.visit_bin(data, size);
+        });
+    }
+
+    //! Visit an extension.
+    bool visit_ext(const char* data, std::uint32_t size) {
+        return forward_element([data, size](auto& decoder) {
+            return decoder.visit_ext(data, size);
+        });
+    }
+
+    //! Start an array.
+    bool start_array(std::uint32_t num_elements) {
+        if (depth_ == 0U) {
+            depth_ = 1U;
+            return derived().own_start_array(num_elements);
+        }
+        ++depth_;
+        return derived().forward([num_elements](auto& decoder) {
+            return decoder.start_array(num_elements);
+        });
+    }
+
+    //! Start an element of an array.
+    bool start_array_item() {
+        if (depth_ == 1U) {
+            return derived().own_start_array_item();
+        }
+        return forward_element(
+            [](auto& decoder) { return decoder.start_array_item(); });
+    }
+
+    //! End an element of an array.
+    bool end_array_item() {
+        if (depth_ == 1U) {
+            return derived().own_end_array_item();
+        }
+        return forward_element(
+            [](auto& decoder) { return decoder.end_array_item(); });
+    }
+
+    //! End an array.
+    bool end_array() {
+        if (depth_ == 1U) {
+            depth_ = 0U;
+            return derived().own_end_array();
+        }
+        --depth_;
+        return derived().forward(
+            [](auto& decoder) { return decoder.end_array(); });
+    }
+
+    //! Start a map.
+    bool start_map(std::uint32_t num_pairs) {
+        if (depth_ == 0U) {
+            depth_ = 1U;
+            return derived().own_start_map(num_pairs);
+        }
+        ++depth_;
+        return derived().forward([num_pairs](auto& decoder) {
+            return decoder.start_map(num_pairs);
+        });
+    }
+
+    //! Start a key of a map.
+    bool start_map_key() {
+        if (depth_ == 1U) {
+            return derived().own_start_map_key();
+        }
+        return forward_element(
+            [](auto& decoder) { return decoder.start_map_key(); });
+    }
+
+    //! End a key of a map.
+    bool end_map_key() {
+        if (depth_ == 1U) {
+            return derived().own_end_map_key();
+        }
+        return forward_element(
+            [](auto& decoder) { return decoder.end_map_key(); });
+    }
+
+    //! Start a value of a map.
+    bool start_map_value() {
+        if (depth_ == 1U) {
+            return derived().own_start_map_value();
+        }
+        return forward_element(
+            [](auto& decoder) { return decoder.start_map_value(); });
+    }
+
+    //! End a value of a map.
+    bool end_map_value() {
+        if (depth_ == 1U) {
+            return derived().own_end_map_value();
+        }
+        return forward_element(
+            [](auto& decoder) { return decoder.end_map_value(); });
+    }
+
+    //! End a map.
+    bool end_map() {
+        if (depth_ == 1U) {
+            depth_ = 0U;
+            return derived().own_end_map();
+        }
+        --depth_;
+        return derived().forward(
+            [](auto& decoder) { return decoder.end_map(); });
+    }
+
+protected:
+    //! Start the array of this container.
+    bool own_start_array(std::uint32_t /*num_elements*/) noexcept {
+        return false;
+    }
+
+    //! Start an element of the array of this container.
+    bool own_start_array_item() noexcept { return false; }
+
+    //! End an element of the array of this container.
+    bool own_end_array_item() noexcept { return false; }
+
+    //! End the array of this container.
+    bool own_end_array() noexcept { return false; }
+
+    //! Start the map of this container.
+    bool own_start_map(std::uint32_t /*num_pairs*/) noexcept { return false; }
+
+    //! Start a key of the map of this container.
+    bool own_start_map_key() noexcept { return false; }
+
+    //! End a key of the map of this container.
+    bool own_end_map_key() noexcept { return false; }
+
+    //! Start a value of the map of this container.
+    bool own_start_map_value() noexcept { return false; }
+
+    //! End a value of the map of this container.
+    bool own_end_map_value() noexcept { return false; }
+
+    //! End the map of this container.
+    bool own_end_map() noexcept { return false; }
+
+private:
+    /*!
+     * \brief Forward an object to the decoder of the current element.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function called with the decoder.
+     * \return Result of the function. False for objects out of elements.
+     */
+    template <typename Function>
+    bool forward_element(Function&& function) {
+        if (depth_ == 0U) {
+            return false;
+        }
+        return derived().forward(std::forward<Function>(function));
+    }
+
+    /*!
+     * \brief Get the derived object.
+     *
+     * \return Derived object.
+     */
+    Derived& derived() noexcept { return *static_cast<Derived*>(this); }
+
+    //! Depth of nested containers including this container.
+    std::size_t depth_{0};
+};
+
+/*!
+ * \brief Class of decoders of booleans.
+ */
+template <>
+class DirectDecoder<bool> : public DirectDecoderBase {
+public:
+    /*!
+     * \brief Set the value to write to.
+     *
+     * \param[in] value Value.
+     */
+    void set_target(bool& value) noexcept { value_ = &value; }
+
+    //! Visit a boolean.
+    bool visit_boolean(bool value) noexcept {
+        *value_ = value;
+        return true;
+    }
+
+private:
+    //! Value.
+    bool* value_{nullptr};
+};
+
+/*!
+ * \brief Class of decoders of integers.
+ *
+ * \tparam T Type of integers.
+ */
+template <typename T>
+class DirectDecoder<T,
+    std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    : public DirectDecoderBase {
+public:
+    /*!
+     * \brief Set the value to write to.
+     *
+     * \param[in] value Value.
+     */
+    void set_target(T& value) noexcept { value_ = &value; }
+
+    //! Visit a non-negative integer.
+    bool visit_positive_integer(std::uint64_t value) noexcept {
+        if (value >
+            static_cast<std::uint64_t>(std::numeric_limits<T>::max())) {
+            return false;
+        }
+        *value_ = static_cast<T>(value);
+        return true;
+    }
+
+    //! Visit a negative integer.
+    bool visit_negative_integer(std::int64_t value) noexcept {
+        if (value >= 0) {
+            return visit_positive_integer(static_cast<std::uint64_t>(value));
+        }
+        if constexpr (std::is_unsigned_v<T>) {
+            return false;
+        } else {
+            if (value <
+                static_cast<std::int64_t>(std::numeric_limits<T>::min())) {
+                return false;
+            }
+            *value_ = static_cast<T>(value);
+            return true;
+        }
+    }
+
+private:
+    //! Value.
+    T* value_{nullptr};
+};
+
+/*!
+ * \brief Class of decoders of floating-point numbers.
+ *
+ * \tparam T Type of floating-point numbers.
+ */
+template <typename T>
+class DirectDecoder<T, std::enable_if_t<std::is_floating_point_v<T>>>
+    : public DirectDecoderBase {
+public:
+    /*!
+     * \brief Set the value to write to.
+     *
+     * \param[in] value Value.
+     */
+    void set_target(T& value) noexcept { value_ = &value; }
+
+    //! Visit a non-negative integer.
+    bool visit_positive_integer(std::uint64_t value) noexcept {
+        *value_ = static_cast<T>(value);
+        return true;
+    }
+
+    //! Visit a negative integer.
+    bool visit_negative_integer(std::int64_t value) noexcept {
+        *value_ = static_cast<T>(value);
+        return true;
+    }
+
+    //! Visit a 32-bit floating-point number.
+    bool visit_float32(float value) noexcept {
+        *value_ = static_cast<T>(value);
+        return true;
+    }
+
+    //! Visit a 64-bit floating-point number.
+    bool visit_float64(double value) noexcept {
+        *value_ = static_cast<T>(value);
+        return true;
+    }
+
+private:
+    //! Value.
+    T* value_{nullptr};
+};
+
+/*!
+ * \brief Class of decoders of strings.
+ */
+template <>
+class DirectDecoder<std::string> : public DirectDecoderBase {
+public:
+    /*!
+     * \brief Set the value to write to.
+     *
+     * \param[in] value Value.
+     */
+    void set_target(std::string& value) noexcept { value_ = &value; }
+
+    //! Visit a string.
+    bool visit_str(const char* data, std::uint32_t size) {
+        value_->assign(data, size);
+        return true;
+    }
+
+    //! Visit a binary.
+    bool visit_bin(const char* data, std::uint32_t size) {
+        value_->assign(data, size);
+        return true;
+    }
+
+private:
+    //! Value.
+    std::string* value_{nullptr};
+};
+
+/*!
+ * \brief Class of decoders of vectors.
+ *
+ * \tparam T Type of elements.
+ * \tparam Allocator Type of the allocator.
+ */
+template <typename T, typename Allocator>
+class DirectDecoder<std::vector<T, Allocator>>
+    : public ContainerDecoderBase<DirectDecoder<std::vector<T, Allocator>>> {
+public:
+    /*!
+     * \brief Set the value to write to.
+     *
+     * \param[in] value Value.
+     */
+    void set_target(std::vector<T, Allocator>& value) noexcept {
+        value_ = &value;
+    }
+
+    //! Start the array of this container.
+    bool own_start_array(std::uint32_t num_elements) {
+        value_->clear();
+        value_->reserve(num_elements);
+        return true;
+    }
+
+    //! Start an element of the array of this container.
+    bool own_start_array_item() {
+        element_decoder_.set_target(value_->emplace_back());
+        return true;
+    }
+
+    //! End an element of the array of this container.
+    bool own_end_array_item() noexcept { return true; }
+
+    //! End the array of this container.
+    bool own_end_array() noexcept { return true; }
+
+    /*!
+     * \brief Forward an object to the decoder of the current element.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function called with the decoder.
+     * \return Result of the function.
+     */
+    template <typename Function>
+    bool forward(Function&& function) {
+        return std::forward<Function>(function)(element_decoder_);
+    }
+
+private:
+    //! Value.
+    std::vector<T, Allocator>* value_{nullptr};
+
+    //! Decoder of elements.
+    DirectDecoder<T> element_decoder_{};
+};
+
+/*!
+ * \brief Class of decoders of maps.
+ *
+ * \tparam Map Type of maps.
+ */
+template <typename Map>
+class MapDecoder : public ContainerDecoderBase<MapDecoder<Map>> {
+public:
+    //! Type of keys.
+    using Key = typename Map::key_type;
+
+    //! Type of mapped values.
+    using Mapped = typename Map::mapped_type;
+
+    /*!
+     * \brief Set the value to write to.
+     *
+     * \param[in] value Value.
+     */
+    void set_target(Map& value) noexcept { value_ = &value; }
+
+    //! Start the map of this container.
+    bool own_start_map(std::uint32_t /*num_pairs*/) {
+        value_->clear();
+        return true;
+    }
+
+    //! Start a key of the map of this container.
+    bool own_start_map_key() {
+        key_ = Key();
+        key_decoder_.set_target(key_);
+        is_in_key_ = true;
+        return true;
+    }
+
+    //! End a key of the map of this container.
+    bool own_end_map_key() noexcept { return true; }
+
+    //! Start a value of the map of this container.
+    bool own_start_map_value() {
+        mapped_ = Mapped();
+        mapped_decoder_.set_target(mapped_);
+        is_in_key_ = false;
+        return true;
+    }
+
+    //! End a value of the map of this container.
+    bool own_end_map_value() {
+        value_->emplace(std::move(key_), std::move(mapped_));
+        return true;
+    }
+
+    //! End the map of this container.
+    bool own_end_map() noexcept { return true; }
+
+    /*!
+     * \brief Forward an object to the decoder of the current key or value.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function called with the decoder.
+     * \return Result of the function.
+     */
+    template <typename Function>
+    bool forward(Function&& function) {
+        if (is_in_key_) {
+            return std::forward<Function>(function)(key_decoder_);
+        }
+        return std::forward<Function>(function)(mapped_decoder_);
+    }
+
+private:
+    //! Value.
+    Map* value_{nullptr};
+
+    //! Key being decoded.
+    Key key_{};
+
+    //! Mapped value being decoded.
+    Mapped mapped_{};
+
+    //! Decoder of keys.
+    DirectDecoder<Key> key_decoder_{};
+
+    //! Decoder of mapped values.
+    DirectDecoder<Mapped> mapped_decoder_{};
+
+    //! Whether a key is being decoded.
+    bool is_in_key_{false};
+};
+
+/*!
+ * \brief Class of decoders of maps.
+ *
+ * \tparam Key Type of keys.
+ * \tparam Mapped Type of mapped values.
+ * \tparam Compare Type of the comparator.
+ * \tparam Allocator Type of the allocator.
+ */
+template <typename Key, typename Mapped, typename Compare, typename Allocator>
+class DirectDecoder<std::map<Key, Mapped, Compare, Allocator>>
+    : public MapDecoder<std::map<Key, Mapped, Compare, Allocator>> {};
+
+/*!
+ * \brief Class of decoders of unordered maps.
+ *
+ * \tparam Key Type of keys.
+ * \tparam Mapped Type of mapped values.
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to compare keys.
+ * \tparam Allocator Type of the allocator.
+ */
+template <typename Key, typename Mapped, typename Hash, typename KeyEqual,
+    typename Allocator>
+class DirectDecoder<
+    std::unordered_map<Key, Mapped, Hash, KeyEqual, Allocator>>
+    : public MapDecoder<
+          std::unordered_map<Key, Mapped, Hash, KeyEqual, Allocator>> {};
+
+/*!
+ * \brief Class of decoders of parameters of methods.
+ *
+ * Parameters are arrays with exactly the same number of elements as the
+ * parameters.
+ *
+ * \tparam Parameters Types of parameters.
+ */
+template <typename... Parameters>
+class ParametersDecoder
+    : public ContainerDecoderBase<ParametersDecoder<Parameters...>> {
+public:
+    /*!
+     * \brief Set the value to write to.
+     *
+     * \param[in] value Value.
+     */
+    void set_target(std::tuple<Parameters...>& value) noexcept {
+        set_target_impl(value, std::index_sequence_for<Parameters...>());
+    }
+
+    /*!
+     * \brief Check whether the number of parameters was invalid.
+     *
+     * \return Whether the number of parameters was invalid.
+     */
+    [[nodiscard]] bool has_invalid_size() const noexcept {
+        return has_invalid_size_;
+    }
+
+    //! Start the array of this container.
+    bool own_start_array(std::uint32_t num_elements) noexcept {
+        if (num_elements != sizeof...(Parameters)) {
+            has_invalid_size_ = true;
+            return false;
+        }
+        index_ = 0;
+        return true;
+    }
+
+    //! Start an element of the array of this container.
+    bool own_start_array_item() noexcept { return true; }
+
+    //! End an element of the array of this container.
+    bool own_end_array_item() noexcept {
+        ++index_;
+        return true;
+    }
+
+    //! End the array of this container.
+    bool own_end_array() noexcept { return true; }
+
+    /*!
+     * \brief Forward an object to the decoder of the current parameter.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function called with the decoder.
+     * \return Result of the function.
+     */
+    template <typename Function>
+    bool forward(Function&& function) {
+        return forward_impl(std::forward<Function>(function),
+            std::index_sequence_for<Parameters...>());
+    }
+
+private:
+    /*!
+     * \brief Set the value to write to.
+     *
+     * \tparam Indices Indices of parameters.
+     * \param[in] value Value.
+     */
+    template <std::size_t... Indices>
+    void set_target_impl([[maybe_unused]] std::tuple<Parameters...>& value,
+        std::index_sequence<Indices... /*indices*/>) noexcept {
+        (std::get<Indices>(decoders_).set_target(std::get<Indices>(value)),
+            ...);
+    }
+
+    /*!
+     * \brief Forward an object to the decoder of the current parameter.
+     *
+     * \tparam Function Type of the function.
+     * \tparam Indices Indices of parameters.
+     * \param[in] function Function called with the decoder.
+     * \return Result of the function.
+     */
+    template <typename Function, std::size_t... Indices>
+    bool forward_impl([[maybe_unused]] Function&& function,
+        std::index_sequence<Indices... /*indices*/>) {
+        bool result = false;
+        (void)((index_ == Indices &&
+                   (result = function(std::get<Indices>(decoders_)), true)) ||
+            ...);
+        return result;
+    }
+
+    //! Decoders of parameters.
+    std::tuple<DirectDecoder<Parameters>...> decoders_{};
+
+    //! Index of the current parameter.
+    std::size_t index_{0};
+
+    //! Whether the number of parameters was invalid.
+    bool has_invalid_size_{false};
+};
+
+/*!
+ * \brief Decode an object in msgpack using a decoder.
+ *
+ * \tparam Decoder Type of the decoder.
+ * \param[in] data Pointer to the data of the object.
+ * \param[in] size Size of the data.
+ * \param[in] decoder Decoder.
+ * \return Whether the object was decoded successfully.
+ */
+template <typename Decoder>
+[[nodiscard]] bool decode_directly(
+    const char* data, std::size_t size, Decoder& decoder) {
+    std::size_t offset = 0;
+    return msgpack::v2::parse(data, size, offset, decoder) && offset == size;
+}
+
+}  // namespace msgpack_rpc::messages::impl
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of EncodedObject class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+
+namespace msgpack_rpc::messages::impl {
+
+/*!
+ * \brief Class of objects in msgpack kept in received bytes.
+ *
+ * Objects are decoded into objects in msgpack library only when requested,
+ * so that types with decoders in direct_decoder.h are decoded directly from
+ * the bytes.
+ *
+ * \note Objects of this class can be used from multiple threads.
+ */
+class EncodedObject {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] buffer Buffer of the data.
+     * \param[in] offset Offset of the object in the buffer.
+     * \param[in] size Size of the object.
+     */
+    EncodedObject(std::shared_ptr<const std::vector<char>> buffer,
+        std::size_t offset, std::size_t size) noexcept
+        : buffer_(std::move(buffer)), offset_(offset), size_(size) {}
+
+    /*!
+     * \brief Get the pointer to the data.
+     *
+     * \return Pointer to the data.
+     */
+    [[nodiscard]] const char* data() const noexcept {
+        return buffer_->data() + offset_;
+    }
+
+    /*!
+     * \brief Get the size of the data.
+     *
+     * \return Size of the data.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /*!
+     * \brief Get the object in msgpack library.
+     *
+     * \return Object.
+     *
+     * \note The object is decoded at the first call of this function or
+     * zone function.
+     */
+    [[nodiscard]] const msgpack::object& object() const {
+        decode();
+        return object_;
+    }
+
+    /*!
+     * \brief Get the zone of the object in msgpack library.
+     *
+     * \return Zone.
+     */
+    [[nodiscard]] const std::shared_ptr<msgpack::zone>& zone() const {
+        decode();
+        return zone_;
+    }
+
+private:
+    /*!
+     * \brief Decode the object if not decoded yet.
+     */
+    void decode() const {
+        std::call_once(decode_once_, [this] {
+            try {
+                msgpack::object_handle handle = msgpack::unpack(data(), size_);
+                object_ = handle.get();
+                zone_ =
+                    std::shared_ptr<msgpack::zone>(std::move(handle.zone()));
+            } catch (const msgpack::unpack_error&) {
+                throw MsgpackRPCException(
+                    StatusCode::INVALID_MESSAGE, "Failed to parse a message.");
+            }
+        });
+    }
+
+    //! Buffer of the data.
+    std::shared_ptr<const std::vector<char>> buffer_;
+
+    //! Offset of the object in the buffer.
+    std::size_t offset_;
+
+    //! Size of the object.
+    std::size_t size_;
+
+    //! Flag to decode the object once.
+    mutable std::once_flag decode_once_{};
+
+    //! Object in msgpack library.
+    mutable msgpack::object object_{};
+
+    //! Zone in msgpack library.
+    mutable std::shared_ptr<msgpack::zone> zone_{};
+};
+
+}  // namespace msgpack_rpc::messages::impl
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of MessageFramer class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/buffer_view.h"
+
+namespace msgpack_rpc::messages::impl {
+
+/*!
+ * \brief Type of functions called with the data of each message found by
+ * parsers, e.g., to record received messages.
+ */
+using FramedMessageHandler =
+    std::function<void(const char* data, std::size_t size)>;
+
+/*!
+ * \brief Struct of bytes of messages found by MessageFramer.
+ */
+struct FramedMessage {
+    //! Buffer of the data.
+    std::shared_ptr<const std::vector<char>> buffer;
+
+    //! Offset of the message in the buffer.
+    std::size_t offset;
+
+    //! Size of the message.
+    std::size_t size;
+};
+
+/*!
+ * \brief Class to find boundaries of messages in received bytes.
+ *
+ * Bytes of partially received messages are scanned only once, and found
+ * messages refer to the received bytes.
+ *
+ * Messages larger than the maximum size are rejected before the whole
+ * messages are buffered.
+ */
+class MSGPACK_RPC_EXPORT MessageFramer {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] read_buffer_size Buffer size to read at once.
+     * \param[in] max_message_size Maximum size of a message.
+     */
+    MessageFramer(std::size_t read_buffer_size, std::size_t max_message_size);
+
+    MessageFramer(const MessageFramer&) = delete;
+    MessageFramer(MessageFramer&&) = delete;
+    MessageFramer& operator=(const MessageFramer&) = delete;
+    MessageFramer& operator=(MessageFramer&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~MessageFramer();
+
+    /*!
+     * \brief Prepare a buffer.
+     *
+     * \return Buffer.
+     */
+    BufferView prepare_buffer();
+
+    /*!
+     * \brief Set some bytes to be consumed.
+     *
+     * \param[in] num_bytes Number of consumed bytes.
+     */
+    void consumed(std::size_t num_bytes);
+
+    /*!
+     * \brief Try to find the next message.
+     *
+     * \return Message if found. Null if more data is required.
+     *
+     * \note This function throws an exception with
+     * StatusCode::INVALID_MESSAGE for invalid data and messages larger than
+     * the maximum size.
+     */
+    [[nodiscard]] std::optional<FramedMessage> try_frame();
+
+private:
+    //! Buffer. (Shared with found messages.)
+    std::shared_ptr<std::vector<char>> buffer_{};
+
+    //! Position of the first byte not framed yet.
+    std::size_t parsed_position_{0};
+
+    //! Position of the end of the received bytes.
+    std::size_t received_position_{0};
+
+    //! Size of the bytes of the next message already scanned.
+    std::size_t scanned_size_{0};
+
+    //! Number of objects in the next message not scanned yet.
+    std::uint64_t num_remaining_objects_{1};
+
+    //! Buffer size to read at once.
+    std::size_t read_buffer_size_;
+
+    //! Maximum size of a message.
+    std::size_t max_message_size_;
+};
+
+}  // namespace msgpack_rpc::messages::impl
@@ -20,8 +20,11 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
+#include <vector>
 
 #include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/external_binary.h"
 #include "msgpack_rpc/messages/impl/sharable_binary_header_fwd.h"
 #include "msgpack_rpc/messages/serialized_message.h"
 
@@ -39,6 +42,14 @@ public:
      */
     SerializationBuffer();
 
+    /*!
+     * \brief Constructor with the initial capacity.
+     *
+     * \param[in] initial_capacity Initial capacity of the buffer. Zero
+     * specifies the default capacity.
+     */
+    explicit SerializationBuffer(std::size_t initial_capacity);
+
     /*!
      * \brief Destructor.
      */
@@ -57,6 +68,16 @@ public:
      */
     void write(const char* data, std::size_t size);
 
+    /*!
+     * \brief Write binary data outside of the buffer without copying.
+     *
+     * \param[in] binary Binary data.
+     *
+     * \note This function writes only the reference to the binary data at the
+     * current position. Headers of the binary must be written separately.
+     */
+    void write_external(const ExternalBinary& binary);
+
     /*!
      * \brief Release the buffer as msgpack_rpc::messages::SerializedMessage
      * object.
@@ -71,6 +92,9 @@ public:
 private:
     //! Buffer.
     impl::SharableBinaryHeader* buffer_;
+
+    //! Binary data outside of the buffer.
+    std::shared_ptr<std::vector<ExternalBinaryPart>> external_parts_{};
 };
 
 }  // namespace msgpack_rpc::messages::impl
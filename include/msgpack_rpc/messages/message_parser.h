@@ -22,17 +22,21 @@
 #include <cstddef>
 #include <optional>
 
-#include <msgpack.hpp>
-
 #include "msgpack_rpc/config/message_parser_config.h"
 #include "msgpack_rpc/impl/msgpack_rpc_export.h"
 #include "msgpack_rpc/messages/buffer_view.h"
+#include "msgpack_rpc/messages/impl/message_framer.h"
 #include "msgpack_rpc/messages/parsed_message.h"
 
 namespace msgpack_rpc::messages {
 
 /*!
  * \brief Class to parse messages.
+ *
+ * Parameters and results in parsed messages are kept in the received bytes
+ * and decoded when used, so that they can be decoded directly into values of
+ * types known at compile time (refer to ParsedParameters::as and
+ * CallResult::result_as).
  */
 class MSGPACK_RPC_EXPORT MessageParser {
 public:
@@ -67,20 +71,36 @@ public:
      */
     void consumed(std::size_t num_bytes);
 
+    /*!
+     * \brief Set a function called with the data of each message before
+     * parsing it.
+     *
+     * \param[in] handler Function.
+     *
+     * \note Compressed messages are passed after decompression.
+     */
+    void set_framed_message_handler(impl::FramedMessageHandler handler);
+
     /*!
      * \brief Try to parse a message and return it if parsed, throw an exception
      * if the message data is invalid.
      *
      * \return Message if parsed. Null if more data is required.
+     *
+     * \note Compressed messages are decompressed here, and decoded into
+     * objects in msgpack library.
      */
     [[nodiscard]] std::optional<ParsedMessage> try_parse();
 
 private:
-    //! Parser.
-    msgpack::unpacker parser_;
+    //! Framer of messages.
+    impl::MessageFramer framer_;
+
+    //! Maximum size of a message.
+    std::size_t max_message_size_;
 
-    //! Buffer size to read at once.
-    std::size_t read_buffer_size_;
+    //! Function called with the data of each message.
+    impl::FramedMessageHandler framed_message_handler_{};
 };
 
 }  // namespace msgpack_rpc::messages
@@ -19,13 +19,24 @@
  */
 #pragma once
 
-#include <tuple>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 #include <msgpack.hpp>
 
+#include "msgpack_rpc/messages/external_binary.h"
 #include "msgpack_rpc/messages/impl/serialization_buffer.h"
 #include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/prepared_method_name.h"
+#include "msgpack_rpc/messages/raw_result.h"
 #include "msgpack_rpc/messages/serialized_message.h"
 
 namespace msgpack_rpc::messages {
@@ -54,10 +65,103 @@ public:
         packer.pack(0);
         packer.pack(message_id);
         packer.pack(method_name.name());
-        packer.pack(std::forward_as_tuple(parameters...));
+        pack_parameters(buffer, packer, parameters...);
         return buffer.release();
     }
 
+    /*!
+     * \brief Serialize a request with the remaining budget of time.
+     *
+     * The remaining budget is appended to the request as the fifth element,
+     * which is a map from `"budget_ns"` to the remaining time in nanoseconds.
+     * Peers not supporting this extension reject such requests, so this
+     * function must be used only when peers are known to support it.
+     *
+     * The remaining time is serialized in a fixed width at the end of the
+     * request, so that update_request_budget function can update it when
+     * the request is actually sent.
+     *
+     * \tparam Parameters Types of parameters.
+     * \param[in] method_name Method name.
+     * \param[in] message_id Message ID.
+     * \param[in] remaining_budget Remaining budget of time to process the
+     * request.
+     * \param[in] parameters Parameters.
+     * \return Serialized data.
+     */
+    template <typename... Parameters>
+    [[nodiscard]] static SerializedMessage serialize_request_with_budget(
+        MethodNameView method_name, MessageID message_id,
+        std::chrono::nanoseconds remaining_budget,
+        const Parameters&... parameters) {
+        impl::SerializationBuffer buffer;
+        msgpack::packer<impl::SerializationBuffer> packer{buffer};
+        packer.pack_array(5);
+        packer.pack(0);
+        packer.pack(message_id);
+        packer.pack(method_name.name());
+        pack_parameters(buffer, packer, parameters...);
+        pack_budget(packer, remaining_budget);
+        return buffer.release();
+    }
+
+    /*!
+     * \brief Serialize a request of a prepared method.
+     *
+     * \tparam Parameters Types of parameters.
+     * \param[in] method_name Prepared method name.
+     * \param[in] message_id Message ID.
+     * \param[in] parameters Parameters.
+     * \return Serialized data.
+     */
+    template <typename... Parameters>
+    [[nodiscard]] static SerializedMessage serialize_request(
+        const PreparedMethodName& method_name, MessageID message_id,
+        const Parameters&... parameters) {
+        impl::SerializationBuffer buffer{method_name.size_hint()};
+        msgpack::packer<impl::SerializationBuffer> packer{buffer};
+        packer.pack_array(4);
+        packer.pack(0);
+        packer.pack(message_id);
+        const std::string_view encoded_name = method_name.encoded_name();
+        buffer.write(encoded_name.data(), encoded_name.size());
+        pack_parameters(buffer, packer, parameters...);
+        auto message = buffer.release();
+        method_name.update_size_hint(message.size());
+        return message;
+    }
+
+    /*!
+     * \brief Serialize a request of a prepared method with the remaining
+     * budget of time.
+     *
+     * \tparam Parameters Types of parameters.
+     * \param[in] method_name Prepared method name.
+     * \param[in] message_id Message ID.
+     * \param[in] remaining_budget Remaining budget of time to process the
+     * request.
+     * \param[in] parameters Parameters.
+     * \return Serialized data.
+     */
+    template <typename... Parameters>
+    [[nodiscard]] static SerializedMessage serialize_request_with_budget(
+        const PreparedMethodName& method_name, MessageID message_id,
+        std::chrono::nanoseconds remaining_budget,
+        const Parameters&... parameters) {
+        impl::SerializationBuffer buffer{method_name.size_hint()};
+        msgpack::packer<impl::SerializationBuffer> packer{buffer};
+        packer.pack_array(5);
+        packer.pack(0);
+        packer.pack(message_id);
+        const std::string_view encoded_name = method_name.encoded_name();
+        buffer.write(encoded_name.data(), encoded_name.size());
+        pack_parameters(buffer, packer, parameters...);
+        pack_budget(packer, remaining_budget);
+        auto message = buffer.release();
+        method_name.update_size_hint(message.size());
+        return message;
+    }
+
     /*!
      * \brief Serialize a successful response.
      *
@@ -75,7 +179,51 @@ public:
         packer.pack(1);
         packer.pack(request_id);
         packer.pack_nil();
-        packer.pack(result);
+        pack_value(buffer, packer, result);
+        return buffer.release();
+    }
+
+    /*!
+     * \brief Serialize a successful response with a serialized result.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] serialized_result Result serialized in msgpack format.
+     * \return Serialized data.
+     */
+    [[nodiscard]] static SerializedMessage
+    serialize_successful_response_with_serialized_result(
+        MessageID request_id, std::string_view serialized_result) {
+        impl::SerializationBuffer buffer{serialized_result.size()};
+        msgpack::packer<impl::SerializationBuffer> packer{buffer};
+        packer.pack_array(4);
+        packer.pack(1);
+        packer.pack(request_id);
+        packer.pack_nil();
+        buffer.write(serialized_result.data(), serialized_result.size());
+        return buffer.release();
+    }
+
+    /*!
+     * \brief Serialize a successful response with a shared serialized result
+     * without copying the result.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] serialized_result Result serialized in msgpack format.
+     * \return Serialized data.
+     */
+    [[nodiscard]] static SerializedMessage
+    serialize_successful_response_with_serialized_result(MessageID request_id,
+        std::shared_ptr<const std::string> serialized_result) {
+        impl::SerializationBuffer buffer;
+        msgpack::packer<impl::SerializationBuffer> packer{buffer};
+        packer.pack_array(4);
+        packer.pack(1);
+        packer.pack(request_id);
+        packer.pack_nil();
+        const char* data = serialized_result->data();
+        const std::size_t size = serialized_result->size();
+        buffer.write_external(ExternalBinary(data, size,
+            [result = std::move(serialized_result)] { (void)result; }));
         return buffer.release();
     }
 
@@ -116,9 +264,118 @@ public:
         packer.pack_array(3);
         packer.pack(2);
         packer.pack(method_name.name());
-        packer.pack(std::forward_as_tuple(parameters...));
+        pack_parameters(buffer, packer, parameters...);
         return buffer.release();
     }
+
+    /*!
+     * \brief Update the remaining budget of time in a serialized request.
+     *
+     * \param[in,out] request Request serialized by
+     * serialize_request_with_budget function.
+     * \param[in] remaining_budget Remaining budget of time to process the
+     * request.
+     *
+     * \note The budget is overwritten in place without copying the request,
+     * so the request must not be read in other threads during this function.
+     */
+    static void update_request_budget(SerializedMessage& request,
+        std::chrono::nanoseconds remaining_budget) noexcept {
+        if (request.size() < BUDGET_VALUE_SIZE) {
+            return;
+        }
+        // Buffers of serialized messages are allocated as mutable memory.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        char* value = const_cast<char*>(request.data()) + request.size() -
+            BUDGET_VALUE_SIZE;
+        std::uint64_t budget = to_budget_ns(remaining_budget);
+        // Big endian as in msgpack.
+        for (std::size_t i = BUDGET_VALUE_SIZE; i > 0; --i) {
+            value[i - 1] = static_cast<char>(budget & BYTE_MASK);
+            budget >>= BITS_PER_BYTE;
+        }
+    }
+
+private:
+    //! Size of the value of the budget at the end of requests.
+    static constexpr std::size_t BUDGET_VALUE_SIZE = sizeof(std::uint64_t);
+
+    //! Mask of a byte.
+    static constexpr std::uint64_t BYTE_MASK = 0xFFU;
+
+    //! Number of bits in a byte.
+    static constexpr unsigned int BITS_PER_BYTE = 8U;
+
+    /*!
+     * \brief Convert the remaining budget of time to nanoseconds.
+     *
+     * \param[in] remaining_budget Remaining budget of time.
+     * \return Remaining budget in nanoseconds.
+     */
+    [[nodiscard]] static std::uint64_t to_budget_ns(
+        std::chrono::nanoseconds remaining_budget) noexcept {
+        return static_cast<std::uint64_t>(
+            std::max(remaining_budget, std::chrono::nanoseconds(0)).count());
+    }
+
+    /*!
+     * \brief Pack the remaining budget of time.
+     *
+     * \param[in,out] packer Packer.
+     * \param[in] remaining_budget Remaining budget of time.
+     */
+    static void pack_budget(msgpack::packer<impl::SerializationBuffer>& packer,
+        std::chrono::nanoseconds remaining_budget) {
+        packer.pack_map(1);
+        packer.pack("budget_ns");
+        // Fixed width so that update_request_budget can overwrite the value.
+        packer.pack_fix_uint64(to_budget_ns(remaining_budget));
+    }
+
+    /*!
+     * \brief Pack parameters.
+     *
+     * \tparam Parameters Types of parameters.
+     * \param[in,out] buffer Buffer.
+     * \param[in,out] packer Packer.
+     * \param[in] parameters Parameters.
+     */
+    template <typename... Parameters>
+    static void pack_parameters(impl::SerializationBuffer& buffer,
+        msgpack::packer<impl::SerializationBuffer>& packer,
+        const Parameters&... parameters) {
+        packer.pack_array(static_cast<std::uint32_t>(sizeof...(Parameters)));
+        // Buffer is unused when no parameter is given.
+        (void)buffer;
+        (pack_value(buffer, packer, parameters), ...);
+    }
+
+    /*!
+     * \brief Pack a value.
+     *
+     * \tparam T Type of the value.
+     * \param[in,out] buffer Buffer.
+     * \param[in,out] packer Packer.
+     * \param[in] value Value.
+     *
+     * \note Data of msgpack_rpc::messages::ExternalBinary and
+     * msgpack_rpc::messages::RawResult objects are not copied here.
+     */
+    template <typename T>
+    static void pack_value(impl::SerializationBuffer& buffer,
+        msgpack::packer<impl::SerializationBuffer>& packer, const T& value) {
+        if constexpr (std::is_same_v<T, ExternalBinary>) {
+            const std::uint32_t size =
+                msgpack::checked_get_container_size(value.size());
+            packer.pack_bin(size);
+            buffer.write_external(value);
+        } else if constexpr (std::is_same_v<T, RawResult>) {
+            // Data already serialized is inserted as is.
+            buffer.write_external(value.binary());
+        } else {
+            packer.pack(value);
+        }
+    }
 };
 
 }  // namespace msgpack_rpc::messages
@@ -27,6 +27,8 @@
 
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/impl/direct_decoder.h"
+#include "msgpack_rpc/messages/impl/encoded_object.h"
 
 namespace msgpack_rpc::messages {
 
@@ -50,33 +52,94 @@ public:
         }
     }
 
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] encoded Encoded object of parameters.
+     *
+     * \note The encoded object must be an array.
+     */
+    explicit ParsedParameters(
+        std::shared_ptr<const impl::EncodedObject> encoded) noexcept
+        : encoded_(std::move(encoded)) {}
+
     /*!
      * \brief Get parameters as given types.
      *
+     * Parameters received as bytes are decoded directly from the bytes if all
+     * the types have decoders in impl::DirectDecoder class, otherwise via the
+     * object in msgpack library.
+     *
      * \tparam Parameters Type of parameters.
      * \return Parameters.
      */
     template <typename... Parameters>
     [[nodiscard]] std::tuple<Parameters...> as() const {
+        if constexpr ((impl::is_directly_decodable_v<Parameters> && ...)) {
+            if (encoded_) {
+                return as_directly<Parameters...>();
+            }
+        }
+        const msgpack::object& parameters = object();
         try {
             // msgpack library doesn't check the number of elements in tuples.
-            if (object_.via.array.size != sizeof...(Parameters)) {
+            if (parameters.via.array.size != sizeof...(Parameters)) {
                 throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
                     "Invalid number of parameters.");
             }
-            return object_.as<std::tuple<Parameters...>>();
+            return parameters.as<std::tuple<Parameters...>>();
         } catch (const msgpack::type_error&) {
             throw MsgpackRPCException(
                 StatusCode::TYPE_ERROR, "Invalid types of parameters.");
         }
     }
 
+    /*!
+     * \brief Get the object of parameters in msgpack library.
+     *
+     * \return Object.
+     *
+     * \note Parameters received as bytes are decoded at the first call.
+     */
+    [[nodiscard]] const msgpack::object& object() const {
+        if (encoded_) {
+            return encoded_->object();
+        }
+        return object_;
+    }
+
 private:
+    /*!
+     * \brief Decode parameters directly from bytes.
+     *
+     * \tparam Parameters Type of parameters.
+     * \return Parameters.
+     */
+    template <typename... Parameters>
+    [[nodiscard]] std::tuple<Parameters...> as_directly() const {
+        std::tuple<Parameters...> parameters;
+        impl::ParametersDecoder<Parameters...> decoder;
+        decoder.set_target(parameters);
+        if (!impl::decode_directly(
+                encoded_->data(), encoded_->size(), decoder)) {
+            if (decoder.has_invalid_size()) {
+                throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+                    "Invalid number of parameters.");
+            }
+            throw MsgpackRPCException(
+                StatusCode::TYPE_ERROR, "Invalid types of parameters.");
+        }
+        return parameters;
+    }
+
     //! Object of parameters in msgpack library.
-    msgpack::object object_;
+    msgpack::object object_{};
 
     //! Zone in msgpack library.
-    std::shared_ptr<msgpack::zone> zone_;
+    std::shared_ptr<msgpack::zone> zone_{};
+
+    //! Encoded object of parameters. (Null if created from an object.)
+    std::shared_ptr<const impl::EncodedObject> encoded_{};
 };
 
 }  // namespace msgpack_rpc::messages
@@ -19,6 +19,8 @@
  */
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <utility>
 
 #include "msgpack_rpc/messages/message_id.h"
@@ -38,12 +40,16 @@ public:
      * \param[in] id Message ID.
      * \param[in] method_name Method name.
      * \param[in] parameters Parameters.
+     * \param[in] deadline Deadline of the request propagated from the client.
      */
     ParsedRequest(MessageID id, MethodNameView method_name,
-        ParsedParameters parameters) noexcept
+        ParsedParameters parameters,
+        std::optional<std::chrono::steady_clock::time_point> deadline =
+            std::nullopt) noexcept
         : id_(id),
           method_name_(method_name),
-          parameters_(std::move(parameters)) {}
+          parameters_(std::move(parameters)),
+          deadline_(deadline) {}
 
     /*!
      * \brief Get the message ID.
@@ -70,6 +76,16 @@ public:
         return parameters_;
     }
 
+    /*!
+     * \brief Get the deadline of the request propagated from the client.
+     *
+     * \return Deadline if propagated, otherwise std::nullopt.
+     */
+    [[nodiscard]] std::optional<std::chrono::steady_clock::time_point>
+    deadline() const noexcept {
+        return deadline_;
+    }
+
 private:
     //! Message ID.
     MessageID id_;
@@ -79,6 +95,9 @@ private:
 
     //! Parameters.
     ParsedParameters parameters_;
+
+    //! Deadline of the request propagated from the client.
+    std::optional<std::chrono::steady_clock::time_point> deadline_;
 };
 
 }  // namespace msgpack_rpc::messages
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of PreparedMethodName class.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+
+namespace msgpack_rpc::messages {
+
+/*!
+ * \brief Class of method names prepared for serialization of requests.
+ *
+ * This class holds the method name already encoded in MessagePack, and a hint
+ * of the size of serialized requests learned from previous requests, so that
+ * requests of frequently called methods can be serialized without encoding
+ * the method name and growing buffers.
+ */
+class PreparedMethodName {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] name Method name.
+     */
+    explicit PreparedMethodName(MethodNameView name)
+        : name_(name.name()), encoded_name_(encode(name)), size_hint_(0U) {}
+
+    /*!
+     * \brief Get the method name.
+     *
+     * \return Method name.
+     */
+    [[nodiscard]] MethodNameView name() const noexcept {
+        return MethodNameView(name_);
+    }
+
+    /*!
+     * \brief Get the method name encoded in MessagePack.
+     *
+     * \return Encoded method name.
+     */
+    [[nodiscard]] std::string_view encoded_name() const noexcept {
+        return encoded_name_;
+    }
+
+    /*!
+     * \brief Get the hint of the size of serialized requests.
+     *
+     * \return Size hint. Zero if no request has been serialized.
+     */
+    [[nodiscard]] std::size_t size_hint() const noexcept {
+        return size_hint_.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Update the hint of the size of serialized requests.
+     *
+     * \param[in] size Size of a serialized request.
+     */
+    void update_size_hint(std::size_t size) const noexcept {
+        size_hint_.store(size, std::memory_order_relaxed);
+    }
+
+    PreparedMethodName(const PreparedMethodName&) = delete;
+    PreparedMethodName(PreparedMethodName&&) = delete;
+    PreparedMethodName& operator=(const PreparedMethodName&) = delete;
+    PreparedMethodName& operator=(PreparedMethodName&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PreparedMethodName() noexcept = default;
+
+private:
+    /*!
+     * \brief Encode a method name in MessagePack.
+     *
+     * \param[in] name Method name.
+     * \return Encoded method name.
+     */
+    [[nodiscard]] static std::string encode(MethodNameView name) {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, name.name());
+        return std::string(buffer.data(), buffer.size());
+    }
+
+    //! Method name.
+    MethodName name_;
+
+    //! Method name encoded in MessagePack.
+    std::string encoded_name_;
+
+    //! Hint of the size of serialized requests.
+    mutable std::atomic<std::size_t> size_hint_;
+};
+
+}  // namespace msgpack_rpc::messages
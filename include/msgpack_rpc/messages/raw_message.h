@@ -0,0 +1,163 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of RawMessage class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_type.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+namespace msgpack_rpc::messages {
+
+/*!
+ * \brief Class of messages whose headers are parsed but whose parameters and
+ * results are kept as received bytes.
+ *
+ * Objects of this class are used to forward messages without decoding and
+ * re-encoding parameters and results.
+ *
+ * \note For notifications of reserved methods whose first parameter is the
+ * message ID of a request (e.g. `$/cancelRequest`), the parameter is parsed as
+ * the message ID of this message.
+ */
+class MSGPACK_RPC_EXPORT RawMessage {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] type Message type.
+     * \param[in] id Message ID. Null for notifications without message IDs.
+     * \param[in] method_name Method name. Empty for responses.
+     * \param[in] buffer Buffer of the data.
+     * \param[in] offset Offset of the message in the buffer.
+     * \param[in] size Size of the message.
+     * \param[in] id_offset Offset of the message ID in the message.
+     * \param[in] id_size Size of the message ID in the message.
+     *
+     * \warning Users must not use this constructor.
+     */
+    RawMessage(MessageType type, std::optional<MessageID> id,
+        MethodNameView method_name,
+        std::shared_ptr<const std::vector<char>> buffer, std::size_t offset,
+        std::size_t size, std::size_t id_offset, std::size_t id_size) noexcept
+        : type_(type),
+          id_(id),
+          method_name_(method_name),
+          buffer_(std::move(buffer)),
+          offset_(offset),
+          size_(size),
+          id_offset_(id_offset),
+          id_size_(id_size) {}
+
+    /*!
+     * \brief Get the message type.
+     *
+     * \return Message type.
+     */
+    [[nodiscard]] MessageType type() const noexcept { return type_; }
+
+    /*!
+     * \brief Get the message ID.
+     *
+     * \return Message ID. Null for notifications without message IDs.
+     */
+    [[nodiscard]] std::optional<MessageID> id() const noexcept { return id_; }
+
+    /*!
+     * \brief Get the method name.
+     *
+     * \return Method name. Empty for responses.
+     */
+    [[nodiscard]] MethodNameView method_name() const noexcept {
+        return method_name_;
+    }
+
+    /*!
+     * \brief Get the pointer to the data of this message.
+     *
+     * \return Pointer to the data.
+     */
+    [[nodiscard]] const char* data() const noexcept {
+        return buffer_->data() + offset_;
+    }
+
+    /*!
+     * \brief Get the size of the data of this message.
+     *
+     * \return Size of the data.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /*!
+     * \brief Serialize this message as is.
+     *
+     * \return Serialized message.
+     *
+     * \note The data is sent from the buffer of this message without copying.
+     */
+    [[nodiscard]] SerializedMessage serialize() const;
+
+    /*!
+     * \brief Serialize this message with the message ID replaced.
+     *
+     * \param[in] id Message ID.
+     * \return Serialized message.
+     *
+     * \note Only the bytes before the message ID are copied, and the rest of
+     * the data is sent from the buffer of this message without copying.
+     * \note This function throws an exception with
+     * StatusCode::PRECONDITION_NOT_MET for messages without message IDs.
+     */
+    [[nodiscard]] SerializedMessage serialize_with_id(MessageID id) const;
+
+private:
+    //! Message type.
+    MessageType type_;
+
+    //! Message ID.
+    std::optional<MessageID> id_;
+
+    //! Method name.
+    MethodNameView method_name_;
+
+    //! Buffer of the data.
+    std::shared_ptr<const std::vector<char>> buffer_;
+
+    //! Offset of the message in the buffer.
+    std::size_t offset_;
+
+    //! Size of the message.
+    std::size_t size_;
+
+    //! Offset of the message ID in the message.
+    std::size_t id_offset_;
+
+    //! Size of the message ID in the message.
+    std::size_t id_size_;
+};
+
+}  // namespace msgpack_rpc::messages
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of RawMessageParser class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/buffer_view.h"
+#include "msgpack_rpc/messages/impl/message_framer.h"
+#include "msgpack_rpc/messages/raw_message.h"
+
+namespace msgpack_rpc::messages {
+
+/*!
+ * \brief Class to parse only headers of messages.
+ *
+ * In contrast to MessageParser, this class doesn't decode parameters and
+ * results, and parsed messages refer to the received bytes.
+ */
+class MSGPACK_RPC_EXPORT RawMessageParser {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] config Configuration.
+     */
+    explicit RawMessageParser(const config::MessageParserConfig& config);
+
+    RawMessageParser(const RawMessageParser&) = delete;
+    RawMessageParser(RawMessageParser&&) = delete;
+    RawMessageParser& operator=(const RawMessageParser&) = delete;
+    RawMessageParser& operator=(RawMessageParser&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~RawMessageParser();
+
+    /*!
+     * \brief Prepare a buffer.
+     *
+     * \return Buffer.
+     */
+    BufferView prepare_buffer();
+
+    /*!
+     * \brief Set some bytes to be consumed.
+     *
+     * \param[in] num_bytes Number of consumed bytes.
+     */
+    void consumed(std::size_t num_bytes);
+
+    /*!
+     * \brief Set a function called with the data of each message before
+     * parsing it.
+     *
+     * \param[in] handler Function.
+     *
+     * \note Data are passed as received.
+     */
+    void set_framed_message_handler(impl::FramedMessageHandler handler);
+
+    /*!
+     * \brief Try to parse a message and return it if parsed, throw an exception
+     * if the message data is invalid.
+     *
+     * \return Message if parsed. Null if more data is required.
+     *
+     * \note Compressed messages are not supported.
+     */
+    [[nodiscard]] std::optional<RawMessage> try_parse();
+
+private:
+    //! Framer of messages.
+    impl::MessageFramer framer_;
+
+    //! Function called with the data of each message.
+    impl::FramedMessageHandler framed_message_handler_{};
+};
+
+}  // namespace msgpack_rpc::messages
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of RawResult class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/external_binary.h"
+
+namespace msgpack_rpc::messages {
+
+namespace impl {
+
+/*!
+ * \brief Check that data is exactly one object in msgpack format.
+ *
+ * \param[in] data Pointer to the data.
+ * \param[in] size Size of the data in bytes.
+ *
+ * \throw MsgpackRPCException The data is not exactly one object
+ * (StatusCode::INVALID_ARGUMENT).
+ *
+ * \note This function only checks the formats and sizes of objects, and
+ * never decodes the objects.
+ */
+MSGPACK_RPC_EXPORT void validate_raw_result(
+    const char* data, std::size_t size);
+
+}  // namespace impl
+
+/*!
+ * \brief Class of results already serialized in msgpack format.
+ *
+ * When functions implementing methods return objects of this class, the
+ * serialized data is inserted to responses as is without decoding and
+ * encoding again. The data is written to sockets directly from the buffer
+ * without copying, similarly to msgpack_rpc::messages::ExternalBinary.
+ *
+ * \note The data must be exactly one object in msgpack format. Constructors
+ * check this and throw msgpack_rpc::MsgpackRPCException with
+ * StatusCode::INVALID_ARGUMENT otherwise.
+ */
+class RawResult {
+public:
+    /*!
+     * \brief Constructor with a buffer owned by callers.
+     *
+     * \param[in] data Pointer to the serialized data.
+     * \param[in] size Size of the serialized data in bytes.
+     * \param[in] release Function called to release the buffer.
+     *
+     * \note The buffer is released immediately if the data is invalid.
+     */
+    RawResult(const char* data, std::size_t size, std::function<void()> release)
+        : binary_(data, size, std::move(release)) {
+        impl::validate_raw_result(data, size);
+    }
+
+    /*!
+     * \brief Constructor with serialized data owned by this object.
+     *
+     * \param[in] data Serialized data.
+     */
+    explicit RawResult(std::string data)
+        : RawResult(std::make_shared<const std::string>(std::move(data))) {}
+
+    /*!
+     * \brief Get the pointer to the serialized data.
+     *
+     * \return Pointer to the serialized data.
+     */
+    [[nodiscard]] const char* data() const noexcept { return binary_.data(); }
+
+    /*!
+     * \brief Get the size of the serialized data.
+     *
+     * \return Size of the serialized data in bytes.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return binary_.size(); }
+
+    /*!
+     * \brief Get the serialized data as an external binary.
+     *
+     * \return Binary.
+     */
+    [[nodiscard]] const ExternalBinary& binary() const noexcept {
+        return binary_;
+    }
+
+private:
+    /*!
+     * \brief Constructor with shared serialized data.
+     *
+     * \param[in] data Serialized data.
+     */
+    explicit RawResult(const std::shared_ptr<const std::string>& data)
+        : RawResult(data->data(), data->size(), [data] { (void)data; }) {}
+
+    //! Serialized data.
+    ExternalBinary binary_;
+};
+
+}  // namespace msgpack_rpc::messages
+
+namespace msgpack {
+MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS) {
+    namespace adaptor {
+
+    /*!
+     * \brief Specialization of msgpack::adaptor::pack for
+     * msgpack_rpc::messages::RawResult.
+     *
+     * \note This decodes and encodes the data again. Serialization of
+     * messages avoids this function for results.
+     */
+    template <>
+    struct pack<msgpack_rpc::messages::RawResult> {
+        /*!
+         * \brief Pack a value.
+         *
+         * \tparam Stream Type of the stream.
+         * \param[in] packer Packer.
+         * \param[in] value Value.
+         * \return Packer.
+         */
+        template <typename Stream>
+        msgpack::packer<Stream>& operator()(msgpack::packer<Stream>& packer,
+            const msgpack_rpc::messages::RawResult& value) const {
+            const auto object_handle =
+                msgpack::unpack(value.data(), value.size());
+            packer.pack(object_handle.get());
+            return packer;
+        }
+    };
+
+    /*!
+     * \brief Specialization of msgpack::adaptor::object_with_zone for
+     * msgpack_rpc::messages::RawResult.
+     */
+    template <>
+    struct object_with_zone<msgpack_rpc::messages::RawResult> {
+        /*!
+         * \brief Create an object copying the data to the zone.
+         *
+         * \param[out] object Object.
+         * \param[in] value Value.
+         */
+        void operator()(msgpack::object::with_zone& object,
+            const msgpack_rpc::messages::RawResult& value) const {
+            const auto object_handle =
+                msgpack::unpack(value.data(), value.size());
+            static_cast<msgpack::object&>(object) =
+                msgpack::object(object_handle.get(), object.zone);
+        }
+    };
+
+    }  // namespace adaptor
+}  // MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS)
+}  // namespace msgpack
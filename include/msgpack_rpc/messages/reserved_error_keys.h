@@ -0,0 +1,41 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of constants of keys in errors reserved in this library.
+ */
+#pragma once
+
+#include <string_view>
+
+namespace msgpack_rpc::messages {
+
+/*!
+ * \brief Key of the status code in errors sent by this library.
+ *
+ * Errors sent by this library itself (not by methods) are maps with this key
+ * and ERROR_MESSAGE_KEY. The value of this key is the name of the status code
+ * formatted by format_status_code function. Clients use status codes only in
+ * errors with this key, so errors thrown in methods never change status codes.
+ */
+constexpr std::string_view ERROR_CODE_KEY = "$/code";
+
+/*!
+ * \brief Key of the message in errors sent by this library.
+ */
+constexpr std::string_view ERROR_MESSAGE_KEY = "$/message";
+
+}  // namespace msgpack_rpc::messages
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of constants of method names reserved in this library.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace msgpack_rpc::messages {
+
+/*!
+ * \brief Name of the method of notifications to cancel requests.
+ *
+ * Notifications of this method have the message ID of the request to cancel
+ * as the only parameter.
+ */
+constexpr std::string_view CANCEL_REQUEST_METHOD_NAME = "$/cancelRequest";
+
+/*!
+ * \brief Name of the method of requests to subscribe to topics.
+ *
+ * Requests of this method have the name of the topic as the only parameter.
+ * Messages published to the topic are sent as notifications whose method name
+ * is the name of the topic.
+ */
+constexpr std::string_view SUBSCRIBE_TOPIC_METHOD_NAME = "$/subscribe";
+
+/*!
+ * \brief Name of the method of requests to unsubscribe from topics.
+ *
+ * Requests of this method have the name of the topic as the only parameter.
+ */
+constexpr std::string_view UNSUBSCRIBE_TOPIC_METHOD_NAME = "$/unsubscribe";
+
+/*!
+ * \brief Name of the method of notifications of chunks of streaming responses.
+ *
+ * Notifications of this method have the message ID of the request and a chunk
+ * as parameters. Chunks of a request are sent before the response of the
+ * request, which ends the stream.
+ */
+constexpr std::string_view STREAM_CHUNK_METHOD_NAME = "$/streamChunk";
+
+/*!
+ * \brief Name of the method of notifications of chunks of uploads.
+ *
+ * Notifications of this method have the message ID of the request and a chunk
+ * as parameters. Chunks of a request are sent after the request.
+ */
+constexpr std::string_view UPLOAD_CHUNK_METHOD_NAME = "$/uploadChunk";
+
+/*!
+ * \brief Name of the method of notifications of the end of uploads.
+ *
+ * Notifications of this method have the message ID of the request as the only
+ * parameter.
+ */
+constexpr std::string_view UPLOAD_END_METHOD_NAME = "$/uploadEnd";
+
+/*!
+ * \brief Name of the method of notifications of chunks of uploads consumed in
+ * servers.
+ *
+ * Notifications of this method have the message ID of the request as the only
+ * parameter, and are sent for each consumed chunk.
+ */
+constexpr std::string_view UPLOAD_ACK_METHOD_NAME = "$/uploadAck";
+
+/*!
+ * \brief Name of the method of notifications advertising support of
+ * compression.
+ *
+ * Notifications of this method have the name of the compression algorithm as
+ * the only parameter, and are sent once at the beginning of connections with
+ * compression enabled. Connections never send compressed messages to peers
+ * without this notification.
+ */
+constexpr std::string_view COMPRESSION_METHOD_NAME = "$/compression";
+
+/*!
+ * \brief Name of the compression algorithm advertised in notifications of
+ * COMPRESSION_METHOD_NAME.
+ */
+constexpr std::string_view COMPRESSION_ALGORITHM_NAME = "lz4";
+
+/*!
+ * \brief Maximum number of chunks of an upload sent but not consumed yet.
+ *
+ * \note This limits the number of chunks, not bytes. Memory of an upload in
+ * servers is bounded by this number times the maximum size of messages.
+ */
+constexpr std::size_t UPLOAD_WINDOW_SIZE = 16;
+
+}  // namespace msgpack_rpc::messages
@@ -20,16 +20,38 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
+#include <vector>
 
 #include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/external_binary.h"
 #include "msgpack_rpc/messages/impl/sharable_binary_header_fwd.h"
 
 namespace msgpack_rpc::messages {
 
+namespace impl {
+
+/*!
+ * \brief Struct of binary data inserted to serialized messages without
+ * copying.
+ */
+struct ExternalBinaryPart {
+    //! Position in the internal buffer where the binary data is inserted.
+    std::size_t offset;
+
+    //! Binary data.
+    ExternalBinary binary;
+};
+
+}  // namespace impl
+
 /*!
  * \brief Class of serialized message data.
  *
  * \note Objects of this class shares internal buffers for the same data.
+ * \note Messages may refer to binary data outside of internal buffers
+ * (msgpack_rpc::messages::ExternalBinary objects) to send them without
+ * copying.
  */
 class MSGPACK_RPC_EXPORT SerializedMessage {
 public:
@@ -50,6 +72,19 @@ public:
      */
     explicit SerializedMessage(impl::SharableBinaryHeader* buffer);
 
+    /*!
+     * \brief Constructor with binary data outside of the buffer.
+     *
+     * \param[in] buffer Buffer.
+     * \param[in] external_parts Binary data inserted to the buffer in the
+     * order of positions, or null.
+     *
+     *\warning Users must not use this constructor.
+     */
+    SerializedMessage(impl::SharableBinaryHeader* buffer,
+        std::shared_ptr<const std::vector<impl::ExternalBinaryPart>>
+            external_parts) noexcept;
+
     /*!
      * \brief Copy constructor.
      *
@@ -89,6 +124,9 @@ public:
      * \brief Get the pointer to the data.
      *
      * \return Pointer to the data.
+     *
+     * \note For messages with external binaries, this is only the data in the
+     * internal buffer. Use for_each_buffer or flatten functions in such cases.
      */
     [[nodiscard]] const char* data() const noexcept;
 
@@ -96,12 +134,89 @@ public:
      * \brief Get the size of the data.
      *
      * \return Size of the data.
+     *
+     * \note For messages with external binaries, this is only the size of the
+     * data in the internal buffer. Use total_size function in such cases.
      */
     [[nodiscard]] std::size_t size() const noexcept;
 
+    /*!
+     * \brief Check whether this message has external binaries.
+     *
+     * \retval true This message has external binaries.
+     * \retval false This message has only the internal buffer.
+     */
+    [[nodiscard]] bool has_external_binaries() const noexcept {
+        return external_parts_ != nullptr;
+    }
+
+    /*!
+     * \brief Get the size of the whole message including external binaries.
+     *
+     * \return Size of the message.
+     */
+    [[nodiscard]] std::size_t total_size() const noexcept;
+
+    /*!
+     * \brief Call a function for each buffer of the data in order.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function called with the pointer to the data and
+     * the size of the data.
+     */
+    template <typename Function>
+    void for_each_buffer(Function&& function) const {
+        for_each_part(function, [&function](const ExternalBinary& binary) {
+            function(binary.data(), binary.size());
+        });
+    }
+
+    /*!
+     * \brief Call functions for each part of the data in order, distinguishing
+     * binary data outside of the internal buffer.
+     *
+     * \tparam InternalFunction Type of the function for the internal buffer.
+     * \tparam ExternalFunction Type of the function for external binaries.
+     * \param[in] internal_function Function called with the pointer to the
+     * data in the internal buffer and the size of the data.
+     * \param[in] external_function Function called with each
+     * msgpack_rpc::messages::ExternalBinary object.
+     */
+    template <typename InternalFunction, typename ExternalFunction>
+    void for_each_part(InternalFunction&& internal_function,
+        ExternalFunction&& external_function) const {
+        std::size_t offset = 0;
+        if (external_parts_ != nullptr) {
+            for (const auto& part : *external_parts_) {
+                if (part.offset > offset) {
+                    internal_function(data() + offset, part.offset - offset);
+                }
+                external_function(part.binary);
+                offset = part.offset;
+            }
+        }
+        if (size() > offset) {
+            internal_function(data() + offset, size() - offset);
+        }
+    }
+
+    /*!
+     * \brief Get the message with the whole data in the internal buffer.
+     *
+     * \return Message.
+     *
+     * \note This function copies the data only for messages with external
+     * binaries.
+     */
+    [[nodiscard]] SerializedMessage flatten() const;
+
 private:
     //! Buffer.
     impl::SharableBinaryHeader* buffer_;
+
+    //! Binary data outside of the buffer.
+    std::shared_ptr<const std::vector<impl::ExternalBinaryPart>>
+        external_parts_{};
 };
 
 }  // namespace msgpack_rpc::messages
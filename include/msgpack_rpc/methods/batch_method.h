@@ -0,0 +1,619 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of BatchMethod class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <asio/error_code.hpp>
+#include <asio/steady_timer.hpp>
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/executors/async_invoke.h"
+#include "msgpack_rpc/executors/i_executor.h"
+#include "msgpack_rpc/executors/operation_type.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+#include "msgpack_rpc/messages/parsed_request.h"
+#include "msgpack_rpc/messages/reserved_error_keys.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/batch_method_options.h"
+#include "msgpack_rpc/methods/cancellation_token.h"
+#include "msgpack_rpc/methods/i_method.h"
+#include "msgpack_rpc/methods/method_exception.h"
+#include "msgpack_rpc/methods/request_deadline.h"
+#include "msgpack_rpc/servers/connection_id.h"
+#include "msgpack_rpc/util/format_msgpack_object.h"
+
+namespace msgpack_rpc::methods {
+
+/*!
+ * \brief Class of methods processing requests in batches.
+ *
+ * \tparam Signature Signature of the method for each request.
+ * \tparam Function Type of the function implementing the method.
+ */
+template <typename Signature, typename Function>
+class BatchMethod;
+
+/*!
+ * \brief Class of methods processing requests in batches.
+ *
+ * \tparam Function Type of the function implementing the method.
+ * \tparam Result Type of the result of each request.
+ * \tparam Parameters Types of parameters of each request.
+ *
+ * The function implementing the method receives parameters of the requests
+ * in a batch as `const std::vector<std::tuple<Parameters...>>&`, and returns
+ * results of the requests as `std::vector<Result>` in the same order (or
+ * nothing if Result is void).
+ *
+ * Requests are queued, and a task to process the queued requests is posted
+ * to the executor (or scheduled after the maximum waiting time), so requests
+ * already waiting in the executor are processed in the same batch without
+ * blocking threads for callbacks. A batch is processed immediately when it
+ * reaches the maximum batch size. Without an executor, requests are processed
+ * immediately, and only requests queued while processing the previous batch
+ * are batched.
+ *
+ * \note Functions like msgpack_rpc::servers::current_connection_id and
+ * msgpack_rpc::methods::current_request_deadline return information of the
+ * request which triggered the processing of a batch if any. Batches processed
+ * by posted tasks have only the connection ID when requests are not batched
+ * across connections.
+ *
+ * Requests cancelled or past their deadlines while waiting in queues are
+ * answered with errors without calling the function.
+ *
+ * \note Scheduled tasks do nothing after this object is destroyed.
+ */
+template <typename Function, typename Result, typename... Parameters>
+class BatchMethod<Result(Parameters...), Function> final : public IMethod {
+public:
+    //! Type of tuples of parameters of each request.
+    using ParameterTuple = std::tuple<std::decay_t<Parameters>...>;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \tparam InputFunction Type of the function in the argument.
+     * \param[in] name Method name.
+     * \param[in] function Function implementing the method.
+     * \param[in] options Options.
+     * \param[in] logger Logger.
+     * \param[in] executor Executor to process batches in.
+     */
+    template <typename InputFunction>
+    BatchMethod(messages::MethodName name, InputFunction&& function,
+        const BatchMethodOptions& options,
+        std::shared_ptr<logging::Logger> logger,
+        std::weak_ptr<executors::IExecutor> executor = {})
+        : core_(std::make_shared<Core>(std::move(name),
+              std::forward<InputFunction>(function), options,
+              std::move(logger), std::move(executor))) {}
+
+    //! \copydoc msgpack_rpc::methods::IMethod::name
+    [[nodiscard]] messages::MethodNameView name() const noexcept override {
+        return core_->name();
+    }
+
+    //! \copydoc msgpack_rpc::methods::IMethod::call
+    [[nodiscard]] messages::SerializedMessage call(
+        const messages::ParsedRequest& request) override {
+        return core_->call(request);
+    }
+
+    //! \copydoc msgpack_rpc::methods::IMethod::async_call
+    void async_call(const messages::ParsedRequest& request,
+        const ResponseCallback& on_response) override {
+        core_->async_call(request, on_response);
+    }
+
+    //! \copydoc msgpack_rpc::methods::IMethod::notify
+    void notify(const messages::ParsedNotification& notification) override {
+        core_->notify(notification);
+    }
+
+private:
+    /*!
+     * \brief Struct of requests waiting for processing.
+     */
+    struct PendingRequest {
+        //! Request.
+        messages::ParsedRequest request;
+
+        //! Callback function called with the response.
+        ResponseCallback on_response;
+
+        //! Deadline of the request.
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+
+        //! Token to notify cancellation of the request.
+        std::shared_ptr<const CancellationToken> cancellation_token;
+    };
+
+    /*!
+     * \brief Struct of queues of requests.
+     */
+    struct Queue {
+        //! Requests.
+        std::deque<PendingRequest> requests{};
+
+        //! Whether a thread is processing requests in this queue.
+        bool is_processing{false};
+
+        //! Whether a task to process requests in this queue is scheduled.
+        bool is_flush_scheduled{false};
+    };
+
+    /*!
+     * \brief Class of the internal data shared with scheduled tasks.
+     *
+     * Scheduled tasks refer to objects of this class via std::weak_ptr, so
+     * tasks after the destruction of the method do nothing.
+     */
+    class Core : public std::enable_shared_from_this<Core> {
+    public:
+        /*!
+         * \brief Constructor.
+         *
+         * \tparam InputFunction Type of the function in the argument.
+         * \param[in] name Method name.
+         * \param[in] function Function implementing the method.
+         * \param[in] options Options.
+         * \param[in] logger Logger.
+         * \param[in] executor Executor to process batches in.
+         */
+        template <typename InputFunction>
+        Core(messages::MethodName name, InputFunction&& function,
+            const BatchMethodOptions& options,
+            std::shared_ptr<logging::Logger> logger,
+            std::weak_ptr<executors::IExecutor> executor)
+            : name_(std::move(name)),
+              function_(std::forward<InputFunction>(function)),
+              options_(options),
+              logger_(std::move(logger)),
+              executor_(std::move(executor)) {}
+
+        /*!
+         * \brief Get the method name.
+         *
+         * \return Method name.
+         */
+        [[nodiscard]] messages::MethodNameView name() const noexcept {
+            return name_;
+        }
+
+        /*!
+         * \brief Call the method synchronously.
+         *
+         * \param[in] request Request.
+         * \return Serialized response.
+         */
+        [[nodiscard]] messages::SerializedMessage call(
+            const messages::ParsedRequest& request) {
+            std::optional<messages::SerializedMessage> response;
+            std::vector<PendingRequest> batch;
+            batch.push_back(create_pending_request(
+                request, [&response](messages::SerializedMessage message) {
+                    response.emplace(std::move(message));
+                }));
+            process(batch);
+            return std::move(*response);
+        }
+
+        /*!
+         * \brief Call the method asynchronously.
+         *
+         * \param[in] request Request.
+         * \param[in] on_response Callback function called with the response.
+         */
+        void async_call(const messages::ParsedRequest& request,
+            const ResponseCallback& on_response) {
+            const servers::ConnectionID key = queue_key();
+            std::unique_lock<std::mutex> lock(mutex_);
+            // References to values in std::unordered_map are not invalidated
+            // until the values are erased.
+            Queue& queue = queues_[key];
+            queue.requests.push_back(
+                create_pending_request(request, on_response));
+            if (queue.is_processing) {
+                return;
+            }
+            const auto executor = executor_.lock();
+            if (!executor ||
+                queue.requests.size() >= options_.max_batch_size()) {
+                process_queue(lock, key, queue, executor);
+                return;
+            }
+            schedule_flush(key, queue, executor);
+        }
+
+        /*!
+         * \brief Process a notification.
+         *
+         * \param[in] notification Notification.
+         */
+        void notify(const messages::ParsedNotification& notification) {
+            try {
+                std::vector<ParameterTuple> parameters;
+                parameters.push_back(notification.parameters()
+                        .as<std::decay_t<Parameters>...>());
+                (void)function_(std::as_const(parameters));
+            } catch (const MethodException& e) {
+                MSGPACK_RPC_DEBUG(logger_,
+                    "Method {} threw an exception with a custom object: {}",
+                    name_, util::format_msgpack_object(e.object()));
+            } catch (const std::exception& e) {
+                MSGPACK_RPC_DEBUG(logger_, "Method {} threw an exception: {}",
+                    name_, e.what());
+            }
+        }
+
+    private:
+        /*!
+         * \brief Create a pending request with the deadline and the
+         * cancellation token of the request being processed in this thread.
+         *
+         * \param[in] request Request.
+         * \param[in] on_response Callback function called with the response.
+         * \return Pending request.
+         */
+        [[nodiscard]] static PendingRequest create_pending_request(
+            const messages::ParsedRequest& request,
+            ResponseCallback on_response) {
+            return PendingRequest{request, std::move(on_response),
+                current_request_deadline(), current_cancellation_token()};
+        }
+
+        /*!
+         * \brief Get the key of the queue of the request being processed in
+         * this thread.
+         *
+         * \return Key.
+         */
+        [[nodiscard]] servers::ConnectionID queue_key() const noexcept {
+            if (options_.batch_across_connections()) {
+                return 0U;
+            }
+            return servers::current_connection_id().value_or(0U);
+        }
+
+        /*!
+         * \brief Schedule a task to process requests in a queue.
+         *
+         * \param[in] key Key of the queue.
+         * \param[in] queue Queue.
+         * \param[in] executor Executor.
+         */
+        void schedule_flush(servers::ConnectionID key, Queue& queue,
+            const std::shared_ptr<executors::IExecutor>& executor) {
+            if (queue.is_flush_scheduled) {
+                return;
+            }
+            queue.is_flush_scheduled = true;
+
+            const auto max_waiting_time = options_.max_waiting_time();
+            if (max_waiting_time <= std::chrono::nanoseconds(0)) {
+                executors::async_invoke(executor,
+                    executors::OperationType::CALLBACK,
+                    [weak_self = this->weak_from_this(), key] {
+                        const auto self = weak_self.lock();
+                        if (self) {
+                            self->flush(key);
+                        }
+                    });
+                return;
+            }
+            auto timer = std::make_shared<asio::steady_timer>(
+                executor->context(executors::OperationType::CALLBACK));
+            timer->expires_after(max_waiting_time);
+            timer->async_wait([weak_self = this->weak_from_this(), key,
+                                  timer](const asio::error_code& error) {
+                if (error) {
+                    return;
+                }
+                const auto self = weak_self.lock();
+                if (self) {
+                    self->flush(key);
+                }
+            });
+        }
+
+        /*!
+         * \brief Process requests in a queue in a scheduled task.
+         *
+         * \param[in] key Key of the queue.
+         */
+        void flush(servers::ConnectionID key) {
+            std::optional<servers::impl::ConnectionIDScope>
+                connection_id_scope;
+            if (!options_.batch_across_connections()) {
+                connection_id_scope.emplace(key);
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            const auto iter = queues_.find(key);
+            if (iter == queues_.end()) {
+                return;
+            }
+            Queue& queue = iter->second;
+            queue.is_flush_scheduled = false;
+            if (queue.is_processing) {
+                // The thread processing this queue schedules this task again.
+                return;
+            }
+            process_queue(lock, key, queue, executor_.lock(), true);
+        }
+
+        /*!
+         * \brief Process requests in a queue.
+         *
+         * \param[in] lock Lock of mutex_.
+         * \param[in] key Key of the queue.
+         * \param[in] queue Queue.
+         * \param[in] executor Executor, or null if not available.
+         * \param[in] process_partial_batch Whether to process the first batch
+         * even if it is smaller than the maximum batch size.
+         *
+         * With an executor, only full batches are processed after the first
+         * batch, and processing of the remaining requests is scheduled so that
+         * more requests join the batch. Without an executor, requests are
+         * processed until the queue becomes empty.
+         */
+        void process_queue(std::unique_lock<std::mutex>& lock,
+            servers::ConnectionID key, Queue& queue,
+            const std::shared_ptr<executors::IExecutor>& executor,
+            bool process_partial_batch = false) {
+            const std::size_t max_batch_size = options_.max_batch_size();
+            queue.is_processing = true;
+            std::vector<PendingRequest> batch;
+            while (!queue.requests.empty() &&
+                (!executor || process_partial_batch ||
+                    queue.requests.size() >= max_batch_size)) {
+                process_partial_batch = false;
+                const auto batch_end = queue.requests.begin() +
+                    static_cast<std::ptrdiff_t>(
+                        std::min(queue.requests.size(), max_batch_size));
+                batch.assign(std::make_move_iterator(queue.requests.begin()),
+                    std::make_move_iterator(batch_end));
+                queue.requests.erase(queue.requests.begin(), batch_end);
+                lock.unlock();
+
+                process(batch);
+                batch.clear();
+
+                lock.lock();
+            }
+            queue.is_processing = false;
+
+            if (!queue.requests.empty()) {
+                schedule_flush(key, queue, executor);
+            } else if (!queue.is_flush_scheduled) {
+                queues_.erase(key);
+            }
+        }
+
+        /*!
+         * \brief Process a batch of requests.
+         *
+         * \param[in] batch Requests.
+         *
+         * Requests cancelled or past their deadlines while waiting in queues
+         * are answered with errors without processing.
+         */
+        void process(const std::vector<PendingRequest>& batch) {
+            std::vector<ParameterTuple> parameters;
+            parameters.reserve(batch.size());
+            std::vector<const PendingRequest*> parsed_requests;
+            parsed_requests.reserve(batch.size());
+            const auto now = std::chrono::steady_clock::now();
+            for (const auto& pending : batch) {
+                if (pending.cancellation_token &&
+                    pending.cancellation_token->is_cancelled()) {
+                    MSGPACK_RPC_DEBUG(logger_,
+                        "Request {} of method {} dropped due to cancellation",
+                        pending.request.id(), name_);
+                    pending.on_response(serialize_status_error(
+                        pending.request.id(), StatusCode::OPERATION_ABORTED,
+                        "The request was cancelled."));
+                    continue;
+                }
+                if (pending.deadline && *pending.deadline <= now) {
+                    MSGPACK_RPC_DEBUG(logger_,
+                        "Request {} of method {} dropped due to the expired "
+                        "deadline",
+                        pending.request.id(), name_);
+                    pending.on_response(serialize_status_error(
+                        pending.request.id(), StatusCode::TIMEOUT,
+                        "The deadline of the request expired in a queue."));
+                    continue;
+                }
+                try {
+                    parameters.push_back(pending.request.parameters()
+                            .as<std::decay_t<Parameters>...>());
+                    parsed_requests.push_back(&pending);
+                } catch (const std::exception& e) {
+                    pending.on_response(
+                        messages::MessageSerializer::serialize_error_response(
+                            pending.request.id(), e.what()));
+                }
+            }
+            if (parsed_requests.empty()) {
+                return;
+            }
+
+            const auto responses = invoke(parameters, parsed_requests);
+            for (std::size_t i = 0; i < parsed_requests.size(); ++i) {
+                parsed_requests[i]->on_response(responses[i]);
+            }
+        }
+
+        /*!
+         * \brief Serialize an error response with a status code.
+         *
+         * \param[in] id Message ID of the request.
+         * \param[in] code Status code.
+         * \param[in] message Error message.
+         * \return Serialized response.
+         */
+        [[nodiscard]] static messages::SerializedMessage
+        serialize_status_error(
+            messages::MessageID id, StatusCode code, std::string message) {
+            const auto error = std::map<std::string, std::string>{
+                {std::string(messages::ERROR_CODE_KEY),
+                    std::string(format_status_code(code))},
+                {std::string(messages::ERROR_MESSAGE_KEY),
+                    std::move(message)}};
+            return messages::MessageSerializer::serialize_error_response(
+                id, error);
+        }
+
+        /*!
+         * \brief Invoke the function and serialize the responses.
+         *
+         * \param[in] parameters Parameters of the requests.
+         * \param[in] requests Requests.
+         * \return Serialized responses.
+         */
+        [[nodiscard]] std::vector<messages::SerializedMessage> invoke(
+            const std::vector<ParameterTuple>& parameters,
+            const std::vector<const PendingRequest*>& requests) {
+            std::vector<messages::SerializedMessage> responses;
+            responses.reserve(requests.size());
+            try {
+                if constexpr (std::is_void_v<Result>) {
+                    function_(parameters);
+                    for (const auto* pending : requests) {
+                        responses.push_back(
+                            messages::MessageSerializer::
+                                serialize_successful_response(
+                                    pending->request.id(),
+                                    msgpack::type::nil_t()));
+                    }
+                } else {
+                    const auto results = function_(parameters);
+                    if (results.size() != requests.size()) {
+                        throw MethodException(
+                            "Invalid number of results in a batch method.");
+                    }
+                    for (std::size_t i = 0; i < requests.size(); ++i) {
+                        responses.push_back(
+                            messages::MessageSerializer::
+                                serialize_successful_response(
+                                    requests[i]->request.id(), results[i]));
+                    }
+                }
+            } catch (const MethodException& e) {
+                MSGPACK_RPC_DEBUG(logger_,
+                    "Method {} threw an exception with a custom object: {}",
+                    name_, util::format_msgpack_object(e.object()));
+                responses.clear();
+                for (const auto* pending : requests) {
+                    responses.push_back(
+                        messages::MessageSerializer::serialize_error_response(
+                            pending->request.id(), e.object()));
+                }
+            } catch (const std::exception& e) {
+                MSGPACK_RPC_DEBUG(logger_, "Method {} threw an exception: {}",
+                    name_, e.what());
+                responses.clear();
+                for (const auto* pending : requests) {
+                    responses.push_back(
+                        messages::MessageSerializer::serialize_error_response(
+                            pending->request.id(), e.what()));
+                }
+            }
+            return responses;
+        }
+
+        //! Method name.
+        messages::MethodName name_;
+
+        //! Function.
+        std::decay_t<Function> function_;
+
+        //! Options.
+        BatchMethodOptions options_;
+
+        //! Logger.
+        std::shared_ptr<logging::Logger> logger_;
+
+        //! Executor to process batches in.
+        std::weak_ptr<executors::IExecutor> executor_;
+
+        //! Queues of requests.
+        std::unordered_map<servers::ConnectionID, Queue> queues_{};
+
+        //! Mutex of queues_.
+        std::mutex mutex_{};
+    };
+
+    //! Internal data.
+    std::shared_ptr<Core> core_;
+};
+
+/*!
+ * \brief Create a method processing requests in batches.
+ *
+ * \tparam Signature Signature of the method for each request.
+ * \tparam Function Type of the function implementing the method.
+ * \param[in] name Name of the method.
+ * \param[in] function Function implementing the method.
+ * \param[in] options Options.
+ * \param[in] logger Logger.
+ * \param[in] executor Executor to process batches in. If not given, requests
+ * are processed in the threads calling the method.
+ * \return Method.
+ */
+template <typename Signature, typename Function>
+[[nodiscard]] inline std::unique_ptr<
+    BatchMethod<Signature, std::decay_t<Function>>>
+create_batch_method(
+    // NOLINTNEXTLINE(performance-unnecessary-value-param) : false positive
+    messages::MethodName name, Function&& function,
+    const BatchMethodOptions& options,
+    std::shared_ptr<logging::Logger> logger,
+    std::weak_ptr<executors::IExecutor> executor = {}) {
+    return std::make_unique<BatchMethod<Signature, std::decay_t<Function>>>(
+        std::move(name), std::forward<Function>(function), options,
+        std::move(logger), std::move(executor));
+}
+
+}  // namespace msgpack_rpc::methods
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of BatchMethodOptions class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::methods {
+
+/*!
+ * \brief Class of options of methods processing requests in batches.
+ */
+class MSGPACK_RPC_EXPORT BatchMethodOptions {
+public:
+    //! Constructor.
+    BatchMethodOptions();
+
+    /*!
+     * \brief Set the maximum number of requests in a batch.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    BatchMethodOptions& max_batch_size(std::size_t value);
+
+    /*!
+     * \brief Set the maximum time to wait for more requests before processing
+     * a batch.
+     *
+     * \param[in] value Value.
+     * \return This.
+     *
+     * \note Zero means a batch is processed after requests already queued in
+     * the executor, so that requests received together are batched.
+     * \note Waiting uses a timer in the executor and blocks no thread.
+     */
+    BatchMethodOptions& max_waiting_time(std::chrono::nanoseconds value);
+
+    /*!
+     * \brief Set whether to batch requests from different connections.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    BatchMethodOptions& batch_across_connections(bool value) noexcept;
+
+    /*!
+     * \brief Get the maximum number of requests in a batch.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t max_batch_size() const noexcept;
+
+    /*!
+     * \brief Get the maximum time to wait for more requests before processing
+     * a batch.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::chrono::nanoseconds max_waiting_time() const noexcept;
+
+    /*!
+     * \brief Get whether to batch requests from different connections.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] bool batch_across_connections() const noexcept;
+
+private:
+    //! Maximum number of requests in a batch.
+    std::size_t max_batch_size_;
+
+    //! Maximum time to wait for more requests before processing a batch.
+    std::chrono::nanoseconds max_waiting_time_;
+
+    //! Whether to batch requests from different connections.
+    bool batch_across_connections_;
+};
+
+}  // namespace msgpack_rpc::methods
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of CachedMethod class.
+ */
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+#include "msgpack_rpc/messages/parsed_request.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/i_method.h"
+#include "msgpack_rpc/methods/method_cache.h"
+
+namespace msgpack_rpc::methods {
+
+/*!
+ * \brief Class of methods caching results of another method.
+ *
+ * Results of successful calls are cached for serialized parameters, and
+ * responses of calls with the same parameters are created from the cached
+ * results without parsing parameters or calling the method.
+ *
+ * \note Only methods returning the same results for the same parameters
+ * without side effects should be cached.
+ */
+class CachedMethod final : public IMethod {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] method Method to cache results of.
+     * \param[in] cache Cache.
+     */
+    CachedMethod(
+        std::unique_ptr<IMethod> method, std::shared_ptr<MethodCache> cache)
+        : method_(std::move(method)), cache_(std::move(cache)) {}
+
+    //! \copydoc msgpack_rpc::methods::IMethod::name
+    [[nodiscard]] messages::MethodNameView name() const noexcept override {
+        return method_->name();
+    }
+
+    //! \copydoc msgpack_rpc::methods::IMethod::call
+    [[nodiscard]] messages::SerializedMessage call(
+        const messages::ParsedRequest& request) override {
+        std::string key = create_key(request);
+        if (auto response = find(request.id(), key)) {
+            return std::move(*response);
+        }
+        auto response = method_->call(request);
+        insert(*cache_, request.id(), std::move(key), response);
+        return response;
+    }
+
+    //! \copydoc msgpack_rpc::methods::IMethod::async_call
+    void async_call(const messages::ParsedRequest& request,
+        const ResponseCallback& on_response) override {
+        std::string key = create_key(request);
+        if (auto response = find(request.id(), key)) {
+            on_response(std::move(*response));
+            return;
+        }
+        method_->async_call(request,
+            [cache = cache_, id = request.id(), key = std::move(key),
+                on_response](messages::SerializedMessage response) {
+                insert(*cache, id, key, response);
+                on_response(std::move(response));
+            });
+    }
+
+    //! \copydoc msgpack_rpc::methods::IMethod::notify
+    void notify(const messages::ParsedNotification& notification) override {
+        method_->notify(notification);
+    }
+
+private:
+    /*!
+     * \brief Create the key of a request.
+     *
+     * \param[in] request Request.
+     * \return Key.
+     */
+    [[nodiscard]] static std::string create_key(
+        const messages::ParsedRequest& request) {
+        // Parsers don't keep the data of parameters, so the parameters are
+        // serialized again. This is still cheaper than converting them to
+        // C++ types in most methods.
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, request.parameters().object());
+        return std::string(buffer.data(), buffer.size());
+    }
+
+    /*!
+     * \brief Find a cached result and create a response.
+     *
+     * \param[in] id Message ID of the request.
+     * \param[in] key Key of the request.
+     * \return Response, or std::nullopt if no result is cached.
+     */
+    [[nodiscard]] std::optional<messages::SerializedMessage> find(
+        messages::MessageID id, std::string_view key) {
+        auto result = cache_->find(key, MethodCache::Clock::now());
+        if (!result) {
+            return std::nullopt;
+        }
+        return messages::MessageSerializer::
+            serialize_successful_response_with_serialized_result(
+                id, std::move(result));
+    }
+
+    /*!
+     * \brief Cache the result in a response.
+     *
+     * \param[in] cache Cache.
+     * \param[in] id Message ID of the request.
+     * \param[in] key Key of the request.
+     * \param[in] response Response.
+     *
+     * \note Error responses are not cached.
+     */
+    static void insert(MethodCache& cache, messages::MessageID id,
+        std::string key, const messages::SerializedMessage& response) {
+        const auto flattened_response = response.flatten();
+        const auto header = messages::MessageSerializer::
+            serialize_successful_response_with_serialized_result(id, "");
+        const auto data = std::string_view(
+            flattened_response.data(), flattened_response.size());
+        const auto header_data =
+            std::string_view(header.data(), header.size());
+        if (data.substr(0, header_data.size()) != header_data) {
+            return;
+        }
+        cache.insert(std::move(key),
+            std::string(data.substr(header_data.size())),
+            MethodCache::Clock::now());
+    }
+
+    //! Method to cache results of.
+    std::unique_ptr<IMethod> method_;
+
+    //! Cache.
+    std::shared_ptr<MethodCache> cache_;
+};
+
+/*!
+ * \brief Create a method caching results of another method.
+ *
+ * \param[in] method Method to cache results of.
+ * \param[in] cache Cache.
+ * \return Method.
+ */
+[[nodiscard]] inline std::unique_ptr<CachedMethod> create_cached_method(
+    std::unique_ptr<IMethod> method, std::shared_ptr<MethodCache> cache) {
+    return std::make_unique<CachedMethod>(std::move(method), std::move(cache));
+}
+
+}  // namespace msgpack_rpc::methods
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of CancellationToken class.
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::methods {
+
+/*!
+ * \brief Class of tokens to notify cancellation of requests.
+ *
+ * \note This class is thread-safe.
+ */
+class CancellationToken {
+public:
+    //! Constructor.
+    CancellationToken() noexcept = default;
+
+    /*!
+     * \brief Cancel the request.
+     */
+    void cancel() noexcept {
+        is_cancelled_.store(true, std::memory_order_release);
+    }
+
+    /*!
+     * \brief Check whether the request has been cancelled.
+     *
+     * \retval true The request has been cancelled.
+     * \retval false The request has not been cancelled.
+     */
+    [[nodiscard]] bool is_cancelled() const noexcept {
+        return is_cancelled_.load(std::memory_order_acquire);
+    }
+
+private:
+    //! Whether the request has been cancelled.
+    std::atomic<bool> is_cancelled_{false};
+};
+
+/*!
+ * \brief Get the token to notify cancellation of the request being processed
+ * in this thread.
+ *
+ * \return Token, or null outside of processing of requests.
+ *
+ * \note This function can be used in functions implementing methods. The
+ * returned token can be passed to other threads to check cancellation
+ * asynchronously.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT std::shared_ptr<const CancellationToken>
+current_cancellation_token() noexcept;
+
+namespace impl {
+
+/*!
+ * \brief Class to set the token of cancellation of the request being
+ * processed in this thread during the lifetime of objects.
+ */
+class MSGPACK_RPC_EXPORT CancellationTokenScope {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] token Token.
+     */
+    explicit CancellationTokenScope(
+        std::shared_ptr<const CancellationToken> token) noexcept;
+
+    CancellationTokenScope(const CancellationTokenScope&) = delete;
+    CancellationTokenScope(CancellationTokenScope&&) = delete;
+    CancellationTokenScope& operator=(const CancellationTokenScope&) = delete;
+    CancellationTokenScope& operator=(CancellationTokenScope&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~CancellationTokenScope() noexcept;
+
+private:
+    //! Token set before this object.
+    std::shared_ptr<const CancellationToken> previous_token_;
+};
+
+}  // namespace impl
+
+}  // namespace msgpack_rpc::methods
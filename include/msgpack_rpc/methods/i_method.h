@@ -19,6 +19,8 @@
  */
 #pragma once
 
+#include <functional>
+
 #include "msgpack_rpc/messages/method_name_view.h"
 #include "msgpack_rpc/messages/parsed_notification.h"
 #include "msgpack_rpc/messages/parsed_request.h"
@@ -31,6 +33,15 @@ namespace msgpack_rpc::methods {
  */
 class IMethod {
 public:
+    /*!
+     * \brief Type of callback functions called with responses.
+     *
+     * Parameters:
+     *
+     * 1. Serialized response.
+     */
+    using ResponseCallback = std::function<void(messages::SerializedMessage)>;
+
     /*!
      * \brief Get the method name.
      *
@@ -47,6 +58,22 @@ public:
     [[nodiscard]] virtual messages::SerializedMessage call(
         const messages::ParsedRequest& request) = 0;
 
+    /*!
+     * \brief Asynchronously call this method.
+     *
+     * \param[in] request Request.
+     * \param[in] on_response Callback function called with the response.
+     *
+     * \note The default implementation calls call function and passes the
+     * response to the callback immediately. Methods processing requests later
+     * (for example, in batches) override this function.
+     * \note Exceptions must not be thrown after the callback is called.
+     */
+    virtual void async_call(const messages::ParsedRequest& request,
+        const ResponseCallback& on_response) {
+        on_response(call(request));
+    }
+
     /*!
      * \brief Notify this method.
      *
@@ -49,6 +49,15 @@ public:
     [[nodiscard]] virtual messages::SerializedMessage call(
         const messages::ParsedRequest& request) = 0;
 
+    /*!
+     * \brief Asynchronously call a method.
+     *
+     * \param[in] request Request.
+     * \param[in] on_response Callback function called with the response.
+     */
+    virtual void async_call(const messages::ParsedRequest& request,
+        const IMethod::ResponseCallback& on_response) = 0;
+
     /*!
      * \brief Notify a method.
      *
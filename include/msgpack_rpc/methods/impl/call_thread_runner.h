@@ -0,0 +1,175 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of CallThreadRunner class.
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "msgpack_rpc/methods/cancellation_token.h"
+#include "msgpack_rpc/methods/request_deadline.h"
+#include "msgpack_rpc/methods/stream_writer.h"
+#include "msgpack_rpc/methods/upload_reader.h"
+#include "msgpack_rpc/servers/connection_id.h"
+
+namespace msgpack_rpc::methods::impl {
+
+/*!
+ * \brief Class to run calls of methods in threads dedicated to the calls.
+ *
+ * Methods waiting for clients (for example, streams waiting for clients to
+ * receive chunks) use this class so that threads for callbacks are not
+ * occupied while waiting. The threads inherit information of the request
+ * being processed in the calling thread (the connection ID, the deadline, the
+ * cancellation token, the sender of chunks of streams, and the source of
+ * chunks of uploads).
+ *
+ * Finished threads are joined when another call starts, and remaining threads
+ * are joined in the destructor.
+ *
+ * \note Senders and sources are used in the threads after the calling thread
+ * returns, so they must be kept alive by the callbacks of responses until the
+ * responses are sent, as servers do.
+ */
+class CallThreadRunner {
+public:
+    //! Constructor.
+    CallThreadRunner() = default;
+
+    CallThreadRunner(const CallThreadRunner&) = delete;
+    CallThreadRunner(CallThreadRunner&&) = delete;
+    CallThreadRunner& operator=(const CallThreadRunner&) = delete;
+    CallThreadRunner& operator=(CallThreadRunner&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     *
+     * This waits for the remaining calls to finish.
+     */
+    ~CallThreadRunner() noexcept {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (auto& thread : threads_) {
+            join(thread.thread);
+        }
+        threads_.clear();
+    }
+
+    /*!
+     * \brief Run a function in a new thread.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function. (Must not throw exceptions.)
+     *
+     * \throw std::system_error Failed to create a thread.
+     */
+    template <typename Function>
+    void run(Function&& function) {
+        const auto connection_id = servers::current_connection_id();
+        auto is_finished = std::make_shared<std::atomic<bool>>(false);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        join_finished_threads();
+        std::thread thread{[connection_id,
+                               deadline = current_request_deadline(),
+                               cancellation_token =
+                                   current_cancellation_token(),
+                               sender = current_stream_chunk_sender(),
+                               source = current_upload_chunk_source(),
+                               is_finished,
+                               function_moved =
+                                   std::forward<Function>(function)]() mutable {
+            {
+                std::optional<servers::impl::ConnectionIDScope>
+                    connection_id_scope;
+                if (connection_id) {
+                    connection_id_scope.emplace(*connection_id);
+                }
+                const RequestDeadlineScope deadline_scope(deadline);
+                const CancellationTokenScope cancellation_scope(
+                    std::move(cancellation_token));
+                const StreamChunkSenderScope stream_scope(sender);
+                const UploadChunkSourceScope upload_scope(source);
+                function_moved();
+            }
+            is_finished->store(true, std::memory_order_release);
+        }};
+        threads_.push_back(Thread{std::move(thread), std::move(is_finished)});
+    }
+
+private:
+    /*!
+     * \brief Struct of threads.
+     */
+    struct Thread {
+        //! Thread.
+        std::thread thread;
+
+        //! Whether the function in the thread has finished.
+        std::shared_ptr<std::atomic<bool>> is_finished;
+    };
+
+    /*!
+     * \brief Join threads whose functions have finished.
+     *
+     * \note This function must be called with the lock of mutex_.
+     */
+    void join_finished_threads() {
+        auto iter = threads_.begin();
+        while (iter != threads_.end()) {
+            if (iter->is_finished->load(std::memory_order_acquire)) {
+                join(iter->thread);
+                iter = threads_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+
+    /*!
+     * \brief Join a thread.
+     *
+     * \param[in] thread Thread.
+     *
+     * \note The last reference to this object can be released in one of the
+     * threads, so the thread is detached instead of joining itself.
+     */
+    static void join(std::thread& thread) noexcept {
+        if (!thread.joinable()) {
+            return;
+        }
+        if (thread.get_id() == std::this_thread::get_id()) {
+            thread.detach();
+            return;
+        }
+        thread.join();
+    }
+
+    //! Mutex of threads_.
+    std::mutex mutex_{};
+
+    //! Threads.
+    std::vector<Thread> threads_{};
+};
+
+}  // namespace msgpack_rpc::methods::impl
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of MethodCache class.
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/methods/method_cache_options.h"
+#include "msgpack_rpc/methods/method_cache_statistics.h"
+#include "msgpack_rpc/util/impl/lru_ttl_cache.h"
+
+namespace msgpack_rpc::methods {
+
+/*!
+ * \brief Class of caches of results of methods in servers.
+ *
+ * Results are stored as serialized data for serialized parameters. Results
+ * are removed when their time to live passes, or in the order of least recent
+ * use when the number of results or the number of bytes exceeds the limit.
+ *
+ * \note Objects of this class are thread-safe, and can be shared to get
+ * statistics while servers use them.
+ */
+class MSGPACK_RPC_EXPORT MethodCache {
+public:
+    //! Type of clocks.
+    using Clock =
+        util::impl::LruTtlCache<std::shared_ptr<const std::string>>::Clock;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] options Options.
+     */
+    explicit MethodCache(
+        const MethodCacheOptions& options = MethodCacheOptions());
+
+    /*!
+     * \brief Find a cached result.
+     *
+     * \param[in] key Serialized parameters.
+     * \param[in] now Current time.
+     * \return Serialized result, or null if no result is cached.
+     *
+     * \note Returned results are shared with this cache without copying.
+     */
+    [[nodiscard]] std::shared_ptr<const std::string> find(
+        std::string_view key, Clock::time_point now);
+
+    /*!
+     * \brief Cache a result.
+     *
+     * \param[in] key Serialized parameters.
+     * \param[in] result Serialized result.
+     * \param[in] now Current time.
+     *
+     * \note Results larger than the maximum number of bytes are not cached.
+     */
+    void insert(std::string key, std::string result, Clock::time_point now);
+
+    /*!
+     * \brief Get the statistics.
+     *
+     * \return Statistics.
+     */
+    [[nodiscard]] MethodCacheStatistics statistics();
+
+    MethodCache(const MethodCache&) = delete;
+    MethodCache(MethodCache&&) = delete;
+    MethodCache& operator=(const MethodCache&) = delete;
+    MethodCache& operator=(MethodCache&&) = delete;
+
+    //! Destructor.
+    ~MethodCache() noexcept;
+
+private:
+    //! Cache.
+    util::impl::LruTtlCache<std::shared_ptr<const std::string>> cache_;
+};
+
+}  // namespace msgpack_rpc::methods
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of MethodCacheOptions class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::methods {
+
+/*!
+ * \brief Class of options of caches of results of methods in servers.
+ */
+class MSGPACK_RPC_EXPORT MethodCacheOptions {
+public:
+    //! Constructor.
+    MethodCacheOptions();
+
+    /*!
+     * \brief Set the maximum number of cached results.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    MethodCacheOptions& max_entries(std::size_t value);
+
+    /*!
+     * \brief Set the maximum number of bytes of cached results.
+     *
+     * \param[in] value Value.
+     * \return This.
+     *
+     * \note Bytes of serialized parameters and results are counted.
+     */
+    MethodCacheOptions& max_bytes(std::size_t value);
+
+    /*!
+     * \brief Set the time to live of cached results.
+     *
+     * \param[in] value Value.
+     * \return This.
+     */
+    MethodCacheOptions& time_to_live(std::chrono::nanoseconds value);
+
+    /*!
+     * \brief Get the maximum number of cached results.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t max_entries() const noexcept;
+
+    /*!
+     * \brief Get the maximum number of bytes of cached results.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::size_t max_bytes() const noexcept;
+
+    /*!
+     * \brief Get the time to live of cached results.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] std::chrono::nanoseconds time_to_live() const noexcept;
+
+private:
+    //! Maximum number of cached results.
+    std::size_t max_entries_;
+
+    //! Maximum number of bytes of cached results.
+    std::size_t max_bytes_;
+
+    //! Time to live of cached results.
+    std::chrono::nanoseconds time_to_live_;
+};
+
+}  // namespace msgpack_rpc::methods
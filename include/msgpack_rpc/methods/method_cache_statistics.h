@@ -0,0 +1,92 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of MethodCacheStatistics class.
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace msgpack_rpc::methods {
+
+/*!
+ * \brief Class of statistics of caches of results of methods in servers.
+ */
+class MethodCacheStatistics {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_hits Number of calls using cached results.
+     * \param[in] num_misses Number of calls without cached results.
+     * \param[in] num_entries Number of cached results.
+     * \param[in] num_bytes Number of bytes of cached results.
+     */
+    MethodCacheStatistics(std::size_t num_hits, std::size_t num_misses,
+        std::size_t num_entries, std::size_t num_bytes) noexcept
+        : num_hits_(num_hits),
+          num_misses_(num_misses),
+          num_entries_(num_entries),
+          num_bytes_(num_bytes) {}
+
+    /*!
+     * \brief Get the number of calls using cached results.
+     *
+     * \return Number of calls.
+     */
+    [[nodiscard]] std::size_t num_hits() const noexcept { return num_hits_; }
+
+    /*!
+     * \brief Get the number of calls without cached results.
+     *
+     * \return Number of calls.
+     */
+    [[nodiscard]] std::size_t num_misses() const noexcept {
+        return num_misses_;
+    }
+
+    /*!
+     * \brief Get the number of cached results.
+     *
+     * \return Number of results.
+     */
+    [[nodiscard]] std::size_t num_entries() const noexcept {
+        return num_entries_;
+    }
+
+    /*!
+     * \brief Get the number of bytes of cached results.
+     *
+     * \return Number of bytes.
+     */
+    [[nodiscard]] std::size_t num_bytes() const noexcept { return num_bytes_; }
+
+private:
+    //! Number of calls using cached results.
+    std::size_t num_hits_;
+
+    //! Number of calls without cached results.
+    std::size_t num_misses_;
+
+    //! Number of cached results.
+    std::size_t num_entries_;
+
+    //! Number of bytes of cached results.
+    std::size_t num_bytes_;
+};
+
+}  // namespace msgpack_rpc::methods
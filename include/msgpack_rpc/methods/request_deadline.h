@@ -0,0 +1,85 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to get deadlines of requests.
+ */
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::methods {
+
+/*!
+ * \brief Get the deadline of the request being processed in this thread.
+ *
+ * \return Deadline if the client propagated it, otherwise std::nullopt.
+ *
+ * \note This function can be used in functions implementing methods.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT std::optional<
+    std::chrono::steady_clock::time_point>
+current_request_deadline() noexcept;
+
+/*!
+ * \brief Get the remaining budget of time of the request being processed in
+ * this thread.
+ *
+ * \return Remaining budget if the client propagated the deadline, otherwise
+ * std::nullopt. Zero is returned after the deadline.
+ *
+ * \note This function can be used in functions implementing methods.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT std::optional<std::chrono::nanoseconds>
+remaining_budget() noexcept;
+
+namespace impl {
+
+/*!
+ * \brief Class to set the deadline of the request being processed in this
+ * thread during the lifetime of objects.
+ */
+class MSGPACK_RPC_EXPORT RequestDeadlineScope {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] deadline Deadline of the request.
+     */
+    explicit RequestDeadlineScope(
+        std::optional<std::chrono::steady_clock::time_point> deadline) noexcept;
+
+    RequestDeadlineScope(const RequestDeadlineScope&) = delete;
+    RequestDeadlineScope(RequestDeadlineScope&&) = delete;
+    RequestDeadlineScope& operator=(const RequestDeadlineScope&) = delete;
+    RequestDeadlineScope& operator=(RequestDeadlineScope&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~RequestDeadlineScope() noexcept;
+
+private:
+    //! Deadline set before this object.
+    std::optional<std::chrono::steady_clock::time_point> previous_deadline_;
+};
+
+}  // namespace impl
+
+}  // namespace msgpack_rpc::methods
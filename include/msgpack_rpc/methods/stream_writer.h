@@ -0,0 +1,159 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of StreamWriter class.
+ */
+#pragma once
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+namespace msgpack_rpc::methods {
+
+namespace impl {
+
+/*!
+ * \brief Interface of senders of chunks of streaming responses.
+ */
+class IStreamChunkSender {
+public:
+    /*!
+     * \brief Send a chunk.
+     *
+     * \param[in] chunk Serialized notification of the chunk.
+     * \retval true The chunk has been queued.
+     * \retval false The connection has been closed.
+     *
+     * \note This function waits while too many messages are queued in the
+     * connection, so this must be called in threads dedicated to streams
+     * (see StreamingMethod class) instead of threads for callbacks.
+     * \note Senders are kept alive by the callbacks of the responses, so
+     * this can be called until the responses are sent.
+     */
+    [[nodiscard]] virtual bool send_stream_chunk(
+        messages::SerializedMessage chunk) = 0;
+
+    IStreamChunkSender(const IStreamChunkSender&) = delete;
+    IStreamChunkSender(IStreamChunkSender&&) = delete;
+    IStreamChunkSender& operator=(const IStreamChunkSender&) = delete;
+    IStreamChunkSender& operator=(IStreamChunkSender&&) = delete;
+
+    //! Destructor.
+    virtual ~IStreamChunkSender() noexcept = default;
+
+protected:
+    //! Constructor.
+    IStreamChunkSender() noexcept = default;
+};
+
+/*!
+ * \brief Get the sender of chunks of the request being processed in this
+ * thread.
+ *
+ * \return Sender, or null outside of processing of requests.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT IStreamChunkSender*
+current_stream_chunk_sender() noexcept;
+
+/*!
+ * \brief Class to set the sender of chunks of the request being processed in
+ * this thread during the lifetime of objects.
+ */
+class MSGPACK_RPC_EXPORT StreamChunkSenderScope {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] sender Sender.
+     */
+    explicit StreamChunkSenderScope(IStreamChunkSender* sender) noexcept;
+
+    StreamChunkSenderScope(const StreamChunkSenderScope&) = delete;
+    StreamChunkSenderScope(StreamChunkSenderScope&&) = delete;
+    StreamChunkSenderScope& operator=(const StreamChunkSenderScope&) = delete;
+    StreamChunkSenderScope& operator=(StreamChunkSenderScope&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~StreamChunkSenderScope() noexcept;
+
+private:
+    //! Sender set before this object.
+    IStreamChunkSender* previous_sender_;
+};
+
+}  // namespace impl
+
+/*!
+ * \brief Class to write chunks of streaming responses.
+ *
+ * \tparam Chunk Type of chunks.
+ *
+ * Objects of this class are passed to functions implementing streaming
+ * methods.
+ */
+template <typename Chunk>
+class StreamWriter {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] sender Sender of chunks.
+     */
+    StreamWriter(
+        messages::MessageID request_id, impl::IStreamChunkSender& sender)
+        : request_id_(request_id), sender_(&sender) {}
+
+    /*!
+     * \brief Write a chunk.
+     *
+     * \param[in] chunk Chunk.
+     *
+     * \throw MsgpackRPCException The connection has been closed.
+     *
+     * \note The chunk is sent as soon as possible. This function waits while
+     * too many messages are queued in the connection, so that chunks are not
+     * produced faster than the client receives them.
+     */
+    void write(const Chunk& chunk) {
+        if (!sender_->send_stream_chunk(
+                messages::MessageSerializer::serialize_notification(
+                    messages::MethodNameView(
+                        messages::STREAM_CHUNK_METHOD_NAME),
+                    request_id_, chunk))) {
+            throw MsgpackRPCException(StatusCode::CONNECTION_FAILURE,
+                "Connection of the stream has been closed.");
+        }
+    }
+
+private:
+    //! Message ID of the request.
+    messages::MessageID request_id_;
+
+    //! Sender of chunks.
+    impl::IStreamChunkSender* sender_;
+};
+
+}  // namespace msgpack_rpc::methods
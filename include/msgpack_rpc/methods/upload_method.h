@@ -0,0 +1,212 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of UploadMethod class.
+ */
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+#include "msgpack_rpc/messages/parsed_request.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/i_method.h"
+#include "msgpack_rpc/methods/impl/call_thread_runner.h"
+#include "msgpack_rpc/methods/method_exception.h"
+#include "msgpack_rpc/methods/upload_reader.h"
+#include "msgpack_rpc/util/format_msgpack_object.h"
+
+namespace msgpack_rpc::methods {
+
+/*!
+ * \brief Class of methods receiving uploads in streams of chunks.
+ *
+ * \tparam Signature Signature of the method.
+ * \tparam Chunk Type of chunks.
+ * \tparam Function Type of the function implementing the method.
+ */
+template <typename Signature, typename Chunk, typename Function>
+class UploadMethod;
+
+/*!
+ * \brief Class of methods receiving uploads in streams of chunks.
+ *
+ * \tparam Function Type of the function implementing the method.
+ * \tparam Chunk Type of chunks.
+ * \tparam Result Type of the result of the method.
+ * \tparam Parameters Types of parameters of the method.
+ *
+ * The function implementing the method receives
+ * `msgpack_rpc::methods::UploadReader<Chunk>&` followed by the parameters,
+ * and reads chunks from the reader while the client sends them.
+ *
+ * When called asynchronously by servers, the function runs in a thread
+ * dedicated to the call, because reading chunks waits for the client to send
+ * them and must not occupy threads for callbacks.
+ */
+template <typename Function, typename Chunk, typename Result,
+    typename... Parameters>
+class UploadMethod<Result(Parameters...), Chunk, Function> final
+    : public IMethod {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \tparam InputFunction Type of the function in the argument.
+     * \param[in] name Method name.
+     * \param[in] function Function implementing the method.
+     * \param[in] logger Logger.
+     */
+    template <typename InputFunction>
+    UploadMethod(messages::MethodName name, InputFunction&& function,
+        std::shared_ptr<logging::Logger> logger)
+        : name_(std::move(name)),
+          function_(std::forward<InputFunction>(function)),
+          logger_(std::move(logger)) {}
+
+    //! \copydoc msgpack_rpc::methods::IMethod::name
+    [[nodiscard]] messages::MethodNameView name() const noexcept override {
+        return name_;
+    }
+
+    //! \copydoc msgpack_rpc::methods::IMethod::call
+    [[nodiscard]] messages::SerializedMessage call(
+        const messages::ParsedRequest& request) override {
+        auto* source = impl::current_upload_chunk_source();
+        if (source == nullptr) {
+            MSGPACK_RPC_DEBUG(
+                logger_, "Method {} was called without an upload.", name_);
+            return messages::MessageSerializer::serialize_error_response(
+                request.id(), "Uploads are not supported in this context.");
+        }
+
+        try {
+            UploadReader<Chunk> reader{request.id(), *source};
+            const auto invoke = [this, &reader](auto&&... parameters) {
+                return function_(
+                    reader, std::forward<decltype(parameters)>(parameters)...);
+            };
+            auto parameters =
+                request.parameters().as<std::decay_t<Parameters>...>();
+            if constexpr (std::is_void_v<Result>) {
+                std::apply(invoke, std::move(parameters));
+                return messages::MessageSerializer::
+                    serialize_successful_response(
+                        request.id(), msgpack::type::nil_t());
+            } else {
+                return messages::MessageSerializer::
+                    serialize_successful_response(request.id(),
+                        std::apply(invoke, std::move(parameters)));
+            }
+        } catch (const MethodException& e) {
+            MSGPACK_RPC_DEBUG(logger_,
+                "Method {} threw an exception with a custom object: {}", name_,
+                util::format_msgpack_object(e.object()));
+            return messages::MessageSerializer::serialize_error_response(
+                request.id(), e.object());
+        } catch (const std::exception& e) {
+            MSGPACK_RPC_DEBUG(
+                logger_, "Method {} threw an exception: {}", name_, e.what());
+            return messages::MessageSerializer::serialize_error_response(
+                request.id(), e.what());
+        }
+    }
+
+    //! \copydoc msgpack_rpc::methods::IMethod::async_call
+    void async_call(const messages::ParsedRequest& request,
+        const ResponseCallback& on_response) override {
+        if (impl::current_upload_chunk_source() == nullptr) {
+            on_response(call(request));
+            return;
+        }
+
+        try {
+            runner_.run([this, request, on_response] {
+                on_response(call(request));
+            });
+        } catch (const std::system_error& e) {
+            MSGPACK_RPC_ERROR(logger_,
+                "Failed to create a thread for method {}: {}", name_,
+                e.what());
+            on_response(messages::MessageSerializer::serialize_error_response(
+                request.id(), "Failed to create a thread for the upload."));
+        }
+    }
+
+    /*!
+     * \brief Notify this method.
+     *
+     * \param[in] notification Notification.
+     *
+     * \note Uploads require requests, so notifications are ignored.
+     */
+    void notify(const messages::ParsedNotification& notification) override {
+        (void)notification;
+        MSGPACK_RPC_DEBUG(
+            logger_, "Upload method {} was notified, but ignored.", name_);
+    }
+
+private:
+    //! Method name.
+    messages::MethodName name_;
+
+    //! Function.
+    std::decay_t<Function> function_;
+
+    //! Logger.
+    std::shared_ptr<logging::Logger> logger_;
+
+    //! Runner of calls in dedicated threads. (Declared last to wait for the
+    //! calls before destroying other members.)
+    impl::CallThreadRunner runner_{};
+};
+
+/*!
+ * \brief Create a method receiving uploads in streams of chunks.
+ *
+ * \tparam Signature Signature of the method (`Result(Parameters...)`).
+ * \tparam Chunk Type of chunks.
+ * \tparam Function Type of the function implementing the method.
+ * \param[in] name Name of the method.
+ * \param[in] function Function implementing the method.
+ * \param[in] logger Logger.
+ * \return Method.
+ */
+template <typename Signature, typename Chunk, typename Function>
+[[nodiscard]] inline std::unique_ptr<
+    UploadMethod<Signature, Chunk, std::decay_t<Function>>>
+create_upload_method(
+    // NOLINTNEXTLINE(performance-unnecessary-value-param) : false positive
+    messages::MethodName name, Function&& function,
+    std::shared_ptr<logging::Logger> logger) {
+    return std::make_unique<
+        UploadMethod<Signature, Chunk, std::decay_t<Function>>>(
+        std::move(name), std::forward<Function>(function), std::move(logger));
+}
+
+}  // namespace msgpack_rpc::methods
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of UploadReader class.
+ */
+#pragma once
+
+#include <optional>
+#include <tuple>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/parsed_parameters.h"
+
+namespace msgpack_rpc::methods {
+
+namespace impl {
+
+/*!
+ * \brief Interface of sources of chunks of uploads.
+ */
+class IUploadChunkSource {
+public:
+    /*!
+     * \brief Get the next chunk of an upload.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \return Parameters of the notification of the chunk, or std::nullopt if
+     * the upload has ended.
+     *
+     * \throw MsgpackRPCException The connection has been closed.
+     *
+     * \note This function waits until the next chunk is received, so this
+     * must be called in threads dedicated to uploads (see UploadMethod class)
+     * instead of threads for callbacks.
+     */
+    [[nodiscard]] virtual std::optional<messages::ParsedParameters>
+    next_upload_chunk(messages::MessageID request_id) = 0;
+
+    IUploadChunkSource(const IUploadChunkSource&) = delete;
+    IUploadChunkSource(IUploadChunkSource&&) = delete;
+    IUploadChunkSource& operator=(const IUploadChunkSource&) = delete;
+    IUploadChunkSource& operator=(IUploadChunkSource&&) = delete;
+
+    //! Destructor.
+    virtual ~IUploadChunkSource() noexcept = default;
+
+protected:
+    //! Constructor.
+    IUploadChunkSource() noexcept = default;
+};
+
+/*!
+ * \brief Get the source of chunks of the request being processed in this
+ * thread.
+ *
+ * \return Source, or null outside of processing of requests.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT IUploadChunkSource*
+current_upload_chunk_source() noexcept;
+
+/*!
+ * \brief Class to set the source of chunks of the request being processed in
+ * this thread during the lifetime of objects.
+ */
+class MSGPACK_RPC_EXPORT UploadChunkSourceScope {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] source Source.
+     */
+    explicit UploadChunkSourceScope(IUploadChunkSource* source) noexcept;
+
+    UploadChunkSourceScope(const UploadChunkSourceScope&) = delete;
+    UploadChunkSourceScope(UploadChunkSourceScope&&) = delete;
+    UploadChunkSourceScope& operator=(const UploadChunkSourceScope&) = delete;
+    UploadChunkSourceScope& operator=(UploadChunkSourceScope&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~UploadChunkSourceScope() noexcept;
+
+private:
+    //! Source set before this object.
+    IUploadChunkSource* previous_source_;
+};
+
+}  // namespace impl
+
+/*!
+ * \brief Class to read chunks of uploads.
+ *
+ * \tparam Chunk Type of chunks.
+ *
+ * Objects of this class are passed to functions implementing upload methods.
+ */
+template <typename Chunk>
+class UploadReader {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] source Source of chunks.
+     */
+    UploadReader(
+        messages::MessageID request_id, impl::IUploadChunkSource& source)
+        : request_id_(request_id), source_(&source) {}
+
+    /*!
+     * \brief Read the next chunk.
+     *
+     * \return Chunk, or std::nullopt if the upload has ended.
+     *
+     * \throw MsgpackRPCException The connection has been closed or the chunk
+     * is invalid.
+     *
+     * \note This function waits until the next chunk is received. Each read
+     * chunk allows the client to send another chunk.
+     */
+    [[nodiscard]] std::optional<Chunk> next() {
+        const auto parameters = source_->next_upload_chunk(request_id_);
+        if (!parameters) {
+            return std::nullopt;
+        }
+        return std::get<1>(parameters->as<messages::MessageID, Chunk>());
+    }
+
+private:
+    //! Message ID of the request.
+    messages::MessageID request_id_;
+
+    //! Source of chunks.
+    impl::IUploadChunkSource* source_;
+};
+
+}  // namespace msgpack_rpc::methods
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of IDs of connections in servers.
+ */
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+
+namespace msgpack_rpc::servers {
+
+//! Type of IDs of connections in servers.
+using ConnectionID = std::uint64_t;
+
+/*!
+ * \brief Get the ID of the connection from which the request or notification
+ * being processed in this thread was received.
+ *
+ * \return ID of the connection if a request or notification is being
+ * processed, otherwise std::nullopt.
+ *
+ * \note This function can be used in functions implementing methods to send
+ * notifications to the client later using
+ * msgpack_rpc::servers::Server::notify function.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT std::optional<ConnectionID>
+current_connection_id() noexcept;
+
+namespace impl {
+
+/*!
+ * \brief Class to set the ID of the connection of the message being processed
+ * in this thread during the lifetime of objects.
+ */
+class MSGPACK_RPC_EXPORT ConnectionIDScope {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] id ID of the connection.
+     */
+    explicit ConnectionIDScope(ConnectionID id) noexcept;
+
+    ConnectionIDScope(const ConnectionIDScope&) = delete;
+    ConnectionIDScope(ConnectionIDScope&&) = delete;
+    ConnectionIDScope& operator=(const ConnectionIDScope&) = delete;
+    ConnectionIDScope& operator=(ConnectionIDScope&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~ConnectionIDScope() noexcept;
+
+private:
+    //! ID set before this object.
+    std::optional<ConnectionID> previous_id_;
+};
+
+}  // namespace impl
+
+}  // namespace msgpack_rpc::servers
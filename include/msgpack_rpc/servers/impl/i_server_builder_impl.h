@@ -24,6 +24,7 @@
 #include "msgpack_rpc/addresses/uri.h"
 #include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/executors/i_async_executor.h"
+#include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/impl/msgpack_rpc_export.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/methods/i_method.h"
@@ -73,6 +74,13 @@ public:
      */
     [[nodiscard]] virtual std::shared_ptr<logging::Logger> logger() = 0;
 
+    /*!
+     * \brief Get the executor in this builder.
+     *
+     * \return Executor.
+     */
+    [[nodiscard]] virtual std::shared_ptr<executors::IExecutor> executor() = 0;
+
     IServerBuilderImpl(const IServerBuilderImpl&) = delete;
     IServerBuilderImpl(IServerBuilderImpl&&) = delete;
     IServerBuilderImpl& operator=(const IServerBuilderImpl&) = delete;
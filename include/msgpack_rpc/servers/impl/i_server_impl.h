@@ -19,11 +19,18 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
 #include "msgpack_rpc/executors/i_executor.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/servers/connection_id.h"
 
 namespace msgpack_rpc::servers::impl {
 
@@ -51,6 +58,49 @@ public:
      */
     [[nodiscard]] virtual std::vector<addresses::URI> local_endpoint_uris() = 0;
 
+    /*!
+     * \brief Send a notification to a client.
+     *
+     * \param[in] connection_id ID of the connection of the client.
+     * \param[in] notification Serialized notification.
+     * \retval true The notification is queued to be sent.
+     * \retval false The connection was not found.
+     */
+    virtual bool notify(ConnectionID connection_id,
+        const messages::SerializedMessage& notification) = 0;
+
+    /*!
+     * \brief Send a notification to all clients.
+     *
+     * \param[in] notification Serialized notification.
+     * \return Number of connections to which the notification is queued.
+     */
+    virtual std::size_t notify_all(
+        const messages::SerializedMessage& notification) = 0;
+
+    /*!
+     * \brief Asynchronously call a method in a client.
+     *
+     * \param[in] connection_id ID of the connection of the client.
+     * \param[in] method_name Name of the method.
+     * \param[in] parameters Parameters.
+     * \return Future object to get the result.
+     */
+    [[nodiscard]] virtual std::shared_ptr<clients::impl::ICallFutureImpl>
+    async_call(ConnectionID connection_id,
+        messages::MethodNameView method_name,
+        const clients::impl::IParametersSerializer& parameters) = 0;
+
+    /*!
+     * \brief Send a notification to clients subscribing a topic.
+     *
+     * \param[in] topic Topic.
+     * \param[in] notification Serialized notification.
+     * \return Number of connections to which the notification is queued.
+     */
+    virtual std::size_t publish(const std::string& topic,
+        const messages::SerializedMessage& notification) = 0;
+
     /*!
      * \brief Get the executor.
      *
@@ -19,12 +19,20 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/clients/call_future.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
 #include "msgpack_rpc/executors/i_executor.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/servers/connection_id.h"
 #include "msgpack_rpc/servers/impl/i_server_impl.h"
 
 namespace msgpack_rpc::servers {
@@ -71,6 +79,119 @@ public:
         return impl_->local_endpoint_uris();
     }
 
+    /*!
+     * \brief Send a notification to a client.
+     *
+     * \tparam Parameters Types of parameters.
+     * \param[in] connection_id ID of the connection of the client. IDs can be
+     * obtained using msgpack_rpc::servers::current_connection_id function in
+     * methods.
+     * \param[in] method_name Name of the method in the client.
+     * \param[in] parameters Parameters.
+     * \retval true The notification is queued to be sent.
+     * \retval false The connection was not found (for example, because it
+     * has been closed).
+     */
+    template <typename... Parameters>
+    bool notify(ConnectionID connection_id,
+        messages::MethodNameView method_name,
+        const Parameters&... parameters) {
+        return impl_->notify(connection_id,
+            messages::MessageSerializer::serialize_notification(
+                method_name, parameters...));
+    }
+
+    /*!
+     * \brief Asynchronously call a method in a client.
+     *
+     * Methods in clients are added using
+     * msgpack_rpc::clients::ClientBuilder::add_method, and called over the
+     * connections from the clients. The timeout of the call is configured by
+     * msgpack_rpc::config::ServerConfig::call_timeout.
+     *
+     * \tparam Result Type of the result.
+     * \tparam Parameters Types of parameters.
+     * \param[in] connection_id ID of the connection of the client. IDs can be
+     * obtained using msgpack_rpc::servers::current_connection_id function in
+     * methods.
+     * \param[in] method_name Name of the method in the client.
+     * \param[in] parameters Parameters.
+     * \return Future object to get the result.
+     *
+     * \throw MsgpackRPCException The connection was not found.
+     */
+    template <typename Result, typename... Parameters>
+    [[nodiscard]] clients::CallFuture<std::decay_t<Result>> async_call(
+        ConnectionID connection_id, messages::MethodNameView method_name,
+        const Parameters&... parameters) {
+        return clients::CallFuture<std::decay_t<Result>>{
+            impl_->async_call(connection_id, method_name,
+                clients::impl::make_parameters_serializer(parameters...))};
+    }
+
+    /*!
+     * \brief Synchronously call a method in a client.
+     *
+     * \tparam Result Type of the result.
+     * \tparam Parameters Types of parameters.
+     * \param[in] connection_id ID of the connection of the client.
+     * \param[in] method_name Name of the method in the client.
+     * \param[in] parameters Parameters.
+     * \return Result.
+     *
+     * \throw MsgpackRPCException The connection was not found, or the call
+     * failed.
+     */
+    template <typename Result, typename... Parameters>
+    std::decay_t<Result> call(ConnectionID connection_id,
+        messages::MethodNameView method_name,
+        const Parameters&... parameters) {
+        return async_call<Result>(connection_id, method_name, parameters...)
+            .get_result();
+    }
+
+    /*!
+     * \brief Send a notification to all clients.
+     *
+     * \tparam Parameters Types of parameters.
+     * \param[in] method_name Name of the method in the clients.
+     * \param[in] parameters Parameters.
+     * \return Number of connections to which the notification is queued.
+     *
+     * \note The notification is serialized only once and shared by all
+     * connections.
+     */
+    template <typename... Parameters>
+    std::size_t notify_all(
+        messages::MethodNameView method_name, const Parameters&... parameters) {
+        return impl_->notify_all(
+            messages::MessageSerializer::serialize_notification(
+                method_name, parameters...));
+    }
+
+    /*!
+     * \brief Publish a message to clients subscribing a topic.
+     *
+     * Clients subscribe to topics using
+     * msgpack_rpc::clients::Client::subscribe, and receive messages as
+     * notifications whose method name is the name of the topic.
+     *
+     * \tparam Parameters Types of parameters.
+     * \param[in] topic Topic.
+     * \param[in] parameters Parameters.
+     * \return Number of connections to which the notification is queued.
+     *
+     * \note The notification is serialized only once and shared by all
+     * subscribers.
+     */
+    template <typename... Parameters>
+    std::size_t publish(
+        const std::string& topic, const Parameters&... parameters) {
+        return impl_->publish(topic,
+            messages::MessageSerializer::serialize_notification(
+                topic, parameters...));
+    }
+
     /*!
      * \brief Get the executor.
      *
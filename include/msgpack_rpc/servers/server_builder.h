@@ -30,8 +30,14 @@
 #include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/methods/batch_method.h"
+#include "msgpack_rpc/methods/batch_method_options.h"
+#include "msgpack_rpc/methods/cached_method.h"
 #include "msgpack_rpc/methods/functional_method.h"
 #include "msgpack_rpc/methods/i_method.h"
+#include "msgpack_rpc/methods/method_cache.h"
+#include "msgpack_rpc/methods/streaming_method.h"
+#include "msgpack_rpc/methods/upload_method.h"
 #include "msgpack_rpc/servers/impl/i_server_builder_impl.h"
 #include "msgpack_rpc/servers/server.h"
 
@@ -131,6 +137,10 @@ public:
      * \note The function can throw exceptions using
      * msgpack_rpc::methods::MethodException class to notify errors using any
      * serializable objects.
+     * \note Parameters of types std::string_view and
+     * msgpack_rpc::messages::BinaryView in the signature refer to the data in
+     * requests without copying. They are valid only during the call of the
+     * function, and can be returned as results.
      */
     template <typename Signature, typename Function>
     ServerBuilder& add_method(messages::MethodName name, Function&& function) {
@@ -139,6 +149,109 @@ public:
                 std::forward<Function>(function), impl_->logger()));
     }
 
+    /*!
+     * \brief Add a method implemented by a function object with a cache of
+     * results.
+     *
+     * \tparam Signature Signature of the method.
+     * \tparam Function Type of the function implementing the method.
+     * \param[in] name Name of the method.
+     * \param[in] function Function implementing the method.
+     * \param[in] cache Cache of results. Statistics can be retrieved from this
+     * object.
+     * \return This.
+     *
+     * \note Results of successful calls are cached for parameters, and calls
+     * with the same parameters return the cached results without calling the
+     * function. Use this overload only for functions returning the same
+     * results for the same parameters without side effects.
+     */
+    template <typename Signature, typename Function>
+    ServerBuilder& add_method(messages::MethodName name, Function&& function,
+        std::shared_ptr<methods::MethodCache> cache) {
+        return add_method(methods::create_cached_method(
+            methods::create_functional_method<Signature>(std::move(name),
+                std::forward<Function>(function), impl_->logger()),
+            std::move(cache)));
+    }
+
+    /*!
+     * \brief Add a method processing requests in batches.
+     *
+     * \tparam Signature Signature of the method for each request.
+     * \tparam Function Type of the function implementing the method.
+     * \param[in] name Name of the method.
+     * \param[in] function Function implementing the method. This function
+     * receives parameters of requests as
+     * `const std::vector<std::tuple<Parameters...>>&` and returns
+     * `std::vector<Result>` with results in the same order.
+     * \param[in] options Options of batches.
+     * \return This.
+     *
+     * \note Batch methods are useful when processing many requests at once is
+     * cheaper than processing them one by one (for example, one query of a
+     * database for many keys).
+     */
+    template <typename Signature, typename Function>
+    ServerBuilder& add_batch_method(messages::MethodName name,
+        Function&& function,
+        const methods::BatchMethodOptions& options =
+            methods::BatchMethodOptions()) {
+        return add_method(methods::create_batch_method<Signature>(
+            std::move(name), std::forward<Function>(function), options,
+            impl_->logger(), impl_->executor()));
+    }
+
+    /*!
+     * \brief Add a method sending results in streams of chunks.
+     *
+     * \tparam Signature Signature of the method (`Chunk(Parameters...)`).
+     * \tparam Function Type of the function implementing the method.
+     * \param[in] name Name of the method.
+     * \param[in] function Function implementing the method. This function
+     * receives `msgpack_rpc::methods::StreamWriter<Chunk>&` followed by the
+     * parameters, and writes chunks to the writer.
+     * \return This.
+     *
+     * \note Streaming methods are useful for large or incremental results,
+     * because chunks are sent as soon as they are written instead of
+     * serializing the whole result at once. Clients receive chunks using
+     * msgpack_rpc::clients::Client::call_stream function.
+     */
+    template <typename Signature, typename Function>
+    ServerBuilder& add_streaming_method(
+        messages::MethodName name, Function&& function) {
+        return add_method(methods::create_streaming_method<Signature>(
+            std::move(name), std::forward<Function>(function),
+            impl_->logger()));
+    }
+
+    /*!
+     * \brief Add a method receiving uploads in streams of chunks.
+     *
+     * \tparam Signature Signature of the method (`Result(Parameters...)`).
+     * \tparam Chunk Type of chunks.
+     * \tparam Function Type of the function implementing the method.
+     * \param[in] name Name of the method.
+     * \param[in] function Function implementing the method. This function
+     * receives `msgpack_rpc::methods::UploadReader<Chunk>&` followed by the
+     * parameters, and reads chunks from the reader.
+     * \return This.
+     *
+     * \note Upload methods are useful for large inputs, because chunks are
+     * processed while the client sends them instead of receiving the whole
+     * input at once. Clients send chunks using
+     * msgpack_rpc::clients::Client::async_call_upload function.
+     * \note A thread for callbacks is blocked while waiting for chunks.
+     */
+    template <typename Signature, typename Chunk, typename Function>
+    ServerBuilder& add_upload_method(
+        messages::MethodName name, Function&& function) {
+        return add_method(methods::create_upload_method<Signature, Chunk>(
+            std::move(name), std::forward<Function>(function),
+            impl_->logger()));
+    }
+
     /*!
      * \brief Build a server.
      *
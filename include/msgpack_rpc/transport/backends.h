@@ -22,11 +22,14 @@
 #include <memory>
 
 #include "msgpack_rpc/config.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/socket_config.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/impl/msgpack_rpc_export.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/transport/i_backend.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport {
 
@@ -36,12 +39,20 @@ namespace msgpack_rpc::transport {
  * \param[in] executor Executor.
  * \param[in] message_parser_config Configuration of parsers of messages.
  * \param[in] logger Logger.
+ * \param[in] socket_config Configuration of socket options.
+ * \param[in] compression_config Configuration of compression of messages.
+ * \param[in] traffic_capture Object to capture traffic. (Null to disable
+ * capture.)
  * \return Backend.
  */
 [[nodiscard]] MSGPACK_RPC_EXPORT std::shared_ptr<IBackend> create_tcp_backend(
     const std::shared_ptr<executors::IExecutor>& executor,
     const config::MessageParserConfig& message_parser_config,
-    std::shared_ptr<logging::Logger> logger);
+    std::shared_ptr<logging::Logger> logger,
+    const config::SocketConfig& socket_config = config::SocketConfig(),
+    const config::CompressionConfig& compression_config =
+        config::CompressionConfig(),
+    std::shared_ptr<TrafficCapture> traffic_capture = nullptr);
 
 #if MSGPACK_RPC_HAS_UNIX_SOCKETS
 
@@ -51,13 +62,16 @@ namespace msgpack_rpc::transport {
  * \param[in] executor Executor.
  * \param[in] message_parser_config Configuration of parsers of messages.
  * \param[in] logger Logger.
+ * \param[in] traffic_capture Object to capture traffic. (Null to disable
+ * capture.)
  * \return Backend.
  */
 [[nodiscard]] MSGPACK_RPC_EXPORT std::shared_ptr<IBackend>
 create_unix_socket_backend(
     const std::shared_ptr<executors::IExecutor>& executor,
     const config::MessageParserConfig& message_parser_config,
-    std::shared_ptr<logging::Logger> logger);
+    std::shared_ptr<logging::Logger> logger,
+    std::shared_ptr<TrafficCapture> traffic_capture = nullptr);
 
 #endif
 
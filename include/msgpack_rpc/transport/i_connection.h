@@ -24,6 +24,7 @@
 #include "msgpack_rpc/addresses/i_address.h"
 #include "msgpack_rpc/common/status.h"
 #include "msgpack_rpc/messages/parsed_message.h"
+#include "msgpack_rpc/messages/raw_message.h"
 #include "msgpack_rpc/messages/serialized_message.h"
 
 namespace msgpack_rpc::transport {
@@ -43,6 +44,17 @@ public:
     using MessageReceivedCallback =
         std::function<void(messages::ParsedMessage)>;
 
+    /*!
+     * \brief Type of callback functions called when a message is received
+     * without decoding parameters and results.
+     *
+     * Parameters:
+     *
+     * 1. Received message.
+     */
+    using RawMessageReceivedCallback =
+        std::function<void(messages::RawMessage)>;
+
     /*!
      * \brief Type of callback functions called when a message is successfully
      * sent.
@@ -71,6 +83,24 @@ public:
     virtual void start(MessageReceivedCallback on_received,
         MessageSentCallback on_sent, ConnectionClosedCallback on_closed) = 0;
 
+    /*!
+     * \brief Start process of this connection receiving messages without
+     * decoding parameters and results.
+     *
+     * \param[in] on_received Callback function called when a message is
+     * received.
+     * \param[in] on_sent Callback function called when a message is
+     * sent.
+     * \param[in] on_closed Callback function called when this connection is
+     * closed.
+     *
+     * \note Either this function or start function can be called only once.
+     * \note Compression of messages is disabled in connections started by this
+     * function.
+     */
+    virtual void start_raw(RawMessageReceivedCallback on_received,
+        MessageSentCallback on_sent, ConnectionClosedCallback on_closed) = 0;
+
     /*!
      * \brief Asynchronously send a message.
      *
@@ -83,6 +113,19 @@ public:
      */
     virtual void async_close() = 0;
 
+    /*!
+     * \brief Pause reading data from this connection.
+     *
+     * Reading stops after the data being processed, so that the flow control
+     * of the underlying protocol can push back peers.
+     */
+    virtual void pause_reading() = 0;
+
+    /*!
+     * \brief Resume reading data from this connection.
+     */
+    virtual void resume_reading() = 0;
+
     /*!
      * \brief Get the address of the local endpoint.
      *
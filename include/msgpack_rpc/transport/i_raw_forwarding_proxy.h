@@ -0,0 +1,96 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of IRawForwardingProxy class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/transport/i_connection.h"
+
+namespace msgpack_rpc::transport {
+
+/*!
+ * \brief Interface of proxies forwarding messages between connections without
+ * decoding parameters and results.
+ *
+ * Proxies receive requests and notifications from downstream connections
+ * (connections to clients), and forward them to upstream connections
+ * (connections to servers) selected by the method names. Only headers of
+ * messages are parsed, and message IDs are rewritten so that requests from
+ * different downstream connections don't conflict in the upstream
+ * connections. Parameters and results are forwarded as received.
+ *
+ * \note Notifications without message IDs from upstream connections (e.g.
+ * messages published to topics) cannot be routed, and are dropped.
+ * \note Connections are not reconnected. Requests forwarded to closed upstream
+ * connections fail with StatusCode::CONNECTION_FAILURE.
+ * \note Requests without responses within the timeout of requests fail with
+ * StatusCode::TIMEOUT, and are cancelled in the upstream connections.
+ * Timeouts are checked when later requests are forwarded.
+ * \note When a queue of messages sent to a connection exceeds a high watermark
+ * of flow control, reading from the connections sending messages to the queue
+ * is paused until the queue is drained.
+ */
+class IRawForwardingProxy {
+public:
+    /*!
+     * \brief Type of functions to select upstream connections.
+     *
+     * Parameters:
+     *
+     * 1. Method name.
+     *
+     * Return value: Index of the upstream connection.
+     */
+    using Router = std::function<std::size_t(messages::MethodNameView)>;
+
+    /*!
+     * \brief Start processing of upstream connections.
+     */
+    virtual void start() = 0;
+
+    /*!
+     * \brief Add a downstream connection and start processing of it.
+     *
+     * \param[in] connection Connection. (Must not be started yet.)
+     */
+    virtual void add_downstream(std::shared_ptr<IConnection> connection) = 0;
+
+    /*!
+     * \brief Stop processing and close all connections.
+     */
+    virtual void stop() = 0;
+
+    IRawForwardingProxy(const IRawForwardingProxy&) = delete;
+    IRawForwardingProxy(IRawForwardingProxy&&) = delete;
+    IRawForwardingProxy& operator=(const IRawForwardingProxy&) = delete;
+    IRawForwardingProxy& operator=(IRawForwardingProxy&&) = delete;
+
+    //! Destructor.
+    virtual ~IRawForwardingProxy() noexcept = default;
+
+protected:
+    //! Constructor.
+    IRawForwardingProxy() noexcept = default;
+};
+
+}  // namespace msgpack_rpc::transport
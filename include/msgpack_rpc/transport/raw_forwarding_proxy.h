@@ -0,0 +1,55 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions for proxies forwarding messages without
+ * decoding parameters and results.
+ */
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "msgpack_rpc/config/flow_control_config.h"
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/transport/i_connection.h"
+#include "msgpack_rpc/transport/i_raw_forwarding_proxy.h"
+
+namespace msgpack_rpc::transport {
+
+/*!
+ * \brief Create a proxy forwarding messages without decoding parameters and
+ * results.
+ *
+ * \param[in] upstreams Upstream connections. (Must not be started yet.)
+ * \param[in] router Function to select upstream connections.
+ * \param[in] request_timeout Timeout of requests forwarded to upstream
+ * connections.
+ * \param[in] flow_control_config Configuration of flow control of queues of
+ * messages sent to connections.
+ * \param[in] logger Logger.
+ * \return Proxy.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT std::shared_ptr<IRawForwardingProxy>
+create_raw_forwarding_proxy(std::vector<std::shared_ptr<IConnection>> upstreams,
+    IRawForwardingProxy::Router router,
+    std::chrono::nanoseconds request_timeout,
+    const config::FlowControlConfig& flow_control_config,
+    std::shared_ptr<logging::Logger> logger);
+
+}  // namespace msgpack_rpc::transport
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of classes to capture traffic.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "msgpack_rpc/config/traffic_capture_config.h"
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+namespace msgpack_rpc::transport {
+
+/*!
+ * \brief Enumeration of directions of captured messages.
+ */
+enum class TrafficDirection : std::uint8_t {
+    //! Message received from the peer.
+    INBOUND = 0,
+
+    //! Message sent to the peer.
+    OUTBOUND = 1
+};
+
+/*!
+ * \brief Struct of messages read from files of captured traffic.
+ */
+struct CapturedMessage {
+    //! Time when the message was captured since the start of the capture.
+    std::chrono::nanoseconds timestamp;
+
+    //! ID of the connection.
+    std::uint32_t connection_id;
+
+    //! Direction.
+    TrafficDirection direction;
+
+    //! Data of the message.
+    std::vector<char> data;
+};
+
+/*!
+ * \brief Class to write messages sent and received by connections to a file.
+ *
+ * The file starts with 8 bytes `MPRPCCAP` and a version in 4 bytes, followed
+ * by records of messages in the order of capture. Each record has
+ * the following fields, with integers in little endian:
+ *
+ * 1. Timestamp in nanoseconds since the start of the capture, measured by the
+ *    steady clock (8 bytes).
+ * 2. ID of the connection (4 bytes).
+ * 3. Direction (1 byte, see TrafficDirection).
+ * 4. Size of the message (4 bytes).
+ * 5. Data of the message.
+ *
+ * Compressed messages received are recorded after decompression, so that
+ * replays don't depend on compression.
+ *
+ * \note IDs of connections are unique only in an object of this class, so an
+ * object of this class overwrites the file, and objects in a process cannot
+ * use the same file at once. Capture traffic of different processes to
+ * different files too.
+ * \note This class is thread-safe.
+ */
+class MSGPACK_RPC_EXPORT TrafficCapture {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] file_path Path of the file. The file is overwritten if
+     * exists.
+     *
+     * \note This function throws an exception with
+     * StatusCode::INVALID_ARGUMENT if another object in this process uses the
+     * same file.
+     */
+    explicit TrafficCapture(std::string_view file_path);
+
+    TrafficCapture(const TrafficCapture&) = delete;
+    TrafficCapture(TrafficCapture&&) = delete;
+    TrafficCapture& operator=(const TrafficCapture&) = delete;
+    TrafficCapture& operator=(TrafficCapture&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~TrafficCapture() noexcept;
+
+    /*!
+     * \brief Register a connection.
+     *
+     * \return ID of the connection.
+     */
+    [[nodiscard]] std::uint32_t register_connection() noexcept;
+
+    /*!
+     * \brief Record a message.
+     *
+     * \param[in] connection_id ID of the connection.
+     * \param[in] direction Direction.
+     * \param[in] data Pointer to the data of the message.
+     * \param[in] size Size of the data of the message.
+     *
+     * \note Messages larger than the limit of the format (4 GiB) are ignored.
+     */
+    void record(std::uint32_t connection_id, TrafficDirection direction,
+        const char* data, std::size_t size);
+
+    /*!
+     * \brief Record a message.
+     *
+     * \param[in] connection_id ID of the connection.
+     * \param[in] direction Direction.
+     * \param[in] message Message.
+     *
+     * \note Messages larger than the limit of the format (4 GiB) are ignored.
+     */
+    void record(std::uint32_t connection_id, TrafficDirection direction,
+        const messages::SerializedMessage& message);
+
+    /*!
+     * \brief Flush records to the file.
+     */
+    void flush();
+
+private:
+    /*!
+     * \brief Write the header of a record.
+     *
+     * \param[in] connection_id ID of the connection.
+     * \param[in] direction Direction.
+     * \param[in] size Size of the data of the message.
+     *
+     * \note The mutex must be locked when calling this function.
+     */
+    void write_record_header(std::uint32_t connection_id,
+        TrafficDirection direction, std::uint32_t size);
+
+    //! Normalized path of the file.
+    std::string normalized_path_;
+
+    //! Mutex of the file.
+    std::mutex mutex_;
+
+    //! File.
+    std::ofstream file_;
+
+    //! Next ID of connections.
+    std::atomic<std::uint32_t> next_connection_id_;
+
+    //! Time when the capture started.
+    std::chrono::steady_clock::time_point start_time_;
+};
+
+/*!
+ * \brief Class to read messages written by TrafficCapture class.
+ */
+class MSGPACK_RPC_EXPORT TrafficCaptureReader {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] file_path Path of the file.
+     */
+    explicit TrafficCaptureReader(std::string_view file_path);
+
+    /*!
+     * \brief Read the next message.
+     *
+     * \return Message if exists. Null at the end of the file.
+     *
+     * \note A record truncated by a crash of the capturing process is treated
+     * as the end of the file.
+     */
+    [[nodiscard]] std::optional<CapturedMessage> next();
+
+private:
+    //! File.
+    std::ifstream file_;
+};
+
+/*!
+ * \brief Create an object to capture traffic.
+ *
+ * \param[in] config Configuration.
+ * \return Object to capture traffic. Null if capture is disabled.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT std::shared_ptr<TrafficCapture>
+create_traffic_capture(const config::TrafficCaptureConfig& config);
+
+}  // namespace msgpack_rpc::transport
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of LruTtlCache class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace msgpack_rpc::util::impl {
+
+/*!
+ * \brief Class of caches removing values when their time to live passes, or in
+ * the order of least recent use when the number of values or the number of
+ * bytes exceeds the limit.
+ *
+ * \tparam Value Type of values. Values are copied in find function, so types
+ * cheap to copy (e.g., std::shared_ptr) should be used.
+ *
+ * \note Objects of this class are thread-safe.
+ */
+template <typename Value>
+class LruTtlCache {
+public:
+    //! Type of clocks.
+    using Clock = std::chrono::steady_clock;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] time_to_live Time to live of values.
+     * \param[in] max_entries Maximum number of values.
+     * \param[in] max_bytes Maximum number of bytes of keys and values.
+     */
+    LruTtlCache(std::chrono::nanoseconds time_to_live, std::size_t max_entries,
+        std::size_t max_bytes) noexcept
+        : time_to_live_(time_to_live),
+          max_entries_(max_entries),
+          max_bytes_(max_bytes) {}
+
+    /*!
+     * \brief Find a value.
+     *
+     * \param[in] key Key.
+     * \param[in] now Current time.
+     * \return Value, or std::nullopt if no value is cached.
+     */
+    [[nodiscard]] std::optional<Value> find(
+        std::string_view key, Clock::time_point now) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = index_.find(key);
+        if (iter == index_.end()) {
+            ++num_misses_;
+            return std::nullopt;
+        }
+        const auto entry = iter->second;
+        if (entry->expiry <= now) {
+            erase_entry(entry);
+            ++num_misses_;
+            return std::nullopt;
+        }
+        entries_.splice(entries_.begin(), entries_, entry);
+        ++num_hits_;
+        return entry->value;
+    }
+
+    /*!
+     * \brief Check whether a value can be cached.
+     *
+     * \param[in] key Key.
+     * \param[in] value_bytes Number of bytes of the value.
+     * \retval true The value can be cached.
+     * \retval false The value is larger than the maximum number of bytes.
+     */
+    [[nodiscard]] bool fits(
+        std::string_view key, std::size_t value_bytes) const noexcept {
+        return key.size() + value_bytes <= max_bytes_;
+    }
+
+    /*!
+     * \brief Cache a value.
+     *
+     * \param[in] key Key.
+     * \param[in] value Value.
+     * \param[in] value_bytes Number of bytes of the value.
+     * \param[in] now Current time.
+     *
+     * \note Values larger than the maximum number of bytes are not cached, and
+     * the value cached for the key is removed in such cases.
+     */
+    void insert(std::string key, Value value, std::size_t value_bytes,
+        Clock::time_point now) {
+        const bool is_cached = fits(key, value_bytes);
+        const std::size_t bytes = key.size() + value_bytes;
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = index_.find(key);
+        if (iter != index_.end()) {
+            erase_entry(iter->second);
+        }
+        if (!is_cached) {
+            return;
+        }
+
+        while (!entries_.empty() &&
+            (entries_.size() >= max_entries_ ||
+                num_bytes_ + bytes > max_bytes_)) {
+            erase_entry(std::prev(entries_.end()));
+        }
+        entries_.push_front(Entry{
+            std::move(key), std::move(value), now + time_to_live_, bytes});
+        // Keys in the index refer to strings in the list, whose addresses
+        // don't change.
+        index_.emplace(entries_.front().key, entries_.begin());
+        num_bytes_ += bytes;
+    }
+
+    /*!
+     * \brief Remove a value.
+     *
+     * \param[in] key Key.
+     */
+    void erase(std::string_view key) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = index_.find(key);
+        if (iter != index_.end()) {
+            erase_entry(iter->second);
+        }
+    }
+
+    /*!
+     * \brief Get the statistics.
+     *
+     * \tparam Statistics Type of the statistics constructed from the number of
+     * hits, the number of misses, the number of entries, and the number of
+     * bytes.
+     * \return Statistics.
+     */
+    template <typename Statistics>
+    [[nodiscard]] Statistics statistics() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return Statistics(num_hits_, num_misses_, entries_.size(), num_bytes_);
+    }
+
+private:
+    //! Struct of entries.
+    struct Entry {
+        //! Key.
+        std::string key;
+
+        //! Value.
+        Value value;
+
+        //! Time when this entry expires.
+        Clock::time_point expiry;
+
+        //! Number of bytes of this entry.
+        std::size_t bytes;
+    };
+
+    //! Type of iterators of entries.
+    using EntryIterator = typename std::list<Entry>::iterator;
+
+    /*!
+     * \brief Remove an entry without locks.
+     *
+     * \param[in] entry Entry.
+     */
+    void erase_entry(EntryIterator entry) {
+        num_bytes_ -= entry->bytes;
+        index_.erase(entry->key);
+        entries_.erase(entry);
+    }
+
+    //! Time to live of values.
+    std::chrono::nanoseconds time_to_live_;
+
+    //! Maximum number of values.
+    std::size_t max_entries_;
+
+    //! Maximum number of bytes of keys and values.
+    std::size_t max_bytes_;
+
+    //! Entries in the order of recent use.
+    std::list<Entry> entries_{};
+
+    //! Index of entries_.
+    std::unordered_map<std::string_view, EntryIterator> index_{};
+
+    //! Number of bytes of cached values.
+    std::size_t num_bytes_{0};
+
+    //! Number of calls of find function finding values.
+    std::size_t num_hits_{0};
+
+    //! Number of calls of find function without values.
+    std::size_t num_misses_{0};
+
+    //! Mutex of this cache.
+    std::mutex mutex_{};
+};
+
+}  // namespace msgpack_rpc::util::impl
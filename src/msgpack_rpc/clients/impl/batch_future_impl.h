@@ -0,0 +1,136 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of BatchFutureImpl class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+#include "msgpack_rpc/clients/impl/i_batch_future_impl.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Class of internal implementation of future objects to wait for
+ * batches of RPCs.
+ */
+class BatchFutureImpl final : public IBatchFutureImpl {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] deadline Deadline of the RPCs.
+     * \param[in] num_calls Number of RPCs.
+     */
+    BatchFutureImpl(
+        std::chrono::steady_clock::time_point deadline, std::size_t num_calls)
+        : deadline_(deadline), num_calls_(num_calls) {}
+
+    /*!
+     * \brief Handle a finished RPC.
+     */
+    void on_finished() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++num_finished_calls_;
+        lock.unlock();
+        cond_var_.notify_all();
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IBatchFutureImpl::wait_all
+    void wait_all() override { wait_until(deadline_, num_calls_); }
+
+    //! \copydoc msgpack_rpc::clients::impl::IBatchFutureImpl::wait_all_within
+    void wait_all_within(std::chrono::nanoseconds timeout) override {
+        wait_until(to_deadline(timeout), num_calls_);
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IBatchFutureImpl::wait_any
+    void wait_any() override {
+        wait_until(deadline_, std::min<std::size_t>(num_calls_, 1U));
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IBatchFutureImpl::wait_any_within
+    void wait_any_within(std::chrono::nanoseconds timeout) override {
+        wait_until(
+            to_deadline(timeout), std::min<std::size_t>(num_calls_, 1U));
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IBatchFutureImpl::num_calls
+    [[nodiscard]] std::size_t num_calls() const noexcept override {
+        return num_calls_;
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IBatchFutureImpl::num_finished_calls
+    [[nodiscard]] std::size_t num_finished_calls() override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return num_finished_calls_;
+    }
+
+private:
+    /*!
+     * \brief Get the deadline of waiting for a timeout.
+     *
+     * \param[in] timeout Timeout.
+     * \return Deadline.
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point to_deadline(
+        std::chrono::nanoseconds timeout) const {
+        return std::min<std::chrono::steady_clock::time_point>(
+            std::chrono::steady_clock::now() + timeout, deadline_);
+    }
+
+    /*!
+     * \brief Wait until the given number of RPCs finish.
+     *
+     * \param[in] deadline Deadline of waiting.
+     * \param[in] num_required_calls Number of RPCs required to finish.
+     */
+    void wait_until(std::chrono::steady_clock::time_point deadline,
+        std::size_t num_required_calls) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cond_var_.wait_until(lock, deadline, [this, num_required_calls] {
+                return num_finished_calls_ >= num_required_calls;
+            })) {
+            throw MsgpackRPCException(StatusCode::TIMEOUT,
+                "RPCs in a batch couldn't finish within a timeout.");
+        }
+    }
+
+    //! Deadline of the RPCs.
+    std::chrono::steady_clock::time_point deadline_;
+
+    //! Number of RPCs.
+    std::size_t num_calls_;
+
+    //! Number of finished RPCs.
+    std::size_t num_finished_calls_{0};
+
+    //! Mutex of num_finished_calls_.
+    std::mutex mutex_{};
+
+    //! Condition variable for notifying change of num_finished_calls_.
+    std::condition_variable cond_var_{};
+};
+
+}  // namespace msgpack_rpc::clients::impl
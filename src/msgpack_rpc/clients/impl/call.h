@@ -21,6 +21,7 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "msgpack_rpc/clients/impl/call_future_impl.h"
@@ -30,6 +31,7 @@
 #include "msgpack_rpc/executors/operation_type.h"
 #include "msgpack_rpc/executors/timer.h"
 #include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/message_id.h"
 
 namespace msgpack_rpc::clients::impl {
 
@@ -49,6 +51,22 @@ public:
         : promise_(deadline),
           timeout_timer_(executor, executors::OperationType::CALLBACK) {}
 
+    /*!
+     * \brief Constructor of RPCs in batches.
+     *
+     * \param[in] executor Executor.
+     * \param[in] future Future object created in advance.
+     * \param[in] batch_id ID of the batch.
+     *
+     * \note Timeout of RPCs in batches is handled by the timers of the
+     * batches, so the timer of this object is not used.
+     */
+    Call(const std::shared_ptr<executors::IExecutor>& executor,
+        std::shared_ptr<CallFutureImpl> future, messages::MessageID batch_id)
+        : promise_(std::move(future)),
+          timeout_timer_(executor, executors::OperationType::CALLBACK),
+          batch_id_(batch_id) {}
+
     /*!
      * \brief Set timeout.
      *
@@ -59,10 +77,21 @@ public:
     template <typename OnTimeout>
     void set_timeout(std::chrono::steady_clock::time_point deadline,
         OnTimeout&& on_timeout) {
+        deadline_ = deadline;
         timeout_timer_.async_sleep_until(
             deadline, std::forward<OnTimeout>(on_timeout));
     }
 
+    /*!
+     * \brief Get the deadline set by set_timeout function.
+     *
+     * \return Deadline.
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point deadline()
+        const noexcept {
+        return deadline_;
+    }
+
     /*!
      * \brief Get the future object to set and get the result of this RPC.
      *
@@ -72,6 +101,15 @@ public:
         return promise_.future();
     }
 
+    /*!
+     * \brief Get the ID of the batch of this RPC.
+     *
+     * \return ID of the batch if this RPC is in a batch.
+     */
+    [[nodiscard]] std::optional<messages::MessageID> batch_id() const noexcept {
+        return batch_id_;
+    }
+
     /*!
      * \brief Set the result.
      *
@@ -92,6 +130,12 @@ private:
 
     //! Timer of timeout.
     executors::Timer timeout_timer_;
+
+    //! Deadline set by set_timeout function.
+    std::chrono::steady_clock::time_point deadline_{};
+
+    //! ID of the batch.
+    std::optional<messages::MessageID> batch_id_{};
 };
 
 }  // namespace msgpack_rpc::clients::impl
@@ -0,0 +1,240 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of CallBatchImpl class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "msgpack_rpc/clients/impl/batch_future_impl.h"
+#include "msgpack_rpc/clients/impl/call_future_impl.h"
+#include "msgpack_rpc/clients/impl/call_list.h"
+#include "msgpack_rpc/clients/impl/cancel_call.h"
+#include "msgpack_rpc/clients/impl/i_batch_future_impl.h"
+#include "msgpack_rpc/clients/impl/i_call_batch_impl.h"
+#include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/clients/impl/message_sender.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/executors/i_async_executor.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/external_binary.h"
+#include "msgpack_rpc/messages/impl/serialization_buffer.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Class of internal implementation of batches of RPCs.
+ */
+class CallBatchImpl final : public ICallBatchImpl {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] call_list List of RPCs.
+     * \param[in] sender Sender of messages.
+     * \param[in] executor Executor.
+     * \param[in] logger Logger.
+     */
+    CallBatchImpl(std::shared_ptr<CallList> call_list,
+        std::shared_ptr<MessageSender> sender,
+        std::weak_ptr<executors::IAsyncExecutor> executor,
+        std::shared_ptr<logging::Logger> logger)
+        : call_list_(std::move(call_list)),
+          sender_(std::move(sender)),
+          executor_(std::move(executor)),
+          logger_(std::move(logger)) {}
+
+    CallBatchImpl(const CallBatchImpl&) = delete;
+    CallBatchImpl(CallBatchImpl&&) = delete;
+    CallBatchImpl& operator=(const CallBatchImpl&) = delete;
+    CallBatchImpl& operator=(CallBatchImpl&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     *
+     * RPCs in a batch destroyed without being sent finish with errors, so that
+     * waiting for them doesn't block.
+     */
+    ~CallBatchImpl() noexcept override {
+        if (is_sent_) {
+            return;
+        }
+        for (const auto& call : calls_) {
+            call.second->set(Status(StatusCode::PRECONDITION_NOT_MET,
+                "The batch of this RPC was not sent."));
+        }
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::ICallBatchImpl::add
+    [[nodiscard]] std::shared_ptr<ICallFutureImpl> add(
+        messages::MethodNameView method_name,
+        const IParametersSerializer& parameters) override {
+        check_state();
+
+        // The remaining budget is updated in send function.
+        auto [request_id, serialized_request] =
+            call_list_->serialize_request(method_name, parameters,
+                std::chrono::steady_clock::now() + call_list_->timeout());
+        requests_size_ += serialized_request.size();
+        requests_.push_back(std::move(serialized_request));
+
+        // Timeout of the RPC is handled by the timer of the batch after the
+        // batch is sent.
+        auto future = std::make_shared<CallFutureImpl>(
+            std::chrono::steady_clock::time_point::max());
+        future->set_cancel_handler(
+            [weak_call_list = std::weak_ptr<CallList>(call_list_),
+                weak_sender = std::weak_ptr<MessageSender>(sender_),
+                request_id = request_id] {
+                cancel_call(weak_call_list, weak_sender, request_id);
+            });
+        calls_.emplace_back(request_id, future);
+
+        return future;
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::ICallBatchImpl::send
+    [[nodiscard]] std::shared_ptr<IBatchFutureImpl> send() override {
+        check_state();
+        is_sent_ = true;
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto deadline = now + call_list_->timeout();
+        auto batch_future =
+            std::make_shared<BatchFutureImpl>(deadline, calls_.size());
+        for (const auto& call : calls_) {
+            call.second->add_completion_handler(
+                [batch_future] { batch_future->on_finished(); });
+        }
+        if (calls_.empty()) {
+            return batch_future;
+        }
+
+        if (call_list_->propagate_deadline()) {
+            // Requests are referred only from this object here, so the budgets
+            // are updated in place.
+            for (auto& request : requests_) {
+                messages::MessageSerializer::update_request_budget(
+                    request, deadline - now);
+            }
+        }
+        auto message = concatenate_requests();
+        requests_.clear();
+        const std::size_t message_size = message.total_size();
+
+        call_list_->register_batch(calls_, deadline);
+        if (!sender_->try_send(std::move(message))) {
+            MSGPACK_RPC_WARN(logger_,
+                "Rejected a batch of {} requests because too many messages "
+                "are waiting to be sent.",
+                calls_.size());
+            for (const auto& call : calls_) {
+                (void)call_list_->fail(call.first,
+                    Status(StatusCode::OVERLOADED, TOO_MANY_MESSAGES_ERROR));
+            }
+            return batch_future;
+        }
+
+        MSGPACK_RPC_DEBUG(logger_, "Send a batch of {} requests (size: {})",
+            calls_.size(), message_size);
+
+        return batch_future;
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::ICallBatchImpl::size
+    [[nodiscard]] std::size_t size() const noexcept override {
+        return calls_.size();
+    }
+
+private:
+    /*!
+     * \brief Concatenate the serialized requests into one message.
+     *
+     * \return Message.
+     *
+     * \note Binary data outside of the buffers of requests are referred from
+     * the message without copying.
+     */
+    [[nodiscard]] messages::SerializedMessage concatenate_requests() const {
+        messages::impl::SerializationBuffer buffer{requests_size_};
+        for (const auto& request : requests_) {
+            request.for_each_part(
+                [&buffer](const char* data, std::size_t size) {
+                    buffer.write(data, size);
+                },
+                [&buffer](const messages::ExternalBinary& binary) {
+                    buffer.write_external(binary);
+                });
+        }
+        return buffer.release();
+    }
+
+    /*!
+     * \brief Check whether this batch can be used.
+     */
+    void check_state() {
+        if (is_sent_) {
+            throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
+                "This batch has already been sent.");
+        }
+        const auto executor = executor_.lock();
+        if (!executor || !executor->is_running()) {
+            throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
+                "This client has been stopped.");
+        }
+    }
+
+    //! List of RPCs.
+    std::shared_ptr<CallList> call_list_;
+
+    //! Sender of messages.
+    std::shared_ptr<MessageSender> sender_;
+
+    //! Executor.
+    std::weak_ptr<executors::IAsyncExecutor> executor_;
+
+    //! Logger.
+    std::shared_ptr<logging::Logger> logger_;
+
+    //! Request IDs and future objects of the RPCs.
+    std::vector<
+        std::pair<messages::MessageID, std::shared_ptr<CallFutureImpl>>>
+        calls_{};
+
+    //! Serialized requests.
+    std::vector<messages::SerializedMessage> requests_{};
+
+    //! Total size of the internal buffers of the serialized requests.
+    std::size_t requests_size_{0};
+
+    //! Whether this batch has been sent.
+    bool is_sent_{false};
+};
+
+}  // namespace msgpack_rpc::clients::impl
@@ -22,10 +22,12 @@
 #include <algorithm>
 #include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "msgpack_rpc/clients/impl/i_call_future_impl.h"
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
@@ -51,6 +53,16 @@ public:
     explicit CallFutureImpl(std::chrono::steady_clock::time_point deadline)
         : deadline_(deadline) {}
 
+    /*!
+     * \brief Get the deadline of the result of the RPC.
+     *
+     * \return Deadline.
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point deadline()
+        const noexcept {
+        return deadline_;
+    }
+
     /*!
      * \brief Set a result.
      *
@@ -65,8 +77,13 @@ public:
         result_.emplace(std::move(result));
 
         is_set_ = true;
+        const auto handlers = std::move(completion_handlers_);
+        completion_handlers_.clear();
         lock.unlock();
         is_set_cond_var_.notify_all();
+        for (const auto& handler : handlers) {
+            handler();
+        }
     }
 
     /*!
@@ -87,8 +104,70 @@ public:
         status_ = error;
 
         is_set_ = true;
+        const auto handlers = std::move(completion_handlers_);
+        completion_handlers_.clear();
         lock.unlock();
         is_set_cond_var_.notify_all();
+        for (const auto& handler : handlers) {
+            handler();
+        }
+    }
+
+    /*!
+     * \brief Set the result or the error of another future object.
+     *
+     * \param[in] source Future object whose result or error has been set.
+     */
+    void set_from(CallFutureImpl& source) {
+        auto result = source.try_get_result();
+        if (result) {
+            set(std::move(*result));
+            return;
+        }
+        // status_ can be used without locks after is_set_ is set to true.
+        set(source.status_);
+    }
+
+    /*!
+     * \brief Set the function called when this RPC is cancelled.
+     *
+     * \param[in] handler Function.
+     */
+    void set_cancel_handler(std::function<void()> handler) {
+        std::unique_lock<std::mutex> lock(is_set_mutex_);
+        cancel_handler_ = std::move(handler);
+    }
+
+    //! \copydoc ICallFutureImpl::add_completion_handler
+    void add_completion_handler(std::function<void()> handler) override {
+        std::unique_lock<std::mutex> lock(is_set_mutex_);
+        if (!is_set_) {
+            completion_handlers_.push_back(std::move(handler));
+            return;
+        }
+        lock.unlock();
+        handler();
+    }
+
+    /*!
+     * \brief Check whether the result or an error has been set.
+     *
+     * \retval true The result or an error has been set.
+     * \retval false Otherwise.
+     */
+    [[nodiscard]] bool is_finished() {
+        std::unique_lock<std::mutex> lock(is_set_mutex_);
+        return is_set_;
+    }
+
+    /*!
+     * \brief Get the result if a response has been received.
+     *
+     * \return Result, or std::nullopt if no response has been received.
+     */
+    [[nodiscard]] std::optional<messages::CallResult> try_get_result() {
+        std::unique_lock<std::mutex> lock(is_set_mutex_);
+        return result_;
     }
 
     //! \copydoc msgpack_rpc::clients::impl::ICallFutureImpl::get_result
@@ -104,6 +183,22 @@ public:
         return get_result_impl();
     }
 
+    //! \copydoc msgpack_rpc::clients::impl::ICallFutureImpl::cancel
+    void cancel() override {
+        std::unique_lock<std::mutex> lock(is_set_mutex_);
+        if (is_set_) {
+            return;
+        }
+        const auto handler = std::move(cancel_handler_);
+        cancel_handler_ = nullptr;
+        lock.unlock();
+
+        if (handler) {
+            handler();
+        }
+        set(Status(StatusCode::OPERATION_ABORTED, "The RPC was cancelled."));
+    }
+
 private:
     /*!
      * \brief Wait the result.
@@ -160,6 +255,12 @@ private:
     //! Deadline of the result of the RPC.
     std::chrono::steady_clock::time_point deadline_;
 
+    //! Function called when this RPC is cancelled (protected by is_set_mutex_).
+    std::function<void()> cancel_handler_{};
+
+    //! Functions called when this RPC finishes (protected by is_set_mutex_).
+    std::vector<std::function<void()>> completion_handlers_{};
+
     /*!
      * \brief Mutex of is_set_.
      *
@@ -21,11 +21,13 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "msgpack_rpc/clients/impl/call.h"
 #include "msgpack_rpc/clients/impl/call_future_impl.h"
@@ -35,6 +37,8 @@
 #include "msgpack_rpc/common/status.h"
 #include "msgpack_rpc/common/status_code.h"
 #include "msgpack_rpc/executors/i_executor.h"
+#include "msgpack_rpc/executors/operation_type.h"
+#include "msgpack_rpc/executors/timer.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/method_name_view.h"
@@ -52,16 +56,37 @@ public:
      * \brief Constructor.
      *
      * \param[in] timeout Timeout of RPCs.
+     * \param[in] propagate_deadline Whether to propagate deadlines of RPCs to
+     * servers.
      * \param[in] executor Executor.
      * \param[in] logger Logger.
      */
     explicit CallList(std::chrono::nanoseconds timeout,
-        std::weak_ptr<executors::IExecutor> executor,
+        bool propagate_deadline, std::weak_ptr<executors::IExecutor> executor,
         std::shared_ptr<logging::Logger> logger)
         : timeout_(timeout),
+          propagate_deadline_(propagate_deadline),
           executor_(std::move(executor)),
           logger_(std::move(logger)) {}
 
+    /*!
+     * \brief Get the timeout of RPCs.
+     *
+     * \return Timeout.
+     */
+    [[nodiscard]] std::chrono::nanoseconds timeout() const noexcept {
+        return timeout_;
+    }
+
+    /*!
+     * \brief Check whether to propagate deadlines of RPCs.
+     *
+     * \return Whether to propagate deadlines of RPCs.
+     */
+    [[nodiscard]] bool propagate_deadline() const noexcept {
+        return propagate_deadline_;
+    }
+
     /*!
      * \brief Register an RPC.
      *
@@ -75,9 +100,8 @@ public:
         const IParametersSerializer& parameters) {
         const auto deadline = std::chrono::steady_clock::now() + timeout_;
 
-        const messages::MessageID request_id = request_id_generator_.generate();
-        const auto serialized_request =
-            parameters.create_serialized_request(method_name, request_id);
+        auto serialized = serialize_request(method_name, parameters, deadline);
+        const messages::MessageID request_id = serialized.first;
 
         std::unique_lock<std::mutex> lock(mutex_);
         const auto [iter, is_success] =
@@ -92,15 +116,105 @@ public:
         auto& call = iter->second;
         lock.unlock();
 
-        call.set_timeout(
-            deadline, [weak_self = this->weak_from_this(), request_id] {
+        set_timeout(call, request_id, deadline);
+
+        return {request_id, std::move(serialized.second), call.future()};
+    }
+
+    /*!
+     * \brief Restart the timeout of an RPC from the current time.
+     *
+     * \param[in] request_id Message ID of the request of the RPC.
+     *
+     * \note This is used for RPCs with streaming responses, whose timeout
+     * applies to the time without progress instead of the whole stream.
+     */
+    void extend_timeout(messages::MessageID request_id) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout_;
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = list_.find(request_id);
+        if (iter == list_.end()) {
+            return;
+        }
+        set_timeout(iter->second, request_id, deadline);
+    }
+
+    /*!
+     * \brief Generate a request ID and serialize a request.
+     *
+     * \param[in] method_name Method name.
+     * \param[in] parameters Parameters.
+     * \param[in] deadline Deadline of the RPC.
+     * \return Request ID and serialized request.
+     *
+     * \note RPCs of the serialized requests must be registered using
+     * register_batch function.
+     * \note When deadlines are propagated, the remaining budget is calculated
+     * from the deadline here, and should be updated using
+     * msgpack_rpc::messages::MessageSerializer::update_request_budget when
+     * the request is actually sent.
+     */
+    [[nodiscard]] std::pair<messages::MessageID, messages::SerializedMessage>
+    serialize_request(messages::MethodNameView method_name,
+        const IParametersSerializer& parameters,
+        std::chrono::steady_clock::time_point deadline) {
+        const messages::MessageID request_id = request_id_generator_.generate();
+        return {request_id,
+            propagate_deadline_
+                ? parameters.create_serialized_request_with_budget(method_name,
+                      request_id, deadline - std::chrono::steady_clock::now())
+                : parameters.create_serialized_request(
+                      method_name, request_id)};
+    }
+
+    /*!
+     * \brief Register a batch of RPCs.
+     *
+     * All RPCs are registered in one critical section, and one timer handles
+     * the timeout of all of them.
+     *
+     * \param[in] calls Request IDs and future objects of RPCs.
+     * \param[in] deadline Deadline of the RPCs.
+     */
+    void register_batch(
+        const std::vector<std::pair<messages::MessageID,
+            std::shared_ptr<CallFutureImpl>>>& calls,
+        std::chrono::steady_clock::time_point deadline) {
+        if (calls.empty()) {
+            return;
+        }
+        const auto batch_executor = executor();
+        const messages::MessageID batch_id = calls.front().first;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto [batch_iter, is_batch_success] =
+            batches_.try_emplace(batch_id, batch_executor);
+        if (!is_batch_success) {
+            // This won't occur in the ordinary condition.
+            throw MsgpackRPCException(
+                StatusCode::UNEXPECTED_ERROR, "Duplicate batch ID.");
+        }
+        auto& batch = batch_iter->second;
+        batch.request_ids.reserve(calls.size());
+        for (const auto& [request_id, future] : calls) {
+            const auto [iter, is_success] = list_.try_emplace(
+                request_id, batch_executor, future, batch_id);
+            if (!is_success) {
+                // This won't occur in the ordinary condition.
+                throw MsgpackRPCException(
+                    StatusCode::UNEXPECTED_ERROR, "Duplicate request ID.");
+            }
+            batch.request_ids.push_back(request_id);
+        }
+        batch.num_remaining_calls = calls.size();
+
+        batch.timer.async_sleep_until(
+            deadline, [weak_self = this->weak_from_this(), batch_id] {
                 const auto self = weak_self.lock();
                 if (self) {
-                    self->on_timeout(request_id);
+                    self->on_batch_timeout(batch_id);
                 }
             });
-
-        return {request_id, serialized_request, call.future()};
     }
 
     /*!
@@ -117,8 +231,51 @@ public:
                 response.id());
             return;
         }
-        iter->second.set(response.result());
-        list_.erase(iter);
+        const auto future = iter->second.future();
+        erase(iter);
+        // Completion handlers of futures may use this list or other locks.
+        lock.unlock();
+        future->set(response.result());
+    }
+
+    /*!
+     * \brief Cancel an RPC.
+     *
+     * The RPC is removed from this list, and the timer of its timeout is
+     * cancelled.
+     *
+     * \param[in] request_id Message ID of the request of the RPC.
+     * \retval true The RPC has been cancelled.
+     * \retval false The RPC has already been finished.
+     */
+    bool cancel(messages::MessageID request_id) {
+        return fail(request_id,
+            Status(StatusCode::OPERATION_ABORTED, "The RPC was cancelled."));
+    }
+
+    /*!
+     * \brief Finish an RPC with an error.
+     *
+     * The RPC is removed from this list, and the timer of its timeout is
+     * cancelled.
+     *
+     * \param[in] request_id Message ID of the request of the RPC.
+     * \param[in] error Error.
+     * \retval true The RPC has been finished with the error.
+     * \retval false The RPC has already been finished.
+     */
+    bool fail(messages::MessageID request_id, const Status& error) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = list_.find(request_id);
+        if (iter == list_.end()) {
+            return false;
+        }
+        const auto future = iter->second.future();
+        // Destruction of the timer cancels it.
+        erase(iter);
+        lock.unlock();
+        future->set(error);
+        return true;
     }
 
 private:
@@ -134,27 +291,133 @@ private:
         return res;
     }
 
+    /*!
+     * \brief Set the timer of timeout of an RPC.
+     *
+     * \param[in] call RPC.
+     * \param[in] request_id Message ID of the request of the RPC.
+     * \param[in] deadline Deadline.
+     */
+    void set_timeout(Call& call, messages::MessageID request_id,
+        std::chrono::steady_clock::time_point deadline) {
+        call.set_timeout(
+            deadline, [weak_self = this->weak_from_this(), request_id] {
+                const auto self = weak_self.lock();
+                if (self) {
+                    self->on_timeout(request_id);
+                }
+            });
+    }
+
     /*!
      * \brief Handle timeout of a RPC.
      *
      * \param[in] request_id Message ID of the request of the RPC.
      */
     void on_timeout(messages::MessageID request_id) {
-        MSGPACK_RPC_WARN(
-            logger_, "Timeout of an RPC (request ID: {}).", request_id);
         std::unique_lock<std::mutex> lock(mutex_);
         const auto iter = list_.find(request_id);
         if (iter == list_.end()) {
             return;
         }
-        iter->second.set(Status(StatusCode::TIMEOUT,
+        if (iter->second.deadline() > std::chrono::steady_clock::now()) {
+            // The timeout has been extended after the timer expired.
+            return;
+        }
+        MSGPACK_RPC_WARN(
+            logger_, "Timeout of an RPC (request ID: {}).", request_id);
+        const auto future = iter->second.future();
+        erase(iter);
+        lock.unlock();
+        future->set(Status(StatusCode::TIMEOUT,
             "Result of an RPC couldn't be received within a timeout."));
+    }
+
+    /*!
+     * \brief Handle timeout of a batch of RPCs.
+     *
+     * \param[in] batch_id ID of the batch.
+     */
+    void on_batch_timeout(messages::MessageID batch_id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto batch_iter = batches_.find(batch_id);
+        if (batch_iter == batches_.end()) {
+            return;
+        }
+        MSGPACK_RPC_WARN(logger_,
+            "Timeout of {} RPCs in a batch (batch ID: {}).",
+            batch_iter->second.num_remaining_calls, batch_id);
+        // Timer is destroyed after this function.
+        const auto batch_node = batches_.extract(batch_iter);
+        std::vector<std::shared_ptr<CallFutureImpl>> futures;
+        futures.reserve(batch_node.mapped().num_remaining_calls);
+        for (const auto request_id : batch_node.mapped().request_ids) {
+            const auto iter = list_.find(request_id);
+            if (iter == list_.end()) {
+                continue;
+            }
+            futures.push_back(iter->second.future());
+            list_.erase(iter);
+        }
+        lock.unlock();
+        for (const auto& future : futures) {
+            future->set(Status(StatusCode::TIMEOUT,
+                "Result of an RPC couldn't be received within a timeout."));
+        }
+    }
+
+    /*!
+     * \brief Remove an RPC from the list.
+     *
+     * \param[in] iter Iterator of the RPC.
+     *
+     * \note This function must be called with the lock of mutex_.
+     */
+    void erase(std::unordered_map<messages::MessageID, Call>::iterator iter) {
+        const auto batch_id = iter->second.batch_id();
         list_.erase(iter);
+        if (!batch_id) {
+            return;
+        }
+        const auto batch_iter = batches_.find(*batch_id);
+        if (batch_iter == batches_.end()) {
+            return;
+        }
+        --batch_iter->second.num_remaining_calls;
+        if (batch_iter->second.num_remaining_calls == 0U) {
+            // Destruction of the timer cancels it.
+            batches_.erase(batch_iter);
+        }
     }
 
+    /*!
+     * \brief Struct of data of batches of RPCs.
+     */
+    struct Batch {
+        /*!
+         * \brief Constructor.
+         *
+         * \param[in] executor Executor.
+         */
+        explicit Batch(const std::shared_ptr<executors::IExecutor>& executor)
+            : timer(executor, executors::OperationType::CALLBACK) {}
+
+        //! Timer of timeout.
+        executors::Timer timer;
+
+        //! Request IDs of RPCs.
+        std::vector<messages::MessageID> request_ids{};
+
+        //! Number of RPCs not finished yet.
+        std::size_t num_remaining_calls{0};
+    };
+
     //! List.
     std::unordered_map<messages::MessageID, Call> list_{};
 
+    //! Batches of RPCs.
+    std::unordered_map<messages::MessageID, Batch> batches_{};
+
     //! Generator of message IDs of requests.
     RequestIDGenerator request_id_generator_{};
 
@@ -164,6 +427,9 @@ private:
     //! Timeout of RPCs.
     std::chrono::nanoseconds timeout_;
 
+    //! Whether to propagate deadlines of RPCs to servers.
+    bool propagate_deadline_;
+
     //! Executor.
     std::weak_ptr<executors::IExecutor> executor_;
 
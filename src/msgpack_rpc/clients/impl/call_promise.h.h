@@ -42,6 +42,14 @@ public:
     explicit CallPromise(std::chrono::steady_clock::time_point deadline)
         : future_(std::make_shared<CallFutureImpl>(deadline)) {}
 
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] future Future created in advance.
+     */
+    explicit CallPromise(std::shared_ptr<CallFutureImpl> future)
+        : future_(std::move(future)) {}
+
     /*!
      * \brief Set a result.
      *
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of cancel_call function.
+ */
+#pragma once
+
+#include <memory>
+
+#include "msgpack_rpc/clients/impl/call_list.h"
+#include "msgpack_rpc/clients/impl/message_sender.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Cancel an RPC.
+ *
+ * \param[in] weak_call_list List of RPCs.
+ * \param[in] weak_sender Sender of messages.
+ * \param[in] request_id Message ID of the request of the RPC.
+ */
+inline void cancel_call(const std::weak_ptr<CallList>& weak_call_list,
+    const std::weak_ptr<MessageSender>& weak_sender,
+    messages::MessageID request_id) {
+    const auto call_list = weak_call_list.lock();
+    if (!call_list || !call_list->cancel(request_id)) {
+        return;
+    }
+    const auto sender = weak_sender.lock();
+    if (!sender) {
+        return;
+    }
+    sender->send(messages::MessageSerializer::serialize_notification(
+        messages::CANCEL_REQUEST_METHOD_NAME, request_id));
+}
+
+}  // namespace msgpack_rpc::clients::impl
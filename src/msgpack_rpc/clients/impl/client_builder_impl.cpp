@@ -20,6 +20,7 @@
 #include "msgpack_rpc/clients/impl/client_builder_impl.h"
 
 #include <memory>
+#include <utility>
 
 #include "msgpack_rpc/clients/impl/i_client_builder_impl.h"
 #include "msgpack_rpc/transport/backend_list.h"
@@ -39,10 +40,11 @@ std::unique_ptr<IClientBuilderImpl> create_default_client_builder_impl(
     const std::shared_ptr<logging::Logger>& logger) {
     const auto executor = executors::create_executor(logger, config.executor());
 
-    auto builder =
-        std::make_unique<ClientBuilderImpl>(executor, logger, std::move(config),
-            transport::create_default_backend_list(
-                executor, config.message_parser(), logger));
+    auto backends = transport::create_default_backend_list(executor,
+        config.message_parser(), logger, config.socket(), config.compression(),
+        config.traffic_capture());
+    auto builder = std::make_unique<ClientBuilderImpl>(
+        executor, logger, std::move(config), std::move(backends));
 
     return builder;
 }
@@ -31,6 +31,9 @@
 #include "msgpack_rpc/config/client_config.h"
 #include "msgpack_rpc/executors/i_async_executor.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/methods/i_method.h"
+#include "msgpack_rpc/methods/i_method_processor.h"
+#include "msgpack_rpc/methods/method_processor.h"
 #include "msgpack_rpc/transport/backend_list.h"
 #include "msgpack_rpc/transport/i_backend.h"
 
@@ -55,7 +58,8 @@ public:
         : executor_(std::move(executor)),
           logger_(std::move(logger)),
           config_(std::move(config)),
-          backends_(std::move(backends)) {}
+          backends_(std::move(backends)),
+          method_processor_(methods::create_method_processor(logger_)) {}
 
     //! \copydoc msgpack_rpc::clients::impl::IClientBuilderImpl::register_protocol
     void register_protocol(
@@ -68,21 +72,34 @@ public:
         config_.add_uri(std::move(uri));
     }
 
+    //! \copydoc msgpack_rpc::clients::impl::IClientBuilderImpl::add_method
+    void add_method(std::unique_ptr<methods::IMethod> method) override {
+        method_processor_->append(std::move(method));
+    }
+
     //! \copydoc msgpack_rpc::clients::impl::IClientBuilderImpl::build
     [[nodiscard]] std::shared_ptr<clients::impl::IClientImpl> build() override {
         const auto connector = std::make_shared<ClientConnector>(executor_,
             backends_, config_.uris(), config_.reconnection(), logger_);
 
         const auto call_list = std::make_shared<CallList>(
-            config_.call_timeout(), executor_, logger_);
+            config_.call_timeout(), config_.propagate_deadline(), executor_,
+            logger_);
 
-        auto client = std::make_shared<ClientImpl>(
-            connector, call_list, executor_, logger_);
+        auto client = std::make_shared<ClientImpl>(connector, call_list,
+            method_processor_, executor_, config_.flow_control(),
+            config_.single_flight_methods(), config_.response_caches(),
+            logger_);
         client->start();
 
         return client;
     }
 
+    //! \copydoc msgpack_rpc::clients::impl::IClientBuilderImpl::logger
+    [[nodiscard]] std::shared_ptr<logging::Logger> logger() override {
+        return logger_;
+    }
+
 private:
     //! Executor.
     std::shared_ptr<executors::IAsyncExecutor> executor_;
@@ -95,6 +112,9 @@ private:
 
     //! Backends.
     transport::BackendList backends_;
+
+    //! Processor of methods called by servers.
+    std::shared_ptr<methods::IMethodProcessor> method_processor_;
 };
 
 }  // namespace msgpack_rpc::clients::impl
@@ -20,25 +20,52 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include <fmt/format.h>
+
+#include "msgpack_rpc/clients/impl/call_batch_impl.h"
 #include "msgpack_rpc/clients/impl/call_list.h"
+#include "msgpack_rpc/clients/impl/cancel_call.h"
 #include "msgpack_rpc/clients/impl/client_connector.h"
+#include "msgpack_rpc/clients/impl/i_call_batch_impl.h"
 #include "msgpack_rpc/clients/impl/i_call_future_impl.h"
 #include "msgpack_rpc/clients/impl/i_client_impl.h"
+#include "msgpack_rpc/clients/impl/i_stream_reader_impl.h"
+#include "msgpack_rpc/clients/impl/i_upload_writer_impl.h"
 #include "msgpack_rpc/clients/impl/message_sender.h"
 #include "msgpack_rpc/clients/impl/parameters_serializer.h"
 #include "msgpack_rpc/clients/impl/received_message_processor.h"
+#include "msgpack_rpc/clients/impl/response_cache.h"
+#include "msgpack_rpc/clients/impl/single_flight_call_table.h"
+#include "msgpack_rpc/clients/impl/stream_flow_controller.h"
+#include "msgpack_rpc/clients/impl/stream_list.h"
+#include "msgpack_rpc/clients/impl/stream_reader_impl.h"
+#include "msgpack_rpc/clients/impl/upload_list.h"
+#include "msgpack_rpc/clients/impl/upload_writer_impl.h"
+#include "msgpack_rpc/clients/response_cache_statistics.h"
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/flow_control_config.h"
+#include "msgpack_rpc/config/response_cache_config.h"
 #include "msgpack_rpc/executors/i_async_executor.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
 #include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/i_method_processor.h"
 
 namespace msgpack_rpc::clients::impl {
 
@@ -52,18 +79,39 @@ public:
      *
      * \param[in] connector Connector.
      * \param[in] call_list List of RPCs.
+     * \param[in] method_processor Processor of methods called by servers.
      * \param[in] executor Executor.
+     * \param[in] flow_control_config Configuration of flow control.
+     * \param[in] single_flight_methods Names of methods whose identical calls
+     * in flight share an RPC.
+     * \param[in] response_caches Configurations of caches of responses for
+     * method names.
      * \param[in] logger Logger.
      */
     ClientImpl(std::shared_ptr<ClientConnector> connector,
         std::shared_ptr<CallList> call_list,
+        std::shared_ptr<methods::IMethodProcessor> method_processor,
         std::shared_ptr<executors::IAsyncExecutor> executor,
+        const config::FlowControlConfig& flow_control_config,
+        const std::vector<std::string>& single_flight_methods,
+        const std::unordered_map<std::string, config::ResponseCacheConfig>&
+            response_caches,
         std::shared_ptr<logging::Logger> logger)
         : executor_(std::move(executor)),
           connector_(std::move(connector)),
           call_list_(std::move(call_list)),
+          method_processor_(std::move(method_processor)),
           logger_(std::move(logger)),
-          sender_(std::make_shared<MessageSender>(connector_, logger_)) {}
+          sender_(std::make_shared<MessageSender>(
+              connector_, flow_control_config, logger_)),
+          single_flight_methods_(
+              single_flight_methods.begin(), single_flight_methods.end()),
+          single_flight_calls_(std::make_shared<SingleFlightCallTable>()),
+          response_cache_(response_caches),
+          stream_list_(std::make_shared<StreamList>(logger_)),
+          stream_flow_controller_(std::make_shared<StreamFlowController>(
+              call_list_, connector_, logger_)),
+          upload_list_(std::make_shared<UploadList>(logger_)) {}
 
     /*!
      * \brief Destructor.
@@ -96,7 +144,10 @@ public:
             // on_connection
             [sender = sender_] { sender->send_next(); },
             // on_received
-            ReceivedMessageProcessor(logger_, call_list_),
+            ReceivedMessageProcessor(logger_, call_list_, stream_list_,
+                upload_list_, method_processor_,
+                std::weak_ptr<MessageSender>(sender_),
+                std::weak_ptr<executors::IExecutor>(executor_)),
             // on_sent
             [sender = sender_] {
                 sender->handle_sent_message();
@@ -129,15 +180,143 @@ public:
         const IParametersSerializer& parameters) override {
         check_executor_state();
 
+        const auto cache = response_cache_.find(method_name);
+        const bool is_single_flight = !single_flight_methods_.empty() &&
+            single_flight_methods_.count(std::string(method_name.name())) > 0U;
+        if (cache == nullptr && !is_single_flight) {
+            return send_request(method_name, parameters);
+        }
+
+        // Serialized notifications have the method name and parameters
+        // without message IDs.
+        const auto serialized_key =
+            parameters.create_serialized_notification(method_name).flatten();
+        std::string key(serialized_key.data(), serialized_key.size());
+
+        if (cache != nullptr) {
+            auto result = cache->find(key, MethodResponseCache::Clock::now());
+            if (result) {
+                MSGPACK_RPC_TRACE(
+                    logger_, "Use a cached response of {}", method_name);
+                auto future = std::make_shared<CallFutureImpl>(
+                    MethodResponseCache::Clock::now());
+                future->set(std::move(*result));
+                return future;
+            }
+        }
+
+        const auto send = [this, method_name, &parameters, &cache, &key] {
+            auto future = send_request(method_name, parameters);
+            if (cache != nullptr) {
+                future->add_completion_handler(
+                    [weak_cache = std::weak_ptr<MethodResponseCache>(cache),
+                        key, future_ptr = future.get()] {
+                        const auto locked_cache = weak_cache.lock();
+                        const auto result = future_ptr->try_get_result();
+                        if (locked_cache && result && result->is_success()) {
+                            locked_cache->insert(key, *result,
+                                MethodResponseCache::Clock::now());
+                        }
+                    });
+            }
+            return future;
+        };
+        if (!is_single_flight) {
+            return send();
+        }
+        return single_flight_calls_->find_or_create(key,
+            std::chrono::steady_clock::now() + call_list_->timeout(), send);
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IClientImpl::async_call_stream
+    [[nodiscard]] std::shared_ptr<IStreamReaderImpl> async_call_stream(
+        messages::MethodNameView method_name,
+        const IParametersSerializer& parameters) override {
+        check_executor_state();
+
         const auto [request_id, serialized_request, future] =
-            call_list_->create(method_name, parameters);
+            create_request(method_name, parameters);
+        auto reader = std::make_shared<StreamReaderImpl>(
+            request_id, future, call_list_->timeout(), stream_flow_controller_);
+        // Readers are registered before sending requests so that no chunk is
+        // lost.
+        stream_list_->add(request_id, reader);
+        future->add_completion_handler(
+            [weak_stream_list = std::weak_ptr<StreamList>(stream_list_),
+                weak_reader = std::weak_ptr<StreamReaderImpl>(reader),
+                request_id = request_id] {
+                const auto stream_list = weak_stream_list.lock();
+                if (stream_list) {
+                    stream_list->remove(request_id);
+                }
+                const auto reader = weak_reader.lock();
+                if (reader) {
+                    reader->finish();
+                }
+            });
 
-        sender_->send(serialized_request, request_id);
+        send_or_fail(serialized_request, request_id, future->deadline());
 
-        MSGPACK_RPC_DEBUG(
-            logger_, "Send request {} (id: {})", method_name, request_id);
+        MSGPACK_RPC_DEBUG(logger_, "Send request {} with a stream (id: {})",
+            method_name, request_id);
 
-        return future;
+        return reader;
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IClientImpl::async_call_upload
+    [[nodiscard]] std::shared_ptr<IUploadWriterImpl> async_call_upload(
+        messages::MethodNameView method_name,
+        const IParametersSerializer& parameters) override {
+        check_executor_state();
+
+        const auto [request_id, serialized_request, future] =
+            create_request(method_name, parameters);
+        auto writer = std::make_shared<UploadWriterImpl>(request_id, future,
+            std::weak_ptr<MessageSender>(sender_),
+            messages::UPLOAD_WINDOW_SIZE,
+            std::chrono::steady_clock::now() + call_list_->timeout());
+        // Writers are registered before sending requests so that no
+        // acknowledgement is lost.
+        upload_list_->add(request_id, writer);
+        future->add_completion_handler(
+            [weak_upload_list = std::weak_ptr<UploadList>(upload_list_),
+                weak_writer = std::weak_ptr<UploadWriterImpl>(writer),
+                request_id = request_id] {
+                const auto upload_list = weak_upload_list.lock();
+                if (upload_list) {
+                    upload_list->remove(request_id);
+                }
+                const auto writer = weak_writer.lock();
+                if (writer) {
+                    writer->on_finished();
+                }
+            });
+
+        send_or_fail(serialized_request, request_id, future->deadline());
+
+        MSGPACK_RPC_DEBUG(logger_, "Send request {} with an upload (id: {})",
+            method_name, request_id);
+
+        return writer;
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IClientImpl::response_cache_statistics
+    [[nodiscard]] ResponseCacheStatistics response_cache_statistics(
+        messages::MethodNameView method_name) override {
+        const auto cache = response_cache_.find(method_name);
+        if (cache == nullptr) {
+            throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+                fmt::format("Method {} has no cache of responses.",
+                    method_name.name()));
+        }
+        return cache->statistics();
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IClientImpl::create_batch
+    [[nodiscard]] std::shared_ptr<ICallBatchImpl> create_batch() override {
+        check_executor_state();
+        return std::make_shared<CallBatchImpl>(
+            call_list_, sender_, executor_, logger_);
     }
 
     //! \copydoc msgpack_rpc::clients::impl::IClientImpl::notify
@@ -148,7 +327,10 @@ public:
         const auto serialized_notification =
             parameters.create_serialized_notification(method_name);
 
-        sender_->send(serialized_notification);
+        if (!sender_->try_send(serialized_notification)) {
+            throw MsgpackRPCException(
+                StatusCode::OVERLOADED, TOO_MANY_MESSAGES_ERROR);
+        }
 
         MSGPACK_RPC_DEBUG(logger_, "Send notification {}", method_name);
     }
@@ -159,6 +341,74 @@ public:
     }
 
 private:
+    /*!
+     * \brief Create and send a request of an RPC.
+     *
+     * \param[in] method_name Method name.
+     * \param[in] parameters Parameters.
+     * \return Future object of the RPC.
+     */
+    [[nodiscard]] std::shared_ptr<CallFutureImpl> send_request(
+        messages::MethodNameView method_name,
+        const IParametersSerializer& parameters) {
+        const auto [request_id, serialized_request, future] =
+            create_request(method_name, parameters);
+
+        send_or_fail(serialized_request, request_id, future->deadline());
+
+        MSGPACK_RPC_DEBUG(
+            logger_, "Send request {} (id: {})", method_name, request_id);
+
+        return future;
+    }
+
+    /*!
+     * \brief Send a request, or finish the RPC with an error if too many
+     * messages are waiting to be sent.
+     *
+     * \param[in] serialized_request Serialized request.
+     * \param[in] request_id Message ID of the request.
+     * \param[in] deadline Deadline of the RPC.
+     */
+    void send_or_fail(const messages::SerializedMessage& serialized_request,
+        messages::MessageID request_id,
+        std::chrono::steady_clock::time_point deadline) {
+        // The remaining budget is updated when the request is actually sent.
+        const auto propagated_deadline = call_list_->propagate_deadline()
+            ? std::optional(deadline)
+            : std::nullopt;
+        if (!sender_->try_send(
+                serialized_request, request_id, propagated_deadline)) {
+            MSGPACK_RPC_WARN(logger_,
+                "Rejected request {} because too many messages are waiting to "
+                "be sent.",
+                request_id);
+            (void)call_list_->fail(request_id,
+                Status(StatusCode::OVERLOADED, TOO_MANY_MESSAGES_ERROR));
+        }
+    }
+
+    /*!
+     * \brief Create a request of an RPC without sending it.
+     *
+     * \param[in] method_name Method name.
+     * \param[in] parameters Parameters.
+     * \return Request ID, serialized request, and future object.
+     */
+    [[nodiscard]] std::tuple<messages::MessageID, messages::SerializedMessage,
+        std::shared_ptr<CallFutureImpl>>
+    create_request(messages::MethodNameView method_name,
+        const IParametersSerializer& parameters) {
+        auto created = call_list_->create(method_name, parameters);
+        std::get<2>(created)->set_cancel_handler(
+            [weak_call_list = std::weak_ptr<CallList>(call_list_),
+                weak_sender = std::weak_ptr<MessageSender>(sender_),
+                request_id = std::get<0>(created)] {
+                cancel_call(weak_call_list, weak_sender, request_id);
+            });
+        return created;
+    }
+
     /*!
      * \brief Check whether the executor is running.
      */
@@ -178,12 +428,33 @@ private:
     //! List of RPCs.
     std::shared_ptr<CallList> call_list_;
 
+    //! Processor of methods called by servers.
+    std::shared_ptr<methods::IMethodProcessor> method_processor_;
+
     //! Logger.
     std::shared_ptr<logging::Logger> logger_;
 
     //! Sender of messages.
     std::shared_ptr<MessageSender> sender_;
 
+    //! Names of methods whose identical calls in flight share an RPC.
+    std::unordered_set<std::string> single_flight_methods_;
+
+    //! RPCs in flight shared by identical calls.
+    std::shared_ptr<SingleFlightCallTable> single_flight_calls_;
+
+    //! Caches of responses.
+    ResponseCache response_cache_;
+
+    //! List of RPCs with streaming responses.
+    std::shared_ptr<StreamList> stream_list_;
+
+    //! Controller of the flow of streaming responses.
+    std::shared_ptr<StreamFlowController> stream_flow_controller_;
+
+    //! List of RPCs with uploads.
+    std::shared_ptr<UploadList> upload_list_;
+
     //! Whether this client has been started.
     std::atomic<bool> is_started_{false};
 
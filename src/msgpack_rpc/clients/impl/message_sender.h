@@ -20,19 +20,29 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <utility>
 
 #include "msgpack_rpc/clients/impl/client_connector.h"
 #include "msgpack_rpc/clients/impl/sent_message_queue.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/flow_control_config.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
 #include "msgpack_rpc/messages/serialized_message.h"
 #include "msgpack_rpc/transport/i_connection.h"
 
 namespace msgpack_rpc::clients::impl {
 
+//! Message of errors when too many messages are waiting to be sent.
+constexpr std::string_view TOO_MANY_MESSAGES_ERROR =
+    "Too many messages are waiting to be sent.";
+
 /*!
  * \brief Class to send messages in clients.
  */
@@ -42,11 +52,32 @@ public:
      * \brief Constructor.
      *
      * \param[in] connector Connector.
+     * \param[in] flow_control_config Configuration of flow control.
      * \param[in] logger Logger.
      */
     MessageSender(std::weak_ptr<ClientConnector> connector,
+        const config::FlowControlConfig& flow_control_config,
         std::shared_ptr<logging::Logger> logger)
-        : connector_(std::move(connector)), logger_(std::move(logger)) {}
+        : connector_(std::move(connector)),
+          logger_(std::move(logger)),
+          sent_messages_(flow_control_config) {}
+
+    /*!
+     * \brief Wait until messages can be sent without exceeding the watermarks
+     * of flow control.
+     *
+     * \param[in] timeout Timeout.
+     *
+     * \warning This function blocks the caller, so this must be used only in
+     * functions documented as blocking.
+     */
+    void wait_until_sendable(std::chrono::nanoseconds timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        if (!sent_messages_.wait_until_writable(deadline)) {
+            throw MsgpackRPCException(
+                StatusCode::TIMEOUT, TOO_MANY_MESSAGES_ERROR);
+        }
+    }
 
     /*!
      * \brief Send a message.
@@ -60,6 +91,30 @@ public:
         send_next();
     }
 
+    /*!
+     * \brief Send a message if it doesn't exceed the high watermarks of flow
+     * control.
+     *
+     * \param[in] message Message.
+     * \param[in] id Message ID (for requests).
+     * \param[in] deadline Deadline of the request to propagate. The remaining
+     * budget in the request is updated from this when the request is actually
+     * sent.
+     * \retval true The message will be sent.
+     * \retval false The message has been rejected.
+     */
+    [[nodiscard]] bool try_send(messages::SerializedMessage message,
+        std::optional<messages::MessageID> id = std::nullopt,
+        std::optional<std::chrono::steady_clock::time_point> deadline =
+            std::nullopt) {
+        if (!sent_messages_.try_push(std::move(message), id, deadline)) {
+            MSGPACK_RPC_TRACE(logger_, "Too many messages to be sent.");
+            return false;
+        }
+        send_next();
+        return true;
+    }
+
     /*!
      * \brief Send the next message if possible.
      */
@@ -74,7 +129,7 @@ public:
                 logger_, "No connection now, so wait for connection.");
             return;
         }
-        const auto [message, request_id] = sent_messages_.next();
+        auto [message, request_id, deadline] = sent_messages_.next();
         if (!message) {
             MSGPACK_RPC_TRACE(logger_, "No message to be sent for now.");
             return;
@@ -84,6 +139,11 @@ public:
             return;
         }
 
+        if (deadline) {
+            // Updated only by the thread sending the message.
+            messages::MessageSerializer::update_request_budget(
+                *message, *deadline - std::chrono::steady_clock::now());
+        }
         connection->async_send(*message);
         MSGPACK_RPC_TRACE(logger_, "Sending next message.");
     }
@@ -126,7 +186,7 @@ private:
     std::shared_ptr<logging::Logger> logger_;
 
     //! Queue of messages to be sent.
-    SentMessageQueue sent_messages_{};
+    SentMessageQueue sent_messages_;
 
     //! Whether this client is sending a message.
     std::atomic<bool> is_sending_{false};
@@ -19,15 +19,28 @@
  */
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <variant>
 
 #include "msgpack_rpc/clients/impl/call_list.h"
+#include "msgpack_rpc/clients/impl/message_sender.h"
+#include "msgpack_rpc/clients/impl/stream_list.h"
+#include "msgpack_rpc/clients/impl/upload_list.h"
+#include "msgpack_rpc/executors/async_invoke.h"
+#include "msgpack_rpc/executors/i_executor.h"
+#include "msgpack_rpc/executors/operation_type.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/method_name_view.h"
 #include "msgpack_rpc/messages/parsed_message.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+#include "msgpack_rpc/messages/parsed_request.h"
 #include "msgpack_rpc/messages/parsed_response.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/methods/i_method_processor.h"
+#include "msgpack_rpc/methods/request_deadline.h"
 #include "msgpack_rpc/util/format_msgpack_object.h"
 
 namespace msgpack_rpc::clients::impl {
@@ -42,10 +55,26 @@ public:
      *
      * \param[in] logger Logger.
      * \param[in] call_list List of RPCs.
+     * \param[in] stream_list List of RPCs with streaming responses.
+     * \param[in] upload_list List of RPCs with uploads.
+     * \param[in] method_processor Processor of methods called by servers.
+     * \param[in] sender Sender of messages.
+     * \param[in] executor Executor.
      */
     ReceivedMessageProcessor(std::shared_ptr<logging::Logger> logger,
-        std::shared_ptr<CallList> call_list)
-        : logger_(std::move(logger)), call_list_(std::move(call_list)) {}
+        std::shared_ptr<CallList> call_list,
+        std::shared_ptr<StreamList> stream_list,
+        std::shared_ptr<UploadList> upload_list,
+        std::shared_ptr<methods::IMethodProcessor> method_processor,
+        std::weak_ptr<MessageSender> sender,
+        std::weak_ptr<executors::IExecutor> executor)
+        : logger_(std::move(logger)),
+          call_list_(std::move(call_list)),
+          stream_list_(std::move(stream_list)),
+          upload_list_(std::move(upload_list)),
+          method_processor_(std::move(method_processor)),
+          sender_(std::move(sender)),
+          executor_(std::move(executor)) {}
 
     /*!
      * \brief Process a received message.
@@ -53,6 +82,17 @@ public:
      * \param[in] message Message.
      */
     void operator()(const messages::ParsedMessage& message) {
+        const auto* request = std::get_if<messages::ParsedRequest>(&message);
+        if (request != nullptr) {
+            on_request(*request);
+            return;
+        }
+        const auto* notification =
+            std::get_if<messages::ParsedNotification>(&message);
+        if (notification != nullptr) {
+            on_notification(*notification);
+            return;
+        }
         const auto* response = std::get_if<messages::ParsedResponse>(&message);
         if (response == nullptr) {
             MSGPACK_RPC_WARN(logger_, "Received an invalid message.");
@@ -70,11 +110,90 @@ public:
     }
 
 private:
+    /*!
+     * \brief Process a request from the server.
+     *
+     * \param[in] request Request.
+     */
+    void on_request(const messages::ParsedRequest& request) {
+        MSGPACK_RPC_DEBUG(logger_, "Received request {} (id: {})",
+            request.method_name(), request.id());
+        const auto executor = executor_.lock();
+        if (!executor) {
+            return;
+        }
+        executors::async_invoke(executor, executors::OperationType::CALLBACK,
+            [processor = method_processor_, weak_sender = sender_, request,
+                logger = logger_] {
+                const auto deadline = request.deadline();
+                if (deadline &&
+                    *deadline <= std::chrono::steady_clock::now()) {
+                    // The server no longer waits for the response.
+                    MSGPACK_RPC_DEBUG(logger,
+                        "Request {} (id: {}) dropped due to the expired "
+                        "deadline",
+                        request.method_name(), request.id());
+                    return;
+                }
+                const methods::impl::RequestDeadlineScope deadline_scope(
+                    deadline);
+                auto response = processor->call(request);
+                const auto sender = weak_sender.lock();
+                if (sender) {
+                    sender->send(std::move(response));
+                }
+            });
+    }
+
+    /*!
+     * \brief Process a notification from the server.
+     *
+     * \param[in] notification Notification.
+     */
+    void on_notification(const messages::ParsedNotification& notification) {
+        if (notification.method_name() ==
+            messages::MethodNameView(messages::STREAM_CHUNK_METHOD_NAME)) {
+            // Chunks are handled here to keep the order with responses.
+            stream_list_->handle(notification);
+            return;
+        }
+        if (notification.method_name() ==
+            messages::MethodNameView(messages::UPLOAD_ACK_METHOD_NAME)) {
+            upload_list_->handle(notification);
+            return;
+        }
+        MSGPACK_RPC_DEBUG(
+            logger_, "Received notification {}", notification.method_name());
+        const auto executor = executor_.lock();
+        if (!executor) {
+            return;
+        }
+        executors::async_invoke(executor, executors::OperationType::CALLBACK,
+            [processor = method_processor_, notification] {
+                processor->notify(notification);
+            });
+    }
+
     //! Logger.
     std::shared_ptr<logging::Logger> logger_;
 
     //! List of RPCs.
     std::shared_ptr<CallList> call_list_;
+
+    //! List of RPCs with streaming responses.
+    std::shared_ptr<StreamList> stream_list_;
+
+    //! List of RPCs with uploads.
+    std::shared_ptr<UploadList> upload_list_;
+
+    //! Processor of methods called by servers.
+    std::shared_ptr<methods::IMethodProcessor> method_processor_;
+
+    //! Sender of messages.
+    std::weak_ptr<MessageSender> sender_;
+
+    //! Executor.
+    std::weak_ptr<executors::IExecutor> executor_;
 };
 
 }  // namespace msgpack_rpc::clients::impl
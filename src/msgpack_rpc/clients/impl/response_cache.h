@@ -0,0 +1,174 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of ResponseCache class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/clients/response_cache_statistics.h"
+#include "msgpack_rpc/config/response_cache_config.h"
+#include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/util/impl/lru_ttl_cache.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Class of caches of responses of a method.
+ *
+ * Responses are removed when their time to live passes, or in the order of
+ * least recent use when the number of responses or the number of bytes
+ * exceeds the limit.
+ *
+ * Results are copied to zones of their own sizes so that cached responses
+ * don't keep buffers of received messages alive. Sizes of responses are
+ * measured as the sizes of keys and the zones.
+ */
+class MethodResponseCache {
+public:
+    //! Type of clocks.
+    using Clock = util::impl::LruTtlCache<messages::CallResult>::Clock;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] config Configuration.
+     */
+    explicit MethodResponseCache(const config::ResponseCacheConfig& config)
+        : cache_(config.time_to_live(), config.max_entries(),
+              config.max_bytes()) {}
+
+    /*!
+     * \brief Find a cached response.
+     *
+     * \param[in] key Key of the call.
+     * \param[in] now Current time.
+     * \return Result, or std::nullopt if no response is cached.
+     */
+    [[nodiscard]] std::optional<messages::CallResult> find(
+        std::string_view key, Clock::time_point now) {
+        return cache_.find(key, now);
+    }
+
+    /*!
+     * \brief Cache a response.
+     *
+     * \param[in] key Key of the call.
+     * \param[in] result Result.
+     * \param[in] now Current time.
+     *
+     * \note Responses larger than the maximum number of bytes are not cached.
+     */
+    void insert(std::string key, const messages::CallResult& result,
+        Clock::time_point now) {
+        const std::size_t zone_size =
+            msgpack::aligned_zone_size(result.object());
+        if (!cache_.fits(key, zone_size)) {
+            cache_.erase(key);
+            return;
+        }
+        cache_.insert(std::move(key), copy(result, zone_size), zone_size, now);
+    }
+
+    /*!
+     * \brief Get the statistics.
+     *
+     * \return Statistics.
+     */
+    [[nodiscard]] ResponseCacheStatistics statistics() {
+        return cache_.statistics<ResponseCacheStatistics>();
+    }
+
+private:
+    /*!
+     * \brief Copy a result to a zone of its own size.
+     *
+     * \param[in] result Result.
+     * \param[in] zone_size Size of the zone.
+     * \return Copied result.
+     */
+    [[nodiscard]] static messages::CallResult copy(
+        const messages::CallResult& result, std::size_t zone_size) {
+        // Zones with zero chunk size can't be expanded.
+        auto zone = std::make_shared<msgpack::zone>(
+            std::max<std::size_t>(zone_size, 1U));
+        const auto object = msgpack::object(result.object(), *zone);
+        if (result.is_error()) {
+            return messages::CallResult::create_error(object, std::move(zone));
+        }
+        return messages::CallResult::create_result(object, std::move(zone));
+    }
+
+    //! Cache.
+    util::impl::LruTtlCache<messages::CallResult> cache_;
+};
+
+/*!
+ * \brief Class of caches of responses of methods in clients.
+ */
+class ResponseCache {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] configs Configurations of caches for method names.
+     */
+    explicit ResponseCache(
+        const std::unordered_map<std::string, config::ResponseCacheConfig>&
+            configs) {
+        for (const auto& [method_name, config] : configs) {
+            caches_.try_emplace(
+                method_name, std::make_shared<MethodResponseCache>(config));
+        }
+    }
+
+    /*!
+     * \brief Find the cache of a method.
+     *
+     * \param[in] method_name Method name.
+     * \return Cache, or nullptr if the method has no cache.
+     */
+    [[nodiscard]] std::shared_ptr<MethodResponseCache> find(
+        messages::MethodNameView method_name) const {
+        if (caches_.empty()) {
+            return nullptr;
+        }
+        const auto iter = caches_.find(std::string(method_name.name()));
+        if (iter == caches_.end()) {
+            return nullptr;
+        }
+        return iter->second;
+    }
+
+private:
+    //! Caches of methods. (Not changed after construction.)
+    std::unordered_map<std::string, std::shared_ptr<MethodResponseCache>>
+        caches_{};
+};
+
+}  // namespace msgpack_rpc::clients::impl
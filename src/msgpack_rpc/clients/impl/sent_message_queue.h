@@ -19,14 +19,18 @@
  */
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <tuple>
 #include <utility>
 
+#include "msgpack_rpc/config/flow_control_config.h"
 #include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/transport/flow_controller.h"
 
 namespace msgpack_rpc::clients::impl {
 
@@ -35,20 +39,29 @@ namespace msgpack_rpc::clients::impl {
  */
 class SentMessageQueue {
 public:
-    //! Constructor.
-    SentMessageQueue() = default;
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] flow_control_config Configuration of flow control.
+     */
+    explicit SentMessageQueue(
+        const config::FlowControlConfig& flow_control_config =
+            config::FlowControlConfig())
+        : flow_controller_(flow_control_config) {}
 
     /*!
      * \brief Get the next message.
      *
-     * \return Next message and its message ID if exists.
+     * \return Next message, its message ID, and the deadline of the request
+     * to propagate if exists.
      */
     [[nodiscard]] std::tuple<std::optional<messages::SerializedMessage>,
-        std::optional<messages::MessageID>>
+        std::optional<messages::MessageID>,
+        std::optional<std::chrono::steady_clock::time_point>>
     next() {
         std::unique_lock<std::mutex> lock(mutex_);
         if (queue_.empty()) {
-            return {std::nullopt, std::nullopt};
+            return {std::nullopt, std::nullopt, std::nullopt};
         }
         return queue_.front();
     }
@@ -58,7 +71,16 @@ public:
      */
     void pop() {
         std::unique_lock<std::mutex> lock(mutex_);
+        if (queue_.empty()) {
+            return;
+        }
+        const bool is_released = flow_controller_.on_popped(
+            std::get<0>(queue_.front()).total_size());
         queue_.pop();
+        lock.unlock();
+        if (is_released) {
+            writable_condition_.notify_all();
+        }
     }
 
     /*!
@@ -66,21 +88,71 @@ public:
      *
      * \param[in] message Message.
      * \param[in] id Message ID (for requests).
+     * \param[in] deadline Deadline of the request to propagate.
      */
     void push(messages::SerializedMessage message,
-        std::optional<messages::MessageID> id = std::nullopt) {
+        std::optional<messages::MessageID> id = std::nullopt,
+        std::optional<std::chrono::steady_clock::time_point> deadline =
+            std::nullopt) {
         std::unique_lock<std::mutex> lock(mutex_);
-        queue_.emplace(std::move(message), id);
+        (void)flow_controller_.on_pushed(message.total_size());
+        queue_.emplace(std::move(message), id, deadline);
+    }
+
+    /*!
+     * \brief Push a message if it doesn't exceed the high watermarks of flow
+     * control.
+     *
+     * \param[in] message Message.
+     * \param[in] id Message ID (for requests).
+     * \param[in] deadline Deadline of the request to propagate.
+     * \retval true The message has been pushed.
+     * \retval false The message has been rejected.
+     */
+    [[nodiscard]] bool try_push(messages::SerializedMessage message,
+        std::optional<messages::MessageID> id = std::nullopt,
+        std::optional<std::chrono::steady_clock::time_point> deadline =
+            std::nullopt) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!flow_controller_.can_push(message.total_size())) {
+            return false;
+        }
+        (void)flow_controller_.on_pushed(message.total_size());
+        queue_.emplace(std::move(message), id, deadline);
+        return true;
+    }
+
+    /*!
+     * \brief Wait until messages can be pushed without exceeding the
+     * watermarks of flow control.
+     *
+     * \param[in] deadline Deadline.
+     * \retval true Messages can be pushed.
+     * \retval false Deadline has passed.
+     */
+    [[nodiscard]] bool wait_until_writable(
+        std::chrono::steady_clock::time_point deadline) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return writable_condition_.wait_until(
+            lock, deadline, [this] { return !flow_controller_.is_paused(); });
     }
 
 private:
-    //! Queue.
+    //! Queue of messages, their message IDs (for requests), and deadlines
+    //! of requests to propagate.
     std::queue<std::tuple<messages::SerializedMessage,
-        std::optional<messages::MessageID>>>
+        std::optional<messages::MessageID>,
+        std::optional<std::chrono::steady_clock::time_point>>>
         queue_{};
 
+    //! Flow controller of queue_.
+    transport::FlowController flow_controller_;
+
     //! Mutex.
     std::mutex mutex_{};
+
+    //! Condition variable notified when backpressure is released.
+    std::condition_variable writable_condition_{};
 };
 
 }  // namespace msgpack_rpc::clients::impl
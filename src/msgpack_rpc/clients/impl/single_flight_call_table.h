@@ -0,0 +1,191 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of SingleFlightCallTable class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "msgpack_rpc/clients/impl/call_future_impl.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Class of tables of RPCs in flight which identical calls share.
+ *
+ * Keys are serialized requests without message IDs, so calls share an RPC
+ * only when their method names and parameters are identical.
+ *
+ * Each call gets its own future object with its own deadline, which receives
+ * the result of the shared RPC. Cancellation of a call fails only the call,
+ * and the shared RPC is cancelled when all calls sharing it are cancelled.
+ */
+class SingleFlightCallTable
+    : public std::enable_shared_from_this<SingleFlightCallTable> {
+public:
+    /*!
+     * \brief Join an RPC in flight, or create an RPC if no identical RPC is in
+     * flight.
+     *
+     * \tparam Function Type of the function to create an RPC.
+     * \param[in] key Key of the RPC.
+     * \param[in] deadline Deadline of the call.
+     * \param[in] create Function to create and send an RPC.
+     * \return Future object of the call.
+     */
+    template <typename Function>
+    [[nodiscard]] std::shared_ptr<CallFutureImpl> find_or_create(
+        std::string key, std::chrono::steady_clock::time_point deadline,
+        Function&& create) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::shared_ptr<Entry> entry;
+        bool is_created = false;
+        const auto iter = calls_.find(key);
+        if (iter != calls_.end() && !iter->second->rpc->is_finished()) {
+            entry = iter->second;
+        } else {
+            entry = std::make_shared<Entry>(Entry{create(), key, 0U});
+            calls_.insert_or_assign(std::move(key), entry);
+            is_created = true;
+        }
+        ++entry->num_callers;
+        lock.unlock();
+        if (is_created) {
+            // The handler is called immediately if the RPC has already
+            // finished, so it's added without the lock.
+            add_erase_handler(entry);
+        }
+
+        auto future = std::make_shared<CallFutureImpl>(deadline);
+        future->set_cancel_handler(
+            [weak_self = weak_from_this(),
+                weak_entry = std::weak_ptr<Entry>(entry)] {
+                const auto self = weak_self.lock();
+                const auto locked_entry = weak_entry.lock();
+                if (self && locked_entry) {
+                    self->release(*locked_entry);
+                }
+            });
+        entry->rpc->add_completion_handler(
+            [weak_future = std::weak_ptr<CallFutureImpl>(future),
+                rpc = entry->rpc.get()] {
+                const auto locked_future = weak_future.lock();
+                if (locked_future) {
+                    locked_future->set_from(*rpc);
+                }
+            });
+        return future;
+    }
+
+    /*!
+     * \brief Get the number of RPCs in this table.
+     *
+     * \return Number of RPCs.
+     */
+    [[nodiscard]] std::size_t size() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return calls_.size();
+    }
+
+private:
+    /*!
+     * \brief Struct of RPCs shared by calls.
+     */
+    struct Entry {
+        //! Future object of the RPC.
+        std::shared_ptr<CallFutureImpl> rpc;
+
+        //! Key of the RPC.
+        std::string key;
+
+        //! Number of calls which share the RPC and haven't been cancelled.
+        std::size_t num_callers;
+    };
+
+    /*!
+     * \brief Add a handler to remove an RPC from this table when it finishes.
+     *
+     * \param[in] entry Entry of the RPC.
+     */
+    void add_erase_handler(const std::shared_ptr<Entry>& entry) {
+        entry->rpc->add_completion_handler(
+            [weak_self = weak_from_this(),
+                weak_entry = std::weak_ptr<Entry>(entry)] {
+                const auto self = weak_self.lock();
+                const auto locked_entry = weak_entry.lock();
+                if (self && locked_entry) {
+                    self->erase(locked_entry.get());
+                }
+            });
+    }
+
+    /*!
+     * \brief Release an RPC when a call sharing it is cancelled.
+     *
+     * \param[in] entry Entry of the RPC.
+     *
+     * The RPC is cancelled when no call shares it.
+     */
+    void release(Entry& entry) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (entry.num_callers == 0U || --entry.num_callers > 0U) {
+            return;
+        }
+        const auto rpc = entry.rpc;
+        // Remove the RPC so that later calls don't join it.
+        erase_impl(&entry);
+        lock.unlock();
+        rpc->cancel();
+    }
+
+    /*!
+     * \brief Remove an RPC from this table.
+     *
+     * \param[in] entry Entry of the RPC.
+     */
+    void erase(const Entry* entry) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        erase_impl(entry);
+    }
+
+    /*!
+     * \brief Remove an RPC from this table without locks.
+     *
+     * \param[in] entry Entry of the RPC.
+     */
+    void erase_impl(const Entry* entry) {
+        const auto iter = calls_.find(entry->key);
+        if (iter != calls_.end() && iter->second.get() == entry) {
+            calls_.erase(iter);
+        }
+    }
+
+    //! RPCs in flight.
+    std::unordered_map<std::string, std::shared_ptr<Entry>> calls_{};
+
+    //! Mutex of calls_ and the number of calls in entries.
+    std::mutex mutex_{};
+};
+
+}  // namespace msgpack_rpc::clients::impl
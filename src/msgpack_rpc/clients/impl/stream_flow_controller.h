@@ -0,0 +1,150 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of StreamFlowController class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "msgpack_rpc/clients/impl/call_list.h"
+#include "msgpack_rpc/clients/impl/client_connector.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/transport/i_connection.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Class to control the flow of streaming responses in clients.
+ *
+ * Reading of the connection is paused while any reader of streams has too
+ * many chunks not read yet, and timeouts of RPCs with streams are restarted
+ * whenever chunks are received or read.
+ */
+class StreamFlowController {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] call_list List of RPCs.
+     * \param[in] connector Connector of the connection.
+     * \param[in] logger Logger.
+     */
+    StreamFlowController(std::weak_ptr<CallList> call_list,
+        std::weak_ptr<ClientConnector> connector,
+        std::shared_ptr<logging::Logger> logger)
+        : call_list_(std::move(call_list)),
+          connector_(std::move(connector)),
+          logger_(std::move(logger)) {}
+
+    /*!
+     * \brief Handle a reader which has become full.
+     */
+    void on_reader_full() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++num_full_readers_;
+        if (num_full_readers_ != 1U) {
+            return;
+        }
+        MSGPACK_RPC_DEBUG(logger_,
+            "Too many chunks of a stream are queued, so pause reading.");
+        // Called in the lock so that the order of pausing and resuming is
+        // kept.
+        const auto connection = this->connection();
+        if (connection) {
+            connection->pause_reading();
+        }
+    }
+
+    /*!
+     * \brief Handle a reader which has been drained.
+     */
+    void on_reader_drained() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (num_full_readers_ == 0U) {
+            return;
+        }
+        --num_full_readers_;
+        if (num_full_readers_ != 0U) {
+            return;
+        }
+        MSGPACK_RPC_DEBUG(
+            logger_, "Chunks of streams have been drained, so resume reading.");
+        const auto connection = this->connection();
+        if (connection) {
+            connection->resume_reading();
+        }
+    }
+
+    /*!
+     * \brief Check whether reading is paused.
+     *
+     * \retval true Reading is paused.
+     * \retval false Otherwise.
+     */
+    [[nodiscard]] bool is_reading_paused() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return num_full_readers_ > 0U;
+    }
+
+    /*!
+     * \brief Restart the timeout of an RPC with a stream.
+     *
+     * \param[in] request_id Message ID of the request of the RPC.
+     */
+    void on_progress(messages::MessageID request_id) {
+        const auto call_list = call_list_.lock();
+        if (call_list) {
+            call_list->extend_timeout(request_id);
+        }
+    }
+
+private:
+    /*!
+     * \brief Get the current connection.
+     *
+     * \return Connection, or nullptr if not connected.
+     */
+    [[nodiscard]] std::shared_ptr<transport::IConnection> connection() {
+        const auto connector = connector_.lock();
+        if (!connector) {
+            return nullptr;
+        }
+        return connector->connection();
+    }
+
+    //! List of RPCs.
+    std::weak_ptr<CallList> call_list_;
+
+    //! Connector of the connection.
+    std::weak_ptr<ClientConnector> connector_;
+
+    //! Logger.
+    std::shared_ptr<logging::Logger> logger_;
+
+    //! Number of readers which have too many chunks not read yet.
+    std::size_t num_full_readers_{0};
+
+    //! Mutex of num_full_readers_.
+    std::mutex mutex_{};
+};
+
+}  // namespace msgpack_rpc::clients::impl
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of StreamList class.
+ */
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/clients/impl/stream_reader_impl.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Class of lists of RPCs with streaming responses.
+ */
+class StreamList {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] logger Logger.
+     */
+    explicit StreamList(std::shared_ptr<logging::Logger> logger)
+        : logger_(std::move(logger)) {}
+
+    /*!
+     * \brief Add a reader of a stream.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] reader Reader.
+     */
+    void add(messages::MessageID request_id,
+        const std::shared_ptr<StreamReaderImpl>& reader) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        readers_.insert_or_assign(request_id, reader);
+    }
+
+    /*!
+     * \brief Remove a reader of a stream.
+     *
+     * \param[in] request_id Message ID of the request.
+     */
+    void remove(messages::MessageID request_id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        readers_.erase(request_id);
+    }
+
+    /*!
+     * \brief Handle a notification of a chunk.
+     *
+     * \param[in] notification Notification.
+     */
+    void handle(const messages::ParsedNotification& notification) {
+        const auto& parameters = notification.parameters();
+        messages::MessageID request_id{};
+        try {
+            request_id = std::get<0>(
+                parameters.as<messages::MessageID, msgpack::object>());
+        } catch (const std::exception& e) {
+            MSGPACK_RPC_WARN(
+                logger_, "Received an invalid chunk of a stream: {}", e.what());
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = readers_.find(request_id);
+        if (iter == readers_.end()) {
+            MSGPACK_RPC_DEBUG(logger_,
+                "Received a chunk of an unknown stream (id: {}).", request_id);
+            return;
+        }
+        const auto reader = iter->second.lock();
+        lock.unlock();
+        if (reader) {
+            reader->push(parameters);
+        }
+    }
+
+private:
+    //! Readers of streams.
+    std::unordered_map<messages::MessageID, std::weak_ptr<StreamReaderImpl>>
+        readers_{};
+
+    //! Mutex of readers_.
+    std::mutex mutex_{};
+
+    //! Logger.
+    std::shared_ptr<logging::Logger> logger_;
+};
+
+}  // namespace msgpack_rpc::clients::impl
@@ -0,0 +1,213 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of StreamReaderImpl class.
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "msgpack_rpc/clients/impl/call_future_impl.h"
+#include "msgpack_rpc/clients/impl/i_stream_reader_impl.h"
+#include "msgpack_rpc/clients/impl/stream_flow_controller.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/parsed_parameters.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Maximum number of chunks of a stream received but not read yet
+ * before reading of the connection is paused.
+ */
+constexpr std::size_t STREAM_READER_QUEUE_SIZE = 64;
+
+/*!
+ * \brief Class of internal implementation of readers of streaming
+ * responses.
+ *
+ * When STREAM_READER_QUEUE_SIZE chunks are queued, reading of the connection
+ * is paused until a half of them are read. Timeout applies to the time
+ * without progress of the stream instead of the whole stream.
+ */
+class StreamReaderImpl final : public IStreamReaderImpl {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] future Future object of the RPC.
+     * \param[in] timeout Timeout of waiting for each chunk.
+     * \param[in] flow_controller Controller of the flow of streams, or nullptr
+     * to disable flow control.
+     * \param[in] max_queued_chunks Maximum number of queued chunks.
+     */
+    StreamReaderImpl(messages::MessageID request_id,
+        std::shared_ptr<CallFutureImpl> future,
+        std::chrono::nanoseconds timeout,
+        std::shared_ptr<StreamFlowController> flow_controller = nullptr,
+        std::size_t max_queued_chunks = STREAM_READER_QUEUE_SIZE)
+        : request_id_(request_id),
+          future_(std::move(future)),
+          timeout_(timeout),
+          last_progress_time_(std::chrono::steady_clock::now()),
+          flow_controller_(std::move(flow_controller)),
+          max_queued_chunks_(max_queued_chunks) {}
+
+    StreamReaderImpl(const StreamReaderImpl&) = delete;
+    StreamReaderImpl(StreamReaderImpl&&) = delete;
+    StreamReaderImpl& operator=(const StreamReaderImpl&) = delete;
+    StreamReaderImpl& operator=(StreamReaderImpl&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~StreamReaderImpl() noexcept override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        release_pause();
+    }
+
+    /*!
+     * \brief Push a received chunk.
+     *
+     * \param[in] chunk Parameters of the notification of the chunk.
+     */
+    void push(messages::ParsedParameters chunk) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            chunks_.push_back(std::move(chunk));
+            last_progress_time_ = std::chrono::steady_clock::now();
+            if (flow_controller_ && !is_full_ &&
+                chunks_.size() >= max_queued_chunks_) {
+                is_full_ = true;
+                // Called in the lock so that the order of pausing and
+                // resuming is kept.
+                flow_controller_->on_reader_full();
+            }
+        }
+        cond_var_.notify_all();
+        if (flow_controller_) {
+            flow_controller_->on_progress(request_id_);
+        }
+    }
+
+    /*!
+     * \brief Handle the end of the stream.
+     *
+     * \note This function is called when the RPC finishes.
+     */
+    void finish() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            is_finished_ = true;
+            // No more chunk will be received.
+            release_pause();
+        }
+        cond_var_.notify_all();
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IStreamReaderImpl::next
+    [[nodiscard]] std::optional<messages::ParsedParameters> next() override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cond_var_.wait_until(lock, last_progress_time_ + timeout_,
+                [this] { return !chunks_.empty() || is_finished_; })) {
+            throw MsgpackRPCException(StatusCode::TIMEOUT,
+                "Chunks of a stream couldn't be received within a timeout.");
+        }
+        if (chunks_.empty()) {
+            return std::nullopt;
+        }
+        auto chunk = std::move(chunks_.front());
+        chunks_.pop_front();
+        last_progress_time_ = std::chrono::steady_clock::now();
+        if (is_full_ && chunks_.size() <= max_queued_chunks_ / 2U) {
+            release_pause();
+        }
+        const bool is_finished = is_finished_;
+        lock.unlock();
+        if (flow_controller_ && !is_finished) {
+            flow_controller_->on_progress(request_id_);
+        }
+        return chunk;
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IStreamReaderImpl::result
+    [[nodiscard]] messages::CallResult result() override {
+        return future_->get_result();
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IStreamReaderImpl::cancel
+    void cancel() override { future_->cancel(); }
+
+private:
+    /*!
+     * \brief Resume reading of the connection if this reader paused it.
+     *
+     * \note mutex_ must be locked.
+     */
+    void release_pause() {
+        if (!is_full_) {
+            return;
+        }
+        is_full_ = false;
+        flow_controller_->on_reader_drained();
+    }
+
+    //! Message ID of the request.
+    messages::MessageID request_id_;
+
+    //! Future object of the RPC.
+    std::shared_ptr<CallFutureImpl> future_;
+
+    //! Timeout of waiting for each chunk.
+    std::chrono::nanoseconds timeout_;
+
+    //! Time when a chunk was received or read last.
+    std::chrono::steady_clock::time_point last_progress_time_;
+
+    //! Controller of the flow of streams.
+    std::shared_ptr<StreamFlowController> flow_controller_;
+
+    //! Maximum number of queued chunks.
+    std::size_t max_queued_chunks_;
+
+    //! Received chunks not read yet.
+    std::deque<messages::ParsedParameters> chunks_{};
+
+    //! Whether this reader has paused reading of the connection.
+    bool is_full_{false};
+
+    //! Whether the RPC has finished.
+    bool is_finished_{false};
+
+    //! Mutex of chunks_, is_full_, is_finished_, and last_progress_time_.
+    std::mutex mutex_{};
+
+    //! Condition variable to wait for chunks.
+    std::condition_variable cond_var_{};
+};
+
+}  // namespace msgpack_rpc::clients::impl
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of UploadList class.
+ */
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "msgpack_rpc/clients/impl/upload_writer_impl.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Class of lists of RPCs with uploads.
+ */
+class UploadList {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] logger Logger.
+     */
+    explicit UploadList(std::shared_ptr<logging::Logger> logger)
+        : logger_(std::move(logger)) {}
+
+    /*!
+     * \brief Add a writer of an upload.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] writer Writer.
+     */
+    void add(messages::MessageID request_id,
+        const std::shared_ptr<UploadWriterImpl>& writer) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        writers_.insert_or_assign(request_id, writer);
+    }
+
+    /*!
+     * \brief Remove a writer of an upload.
+     *
+     * \param[in] request_id Message ID of the request.
+     */
+    void remove(messages::MessageID request_id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        writers_.erase(request_id);
+    }
+
+    /*!
+     * \brief Handle a notification of an acknowledgement of a chunk.
+     *
+     * \param[in] notification Notification.
+     */
+    void handle(const messages::ParsedNotification& notification) {
+        messages::MessageID request_id{};
+        try {
+            request_id = std::get<0>(
+                notification.parameters().as<messages::MessageID>());
+        } catch (const std::exception& e) {
+            MSGPACK_RPC_WARN(logger_,
+                "Received an invalid acknowledgement of an upload: {}",
+                e.what());
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = writers_.find(request_id);
+        if (iter == writers_.end()) {
+            MSGPACK_RPC_DEBUG(logger_,
+                "Received an acknowledgement of an unknown upload (id: {}).",
+                request_id);
+            return;
+        }
+        const auto writer = iter->second.lock();
+        lock.unlock();
+        if (writer) {
+            writer->on_ack();
+        }
+    }
+
+private:
+    //! Writers of uploads.
+    std::unordered_map<messages::MessageID, std::weak_ptr<UploadWriterImpl>>
+        writers_{};
+
+    //! Mutex of writers_.
+    std::mutex mutex_{};
+
+    //! Logger.
+    std::shared_ptr<logging::Logger> logger_;
+};
+
+}  // namespace msgpack_rpc::clients::impl
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of UploadWriterImpl class.
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "msgpack_rpc/clients/impl/call_future_impl.h"
+#include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/clients/impl/i_upload_writer_impl.h"
+#include "msgpack_rpc/clients/impl/message_sender.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+namespace msgpack_rpc::clients::impl {
+
+/*!
+ * \brief Class of internal implementation of writers of uploads.
+ *
+ * At most a fixed number of chunks are sent without acknowledgements of
+ * consumption from the server.
+ */
+class UploadWriterImpl final : public IUploadWriterImpl {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] future Future object of the RPC.
+     * \param[in] sender Sender of messages.
+     * \param[in] window_size Maximum number of chunks not consumed in the
+     * server.
+     * \param[in] deadline Deadline of the RPC.
+     */
+    UploadWriterImpl(messages::MessageID request_id,
+        std::shared_ptr<CallFutureImpl> future,
+        std::weak_ptr<MessageSender> sender, std::size_t window_size,
+        std::chrono::steady_clock::time_point deadline)
+        : request_id_(request_id),
+          future_(std::move(future)),
+          sender_(std::move(sender)),
+          window_size_(window_size),
+          deadline_(deadline) {}
+
+    /*!
+     * \brief Handle an acknowledgement of a consumed chunk.
+     */
+    void on_ack() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (num_unconsumed_chunks_ > 0U) {
+                --num_unconsumed_chunks_;
+            }
+        }
+        cond_var_.notify_all();
+    }
+
+    /*!
+     * \brief Handle the end of the RPC.
+     */
+    void on_finished() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            is_finished_ = true;
+        }
+        cond_var_.notify_all();
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IUploadWriterImpl::request_id
+    [[nodiscard]] messages::MessageID request_id() const noexcept override {
+        return request_id_;
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IUploadWriterImpl::write
+    void write(messages::SerializedMessage chunk) override {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (is_ended_) {
+                throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
+                    "The upload has already been finished.");
+            }
+            if (!cond_var_.wait_until(lock, deadline_, [this] {
+                    return is_finished_ ||
+                        num_unconsumed_chunks_ < window_size_;
+                })) {
+                throw MsgpackRPCException(StatusCode::TIMEOUT,
+                    "Chunks of an upload couldn't be sent within a timeout.");
+            }
+            if (is_finished_) {
+                throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
+                    "The RPC of the upload has already finished.");
+            }
+            ++num_unconsumed_chunks_;
+        }
+        send(std::move(chunk));
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IUploadWriterImpl::finish
+    [[nodiscard]] std::shared_ptr<ICallFutureImpl> finish() override {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (is_ended_) {
+                return future_;
+            }
+            is_ended_ = true;
+        }
+        send(messages::MessageSerializer::serialize_notification(
+            messages::MethodNameView(messages::UPLOAD_END_METHOD_NAME),
+            request_id_));
+        return future_;
+    }
+
+    //! \copydoc msgpack_rpc::clients::impl::IUploadWriterImpl::cancel
+    void cancel() override { future_->cancel(); }
+
+private:
+    /*!
+     * \brief Send a message.
+     *
+     * \param[in] message Message.
+     */
+    void send(messages::SerializedMessage message) {
+        const auto sender = sender_.lock();
+        if (!sender) {
+            throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
+                "The client has been stopped.");
+        }
+        sender->wait_until_sendable(
+            deadline_ - std::chrono::steady_clock::now());
+        sender->send(std::move(message));
+    }
+
+    //! Message ID of the request.
+    messages::MessageID request_id_;
+
+    //! Future object of the RPC.
+    std::shared_ptr<CallFutureImpl> future_;
+
+    //! Sender of messages.
+    std::weak_ptr<MessageSender> sender_;
+
+    //! Maximum number of chunks not consumed in the server.
+    std::size_t window_size_;
+
+    //! Deadline of the RPC.
+    std::chrono::steady_clock::time_point deadline_;
+
+    //! Number of chunks sent but not consumed in the server.
+    std::size_t num_unconsumed_chunks_{0};
+
+    //! Whether the upload has been finished by the client.
+    bool is_ended_{false};
+
+    //! Whether the RPC has finished.
+    bool is_finished_{false};
+
+    //! Mutex of the states.
+    std::mutex mutex_{};
+
+    //! Condition variable to wait for acknowledgements.
+    std::condition_variable cond_var_{};
+};
+
+}  // namespace msgpack_rpc::clients::impl
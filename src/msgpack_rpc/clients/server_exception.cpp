@@ -19,18 +19,63 @@
  */
 #include "msgpack_rpc/clients/server_exception.h"
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include <fmt/format.h>
 
+#include "msgpack_rpc/messages/reserved_error_keys.h"
 #include "msgpack_rpc/util/format_msgpack_object.h"
 
 namespace msgpack_rpc::clients {
 
+namespace {
+
+/*!
+ * \brief Check whether an object is a string with a value.
+ *
+ * \param[in] object Object.
+ * \param[in] value Value.
+ * \retval true The object is the string.
+ * \retval false Otherwise.
+ */
+bool is_string_of(
+    const msgpack::object& object, std::string_view value) noexcept {
+    return object.type == msgpack::type::STR &&
+        std::string_view(object.via.str.ptr, object.via.str.size) == value;
+}
+
+/*!
+ * \brief Get the status code of an error in a server.
+ *
+ * Only errors sent by this library itself have status codes other than
+ * StatusCode::SERVER_ERROR. (Refer to messages::ERROR_CODE_KEY.)
+ *
+ * \param[in] object Object specifying the error.
+ * \return Status code.
+ */
+StatusCode status_code_of(const msgpack::object& object) noexcept {
+    if (object.type != msgpack::type::MAP) {
+        return StatusCode::SERVER_ERROR;
+    }
+    for (std::uint32_t i = 0; i < object.via.map.size; ++i) {
+        const auto& pair = object.via.map.ptr[i];
+        if (is_string_of(pair.key, messages::ERROR_CODE_KEY) &&
+            is_string_of(
+                pair.val, format_status_code(StatusCode::OVERLOADED))) {
+            return StatusCode::OVERLOADED;
+        }
+    }
+    return StatusCode::SERVER_ERROR;
+}
+
+}  // namespace
+
 ServerException::ServerException(
     msgpack::object object, std::shared_ptr<msgpack::zone> zone)
-    : MsgpackRPCException(StatusCode::SERVER_ERROR,
+    : MsgpackRPCException(status_code_of(object),
           fmt::format(
               "An error in a server: {}", util::format_msgpack_object(object))),
       zone_(std::move(zone)),
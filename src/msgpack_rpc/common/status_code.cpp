@@ -46,6 +46,8 @@ std::string_view format_status_code(StatusCode code) noexcept {
         return "TIMEOUT";
     case StatusCode::SERVER_ERROR:
         return "SERVER_ERROR";
+    case StatusCode::OVERLOADED:
+        return "OVERLOADED";
     case StatusCode::UNEXPECTED_ERROR:
         return "UNEXPECTED_ERROR";
     }
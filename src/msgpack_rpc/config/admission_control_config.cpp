@@ -0,0 +1,62 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of AdmissionControlConfig class.
+ */
+#include "msgpack_rpc/config/admission_control_config.h"
+
+#include <cstddef>
+
+namespace msgpack_rpc::config {
+
+AdmissionControlConfig::AdmissionControlConfig()
+    : max_connections_(0),
+      max_in_flight_per_connection_(0),
+      max_in_flight_requests_(0) {}
+
+AdmissionControlConfig& AdmissionControlConfig::max_connections(
+    std::size_t value) noexcept {
+    max_connections_ = value;
+    return *this;
+}
+
+std::size_t AdmissionControlConfig::max_connections() const noexcept {
+    return max_connections_;
+}
+
+AdmissionControlConfig& AdmissionControlConfig::max_in_flight_per_connection(
+    std::size_t value) noexcept {
+    max_in_flight_per_connection_ = value;
+    return *this;
+}
+
+std::size_t AdmissionControlConfig::max_in_flight_per_connection()
+    const noexcept {
+    return max_in_flight_per_connection_;
+}
+
+AdmissionControlConfig& AdmissionControlConfig::max_in_flight_requests(
+    std::size_t value) noexcept {
+    max_in_flight_requests_ = value;
+    return *this;
+}
+
+std::size_t AdmissionControlConfig::max_in_flight_requests() const noexcept {
+    return max_in_flight_requests_;
+}
+
+}  // namespace msgpack_rpc::config
@@ -21,7 +21,9 @@
 
 #include <chrono>
 #include <ratio>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 
 #include "msgpack_rpc/addresses/uri.h"
@@ -36,7 +38,8 @@ constexpr auto CLIENT_CONFIG_CALL_TIMEOUT = std::chrono::seconds(15);
 
 }  // namespace
 
-ClientConfig::ClientConfig() : call_timeout_(CLIENT_CONFIG_CALL_TIMEOUT) {}
+ClientConfig::ClientConfig()
+    : call_timeout_(CLIENT_CONFIG_CALL_TIMEOUT), propagate_deadline_(false) {}
 
 ClientConfig& ClientConfig::add_uri(addresses::URI uri) {
     uris_.push_back(std::move(uri));
@@ -64,6 +67,37 @@ std::chrono::nanoseconds ClientConfig::call_timeout() const noexcept {
     return call_timeout_;
 }
 
+ClientConfig& ClientConfig::propagate_deadline(bool value) noexcept {
+    propagate_deadline_ = value;
+    return *this;
+}
+
+bool ClientConfig::propagate_deadline() const noexcept {
+    return propagate_deadline_;
+}
+
+ClientConfig& ClientConfig::add_single_flight_method(
+    std::string_view method_name) {
+    single_flight_methods_.emplace_back(method_name);
+    return *this;
+}
+
+const std::vector<std::string>& ClientConfig::single_flight_methods()
+    const noexcept {
+    return single_flight_methods_;
+}
+
+ClientConfig& ClientConfig::add_response_cache(
+    std::string_view method_name, const ResponseCacheConfig& config) {
+    response_caches_.insert_or_assign(std::string(method_name), config);
+    return *this;
+}
+
+const std::unordered_map<std::string, ResponseCacheConfig>&
+ClientConfig::response_caches() const noexcept {
+    return response_caches_;
+}
+
 MessageParserConfig& ClientConfig::message_parser() noexcept {
     return message_parser_;
 }
@@ -86,4 +120,30 @@ const ReconnectionConfig& ClientConfig::reconnection() const noexcept {
     return reconnection_;
 }
 
+SocketConfig& ClientConfig::socket() noexcept { return socket_; }
+
+const SocketConfig& ClientConfig::socket() const noexcept { return socket_; }
+
+CompressionConfig& ClientConfig::compression() noexcept { return compression_; }
+
+const CompressionConfig& ClientConfig::compression() const noexcept {
+    return compression_;
+}
+
+TrafficCaptureConfig& ClientConfig::traffic_capture() noexcept {
+    return traffic_capture_;
+}
+
+const TrafficCaptureConfig& ClientConfig::traffic_capture() const noexcept {
+    return traffic_capture_;
+}
+
+FlowControlConfig& ClientConfig::flow_control() noexcept {
+    return flow_control_;
+}
+
+const FlowControlConfig& ClientConfig::flow_control() const noexcept {
+    return flow_control_;
+}
+
 }  // namespace msgpack_rpc::config
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of CompressionConfig class.
+ */
+#include "msgpack_rpc/config/compression_config.h"
+
+#include <cstddef>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+
+namespace msgpack_rpc::config {
+
+namespace {
+
+//! Default minimum size of messages to compress.
+constexpr std::size_t COMPRESSION_CONFIG_DEFAULT_MIN_MESSAGE_SIZE =
+    static_cast<std::size_t>(16) * 1024;
+
+}  // namespace
+
+CompressionConfig::CompressionConfig()
+    : enabled_(false),
+      min_message_size_(COMPRESSION_CONFIG_DEFAULT_MIN_MESSAGE_SIZE) {}
+
+CompressionConfig& CompressionConfig::enabled(bool value) noexcept {
+    enabled_ = value;
+    return *this;
+}
+
+bool CompressionConfig::enabled() const noexcept { return enabled_; }
+
+CompressionConfig& CompressionConfig::min_message_size(std::size_t value) {
+    if (value <= 0U) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Minimum size of messages to compress must be at least one.");
+    }
+    min_message_size_ = value;
+    return *this;
+}
+
+std::size_t CompressionConfig::min_message_size() const noexcept {
+    return min_message_size_;
+}
+
+}  // namespace msgpack_rpc::config
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of FlowControlConfig class.
+ */
+#include "msgpack_rpc/config/flow_control_config.h"
+
+#include <cstddef>
+
+namespace msgpack_rpc::config {
+
+namespace {
+
+constexpr auto FLOW_CONTROL_CONFIG_DEFAULT_HIGH_WATERMARK_BYTES =
+    static_cast<std::size_t>(64) * 1024 * 1024;
+
+constexpr auto FLOW_CONTROL_CONFIG_DEFAULT_LOW_WATERMARK_BYTES =
+    static_cast<std::size_t>(32) * 1024 * 1024;
+
+}  // namespace
+
+FlowControlConfig::FlowControlConfig()
+    : high_watermark_bytes_(FLOW_CONTROL_CONFIG_DEFAULT_HIGH_WATERMARK_BYTES),
+      low_watermark_bytes_(FLOW_CONTROL_CONFIG_DEFAULT_LOW_WATERMARK_BYTES),
+      high_watermark_messages_(0),
+      low_watermark_messages_(0) {}
+
+FlowControlConfig& FlowControlConfig::high_watermark_bytes(
+    std::size_t value) noexcept {
+    high_watermark_bytes_ = value;
+    return *this;
+}
+
+std::size_t FlowControlConfig::high_watermark_bytes() const noexcept {
+    return high_watermark_bytes_;
+}
+
+FlowControlConfig& FlowControlConfig::low_watermark_bytes(
+    std::size_t value) noexcept {
+    low_watermark_bytes_ = value;
+    return *this;
+}
+
+std::size_t FlowControlConfig::low_watermark_bytes() const noexcept {
+    return low_watermark_bytes_;
+}
+
+FlowControlConfig& FlowControlConfig::high_watermark_messages(
+    std::size_t value) noexcept {
+    high_watermark_messages_ = value;
+    return *this;
+}
+
+std::size_t FlowControlConfig::high_watermark_messages() const noexcept {
+    return high_watermark_messages_;
+}
+
+FlowControlConfig& FlowControlConfig::low_watermark_messages(
+    std::size_t value) noexcept {
+    low_watermark_messages_ = value;
+    return *this;
+}
+
+std::size_t FlowControlConfig::low_watermark_messages() const noexcept {
+    return low_watermark_messages_;
+}
+
+}  // namespace msgpack_rpc::config
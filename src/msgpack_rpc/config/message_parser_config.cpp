@@ -26,9 +26,18 @@
 
 namespace msgpack_rpc::config {
 
+namespace {
+
+//! Default maximum size of a message.
+constexpr auto MESSAGE_PARSER_CONFIG_DEFAULT_MAX_MESSAGE_SIZE =
+    static_cast<std::size_t>(64) * 1024 * 1024;  // 64 MiB.
+
+}  // namespace
+
 MessageParserConfig::MessageParserConfig()
     : read_buffer_size_(
-          static_cast<std::size_t>(MSGPACK_UNPACKER_RESERVE_SIZE)) {}
+          static_cast<std::size_t>(MSGPACK_UNPACKER_RESERVE_SIZE)),
+      max_message_size_(MESSAGE_PARSER_CONFIG_DEFAULT_MAX_MESSAGE_SIZE) {}
 
 MessageParserConfig& MessageParserConfig::read_buffer_size(std::size_t value) {
     if (value <= 0U) {
@@ -43,4 +52,17 @@ std::size_t MessageParserConfig::read_buffer_size() const noexcept {
     return read_buffer_size_;
 }
 
+MessageParserConfig& MessageParserConfig::max_message_size(std::size_t value) {
+    if (value <= 0U) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Maximum size of a message must be at least one.");
+    }
+    max_message_size_ = value;
+    return *this;
+}
+
+std::size_t MessageParserConfig::max_message_size() const noexcept {
+    return max_message_size_;
+}
+
 }  // namespace msgpack_rpc::config
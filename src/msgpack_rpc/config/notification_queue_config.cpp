@@ -0,0 +1,58 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of NotificationQueueConfig class.
+ */
+#include "msgpack_rpc/config/notification_queue_config.h"
+
+#include <cstddef>
+
+namespace msgpack_rpc::config {
+
+namespace {
+
+constexpr std::size_t
+    NOTIFICATION_QUEUE_CONFIG_DEFAULT_MAX_QUEUED_NOTIFICATIONS = 1024;
+
+}  // namespace
+
+NotificationQueueConfig::NotificationQueueConfig()
+    : max_queued_notifications_(
+          NOTIFICATION_QUEUE_CONFIG_DEFAULT_MAX_QUEUED_NOTIFICATIONS),
+      disconnect_slow_consumers_(false) {}
+
+NotificationQueueConfig& NotificationQueueConfig::max_queued_notifications(
+    std::size_t value) noexcept {
+    max_queued_notifications_ = value;
+    return *this;
+}
+
+std::size_t NotificationQueueConfig::max_queued_notifications() const noexcept {
+    return max_queued_notifications_;
+}
+
+NotificationQueueConfig& NotificationQueueConfig::disconnect_slow_consumers(
+    bool value) noexcept {
+    disconnect_slow_consumers_ = value;
+    return *this;
+}
+
+bool NotificationQueueConfig::disconnect_slow_consumers() const noexcept {
+    return disconnect_slow_consumers_;
+}
+
+}  // namespace msgpack_rpc::config
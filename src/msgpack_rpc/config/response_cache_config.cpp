@@ -0,0 +1,88 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of ResponseCacheConfig class.
+ */
+#include "msgpack_rpc/config/response_cache_config.h"
+
+#include <chrono>
+#include <cstddef>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+
+namespace msgpack_rpc::config {
+
+namespace {
+
+constexpr auto RESPONSE_CACHE_CONFIG_DEFAULT_TIME_TO_LIVE =
+    std::chrono::seconds(1);
+
+constexpr auto RESPONSE_CACHE_CONFIG_DEFAULT_MAX_ENTRIES =
+    static_cast<std::size_t>(1024);
+
+constexpr auto RESPONSE_CACHE_CONFIG_DEFAULT_MAX_BYTES =
+    static_cast<std::size_t>(64) * 1024 * 1024;
+
+}  // namespace
+
+ResponseCacheConfig::ResponseCacheConfig()
+    : time_to_live_(RESPONSE_CACHE_CONFIG_DEFAULT_TIME_TO_LIVE),
+      max_entries_(RESPONSE_CACHE_CONFIG_DEFAULT_MAX_ENTRIES),
+      max_bytes_(RESPONSE_CACHE_CONFIG_DEFAULT_MAX_BYTES) {}
+
+ResponseCacheConfig& ResponseCacheConfig::time_to_live(
+    std::chrono::nanoseconds value) {
+    if (value <= std::chrono::nanoseconds(0)) {
+        throw MsgpackRPCException(
+            StatusCode::INVALID_ARGUMENT, "Duration must be longer than zero.");
+    }
+    time_to_live_ = value;
+    return *this;
+}
+
+std::chrono::nanoseconds ResponseCacheConfig::time_to_live() const noexcept {
+    return time_to_live_;
+}
+
+ResponseCacheConfig& ResponseCacheConfig::max_entries(std::size_t value) {
+    if (value == 0U) {
+        throw MsgpackRPCException(
+            StatusCode::INVALID_ARGUMENT, "Value must be at least one.");
+    }
+    max_entries_ = value;
+    return *this;
+}
+
+std::size_t ResponseCacheConfig::max_entries() const noexcept {
+    return max_entries_;
+}
+
+ResponseCacheConfig& ResponseCacheConfig::max_bytes(std::size_t value) {
+    if (value == 0U) {
+        throw MsgpackRPCException(
+            StatusCode::INVALID_ARGUMENT, "Value must be at least one.");
+    }
+    max_bytes_ = value;
+    return *this;
+}
+
+std::size_t ResponseCacheConfig::max_bytes() const noexcept {
+    return max_bytes_;
+}
+
+}  // namespace msgpack_rpc::config
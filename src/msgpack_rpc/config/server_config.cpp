@@ -19,13 +19,27 @@
  */
 #include "msgpack_rpc/config/server_config.h"
 
+#include <chrono>
 #include <string_view>
 
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
 
 namespace msgpack_rpc::config {
 
-ServerConfig::ServerConfig() = default;
+namespace {
+
+constexpr auto SERVER_CONFIG_UPLOAD_IDLE_TIMEOUT = std::chrono::seconds(15);
+
+constexpr auto SERVER_CONFIG_CALL_TIMEOUT = std::chrono::seconds(15);
+
+}  // namespace
+
+ServerConfig::ServerConfig()
+    : upload_idle_timeout_(SERVER_CONFIG_UPLOAD_IDLE_TIMEOUT),
+      call_timeout_(SERVER_CONFIG_CALL_TIMEOUT),
+      propagate_deadline_(false) {}
 
 ServerConfig& ServerConfig::add_uri(const addresses::URI& uri) {
     uris_.push_back(uri);
@@ -40,6 +54,42 @@ const std::vector<addresses::URI>& ServerConfig::uris() const noexcept {
     return uris_;
 }
 
+ServerConfig& ServerConfig::upload_idle_timeout(
+    std::chrono::nanoseconds value) {
+    if (value <= std::chrono::nanoseconds(0)) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Duration of timeout must be longer than zero.");
+    }
+    upload_idle_timeout_ = value;
+    return *this;
+}
+
+std::chrono::nanoseconds ServerConfig::upload_idle_timeout() const noexcept {
+    return upload_idle_timeout_;
+}
+
+ServerConfig& ServerConfig::call_timeout(std::chrono::nanoseconds value) {
+    if (value <= std::chrono::nanoseconds(0)) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Duration of timeout must be longer than zero.");
+    }
+    call_timeout_ = value;
+    return *this;
+}
+
+std::chrono::nanoseconds ServerConfig::call_timeout() const noexcept {
+    return call_timeout_;
+}
+
+ServerConfig& ServerConfig::propagate_deadline(bool value) noexcept {
+    propagate_deadline_ = value;
+    return *this;
+}
+
+bool ServerConfig::propagate_deadline() const noexcept {
+    return propagate_deadline_;
+}
+
 MessageParserConfig& ServerConfig::message_parser() noexcept {
     return message_parser_;
 }
@@ -54,4 +104,47 @@ const ExecutorConfig& ServerConfig::executor() const noexcept {
     return executor_;
 }
 
+SocketConfig& ServerConfig::socket() noexcept { return socket_; }
+
+const SocketConfig& ServerConfig::socket() const noexcept { return socket_; }
+
+CompressionConfig& ServerConfig::compression() noexcept { return compression_; }
+
+const CompressionConfig& ServerConfig::compression() const noexcept {
+    return compression_;
+}
+
+TrafficCaptureConfig& ServerConfig::traffic_capture() noexcept {
+    return traffic_capture_;
+}
+
+const TrafficCaptureConfig& ServerConfig::traffic_capture() const noexcept {
+    return traffic_capture_;
+}
+
+FlowControlConfig& ServerConfig::flow_control() noexcept {
+    return flow_control_;
+}
+
+const FlowControlConfig& ServerConfig::flow_control() const noexcept {
+    return flow_control_;
+}
+
+AdmissionControlConfig& ServerConfig::admission_control() noexcept {
+    return admission_control_;
+}
+
+const AdmissionControlConfig& ServerConfig::admission_control() const noexcept {
+    return admission_control_;
+}
+
+NotificationQueueConfig& ServerConfig::notification_queue() noexcept {
+    return notification_queue_;
+}
+
+const NotificationQueueConfig& ServerConfig::notification_queue()
+    const noexcept {
+    return notification_queue_;
+}
+
 }  // namespace msgpack_rpc::config
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of SocketConfig class.
+ */
+#include "msgpack_rpc/config/socket_config.h"
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+
+namespace msgpack_rpc::config {
+
+namespace {
+
+/*!
+ * \brief Maximum value of integer options.
+ *
+ * Socket options are given as int values in the operating system.
+ */
+constexpr auto SOCKET_CONFIG_MAX_INTEGER =
+    static_cast<std::size_t>(std::numeric_limits<int>::max());
+
+/*!
+ * \brief Check an integer value of an option.
+ *
+ * \param[in] value Value.
+ */
+void check_integer_option(std::size_t value) {
+    if (value > SOCKET_CONFIG_MAX_INTEGER) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Value of a socket option is too large.");
+    }
+}
+
+/*!
+ * \brief Check a duration of an option.
+ *
+ * \param[in] value Value.
+ */
+void check_duration_option(std::chrono::nanoseconds value) {
+    if (value < std::chrono::nanoseconds(0)) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Duration must be larger than or equal to zero.");
+    }
+}
+
+}  // namespace
+
+SocketConfig::SocketConfig()
+    : tcp_no_delay_(true),
+      send_buffer_size_(0),
+      receive_buffer_size_(0),
+      keep_alive_(false),
+      keep_alive_idle_time_(0),
+      keep_alive_interval_(0),
+      keep_alive_count_(0),
+      tcp_quick_ack_(false),
+      busy_poll_time_(0),
+      listen_backlog_(0) {}
+
+SocketConfig& SocketConfig::tcp_no_delay(bool value) noexcept {
+    tcp_no_delay_ = value;
+    return *this;
+}
+
+bool SocketConfig::tcp_no_delay() const noexcept { return tcp_no_delay_; }
+
+SocketConfig& SocketConfig::send_buffer_size(std::size_t value) {
+    check_integer_option(value);
+    send_buffer_size_ = value;
+    return *this;
+}
+
+std::size_t SocketConfig::send_buffer_size() const noexcept {
+    return send_buffer_size_;
+}
+
+SocketConfig& SocketConfig::receive_buffer_size(std::size_t value) {
+    check_integer_option(value);
+    receive_buffer_size_ = value;
+    return *this;
+}
+
+std::size_t SocketConfig::receive_buffer_size() const noexcept {
+    return receive_buffer_size_;
+}
+
+SocketConfig& SocketConfig::keep_alive(bool value) noexcept {
+    keep_alive_ = value;
+    return *this;
+}
+
+bool SocketConfig::keep_alive() const noexcept { return keep_alive_; }
+
+SocketConfig& SocketConfig::keep_alive_idle_time(
+    std::chrono::nanoseconds value) {
+    check_duration_option(value);
+    keep_alive_idle_time_ = value;
+    return *this;
+}
+
+std::chrono::nanoseconds SocketConfig::keep_alive_idle_time() const noexcept {
+    return keep_alive_idle_time_;
+}
+
+SocketConfig& SocketConfig::keep_alive_interval(
+    std::chrono::nanoseconds value) {
+    check_duration_option(value);
+    keep_alive_interval_ = value;
+    return *this;
+}
+
+std::chrono::nanoseconds SocketConfig::keep_alive_interval() const noexcept {
+    return keep_alive_interval_;
+}
+
+SocketConfig& SocketConfig::keep_alive_count(std::size_t value) {
+    check_integer_option(value);
+    keep_alive_count_ = value;
+    return *this;
+}
+
+std::size_t SocketConfig::keep_alive_count() const noexcept {
+    return keep_alive_count_;
+}
+
+SocketConfig& SocketConfig::tcp_quick_ack(bool value) noexcept {
+    tcp_quick_ack_ = value;
+    return *this;
+}
+
+bool SocketConfig::tcp_quick_ack() const noexcept { return tcp_quick_ack_; }
+
+SocketConfig& SocketConfig::busy_poll_time(std::chrono::nanoseconds value) {
+    check_duration_option(value);
+    busy_poll_time_ = value;
+    return *this;
+}
+
+std::chrono::nanoseconds SocketConfig::busy_poll_time() const noexcept {
+    return busy_poll_time_;
+}
+
+SocketConfig& SocketConfig::listen_backlog(std::size_t value) {
+    check_integer_option(value);
+    listen_backlog_ = value;
+    return *this;
+}
+
+std::size_t SocketConfig::listen_backlog() const noexcept {
+    return listen_backlog_;
+}
+
+}  // namespace msgpack_rpc::config
@@ -28,12 +28,19 @@
 
 #include <toml++/toml.h>
 
+#include "msgpack_rpc/config/admission_control_config.h"
 #include "msgpack_rpc/config/client_config.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/executor_config.h"
+#include "msgpack_rpc/config/flow_control_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/notification_queue_config.h"
 #include "msgpack_rpc/config/reconnection_config.h"
+#include "msgpack_rpc/config/response_cache_config.h"
 #include "msgpack_rpc/config/server_config.h"
+#include "msgpack_rpc/config/socket_config.h"
 #include "msgpack_rpc/config/toml/parse_toml_common.h"
+#include "msgpack_rpc/config/traffic_capture_config.h"
 
 namespace msgpack_rpc::config::toml::impl {
 
@@ -50,6 +57,9 @@ inline void parse_toml(
         if (key_str == "read_buffer_size") {
             MSGPACK_RPC_PARSE_TOML_VALUE(
                 "read_buffer_size", read_buffer_size, std::size_t);
+        } else if (key_str == "max_message_size") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "max_message_size", max_message_size, std::size_t);
         }
     }
 }
@@ -95,6 +105,170 @@ inline void parse_toml(const ::toml::table& table, ReconnectionConfig& config) {
     }
 }
 
+/*!
+ * \brief Parse a configuration of socket options from TOML.
+ *
+ * \param[in] table Table in TOML.
+ * \param[out] config Configuration.
+ */
+inline void parse_toml(const ::toml::table& table, SocketConfig& config) {
+    for (const auto& [key, value] : table) {
+        const auto key_str = key.str();
+        if (key_str == "tcp_no_delay") {
+            MSGPACK_RPC_PARSE_TOML_VALUE("tcp_no_delay", tcp_no_delay, bool);
+        } else if (key_str == "send_buffer_size") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "send_buffer_size", send_buffer_size, std::size_t);
+        } else if (key_str == "receive_buffer_size") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "receive_buffer_size", receive_buffer_size, std::size_t);
+        } else if (key_str == "keep_alive") {
+            MSGPACK_RPC_PARSE_TOML_VALUE("keep_alive", keep_alive, bool);
+        } else if (key_str == "keep_alive_idle_time_sec") {
+            MSGPACK_RPC_PARSE_TOML_VALUE_DURATION(
+                "keep_alive_idle_time_sec", keep_alive_idle_time);
+        } else if (key_str == "keep_alive_interval_sec") {
+            MSGPACK_RPC_PARSE_TOML_VALUE_DURATION(
+                "keep_alive_interval_sec", keep_alive_interval);
+        } else if (key_str == "keep_alive_count") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "keep_alive_count", keep_alive_count, std::size_t);
+        } else if (key_str == "tcp_quick_ack") {
+            MSGPACK_RPC_PARSE_TOML_VALUE("tcp_quick_ack", tcp_quick_ack, bool);
+        } else if (key_str == "busy_poll_time_sec") {
+            MSGPACK_RPC_PARSE_TOML_VALUE_DURATION(
+                "busy_poll_time_sec", busy_poll_time);
+        } else if (key_str == "listen_backlog") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "listen_backlog", listen_backlog, std::size_t);
+        }
+    }
+}
+
+/*!
+ * \brief Parse a configuration of compression of messages from TOML.
+ *
+ * \param[in] table Table in TOML.
+ * \param[out] config Configuration.
+ */
+inline void parse_toml(const ::toml::table& table, CompressionConfig& config) {
+    for (const auto& [key, value] : table) {
+        const auto key_str = key.str();
+        if (key_str == "enabled") {
+            MSGPACK_RPC_PARSE_TOML_VALUE("enabled", enabled, bool);
+        } else if (key_str == "min_message_size") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "min_message_size", min_message_size, std::size_t);
+        }
+    }
+}
+
+/*!
+ * \brief Parse a configuration of capture of traffic from TOML.
+ *
+ * \param[in] table Table in TOML.
+ * \param[out] config Configuration.
+ */
+inline void parse_toml(
+    const ::toml::table& table, TrafficCaptureConfig& config) {
+    for (const auto& [key, value] : table) {
+        const auto key_str = key.str();
+        if (key_str == "file_path") {
+            MSGPACK_RPC_PARSE_TOML_VALUE("file_path", file_path, std::string);
+        }
+    }
+}
+
+/*!
+ * \brief Parse a configuration of flow control from TOML.
+ *
+ * \param[in] table Table in TOML.
+ * \param[out] config Configuration.
+ */
+inline void parse_toml(const ::toml::table& table, FlowControlConfig& config) {
+    for (const auto& [key, value] : table) {
+        const auto key_str = key.str();
+        if (key_str == "high_watermark_bytes") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "high_watermark_bytes", high_watermark_bytes, std::size_t);
+        } else if (key_str == "low_watermark_bytes") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "low_watermark_bytes", low_watermark_bytes, std::size_t);
+        } else if (key_str == "high_watermark_messages") {
+            MSGPACK_RPC_PARSE_TOML_VALUE("high_watermark_messages",
+                high_watermark_messages, std::size_t);
+        } else if (key_str == "low_watermark_messages") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "low_watermark_messages", low_watermark_messages, std::size_t);
+        }
+    }
+}
+
+/*!
+ * \brief Parse a configuration of admission control from TOML.
+ *
+ * \param[in] table Table in TOML.
+ * \param[out] config Configuration.
+ */
+inline void parse_toml(
+    const ::toml::table& table, AdmissionControlConfig& config) {
+    for (const auto& [key, value] : table) {
+        const auto key_str = key.str();
+        if (key_str == "max_connections") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "max_connections", max_connections, std::size_t);
+        } else if (key_str == "max_in_flight_per_connection") {
+            MSGPACK_RPC_PARSE_TOML_VALUE("max_in_flight_per_connection",
+                max_in_flight_per_connection, std::size_t);
+        } else if (key_str == "max_in_flight_requests") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "max_in_flight_requests", max_in_flight_requests, std::size_t);
+        }
+    }
+}
+
+/*!
+ * \brief Parse a configuration of queues of notifications from TOML.
+ *
+ * \param[in] table Table in TOML.
+ * \param[out] config Configuration.
+ */
+inline void parse_toml(
+    const ::toml::table& table, NotificationQueueConfig& config) {
+    for (const auto& [key, value] : table) {
+        const auto key_str = key.str();
+        if (key_str == "max_queued_notifications") {
+            MSGPACK_RPC_PARSE_TOML_VALUE("max_queued_notifications",
+                max_queued_notifications, std::size_t);
+        } else if (key_str == "disconnect_slow_consumers") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "disconnect_slow_consumers", disconnect_slow_consumers, bool);
+        }
+    }
+}
+
+/*!
+ * \brief Parse a configuration of caches of responses from TOML.
+ *
+ * \param[in] table Table in TOML.
+ * \param[out] config Configuration.
+ */
+inline void parse_toml(
+    const ::toml::table& table, ResponseCacheConfig& config) {
+    for (const auto& [key, value] : table) {
+        const auto key_str = key.str();
+        if (key_str == "time_to_live_sec") {
+            MSGPACK_RPC_PARSE_TOML_VALUE_DURATION(
+                "time_to_live_sec", time_to_live);
+        } else if (key_str == "max_entries") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "max_entries", max_entries, std::size_t);
+        } else if (key_str == "max_bytes") {
+            MSGPACK_RPC_PARSE_TOML_VALUE("max_bytes", max_bytes, std::size_t);
+        }
+    }
+}
+
 /*!
  * \brief Parse a configuration of clients from TOML.
  *
@@ -123,6 +297,36 @@ inline void parse_toml(const ::toml::table& table, ClientConfig& config) {
         } else if (key_str == "call_timeout_sec") {
             MSGPACK_RPC_PARSE_TOML_VALUE_DURATION(
                 "call_timeout_sec", call_timeout);
+        } else if (key_str == "propagate_deadline") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "propagate_deadline", propagate_deadline, bool);
+        } else if (key_str == "single_flight_methods") {
+            const auto* methods_node = value.as_array();
+            if (methods_node == nullptr) {
+                throw_error(value.source(), "single_flight_methods");
+            }
+            for (const auto& elem : *methods_node) {
+                const auto* method_node = elem.as_string();
+                if (method_node == nullptr) {
+                    throw_error(elem.source(), "single_flight_methods");
+                }
+                config.add_single_flight_method(method_node->get());
+            }
+        } else if (key_str == "response_caches") {
+            const auto* caches_table = value.as_table();
+            if (caches_table == nullptr) {
+                throw_error(value.source(), "response_caches");
+            }
+            for (const auto& [method_name, cache_value] : *caches_table) {
+                const auto* cache_table = cache_value.as_table();
+                if (cache_table == nullptr) {
+                    throw_error(cache_value.source(), "response_caches",
+                        "\"response_caches\" must be a table of tables.");
+                }
+                ResponseCacheConfig cache_config;
+                parse_toml(*cache_table, cache_config);
+                config.add_response_cache(method_name.str(), cache_config);
+            }
         } else if (key_str == "message_parser") {
             const auto* child_table = value.as_table();
             if (child_table == nullptr) {
@@ -141,6 +345,30 @@ inline void parse_toml(const ::toml::table& table, ClientConfig& config) {
                 throw_error(value.source(), "reconnection");
             }
             parse_toml(*child_table, config.reconnection());
+        } else if (key_str == "socket") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "socket");
+            }
+            parse_toml(*child_table, config.socket());
+        } else if (key_str == "compression") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "compression");
+            }
+            parse_toml(*child_table, config.compression());
+        } else if (key_str == "traffic_capture") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "traffic_capture");
+            }
+            parse_toml(*child_table, config.traffic_capture());
+        } else if (key_str == "flow_control") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "flow_control");
+            }
+            parse_toml(*child_table, config.flow_control());
         }
     }
 }
@@ -190,6 +418,15 @@ inline void parse_toml(const ::toml::table& table, ServerConfig& config) {
                     throw_error(elem.source(), "uris", e.what());
                 }
             }
+        } else if (key_str == "upload_idle_timeout_sec") {
+            MSGPACK_RPC_PARSE_TOML_VALUE_DURATION(
+                "upload_idle_timeout_sec", upload_idle_timeout);
+        } else if (key_str == "call_timeout_sec") {
+            MSGPACK_RPC_PARSE_TOML_VALUE_DURATION(
+                "call_timeout_sec", call_timeout);
+        } else if (key_str == "propagate_deadline") {
+            MSGPACK_RPC_PARSE_TOML_VALUE(
+                "propagate_deadline", propagate_deadline, bool);
         } else if (key_str == "message_parser") {
             const auto* child_table = value.as_table();
             if (child_table == nullptr) {
@@ -202,6 +439,42 @@ inline void parse_toml(const ::toml::table& table, ServerConfig& config) {
                 throw_error(value.source(), "executor");
             }
             parse_toml(*child_table, config.executor());
+        } else if (key_str == "socket") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "socket");
+            }
+            parse_toml(*child_table, config.socket());
+        } else if (key_str == "compression") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "compression");
+            }
+            parse_toml(*child_table, config.compression());
+        } else if (key_str == "traffic_capture") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "traffic_capture");
+            }
+            parse_toml(*child_table, config.traffic_capture());
+        } else if (key_str == "flow_control") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "flow_control");
+            }
+            parse_toml(*child_table, config.flow_control());
+        } else if (key_str == "admission_control") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "admission_control");
+            }
+            parse_toml(*child_table, config.admission_control());
+        } else if (key_str == "notification_queue") {
+            const auto* child_table = value.as_table();
+            if (child_table == nullptr) {
+                throw_error(value.source(), "notification_queue");
+            }
+            parse_toml(*child_table, config.notification_queue());
         }
     }
 }
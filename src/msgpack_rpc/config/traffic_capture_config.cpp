@@ -0,0 +1,41 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of TrafficCaptureConfig class.
+ */
+#include "msgpack_rpc/config/traffic_capture_config.h"
+
+#include <string_view>
+
+namespace msgpack_rpc::config {
+
+TrafficCaptureConfig::TrafficCaptureConfig() = default;
+
+TrafficCaptureConfig& TrafficCaptureConfig::file_path(std::string_view value) {
+    file_path_ = value;
+    return *this;
+}
+
+std::string_view TrafficCaptureConfig::file_path() const noexcept {
+    return file_path_;
+}
+
+bool TrafficCaptureConfig::enabled() const noexcept {
+    return !file_path_.empty();
+}
+
+}  // namespace msgpack_rpc::config
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to compress messages.
+ */
+#include "msgpack_rpc/messages/impl/message_compression.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include <fmt/format.h>
+#include <lz4.h>
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/impl/sharable_binary_header.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+
+namespace msgpack_rpc::messages::impl {
+
+namespace {
+
+//! Size of the header of extension objects with 32-bit sizes.
+constexpr std::size_t EXT32_HEADER_SIZE = 6;
+
+//! Size of the size of original messages.
+constexpr std::size_t ORIGINAL_SIZE_SIZE = 4;
+
+//! Size of the header of compressed messages.
+constexpr std::size_t COMPRESSED_MESSAGE_HEADER_SIZE =
+    EXT32_HEADER_SIZE + ORIGINAL_SIZE_SIZE;
+
+//! First byte of extension objects with 32-bit sizes.
+constexpr auto EXT32_FORMAT = static_cast<char>(0xC9);
+
+/*!
+ * \brief Maximum ratio of the original size to the compressed size.
+ *
+ * LZ4 cannot compress data to less than about 1/255 of the original size, so
+ * larger sizes are rejected before allocating buffers.
+ */
+constexpr std::size_t MAX_COMPRESSION_RATIO = 256;
+
+/*!
+ * \brief Write a 32-bit unsigned integer in big endian.
+ *
+ * \param[out] data Buffer.
+ * \param[in] value Value.
+ */
+void write_uint32(char* data, std::uint32_t value) noexcept {
+    constexpr unsigned int bits_per_byte = 8;
+    constexpr std::uint32_t byte_mask = 0xFFU;
+    for (std::size_t i = 0; i < 4U; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data[i] = static_cast<char>(
+            (value >> (bits_per_byte * (3U - i))) & byte_mask);
+    }
+}
+
+/*!
+ * \brief Read a 32-bit unsigned integer in big endian.
+ *
+ * \param[in] data Buffer.
+ * \return Value.
+ */
+[[nodiscard]] std::uint32_t read_uint32(const char* data) noexcept {
+    constexpr unsigned int bits_per_byte = 8;
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < 4U; ++i) {
+        value <<= bits_per_byte;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        value |= static_cast<unsigned char>(data[i]);
+    }
+    return value;
+}
+
+/*!
+ * \brief Function to make objects refer to the buffer of decompressed data
+ * instead of copying.
+ *
+ * \return Whether to refer to the buffer.
+ */
+bool refer_to_decompressed_buffer(msgpack::type::object_type /*type*/,
+    std::size_t /*size*/, void* /*user_data*/) {
+    return true;
+}
+
+}  // namespace
+
+std::optional<SerializedMessage> compress_message(
+    const SerializedMessage& message) {
+    const SerializedMessage original = message.flatten();
+    const std::size_t original_size = original.size();
+    if (original_size > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE)) {
+        return std::nullopt;
+    }
+    const int bound = LZ4_compressBound(static_cast<int>(original_size));
+
+    auto* buffer = allocate_sharable_binary(
+        COMPRESSED_MESSAGE_HEADER_SIZE + static_cast<std::size_t>(bound));
+    // Following operations won't throw exceptions.
+    enable_reference_count_of_sharable_binary(buffer);
+    SerializedMessage compressed(buffer);
+
+    char* data = binary_buffer_of(buffer);
+    const int compressed_size = LZ4_compress_default(original.data(),
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data + COMPRESSED_MESSAGE_HEADER_SIZE,
+        static_cast<int>(original_size), bound);
+    if (compressed_size <= 0) {
+        return std::nullopt;
+    }
+    const std::size_t total_size = COMPRESSED_MESSAGE_HEADER_SIZE +
+        static_cast<std::size_t>(compressed_size);
+    if (total_size >= original_size) {
+        return std::nullopt;
+    }
+
+    data[0] = EXT32_FORMAT;
+    write_uint32(data + 1,  // NOLINT(*-pointer-arithmetic)
+        static_cast<std::uint32_t>(total_size - EXT32_HEADER_SIZE));
+    data[EXT32_HEADER_SIZE - 1U] =
+        static_cast<char>(COMPRESSED_MESSAGE_EXT_TYPE);
+    write_uint32(data + EXT32_HEADER_SIZE,  // NOLINT(*-pointer-arithmetic)
+        static_cast<std::uint32_t>(original_size));
+    buffer->binary_size = total_size;
+    return compressed;
+}
+
+bool is_compressed_message(const msgpack::object& object) noexcept {
+    return object.type == msgpack::type::EXT &&
+        object.via.ext.type() == COMPRESSED_MESSAGE_EXT_TYPE;
+}
+
+msgpack::object_handle decompress_message(const msgpack::object& object,
+    std::size_t max_message_size, const FramedMessageHandler& on_decompressed) {
+    const std::size_t size = object.via.ext.size;
+    if (size < ORIGINAL_SIZE_SIZE) {
+        throw MsgpackRPCException(
+            StatusCode::INVALID_MESSAGE, "Invalid compressed message.");
+    }
+    const char* data = object.via.ext.data();
+    const std::size_t original_size = read_uint32(data);
+    const std::size_t compressed_size = size - ORIGINAL_SIZE_SIZE;
+    if (original_size == 0U ||
+        original_size > compressed_size * MAX_COMPRESSION_RATIO ||
+        original_size > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE)) {
+        throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+            "Invalid size of a compressed message.");
+    }
+    if (original_size > max_message_size) {
+        throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+            fmt::format("Too large message (size: {}, limit: {}).",
+                original_size, max_message_size));
+    }
+
+    auto zone = std::make_unique<msgpack::zone>();
+    auto* buffer = static_cast<char*>(zone->allocate_no_align(original_size));
+    const int decompressed_size = LZ4_decompress_safe(
+        data + ORIGINAL_SIZE_SIZE,  // NOLINT(*-pointer-arithmetic)
+        buffer, static_cast<int>(compressed_size),
+        static_cast<int>(original_size));
+    if (decompressed_size != static_cast<int>(original_size)) {
+        throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+            "Failed to decompress a message.");
+    }
+    if (on_decompressed) {
+        on_decompressed(buffer, original_size);
+    }
+
+    std::size_t offset = 0;
+    bool referenced = false;
+    msgpack::object result;
+    try {
+        result = msgpack::unpack(*zone, buffer, original_size, offset,
+            referenced, &refer_to_decompressed_buffer);
+    } catch (const msgpack::unpack_error&) {
+        throw MsgpackRPCException(
+            StatusCode::INVALID_MESSAGE, "Failed to parse a message.");
+    }
+    if (offset != original_size) {
+        throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+            "Invalid data after a compressed message.");
+    }
+    return msgpack::object_handle(result, std::move(zone));
+}
+
+bool is_compression_algorithm_supported(
+    const ParsedParameters& parameters) noexcept {
+    try {
+        const msgpack::object& object = parameters.object();
+        if (object.type != msgpack::type::ARRAY ||
+            object.via.array.size < 1U) {
+            return false;
+        }
+        const msgpack::object& algorithm = object.via.array.ptr[0];
+        return algorithm.type == msgpack::type::STR &&
+            std::string_view(algorithm.via.str.ptr, algorithm.via.str.size) ==
+            COMPRESSION_ALGORITHM_NAME;
+    } catch (const std::exception& /*exception*/) {
+        // Parameters which cannot be decoded are not supported.
+        return false;
+    }
+}
+
+}  // namespace msgpack_rpc::messages::impl
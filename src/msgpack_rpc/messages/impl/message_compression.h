@@ -0,0 +1,90 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to compress messages.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/impl/message_framer.h"
+#include "msgpack_rpc/messages/parsed_parameters.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+namespace msgpack_rpc::messages::impl {
+
+/*!
+ * \brief Type of the extension type of msgpack for compressed messages.
+ *
+ * Compressed messages are extension objects of this type whose data is the
+ * size of the original message as a 32-bit big-endian unsigned integer
+ * followed by the original message compressed to a LZ4 block.
+ */
+constexpr std::int8_t COMPRESSED_MESSAGE_EXT_TYPE = 76;
+
+/*!
+ * \brief Compress a message.
+ *
+ * \param[in] message Message.
+ * \return Compressed message. Null if compression doesn't reduce the size.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT std::optional<SerializedMessage>
+compress_message(const SerializedMessage& message);
+
+/*!
+ * \brief Check whether an object in msgpack library is a compressed message.
+ *
+ * \param[in] object Object in msgpack library.
+ * \return Whether the object is a compressed message.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT bool is_compressed_message(
+    const msgpack::object& object) noexcept;
+
+/*!
+ * \brief Decompress a message.
+ *
+ * \param[in] object Object in msgpack library of a compressed message.
+ * \param[in] max_message_size Maximum size of the original message.
+ * \param[in] on_decompressed Function called with the data of the original
+ * message before parsing it. (Optional.)
+ * \return Object in msgpack library of the original message.
+ *
+ * \note This function throws an exception with
+ * StatusCode::INVALID_MESSAGE for invalid data, including messages whose
+ * original sizes exceed the maximum size, before allocating memory for them.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT msgpack::object_handle decompress_message(
+    const msgpack::object& object, std::size_t max_message_size,
+    const FramedMessageHandler& on_decompressed = nullptr);
+
+/*!
+ * \brief Check whether the compression algorithm advertised by a peer is
+ * supported.
+ *
+ * \param[in] parameters Parameters of the notification advertising support of
+ * compression.
+ * \return Whether the algorithm is supported.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT bool is_compression_algorithm_supported(
+    const ParsedParameters& parameters) noexcept;
+
+}  // namespace msgpack_rpc::messages::impl
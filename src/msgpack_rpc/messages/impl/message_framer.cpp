@@ -0,0 +1,116 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of MessageFramer class.
+ */
+#include "msgpack_rpc/messages/impl/message_framer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/impl/raw_message_scanner.h"
+
+namespace msgpack_rpc::messages::impl {
+
+namespace {
+
+/*!
+ * \brief Throw an exception for a message larger than the maximum size.
+ *
+ * \param[in] size Size of the message.
+ * \param[in] max_message_size Maximum size of a message.
+ */
+[[noreturn]] void throw_too_large_message(
+    std::size_t size, std::size_t max_message_size) {
+    throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+        fmt::format("Too large message (size: {}, limit: {}).", size,
+            max_message_size));
+}
+
+}  // namespace
+
+MessageFramer::MessageFramer(
+    std::size_t read_buffer_size, std::size_t max_message_size)
+    : read_buffer_size_(read_buffer_size),
+      max_message_size_(max_message_size) {}
+
+MessageFramer::~MessageFramer() = default;
+
+BufferView MessageFramer::prepare_buffer() {
+    if (buffer_ == nullptr ||
+        buffer_->size() - received_position_ < read_buffer_size_) {
+        const std::size_t remaining_size =
+            received_position_ - parsed_position_;
+        if (buffer_ != nullptr && buffer_.use_count() == 1 &&
+            buffer_->size() - remaining_size >= read_buffer_size_) {
+            // No found message refers to the buffer, so reuse it.
+            std::memmove(buffer_->data(), buffer_->data() + parsed_position_,
+                remaining_size);
+        } else {
+            // Grow the buffer geometrically for large messages.
+            auto new_buffer = std::make_shared<std::vector<char>>(std::max(
+                remaining_size + read_buffer_size_, 2U * remaining_size));
+            if (remaining_size > 0U) {
+                std::memcpy(new_buffer->data(),
+                    buffer_->data() + parsed_position_, remaining_size);
+            }
+            buffer_ = std::move(new_buffer);
+        }
+        // scanned_size_ is relative to parsed_position_, so it is kept.
+        parsed_position_ = 0;
+        received_position_ = remaining_size;
+    }
+    return BufferView(buffer_->data() + received_position_,
+        buffer_->size() - received_position_);
+}
+
+void MessageFramer::consumed(std::size_t num_bytes) {
+    received_position_ += num_bytes;
+}
+
+std::optional<FramedMessage> MessageFramer::try_frame() {
+    if (parsed_position_ == received_position_) {
+        return std::nullopt;
+    }
+    const std::size_t received_size = received_position_ - parsed_position_;
+    if (!continue_finding_msgpack_object_size(
+            buffer_->data() + parsed_position_, received_size, scanned_size_,
+            num_remaining_objects_)) {
+        // All the received bytes belong to the next message here.
+        if (received_size > max_message_size_) {
+            throw_too_large_message(received_size, max_message_size_);
+        }
+        return std::nullopt;
+    }
+    if (scanned_size_ > max_message_size_) {
+        throw_too_large_message(scanned_size_, max_message_size_);
+    }
+    FramedMessage message{buffer_, parsed_position_, scanned_size_};
+    parsed_position_ += scanned_size_;
+    scanned_size_ = 0;
+    num_remaining_objects_ = 1;
+    return message;
+}
+
+}  // namespace msgpack_rpc::messages::impl
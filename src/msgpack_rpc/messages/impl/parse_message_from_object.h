@@ -19,9 +19,12 @@
  */
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <utility>
 
@@ -100,6 +103,50 @@ namespace msgpack_rpc::messages::impl {
     }
 }
 
+/*!
+ * \brief Parse a deadline from the extension of a request in an object in
+ * msgpack library.
+ *
+ * The extension is a map which can contain the remaining budget of time in
+ * nanoseconds with key `"budget_ns"`. Unknown keys are ignored.
+ *
+ * \param[in] object Object in msgpack library.
+ * \return Deadline if specified, otherwise std::nullopt.
+ */
+[[nodiscard]] inline std::optional<std::chrono::steady_clock::time_point>
+parse_deadline_from_object(const msgpack::object& object) {
+    if (object.type != msgpack::type::MAP) {
+        throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+            "Invalid extension of a request in a message.");
+    }
+    try {
+        for (std::uint32_t i = 0; i < object.via.map.size; ++i) {
+            const auto& pair = object.via.map.ptr[i];
+            if (pair.key.type != msgpack::type::STR ||
+                pair.key.as<std::string_view>() != "budget_ns") {
+                continue;
+            }
+            const auto budget = pair.val.as<std::uint64_t>();
+            const auto now = std::chrono::steady_clock::now();
+            // Limit the budget to prevent overflow.
+            const auto max_budget = std::chrono::duration_cast<
+                std::chrono::nanoseconds>(
+                std::chrono::steady_clock::time_point::max() - now);
+            if (budget >= static_cast<std::uint64_t>(max_budget.count())) {
+                return std::chrono::steady_clock::time_point::max();
+            }
+            return now +
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::nanoseconds(
+                        static_cast<std::chrono::nanoseconds::rep>(budget)));
+        }
+    } catch (const msgpack::type_error&) {
+        throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+            "Invalid extension of a request in a message.");
+    }
+    return std::nullopt;
+}
+
 /*!
  * \brief Parse a request from an object in msgpack library.
  *
@@ -109,7 +156,9 @@ namespace msgpack_rpc::messages::impl {
 [[nodiscard]] inline ParsedRequest parse_request_from_object(
     msgpack::object_handle object) {
     constexpr std::uint32_t num_elements_in_root_array = 4;
-    if (object->via.array.size != num_elements_in_root_array) {
+    constexpr std::uint32_t num_elements_with_extension = 5;
+    if (object->via.array.size != num_elements_in_root_array &&
+        object->via.array.size != num_elements_with_extension) {
         throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
             "Invalid size of the array of a message.");
     }
@@ -117,9 +166,14 @@ namespace msgpack_rpc::messages::impl {
     const auto message_id =
         parse_message_id_from_object(object->via.array.ptr[1]);
     auto method_name = parse_method_name_from_object(object->via.array.ptr[2]);
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+    if (object->via.array.size == num_elements_with_extension) {
+        deadline = parse_deadline_from_object(object->via.array.ptr[4]);
+    }
     auto parameters =
         ParsedParameters(object->via.array.ptr[3], std::move(object.zone()));
-    return ParsedRequest(message_id, method_name, std::move(parameters));
+    return ParsedRequest(
+        message_id, method_name, std::move(parameters), deadline);
 }
 
 /*!
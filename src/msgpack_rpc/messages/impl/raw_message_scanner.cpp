@@ -0,0 +1,719 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to scan raw messages.
+ */
+#include "msgpack_rpc/messages/impl/raw_message_scanner.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/impl/encoded_object.h"
+#include "msgpack_rpc/messages/impl/parse_message_from_object.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_type.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/parsed_message.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+#include "msgpack_rpc/messages/parsed_parameters.h"
+#include "msgpack_rpc/messages/parsed_request.h"
+#include "msgpack_rpc/messages/parsed_response.h"
+#include "msgpack_rpc/messages/raw_message.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+
+namespace msgpack_rpc::messages::impl {
+
+namespace {
+
+//! Maximum first byte of positive fixint.
+constexpr std::uint8_t MAX_POSITIVE_FIXINT = 0x7F;
+
+//! Maximum first byte of fixmap.
+constexpr std::uint8_t MAX_FIXMAP = 0x8F;
+
+//! Maximum first byte of fixarray.
+constexpr std::uint8_t MAX_FIXARRAY = 0x9F;
+
+//! Maximum first byte of fixstr.
+constexpr std::uint8_t MAX_FIXSTR = 0xBF;
+
+//! Minimum first byte of negative fixint.
+constexpr std::uint8_t MIN_NEGATIVE_FIXINT = 0xE0;
+
+//! Mask of sizes in the first byte of fixmap and fixarray.
+constexpr std::uint8_t FIX_CONTAINER_SIZE_MASK = 0x0F;
+
+//! Mask of sizes in the first byte of fixstr.
+constexpr std::uint8_t FIXSTR_SIZE_MASK = 0x1F;
+
+//! First byte of the first format in FORMAT_LAYOUTS.
+constexpr std::uint8_t FIRST_FORMAT_IN_TABLE = 0xC0;
+
+//! First byte of uint 8.
+constexpr std::uint8_t UINT8_FORMAT = 0xCC;
+
+//! First byte of uint 64.
+constexpr std::uint8_t UINT64_FORMAT = 0xCF;
+
+//! First byte of int 8.
+constexpr std::uint8_t INT8_FORMAT = 0xD0;
+
+//! First byte of int 64.
+constexpr std::uint8_t INT64_FORMAT = 0xD3;
+
+//! First byte of nil.
+constexpr std::uint8_t NIL_FORMAT = 0xC0;
+
+//! First byte of array 16.
+constexpr std::uint8_t ARRAY16_FORMAT = 0xDC;
+
+//! First byte of array 32.
+constexpr std::uint8_t ARRAY32_FORMAT = 0xDD;
+
+//! First byte of bin 8.
+constexpr std::uint8_t BIN8_FORMAT = 0xC4;
+
+//! First byte of bin 32.
+constexpr std::uint8_t BIN32_FORMAT = 0xC6;
+
+//! First byte of str 8.
+constexpr std::uint8_t STR8_FORMAT = 0xD9;
+
+//! First byte of str 32.
+constexpr std::uint8_t STR32_FORMAT = 0xDB;
+
+/*!
+ * \brief Enumeration of kinds of formats in msgpack.
+ */
+enum class FormatKind : std::uint8_t {
+    //! Format with a fixed size.
+    FIXED,
+
+    //! Format with the size of the payload.
+    PAYLOAD,
+
+    //! Array with the number of elements.
+    ARRAY,
+
+    //! Map with the number of pairs.
+    MAP,
+
+    //! Invalid format.
+    INVALID
+};
+
+/*!
+ * \brief Struct of layouts of formats in msgpack.
+ */
+struct FormatLayout {
+    //! Kind of the format.
+    FormatKind kind;
+
+    //! Size of the header. (Size of the whole object for FormatKind::FIXED.)
+    std::size_t header_size;
+
+    //! Size of the field of the size next to the first byte.
+    std::size_t size_field_size;
+};
+
+//! Layouts of formats from 0xC0 to 0xDF.
+constexpr std::array<FormatLayout, 32> FORMAT_LAYOUTS{{
+    {FormatKind::FIXED, 1, 0},     // 0xC0: nil
+    {FormatKind::INVALID, 0, 0},   // 0xC1: (never used)
+    {FormatKind::FIXED, 1, 0},     // 0xC2: false
+    {FormatKind::FIXED, 1, 0},     // 0xC3: true
+    {FormatKind::PAYLOAD, 2, 1},   // 0xC4: bin 8
+    {FormatKind::PAYLOAD, 3, 2},   // 0xC5: bin 16
+    {FormatKind::PAYLOAD, 5, 4},   // 0xC6: bin 32
+    {FormatKind::PAYLOAD, 3, 1},   // 0xC7: ext 8
+    {FormatKind::PAYLOAD, 4, 2},   // 0xC8: ext 16
+    {FormatKind::PAYLOAD, 6, 4},   // 0xC9: ext 32
+    {FormatKind::FIXED, 5, 0},     // 0xCA: float 32
+    {FormatKind::FIXED, 9, 0},     // 0xCB: float 64
+    {FormatKind::FIXED, 2, 0},     // 0xCC: uint 8
+    {FormatKind::FIXED, 3, 0},     // 0xCD: uint 16
+    {FormatKind::FIXED, 5, 0},     // 0xCE: uint 32
+    {FormatKind::FIXED, 9, 0},     // 0xCF: uint 64
+    {FormatKind::FIXED, 2, 0},     // 0xD0: int 8
+    {FormatKind::FIXED, 3, 0},     // 0xD1: int 16
+    {FormatKind::FIXED, 5, 0},     // 0xD2: int 32
+    {FormatKind::FIXED, 9, 0},     // 0xD3: int 64
+    {FormatKind::FIXED, 3, 0},     // 0xD4: fixext 1
+    {FormatKind::FIXED, 4, 0},     // 0xD5: fixext 2
+    {FormatKind::FIXED, 6, 0},     // 0xD6: fixext 4
+    {FormatKind::FIXED, 10, 0},    // 0xD7: fixext 8
+    {FormatKind::FIXED, 18, 0},    // 0xD8: fixext 16
+    {FormatKind::PAYLOAD, 2, 1},   // 0xD9: str 8
+    {FormatKind::PAYLOAD, 3, 2},   // 0xDA: str 16
+    {FormatKind::PAYLOAD, 5, 4},   // 0xDB: str 32
+    {FormatKind::ARRAY, 3, 2},     // 0xDC: array 16
+    {FormatKind::ARRAY, 5, 4},     // 0xDD: array 32
+    {FormatKind::MAP, 3, 2},       // 0xDE: map 16
+    {FormatKind::MAP, 5, 4},       // 0xDF: map 32
+}};
+
+/*!
+ * \brief Struct of headers of objects in msgpack.
+ */
+struct ObjectHeader {
+    //! First byte.
+    std::uint8_t format;
+
+    //! Size of the header.
+    std::size_t header_size;
+
+    //! Size of the payload next to the header.
+    std::uint64_t payload_size;
+
+    //! Number of objects contained in the object.
+    std::uint64_t num_children;
+};
+
+/*!
+ * \brief Read an unsigned integer in big endian.
+ *
+ * \param[in] data Buffer.
+ * \param[in] size Number of bytes.
+ * \return Value.
+ */
+[[nodiscard]] std::uint64_t read_big_endian(
+    const char* data, std::size_t size) noexcept {
+    constexpr unsigned int bits_per_byte = 8;
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        value <<= bits_per_byte;
+        value |= static_cast<unsigned char>(data[i]);
+    }
+    return value;
+}
+
+/*!
+ * \brief Read the header of an object.
+ *
+ * \param[in] data Pointer to the data.
+ * \param[in] size Size of the data. (Must be positive.)
+ * \return Header. Null if more data is required.
+ */
+[[nodiscard]] std::optional<ObjectHeader> read_object_header(
+    const char* data, std::size_t size) {
+    const auto format = static_cast<std::uint8_t>(data[0]);
+    if (format <= MAX_POSITIVE_FIXINT || format >= MIN_NEGATIVE_FIXINT) {
+        return ObjectHeader{format, 1U, 0U, 0U};
+    }
+    if (format <= MAX_FIXMAP) {
+        return ObjectHeader{
+            format, 1U, 0U, 2U * (format & FIX_CONTAINER_SIZE_MASK)};
+    }
+    if (format <= MAX_FIXARRAY) {
+        return ObjectHeader{format, 1U, 0U,
+            static_cast<std::uint64_t>(format & FIX_CONTAINER_SIZE_MASK)};
+    }
+    if (format <= MAX_FIXSTR) {
+        return ObjectHeader{format, 1U,
+            static_cast<std::uint64_t>(format & FIXSTR_SIZE_MASK), 0U};
+    }
+
+    const FormatLayout& layout = FORMAT_LAYOUTS.at(
+        static_cast<std::size_t>(format - FIRST_FORMAT_IN_TABLE));
+    if (layout.kind == FormatKind::INVALID) {
+        throw MsgpackRPCException(
+            StatusCode::INVALID_MESSAGE, "Failed to parse a message.");
+    }
+    if (size < layout.header_size) {
+        return std::nullopt;
+    }
+    const std::uint64_t value =
+        read_big_endian(data + 1, layout.size_field_size);
+    switch (layout.kind) {
+    case FormatKind::PAYLOAD:
+        return ObjectHeader{format, layout.header_size, value, 0U};
+    case FormatKind::ARRAY:
+        return ObjectHeader{format, layout.header_size, 0U, value};
+    case FormatKind::MAP:
+        return ObjectHeader{format, layout.header_size, 0U, 2U * value};
+    default:
+        return ObjectHeader{format, layout.header_size, 0U, 0U};
+    }
+}
+
+/*!
+ * \brief Check whether the first byte of an object is of an array.
+ *
+ * \param[in] format First byte.
+ * \return Whether the object is an array.
+ */
+[[nodiscard]] bool is_array_format(std::uint8_t format) noexcept {
+    return (format > MAX_FIXMAP && format <= MAX_FIXARRAY) ||
+        format == ARRAY16_FORMAT || format == ARRAY32_FORMAT;
+}
+
+/*!
+ * \brief Class to read headers of messages.
+ */
+class MessageHeaderReader {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] data Pointer to the data of a message.
+     * \param[in] size Size of the data.
+     */
+    MessageHeaderReader(const char* data, std::size_t size) noexcept
+        : data_(data), size_(size) {}
+
+    /*!
+     * \brief Read the header of an array.
+     *
+     * \param[in] error_message Error message for invalid data.
+     * \return Number of elements.
+     */
+    [[nodiscard]] std::uint64_t read_array_size(
+        std::string_view error_message) {
+        const ObjectHeader header = read_header(error_message);
+        if (!is_array_format(header.format)) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, error_message);
+        }
+        position_ += header.header_size;
+        return header.num_children;
+    }
+
+    /*!
+     * \brief Read a non-negative integer.
+     *
+     * \param[in] error_message Error message for invalid data.
+     * \return Value.
+     */
+    [[nodiscard]] std::uint64_t read_uint(std::string_view error_message) {
+        const ObjectHeader header = read_header(error_message);
+        const char* value_data = data_ + position_ + 1;
+        const std::size_t value_size = header.header_size - 1U;
+        std::uint64_t value = 0;
+        if (header.format <= MAX_POSITIVE_FIXINT) {
+            value = header.format;
+        } else if (header.format >= UINT8_FORMAT &&
+            header.format <= UINT64_FORMAT) {
+            value = read_big_endian(value_data, value_size);
+        } else if (header.format >= INT8_FORMAT &&
+            header.format <= INT64_FORMAT) {
+            constexpr auto sign_bit = static_cast<unsigned char>(0x80);
+            if ((static_cast<unsigned char>(value_data[0]) & sign_bit) != 0U) {
+                throw MsgpackRPCException(
+                    StatusCode::INVALID_MESSAGE, error_message);
+            }
+            value = read_big_endian(value_data, value_size);
+        } else {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, error_message);
+        }
+        position_ += header.header_size;
+        return value;
+    }
+
+    /*!
+     * \brief Read a string.
+     *
+     * \param[in] error_message Error message for invalid data.
+     * \return String referring to the data.
+     */
+    [[nodiscard]] std::string_view read_str(std::string_view error_message) {
+        const ObjectHeader header = read_header(error_message);
+        const bool is_str =
+            (header.format > MAX_FIXARRAY && header.format <= MAX_FIXSTR) ||
+            (header.format >= STR8_FORMAT && header.format <= STR32_FORMAT) ||
+            (header.format >= BIN8_FORMAT && header.format <= BIN32_FORMAT);
+        if (!is_str ||
+            header.payload_size > size_ - position_ - header.header_size) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, error_message);
+        }
+        const auto payload_size =
+            static_cast<std::size_t>(header.payload_size);
+        const std::string_view value(
+            data_ + position_ + header.header_size, payload_size);
+        position_ += header.header_size + payload_size;
+        return value;
+    }
+
+    /*!
+     * \brief Skip an object.
+     *
+     * \param[in] error_message Error message for invalid data.
+     * \return Size of the object.
+     */
+    std::size_t skip_object(std::string_view error_message) {
+        if (position_ >= size_) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, error_message);
+        }
+        const auto object_size =
+            find_msgpack_object_size(data_ + position_, size_ - position_);
+        if (!object_size) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, error_message);
+        }
+        position_ += *object_size;
+        return *object_size;
+    }
+
+    /*!
+     * \brief Check whether the next object is nil.
+     *
+     * \return Whether the next object is nil.
+     */
+    [[nodiscard]] bool is_next_nil() const noexcept {
+        return position_ < size_ &&
+            static_cast<std::uint8_t>(data_[position_]) == NIL_FORMAT;
+    }
+
+    /*!
+     * \brief Check whether the next object is an array.
+     *
+     * \return Whether the next object is an array.
+     */
+    [[nodiscard]] bool is_next_array() const noexcept {
+        return position_ < size_ &&
+            is_array_format(static_cast<std::uint8_t>(data_[position_]));
+    }
+
+    /*!
+     * \brief Get the current position.
+     *
+     * \return Position.
+     */
+    [[nodiscard]] std::size_t position() const noexcept { return position_; }
+
+private:
+    /*!
+     * \brief Read the header of the next object.
+     *
+     * \param[in] error_message Error message for invalid data.
+     * \return Header.
+     */
+    [[nodiscard]] ObjectHeader read_header(std::string_view error_message) {
+        if (position_ >= size_) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, error_message);
+        }
+        const auto header =
+            read_object_header(data_ + position_, size_ - position_);
+        if (!header) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, error_message);
+        }
+        return *header;
+    }
+
+    //! Pointer to the data.
+    const char* data_;
+
+    //! Size of the data.
+    std::size_t size_;
+
+    //! Current position.
+    std::size_t position_{0};
+};
+
+/*!
+ * \brief Read a message ID.
+ *
+ * \param[in] reader Reader.
+ * \return Message ID.
+ */
+[[nodiscard]] MessageID read_message_id(MessageHeaderReader& reader) {
+    constexpr std::string_view error_message =
+        "Invalid message ID in a message.";
+    const std::uint64_t value = reader.read_uint(error_message);
+    if (value > std::numeric_limits<MessageID>::max()) {
+        throw MsgpackRPCException(StatusCode::INVALID_MESSAGE, error_message);
+    }
+    return static_cast<MessageID>(value);
+}
+
+/*!
+ * \brief Read a method name.
+ *
+ * \param[in] reader Reader.
+ * \return Method name.
+ */
+[[nodiscard]] MethodNameView read_method_name(MessageHeaderReader& reader) {
+    return MethodNameView(
+        reader.read_str("Invalid method name in a message."));
+}
+
+/*!
+ * \brief Check whether notifications of a method have the message ID of a
+ * request as the first parameter.
+ *
+ * \param[in] method_name Method name.
+ * \return Whether notifications have the message ID.
+ */
+[[nodiscard]] bool has_request_id_parameter(
+    MethodNameView method_name) noexcept {
+    const std::string_view name = method_name.name();
+    return name == CANCEL_REQUEST_METHOD_NAME ||
+        name == STREAM_CHUNK_METHOD_NAME || name == UPLOAD_CHUNK_METHOD_NAME ||
+        name == UPLOAD_END_METHOD_NAME || name == UPLOAD_ACK_METHOD_NAME;
+}
+
+/*!
+ * \brief Read an object into an encoded object.
+ *
+ * \param[in] reader Reader.
+ * \param[in] buffer Buffer of the data.
+ * \param[in] offset Offset of the message in the buffer.
+ * \param[in] error_message Error message for invalid data.
+ * \return Encoded object.
+ */
+[[nodiscard]] std::shared_ptr<const EncodedObject> read_encoded_object(
+    MessageHeaderReader& reader,
+    const std::shared_ptr<const std::vector<char>>& buffer, std::size_t offset,
+    std::string_view error_message) {
+    const std::size_t object_offset = offset + reader.position();
+    const std::size_t object_size = reader.skip_object(error_message);
+    return std::make_shared<const EncodedObject>(
+        buffer, object_offset, object_size);
+}
+
+/*!
+ * \brief Read parameters.
+ *
+ * \param[in] reader Reader.
+ * \param[in] buffer Buffer of the data.
+ * \param[in] offset Offset of the message in the buffer.
+ * \return Parameters.
+ */
+[[nodiscard]] ParsedParameters read_parameters(MessageHeaderReader& reader,
+    const std::shared_ptr<const std::vector<char>>& buffer,
+    std::size_t offset) {
+    constexpr std::string_view error_message = "Invalid type of parameters.";
+    if (!reader.is_next_array()) {
+        throw MsgpackRPCException(StatusCode::INVALID_MESSAGE, error_message);
+    }
+    return ParsedParameters(
+        read_encoded_object(reader, buffer, offset, error_message));
+}
+
+/*!
+ * \brief Read the deadline in the extension of a request.
+ *
+ * \param[in] reader Reader.
+ * \param[in] data Pointer to the data of the message.
+ * \return Deadline if specified, otherwise std::nullopt.
+ */
+[[nodiscard]] std::optional<std::chrono::steady_clock::time_point>
+read_deadline(MessageHeaderReader& reader, const char* data) {
+    constexpr std::string_view error_message =
+        "Invalid extension of a request in a message.";
+    const std::size_t extension_offset = reader.position();
+    const std::size_t extension_size = reader.skip_object(error_message);
+    try {
+        const msgpack::object_handle extension =
+            msgpack::unpack(data + extension_offset, extension_size);
+        return parse_deadline_from_object(extension.get());
+    } catch (const msgpack::unpack_error&) {
+        throw MsgpackRPCException(StatusCode::INVALID_MESSAGE, error_message);
+    }
+}
+
+}  // namespace
+
+std::optional<std::size_t> find_msgpack_object_size(
+    const char* data, std::size_t size) {
+    std::size_t scanned_size = 0;
+    std::uint64_t num_remaining_objects = 1;
+    if (!continue_finding_msgpack_object_size(
+            data, size, scanned_size, num_remaining_objects)) {
+        return std::nullopt;
+    }
+    return scanned_size;
+}
+
+bool continue_finding_msgpack_object_size(const char* data, std::size_t size,
+    std::size_t& scanned_size, std::uint64_t& num_remaining_objects) {
+    while (num_remaining_objects > 0U) {
+        if (scanned_size >= size) {
+            return false;
+        }
+        const auto header =
+            read_object_header(data + scanned_size, size - scanned_size);
+        if (!header ||
+            header->payload_size > size - scanned_size - header->header_size) {
+            return false;
+        }
+        --num_remaining_objects;
+        num_remaining_objects += header->num_children;
+        scanned_size += header->header_size +
+            static_cast<std::size_t>(header->payload_size);
+    }
+    return true;
+}
+
+bool is_msgpack_array(const char* data, std::size_t size) noexcept {
+    return size > 0U && is_array_format(static_cast<std::uint8_t>(data[0]));
+}
+
+RawMessage scan_raw_message(std::shared_ptr<const std::vector<char>> buffer,
+    std::size_t offset, std::size_t size) {
+    MessageHeaderReader reader(buffer->data() + offset, size);
+    constexpr std::string_view invalid_size_message =
+        "Invalid size of the array of a message.";
+    const std::uint64_t num_elements =
+        reader.read_array_size("Invalid type of a message.");
+    const std::uint64_t type =
+        reader.read_uint("Invalid message type in a message.");
+
+    switch (type) {
+    case static_cast<std::uint64_t>(MessageType::REQUEST): {
+        constexpr std::uint64_t num_elements_in_root_array = 4;
+        constexpr std::uint64_t num_elements_with_extension = 5;
+        if (num_elements != num_elements_in_root_array &&
+            num_elements != num_elements_with_extension) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, invalid_size_message);
+        }
+        const std::size_t id_offset = reader.position();
+        const MessageID id = read_message_id(reader);
+        const std::size_t id_size = reader.position() - id_offset;
+        const MethodNameView method_name = read_method_name(reader);
+        return RawMessage(MessageType::REQUEST, id, method_name,
+            std::move(buffer), offset, size, id_offset, id_size);
+    }
+    case static_cast<std::uint64_t>(MessageType::RESPONSE): {
+        constexpr std::uint64_t num_elements_in_root_array = 4;
+        if (num_elements != num_elements_in_root_array) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, invalid_size_message);
+        }
+        const std::size_t id_offset = reader.position();
+        const MessageID id = read_message_id(reader);
+        const std::size_t id_size = reader.position() - id_offset;
+        return RawMessage(MessageType::RESPONSE, id,
+            MethodNameView(std::string_view()), std::move(buffer), offset,
+            size, id_offset, id_size);
+    }
+    case static_cast<std::uint64_t>(MessageType::NOTIFICATION): {
+        constexpr std::uint64_t num_elements_in_root_array = 3;
+        if (num_elements != num_elements_in_root_array) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, invalid_size_message);
+        }
+        const MethodNameView method_name = read_method_name(reader);
+        if (!has_request_id_parameter(method_name)) {
+            return RawMessage(MessageType::NOTIFICATION, std::nullopt,
+                method_name, std::move(buffer), offset, size, 0U, 0U);
+        }
+        const std::uint64_t num_parameters =
+            reader.read_array_size("Invalid type of parameters.");
+        if (num_parameters == 0U) {
+            throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+                "Invalid number of parameters.");
+        }
+        const std::size_t id_offset = reader.position();
+        const MessageID id = read_message_id(reader);
+        const std::size_t id_size = reader.position() - id_offset;
+        return RawMessage(MessageType::NOTIFICATION, id, method_name,
+            std::move(buffer), offset, size, id_offset, id_size);
+    }
+    default:
+        throw MsgpackRPCException(
+            StatusCode::INVALID_MESSAGE, "Invalid message type in a message.");
+    }
+}
+
+ParsedMessage scan_message(
+    const std::shared_ptr<const std::vector<char>>& buffer, std::size_t offset,
+    std::size_t size) {
+    const char* data = buffer->data() + offset;
+    MessageHeaderReader reader(data, size);
+    constexpr std::string_view invalid_size_message =
+        "Invalid size of the array of a message.";
+    const std::uint64_t num_elements =
+        reader.read_array_size("Invalid type of a message.");
+    constexpr std::uint64_t min_elements_in_root_array = 3;
+    if (num_elements < min_elements_in_root_array) {
+        throw MsgpackRPCException(
+            StatusCode::INVALID_MESSAGE, invalid_size_message);
+    }
+    const std::uint64_t type =
+        reader.read_uint("Invalid message type in a message.");
+
+    switch (type) {
+    case static_cast<std::uint64_t>(MessageType::REQUEST): {
+        constexpr std::uint64_t num_elements_in_root_array = 4;
+        constexpr std::uint64_t num_elements_with_extension = 5;
+        if (num_elements != num_elements_in_root_array &&
+            num_elements != num_elements_with_extension) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, invalid_size_message);
+        }
+        const MessageID id = read_message_id(reader);
+        const MethodNameView method_name = read_method_name(reader);
+        auto parameters = read_parameters(reader, buffer, offset);
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+        if (num_elements == num_elements_with_extension) {
+            deadline = read_deadline(reader, data);
+        }
+        return ParsedRequest(id, method_name, std::move(parameters), deadline);
+    }
+    case static_cast<std::uint64_t>(MessageType::RESPONSE): {
+        constexpr std::uint64_t num_elements_in_root_array = 4;
+        if (num_elements != num_elements_in_root_array) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, invalid_size_message);
+        }
+        const MessageID id = read_message_id(reader);
+        constexpr std::string_view error_message =
+            "Invalid result in a message.";
+        if (!reader.is_next_nil()) {
+            return ParsedResponse(id,
+                CallResult::create_error(read_encoded_object(
+                    reader, buffer, offset, error_message)));
+        }
+        (void)reader.skip_object(error_message);
+        return ParsedResponse(id,
+            CallResult::create_result(
+                read_encoded_object(reader, buffer, offset, error_message)));
+    }
+    case static_cast<std::uint64_t>(MessageType::NOTIFICATION): {
+        constexpr std::uint64_t num_elements_in_root_array = 3;
+        if (num_elements != num_elements_in_root_array) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, invalid_size_message);
+        }
+        const MethodNameView method_name = read_method_name(reader);
+        return ParsedNotification(
+            method_name, read_parameters(reader, buffer, offset));
+    }
+    default:
+        throw MsgpackRPCException(
+            StatusCode::INVALID_MESSAGE, "Invalid message type in a message.");
+    }
+}
+
+}  // namespace msgpack_rpc::messages::impl
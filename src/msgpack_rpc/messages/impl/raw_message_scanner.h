@@ -0,0 +1,116 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to scan raw messages.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "msgpack_rpc/impl/msgpack_rpc_export.h"
+#include "msgpack_rpc/messages/parsed_message.h"
+#include "msgpack_rpc/messages/raw_message.h"
+
+namespace msgpack_rpc::messages::impl {
+
+/*!
+ * \brief Find the size of an object in msgpack at the beginning of data.
+ *
+ * This function only checks the formats and sizes of objects, and never
+ * decodes the objects.
+ *
+ * \param[in] data Pointer to the data.
+ * \param[in] size Size of the data.
+ * \return Size of the object. Null if more data is required.
+ *
+ * \note This function throws an exception with
+ * StatusCode::INVALID_MESSAGE for invalid data.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT std::optional<std::size_t>
+find_msgpack_object_size(const char* data, std::size_t size);
+
+/*!
+ * \brief Continue to find the size of an object in msgpack at the beginning of
+ * data.
+ *
+ * This function scans only the data after the bytes already scanned, so finding
+ * the size of an object received in parts takes time linear in the size of the
+ * object.
+ *
+ * \param[in] data Pointer to the data.
+ * \param[in] size Size of the data.
+ * \param[in,out] scanned_size Size of the data already scanned. (Zero at
+ * first.) This is the size of the object when this function returns true.
+ * \param[in,out] num_remaining_objects Number of objects not scanned yet. (One
+ * at first.)
+ * \return Whether the whole object has been scanned.
+ *
+ * \note This function throws an exception with
+ * StatusCode::INVALID_MESSAGE for invalid data.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT bool continue_finding_msgpack_object_size(
+    const char* data, std::size_t size, std::size_t& scanned_size,
+    std::uint64_t& num_remaining_objects);
+
+/*!
+ * \brief Check whether data starts with an array in msgpack.
+ *
+ * \param[in] data Pointer to the data.
+ * \param[in] size Size of the data.
+ * \return Whether the data starts with an array.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT bool is_msgpack_array(
+    const char* data, std::size_t size) noexcept;
+
+/*!
+ * \brief Parse the header of a message.
+ *
+ * \param[in] buffer Buffer of the data.
+ * \param[in] offset Offset of the message in the buffer.
+ * \param[in] size Size of the message found by find_msgpack_object_size.
+ * \return Message.
+ *
+ * \note This function throws an exception with
+ * StatusCode::INVALID_MESSAGE for invalid messages.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT RawMessage scan_raw_message(
+    std::shared_ptr<const std::vector<char>> buffer, std::size_t offset,
+    std::size_t size);
+
+/*!
+ * \brief Parse a message without decoding parameters and results.
+ *
+ * Parameters and results of the parsed message refer to the data, and are
+ * decoded when used.
+ *
+ * \param[in] buffer Buffer of the data.
+ * \param[in] offset Offset of the message in the buffer.
+ * \param[in] size Size of the message found by find_msgpack_object_size.
+ * \return Message.
+ *
+ * \note This function throws an exception with
+ * StatusCode::INVALID_MESSAGE for invalid messages.
+ */
+[[nodiscard]] MSGPACK_RPC_EXPORT ParsedMessage scan_message(
+    const std::shared_ptr<const std::vector<char>>& buffer, std::size_t offset,
+    std::size_t size);
+
+}  // namespace msgpack_rpc::messages::impl
@@ -21,6 +21,9 @@
 
 #include <cstddef>
 #include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "msgpack_rpc/messages/impl/sharable_binary_header.h"
 #include "msgpack_rpc/messages/serialized_message.h"
@@ -30,6 +33,13 @@ namespace msgpack_rpc::messages::impl {
 SerializationBuffer::SerializationBuffer()
     : buffer_(allocate_shared_binary()) {}
 
+SerializationBuffer::SerializationBuffer(std::size_t initial_capacity)
+    : buffer_(initial_capacity == 0U
+              ? allocate_shared_binary()
+              : allocate_sharable_binary(initial_capacity)) {
+    buffer_->binary_size = 0U;
+}
+
 SerializationBuffer::~SerializationBuffer() noexcept {
     deallocate_sharable_binary(buffer_);
 }
@@ -42,9 +52,17 @@ void SerializationBuffer::write(const char* data, std::size_t size) {
     buffer_->binary_size += size;
 }
 
+void SerializationBuffer::write_external(const ExternalBinary& binary) {
+    if (external_parts_ == nullptr) {
+        external_parts_ = std::make_shared<std::vector<ExternalBinaryPart>>();
+    }
+    external_parts_->push_back(
+        ExternalBinaryPart{buffer_->binary_size, binary});
+}
+
 SerializedMessage SerializationBuffer::release() noexcept {
     enable_reference_count_of_sharable_binary(buffer_);
-    SerializedMessage message{buffer_};
+    SerializedMessage message{buffer_, std::move(external_parts_)};
     buffer_ = nullptr;
     return message;
 }
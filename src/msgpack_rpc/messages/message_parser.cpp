@@ -21,39 +21,84 @@
 
 #include <utility>
 
+#include <msgpack.hpp>
+
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/impl/message_compression.h"
 #include "msgpack_rpc/messages/impl/parse_message_from_object.h"
+#include "msgpack_rpc/messages/impl/raw_message_scanner.h"
 #include "msgpack_rpc/messages/parsed_message.h"
 
 namespace msgpack_rpc::messages {
 
+namespace {
+
+/*!
+ * \brief Parse a message which is not an array, such as compressed messages.
+ *
+ * \param[in] data Pointer to the data of the message.
+ * \param[in] size Size of the message.
+ * \param[in] max_message_size Maximum size of a message.
+ * \param[in] framed_message_handler Function called with the data of the
+ * message, or the data of the original message for compressed messages.
+ * \return Message.
+ */
+[[nodiscard]] ParsedMessage parse_non_array_message(const char* data,
+    std::size_t size, std::size_t max_message_size,
+    const impl::FramedMessageHandler& framed_message_handler) {
+    msgpack::object_handle object = [data, size] {
+        try {
+            return msgpack::unpack(data, size);
+        } catch (const msgpack::unpack_error&) {
+            throw MsgpackRPCException(
+                StatusCode::INVALID_MESSAGE, "Failed to parse a message.");
+        }
+    }();
+    if (impl::is_compressed_message(object.get())) {
+        return impl::parse_message_from_object(impl::decompress_message(
+            object.get(), max_message_size, framed_message_handler));
+    }
+    if (framed_message_handler) {
+        framed_message_handler(data, size);
+    }
+    return impl::parse_message_from_object(std::move(object));
+}
+
+}  // namespace
+
 MessageParser::MessageParser(const config::MessageParserConfig& config)
-    : read_buffer_size_(config.read_buffer_size()) {}
+    : framer_(config.read_buffer_size(), config.max_message_size()),
+      max_message_size_(config.max_message_size()) {}
 
 MessageParser::~MessageParser() = default;
 
-BufferView MessageParser::prepare_buffer() {
-    parser_.reserve_buffer(read_buffer_size_);
-    return BufferView(parser_.buffer(), read_buffer_size_);
-}
+BufferView MessageParser::prepare_buffer() { return framer_.prepare_buffer(); }
 
 void MessageParser::consumed(std::size_t num_bytes) {
-    parser_.buffer_consumed(num_bytes);
+    framer_.consumed(num_bytes);
+}
+
+void MessageParser::set_framed_message_handler(
+    impl::FramedMessageHandler handler) {
+    framed_message_handler_ = std::move(handler);
 }
 
 std::optional<ParsedMessage> MessageParser::try_parse() {
-    msgpack::object_handle object;
-    try {
-        if (!parser_.next(object)) {
-            return std::nullopt;
-        }
-    } catch (const msgpack::unpack_error&) {
-        throw MsgpackRPCException(
-            StatusCode::INVALID_MESSAGE, "Failed to parse a message.");
+    const auto framed = framer_.try_frame();
+    if (!framed) {
+        return std::nullopt;
     }
 
-    return impl::parse_message_from_object(std::move(object));
+    const char* data = framed->buffer->data() + framed->offset;
+    if (!impl::is_msgpack_array(data, framed->size)) {
+        return parse_non_array_message(
+            data, framed->size, max_message_size_, framed_message_handler_);
+    }
+    if (framed_message_handler_) {
+        framed_message_handler_(data, framed->size);
+    }
+    return impl::scan_message(framed->buffer, framed->offset, framed->size);
 }
 
 }  // namespace msgpack_rpc::messages
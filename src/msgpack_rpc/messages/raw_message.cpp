@@ -0,0 +1,74 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of RawMessage class.
+ */
+#include "msgpack_rpc/messages/raw_message.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/external_binary.h"
+#include "msgpack_rpc/messages/impl/serialization_buffer.h"
+
+namespace msgpack_rpc::messages {
+
+namespace {
+
+/*!
+ * \brief Create an ExternalBinary object referring to a part of a buffer.
+ *
+ * \param[in] buffer Buffer.
+ * \param[in] data Pointer to the data in the buffer.
+ * \param[in] size Size of the data.
+ * \return ExternalBinary object keeping the buffer alive.
+ */
+[[nodiscard]] ExternalBinary refer_buffer(
+    const std::shared_ptr<const std::vector<char>>& buffer, const char* data,
+    std::size_t size) {
+    return ExternalBinary(data, size, [buffer] { (void)buffer; });
+}
+
+}  // namespace
+
+SerializedMessage RawMessage::serialize() const {
+    impl::SerializationBuffer buffer;
+    buffer.write_external(refer_buffer(buffer_, data(), size_));
+    return buffer.release();
+}
+
+SerializedMessage RawMessage::serialize_with_id(MessageID id) const {
+    if (!id_) {
+        throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
+            "This message has no message ID.");
+    }
+    impl::SerializationBuffer buffer;
+    buffer.write(data(), id_offset_);
+    msgpack::packer<impl::SerializationBuffer> packer{buffer};
+    packer.pack(id);
+    const std::size_t rest_offset = id_offset_ + id_size_;
+    buffer.write_external(
+        refer_buffer(buffer_, data() + rest_offset, size_ - rest_offset));
+    return buffer.release();
+}
+
+}  // namespace msgpack_rpc::messages
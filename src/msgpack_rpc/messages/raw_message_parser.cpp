@@ -0,0 +1,59 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of RawMessageParser class.
+ */
+#include "msgpack_rpc/messages/raw_message_parser.h"
+
+#include <utility>
+
+#include "msgpack_rpc/messages/impl/raw_message_scanner.h"
+
+namespace msgpack_rpc::messages {
+
+RawMessageParser::RawMessageParser(const config::MessageParserConfig& config)
+    : framer_(config.read_buffer_size(), config.max_message_size()) {}
+
+RawMessageParser::~RawMessageParser() = default;
+
+BufferView RawMessageParser::prepare_buffer() {
+    return framer_.prepare_buffer();
+}
+
+void RawMessageParser::consumed(std::size_t num_bytes) {
+    framer_.consumed(num_bytes);
+}
+
+void RawMessageParser::set_framed_message_handler(
+    impl::FramedMessageHandler handler) {
+    framed_message_handler_ = std::move(handler);
+}
+
+std::optional<RawMessage> RawMessageParser::try_parse() {
+    auto framed = framer_.try_frame();
+    if (!framed) {
+        return std::nullopt;
+    }
+    if (framed_message_handler_) {
+        framed_message_handler_(
+            framed->buffer->data() + framed->offset, framed->size);
+    }
+    return impl::scan_raw_message(
+        std::move(framed->buffer), framed->offset, framed->size);
+}
+
+}  // namespace msgpack_rpc::messages
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of RawResult class.
+ */
+#include "msgpack_rpc/messages/raw_result.h"
+
+#include <cstddef>
+#include <optional>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/impl/raw_message_scanner.h"
+
+namespace msgpack_rpc::messages::impl {
+
+void validate_raw_result(const char* data, std::size_t size) {
+    std::optional<std::size_t> object_size;
+    try {
+        object_size = find_msgpack_object_size(data, size);
+    } catch (const MsgpackRPCException&) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Invalid data in msgpack format in a raw result.");
+    }
+    if (object_size != size) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "A raw result must be exactly one object in msgpack format.");
+    }
+}
+
+}  // namespace msgpack_rpc::messages::impl
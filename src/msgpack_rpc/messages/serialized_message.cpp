@@ -21,7 +21,9 @@
 
 #include <cstddef>
 #include <cstring>
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include "msgpack_rpc/messages/impl/sharable_binary_header.h"
 
@@ -37,13 +39,19 @@ SerializedMessage::SerializedMessage(const char* data, std::size_t size)
 SerializedMessage::SerializedMessage(impl::SharableBinaryHeader* buffer)
     : buffer_(buffer) {}
 
+SerializedMessage::SerializedMessage(impl::SharableBinaryHeader* buffer,
+    std::shared_ptr<const std::vector<impl::ExternalBinaryPart>>
+        external_parts) noexcept
+    : buffer_(buffer), external_parts_(std::move(external_parts)) {}
+
 SerializedMessage::SerializedMessage(const SerializedMessage& other) noexcept
-    : buffer_(other.buffer_) {
+    : buffer_(other.buffer_), external_parts_(other.external_parts_) {
     impl::add_reference_count_of_sharable_binary(buffer_);
 }
 
 SerializedMessage::SerializedMessage(SerializedMessage&& other) noexcept
-    : buffer_(std::exchange(other.buffer_, nullptr)) {}
+    : buffer_(std::exchange(other.buffer_, nullptr)),
+      external_parts_(std::move(other.external_parts_)) {}
 
 SerializedMessage& SerializedMessage::operator=(
     const SerializedMessage& other) noexcept {
@@ -55,12 +63,14 @@ SerializedMessage& SerializedMessage::operator=(
     }
     buffer_ = other.buffer_;
     impl::add_reference_count_of_sharable_binary(buffer_);
+    external_parts_ = other.external_parts_;
     return *this;
 }
 
 SerializedMessage& SerializedMessage::operator=(
     SerializedMessage&& other) noexcept {
     std::swap(buffer_, other.buffer_);
+    std::swap(external_parts_, other.external_parts_);
     return *this;
 }
 
@@ -78,4 +88,29 @@ std::size_t SerializedMessage::size() const noexcept {
     return buffer_->binary_size;
 }
 
+std::size_t SerializedMessage::total_size() const noexcept {
+    std::size_t size = this->size();
+    if (external_parts_ != nullptr) {
+        for (const auto& part : *external_parts_) {
+            size += part.binary.size();
+        }
+    }
+    return size;
+}
+
+SerializedMessage SerializedMessage::flatten() const {
+    if (external_parts_ == nullptr) {
+        return *this;
+    }
+    auto* buffer = impl::allocate_sharable_binary(total_size());
+    // Following operations won't throw exceptions.
+    impl::enable_reference_count_of_sharable_binary(buffer);
+    std::size_t offset = 0;
+    for_each_buffer([buffer, &offset](const char* data, std::size_t size) {
+        std::memcpy(impl::binary_buffer_of(buffer) + offset, data, size);
+        offset += size;
+    });
+    return SerializedMessage(buffer);
+}
+
 }  // namespace msgpack_rpc::messages
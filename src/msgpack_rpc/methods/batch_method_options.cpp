@@ -0,0 +1,80 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of BatchMethodOptions class.
+ */
+#include "msgpack_rpc/methods/batch_method_options.h"
+
+#include <chrono>
+#include <cstddef>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+
+namespace msgpack_rpc::methods {
+
+namespace {
+
+constexpr std::size_t BATCH_METHOD_OPTIONS_DEFAULT_MAX_BATCH_SIZE = 1024;
+
+}  // namespace
+
+BatchMethodOptions::BatchMethodOptions()
+    : max_batch_size_(BATCH_METHOD_OPTIONS_DEFAULT_MAX_BATCH_SIZE),
+      max_waiting_time_(0),
+      batch_across_connections_(true) {}
+
+BatchMethodOptions& BatchMethodOptions::max_batch_size(std::size_t value) {
+    if (value <= 0U) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Maximum number of requests in a batch must be larger than "
+            "zero.");
+    }
+    max_batch_size_ = value;
+    return *this;
+}
+
+BatchMethodOptions& BatchMethodOptions::max_waiting_time(
+    std::chrono::nanoseconds value) {
+    if (value < std::chrono::nanoseconds(0)) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Waiting time must be larger than or equal to zero.");
+    }
+    max_waiting_time_ = value;
+    return *this;
+}
+
+BatchMethodOptions& BatchMethodOptions::batch_across_connections(
+    bool value) noexcept {
+    batch_across_connections_ = value;
+    return *this;
+}
+
+std::size_t BatchMethodOptions::max_batch_size() const noexcept {
+    return max_batch_size_;
+}
+
+std::chrono::nanoseconds BatchMethodOptions::max_waiting_time()
+    const noexcept {
+    return max_waiting_time_;
+}
+
+bool BatchMethodOptions::batch_across_connections() const noexcept {
+    return batch_across_connections_;
+}
+
+}  // namespace msgpack_rpc::methods
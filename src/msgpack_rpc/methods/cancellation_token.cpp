@@ -0,0 +1,52 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of CancellationToken class.
+ */
+#include "msgpack_rpc/methods/cancellation_token.h"
+
+#include <utility>
+
+namespace msgpack_rpc::methods {
+
+namespace {
+
+//! Token of cancellation of the request being processed in this thread.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::shared_ptr<const CancellationToken> current_token{};
+
+}  // namespace
+
+std::shared_ptr<const CancellationToken> current_cancellation_token() noexcept {
+    return current_token;
+}
+
+namespace impl {
+
+CancellationTokenScope::CancellationTokenScope(
+    std::shared_ptr<const CancellationToken> token) noexcept
+    : previous_token_(std::move(current_token)) {
+    current_token = std::move(token);
+}
+
+CancellationTokenScope::~CancellationTokenScope() noexcept {
+    current_token = std::move(previous_token_);
+}
+
+}  // namespace impl
+
+}  // namespace msgpack_rpc::methods
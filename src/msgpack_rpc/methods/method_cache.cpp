@@ -0,0 +1,57 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of MethodCache class.
+ */
+#include "msgpack_rpc/methods/method_cache.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace msgpack_rpc::methods {
+
+MethodCache::MethodCache(const MethodCacheOptions& options)
+    : cache_(options.time_to_live(), options.max_entries(),
+          options.max_bytes()) {}
+
+std::shared_ptr<const std::string> MethodCache::find(
+    std::string_view key, Clock::time_point now) {
+    auto result = cache_.find(key, now);
+    if (!result) {
+        return nullptr;
+    }
+    return std::move(*result);
+}
+
+void MethodCache::insert(
+    std::string key, std::string result, Clock::time_point now) {
+    const std::size_t result_bytes = result.size();
+    cache_.insert(std::move(key),
+        std::make_shared<const std::string>(std::move(result)), result_bytes,
+        now);
+}
+
+MethodCacheStatistics MethodCache::statistics() {
+    return cache_.statistics<MethodCacheStatistics>();
+}
+
+MethodCache::~MethodCache() noexcept = default;
+
+}  // namespace msgpack_rpc::methods
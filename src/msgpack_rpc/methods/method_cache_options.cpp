@@ -0,0 +1,88 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of MethodCacheOptions class.
+ */
+#include "msgpack_rpc/methods/method_cache_options.h"
+
+#include <chrono>
+#include <cstddef>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+
+namespace msgpack_rpc::methods {
+
+namespace {
+
+constexpr std::size_t METHOD_CACHE_OPTIONS_DEFAULT_MAX_ENTRIES = 1024;
+
+constexpr std::size_t METHOD_CACHE_OPTIONS_DEFAULT_MAX_BYTES =
+    static_cast<std::size_t>(64) * 1024 * 1024;
+
+constexpr auto METHOD_CACHE_OPTIONS_DEFAULT_TIME_TO_LIVE =
+    std::chrono::seconds(1);
+
+}  // namespace
+
+MethodCacheOptions::MethodCacheOptions()
+    : max_entries_(METHOD_CACHE_OPTIONS_DEFAULT_MAX_ENTRIES),
+      max_bytes_(METHOD_CACHE_OPTIONS_DEFAULT_MAX_BYTES),
+      time_to_live_(METHOD_CACHE_OPTIONS_DEFAULT_TIME_TO_LIVE) {}
+
+MethodCacheOptions& MethodCacheOptions::max_entries(std::size_t value) {
+    if (value <= 0U) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Maximum number of cached results must be larger than zero.");
+    }
+    max_entries_ = value;
+    return *this;
+}
+
+MethodCacheOptions& MethodCacheOptions::max_bytes(std::size_t value) {
+    if (value <= 0U) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Maximum number of bytes of cached results must be larger than "
+            "zero.");
+    }
+    max_bytes_ = value;
+    return *this;
+}
+
+MethodCacheOptions& MethodCacheOptions::time_to_live(
+    std::chrono::nanoseconds value) {
+    if (value <= std::chrono::nanoseconds(0)) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            "Time to live must be longer than zero.");
+    }
+    time_to_live_ = value;
+    return *this;
+}
+
+std::size_t MethodCacheOptions::max_entries() const noexcept {
+    return max_entries_;
+}
+
+std::size_t MethodCacheOptions::max_bytes() const noexcept {
+    return max_bytes_;
+}
+
+std::chrono::nanoseconds MethodCacheOptions::time_to_live() const noexcept {
+    return time_to_live_;
+}
+
+}  // namespace msgpack_rpc::methods
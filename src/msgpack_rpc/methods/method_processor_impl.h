@@ -66,6 +66,20 @@ public:
         }
     }
 
+    //! \copydoc msgpack_rpc::methods::IMethodProcessor::async_call
+    void async_call(const messages::ParsedRequest& request,
+        const IMethod::ResponseCallback& on_response) override {
+        try {
+            methods_.get(request.method_name())
+                ->async_call(request, on_response);
+        } catch (const std::exception& e) {
+            MSGPACK_RPC_DEBUG(logger_, "Error when calling a method {}: {}",
+                request.method_name(), e.what());
+            on_response(messages::MessageSerializer::serialize_error_response(
+                request.id(), e.what()));
+        }
+    }
+
     //! \copydoc msgpack_rpc::methods::IMethodProcessor::notify
     void notify(const messages::ParsedNotification& notification) override {
         try {
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to get deadlines of requests.
+ */
+#include "msgpack_rpc/methods/request_deadline.h"
+
+#include <algorithm>
+
+namespace msgpack_rpc::methods {
+
+namespace {
+
+//! Deadline of the request being processed in this thread.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::optional<std::chrono::steady_clock::time_point>
+    current_deadline{};
+
+}  // namespace
+
+std::optional<std::chrono::steady_clock::time_point>
+current_request_deadline() noexcept {
+    return current_deadline;
+}
+
+std::optional<std::chrono::nanoseconds> remaining_budget() noexcept {
+    if (!current_deadline) {
+        return std::nullopt;
+    }
+    return std::max(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            *current_deadline - std::chrono::steady_clock::now()),
+        std::chrono::nanoseconds(0));
+}
+
+namespace impl {
+
+RequestDeadlineScope::RequestDeadlineScope(
+    std::optional<std::chrono::steady_clock::time_point> deadline) noexcept
+    : previous_deadline_(current_deadline) {
+    current_deadline = deadline;
+}
+
+RequestDeadlineScope::~RequestDeadlineScope() noexcept {
+    current_deadline = previous_deadline_;
+}
+
+}  // namespace impl
+
+}  // namespace msgpack_rpc::methods
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of StreamWriter class.
+ */
+#include "msgpack_rpc/methods/stream_writer.h"
+
+namespace msgpack_rpc::methods::impl {
+
+namespace {
+
+//! Sender of chunks of the request being processed in this thread.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local IStreamChunkSender* current_sender{nullptr};
+
+}  // namespace
+
+IStreamChunkSender* current_stream_chunk_sender() noexcept {
+    return current_sender;
+}
+
+StreamChunkSenderScope::StreamChunkSenderScope(
+    IStreamChunkSender* sender) noexcept
+    : previous_sender_(current_sender) {
+    current_sender = sender;
+}
+
+StreamChunkSenderScope::~StreamChunkSenderScope() noexcept {
+    current_sender = previous_sender_;
+}
+
+}  // namespace msgpack_rpc::methods::impl
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of UploadReader class.
+ */
+#include "msgpack_rpc/methods/upload_reader.h"
+
+namespace msgpack_rpc::methods::impl {
+
+namespace {
+
+//! Source of chunks of the request being processed in this thread.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local IUploadChunkSource* current_source{nullptr};
+
+}  // namespace
+
+IUploadChunkSource* current_upload_chunk_source() noexcept {
+    return current_source;
+}
+
+UploadChunkSourceScope::UploadChunkSourceScope(
+    IUploadChunkSource* source) noexcept
+    : previous_source_(current_source) {
+    current_source = source;
+}
+
+UploadChunkSourceScope::~UploadChunkSourceScope() noexcept {
+    current_source = previous_source_;
+}
+
+}  // namespace msgpack_rpc::methods::impl
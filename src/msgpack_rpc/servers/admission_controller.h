@@ -0,0 +1,158 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of AdmissionController class.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "msgpack_rpc/config/admission_control_config.h"
+
+namespace msgpack_rpc::servers {
+
+/*!
+ * \brief Increment a counter if the result doesn't exceed a limit.
+ *
+ * \param[in,out] counter Counter.
+ * \param[in] limit Limit. (Zero for no limit.)
+ * \retval true Counter was incremented.
+ * \retval false Counter has already reached the limit.
+ */
+inline bool try_increment_within(
+    std::atomic<std::size_t>& counter, std::size_t limit) noexcept {
+    if (limit == 0U) {
+        counter.fetch_add(1U, std::memory_order_relaxed);
+        return true;
+    }
+    std::size_t current = counter.load(std::memory_order_relaxed);
+    do {
+        if (current >= limit) {
+            return false;
+        }
+    } while (!counter.compare_exchange_weak(
+        current, current + 1U, std::memory_order_relaxed));
+    return true;
+}
+
+/*!
+ * \brief Class to limit connections and requests processed in servers.
+ *
+ * \note Objects of this class are shared among connections and thread-safe.
+ */
+class AdmissionController {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] config Configuration.
+     */
+    explicit AdmissionController(
+        const config::AdmissionControlConfig& config) noexcept
+        : max_connections_(config.max_connections()),
+          max_in_flight_per_connection_(config.max_in_flight_per_connection()),
+          max_in_flight_requests_(config.max_in_flight_requests()) {}
+
+    /*!
+     * \brief Try to add a connection.
+     *
+     * \retval true The connection is admitted.
+     * \retval false The connection must be rejected.
+     */
+    [[nodiscard]] bool try_add_connection() noexcept {
+        return try_increment_within(num_connections_, max_connections_);
+    }
+
+    /*!
+     * \brief Remove a connection added by try_add_connection.
+     */
+    void remove_connection() noexcept {
+        num_connections_.fetch_sub(1U, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Try to start processing of a request.
+     *
+     * \param[in,out] num_in_flight_in_connection Number of in-flight requests
+     * in the connection of the request.
+     * \retval true The request is admitted.
+     * \retval false The request must be rejected.
+     */
+    [[nodiscard]] bool try_start_request(
+        std::atomic<std::size_t>& num_in_flight_in_connection) noexcept {
+        if (!try_increment_within(
+                num_in_flight_in_connection, max_in_flight_per_connection_)) {
+            return false;
+        }
+        if (!try_increment_within(
+                num_in_flight_requests_, max_in_flight_requests_)) {
+            num_in_flight_in_connection.fetch_sub(
+                1U, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    /*!
+     * \brief Finish processing of a request admitted by try_start_request.
+     *
+     * \param[in,out] num_in_flight_in_connection Number of in-flight requests
+     * in the connection of the request.
+     */
+    void finish_request(
+        std::atomic<std::size_t>& num_in_flight_in_connection) noexcept {
+        num_in_flight_requests_.fetch_sub(1U, std::memory_order_relaxed);
+        num_in_flight_in_connection.fetch_sub(1U, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Get the number of connections.
+     *
+     * \return Number of connections.
+     */
+    [[nodiscard]] std::size_t num_connections() const noexcept {
+        return num_connections_.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Get the number of in-flight requests in the server.
+     *
+     * \return Number of requests.
+     */
+    [[nodiscard]] std::size_t num_in_flight_requests() const noexcept {
+        return num_in_flight_requests_.load(std::memory_order_relaxed);
+    }
+
+private:
+    //! Maximum number of connections.
+    std::size_t max_connections_;
+
+    //! Maximum number of in-flight requests in a connection.
+    std::size_t max_in_flight_per_connection_;
+
+    //! Maximum number of in-flight requests in the server.
+    std::size_t max_in_flight_requests_;
+
+    //! Number of connections.
+    std::atomic<std::size_t> num_connections_{0};
+
+    //! Number of in-flight requests in the server.
+    std::atomic<std::size_t> num_in_flight_requests_{0};
+};
+
+}  // namespace msgpack_rpc::servers
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions of IDs of connections in servers.
+ */
+#include "msgpack_rpc/servers/connection_id.h"
+
+namespace msgpack_rpc::servers {
+
+namespace {
+
+//! ID of the connection of the message being processed in this thread.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::optional<ConnectionID> current_id{};
+
+}  // namespace
+
+std::optional<ConnectionID> current_connection_id() noexcept {
+    return current_id;
+}
+
+namespace impl {
+
+ConnectionIDScope::ConnectionIDScope(ConnectionID id) noexcept
+    : previous_id_(current_id) {
+    current_id = id;
+}
+
+ConnectionIDScope::~ConnectionIDScope() noexcept { current_id = previous_id_; }
+
+}  // namespace impl
+
+}  // namespace msgpack_rpc::servers
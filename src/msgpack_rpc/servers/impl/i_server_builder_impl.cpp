@@ -21,9 +21,8 @@
 
 #include <memory>
 #include <utility>
-#include <vector>
 
-#include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/servers/impl/server_builder_impl.h"
 #include "msgpack_rpc/transport/backend_list.h"
 #include "msgpack_rpc/transport/create_default_backend_list.h"
@@ -34,8 +33,7 @@ std::unique_ptr<IServerBuilderImpl> create_empty_server_builder_impl(
     std::shared_ptr<executors::IAsyncExecutor> executor,
     std::shared_ptr<logging::Logger> logger) {
     return std::make_unique<ServerBuilderImpl>(std::move(executor),
-        std::move(logger), transport::BackendList(),
-        std::vector<addresses::URI>{});
+        std::move(logger), transport::BackendList(), config::ServerConfig());
 }
 
 std::unique_ptr<IServerBuilderImpl> create_default_builder_impl(
@@ -45,9 +43,10 @@ std::unique_ptr<IServerBuilderImpl> create_default_builder_impl(
         executors::create_executor(logger, server_config.executor());
 
     auto builder = std::make_unique<ServerBuilderImpl>(executor, logger,
-        transport::create_default_backend_list(
-            executor, server_config.message_parser(), logger),
-        server_config.uris());
+        transport::create_default_backend_list(executor,
+            server_config.message_parser(), logger, server_config.socket(),
+            server_config.compression(), server_config.traffic_capture()),
+        server_config);
 
     return builder;
 }
@@ -26,7 +26,9 @@
 #include "msgpack_rpc/addresses/uri.h"
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/executors/i_async_executor.h"
+#include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/methods/i_method.h"
 #include "msgpack_rpc/methods/i_method_processor.h"
@@ -52,15 +54,15 @@ public:
      * \param[in] executor Executor.
      * \param[in] logger Logger.
      * \param[in] backends Backends.
-     * \param[in] uris URIs to listen to.
+     * \param[in] config Configuration.
      */
     ServerBuilderImpl(std::shared_ptr<executors::IAsyncExecutor> executor,
         std::shared_ptr<logging::Logger> logger,
-        transport::BackendList backends, std::vector<addresses::URI> uris)
+        transport::BackendList backends, config::ServerConfig config)
         : executor_(std::move(executor)),
           logger_(std::move(logger)),
           backends_(std::move(backends)),
-          uris_(std::move(uris)),
+          config_(std::move(config)),
           processor_(methods::create_method_processor(logger_)) {}
 
     //! \copydoc msgpack_rpc::servers::impl::IServerBuilderImpl::register_protocol
@@ -71,7 +73,7 @@ public:
 
     //! \copydoc msgpack_rpc::servers::impl::IServerBuilderImpl::listen_to
     void listen_to(addresses::URI uri) override {
-        uris_.push_back(std::move(uri));
+        config_.add_uri(std::move(uri));
     }
 
     //! \copydoc msgpack_rpc::servers::impl::IServerBuilderImpl::add_method
@@ -81,13 +83,13 @@ public:
 
     //! \copydoc msgpack_rpc::servers::impl::IServerBuilderImpl::build
     [[nodiscard]] std::unique_ptr<IServerImpl> build() override {
-        if (uris_.empty()) {
+        if (config_.uris().empty()) {
             throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
                 "No URI to listen to was given.");
         }
 
         std::vector<std::shared_ptr<transport::IAcceptor>> acceptors;
-        for (const auto& uri : uris_) {
+        for (const auto& uri : config_.uris()) {
             const auto backend = backends_.find(uri.scheme());
 
             const auto added_acceptors =
@@ -102,8 +104,8 @@ public:
                 "All URI set to listen to was unusable.");
         }
 
-        auto server = std::make_unique<ServerImpl>(
-            std::move(acceptors), std::move(processor_), executor_, logger_);
+        auto server = std::make_unique<ServerImpl>(std::move(acceptors),
+            std::move(processor_), executor_, config_, logger_);
         server->start();
 
         return server;
@@ -114,6 +116,11 @@ public:
         return logger_;
     }
 
+    //! \copydoc msgpack_rpc::servers::impl::IServerBuilderImpl::executor
+    [[nodiscard]] std::shared_ptr<executors::IExecutor> executor() override {
+        return executor_;
+    }
+
 private:
     //! Executor.
     std::shared_ptr<executors::IAsyncExecutor> executor_;
@@ -124,8 +131,8 @@ private:
     //! Backends.
     transport::BackendList backends_{};
 
-    //! URIs to listen to.
-    std::vector<addresses::URI> uris_{};
+    //! Configuration.
+    config::ServerConfig config_;
 
     //! Processor of methods.
     std::unique_ptr<methods::IMethodProcessor> processor_;
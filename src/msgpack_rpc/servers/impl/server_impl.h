@@ -20,6 +20,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <memory>
@@ -29,14 +30,25 @@
 
 #include "msgpack_rpc/addresses/i_address.h"
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/executors/i_async_executor.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/functional_method.h"
 #include "msgpack_rpc/methods/i_method_processor.h"
+#include "msgpack_rpc/servers/admission_controller.h"
+#include "msgpack_rpc/servers/connection_id.h"
 #include "msgpack_rpc/servers/impl/i_server_impl.h"
 #include "msgpack_rpc/servers/server_connection.h"
+#include "msgpack_rpc/servers/server_connection_list.h"
 #include "msgpack_rpc/servers/stop_signal_handler.h"
 #include "msgpack_rpc/transport/i_acceptor.h"
 #include "msgpack_rpc/transport/i_connection.h"
@@ -54,17 +66,24 @@ public:
      * \param[in] acceptors Acceptors.
      * \param[in] processor Processor of methods.
      * \param[in] executor Executor.
+     * \param[in] config Configuration.
      * \param[in] logger Logger.
      */
     ServerImpl(std::vector<std::shared_ptr<transport::IAcceptor>> acceptors,
         std::unique_ptr<methods::IMethodProcessor> processor,
         std::shared_ptr<executors::IAsyncExecutor> executor,
-        std::shared_ptr<logging::Logger> logger)
+        config::ServerConfig config, std::shared_ptr<logging::Logger> logger)
         : acceptors_(std::move(acceptors)),
           processor_(std::move(processor)),
           executor_(std::move(executor)),
+          config_(std::move(config)),
+          admission_controller_(std::make_shared<AdmissionController>(
+              config_.admission_control())),
+          connection_list_(std::make_shared<ServerConnectionList>()),
           logger_(std::move(logger)),
-          stop_signal_handler_(std::make_shared<StopSignalHandler>(logger_)) {}
+          stop_signal_handler_(std::make_shared<StopSignalHandler>(logger_)) {
+        add_topic_methods();
+    }
 
     //! Destructor.
     ~ServerImpl() override {
@@ -145,12 +164,74 @@ public:
         return uris;
     }
 
+    //! \copydoc msgpack_rpc::servers::impl::IServerImpl::notify
+    bool notify(ConnectionID connection_id,
+        const messages::SerializedMessage& notification) override {
+        return connection_list_->notify(connection_id, notification);
+    }
+
+    //! \copydoc msgpack_rpc::servers::impl::IServerImpl::notify_all
+    std::size_t notify_all(
+        const messages::SerializedMessage& notification) override {
+        return connection_list_->notify_all(notification);
+    }
+
+    //! \copydoc msgpack_rpc::servers::impl::IServerImpl::async_call
+    [[nodiscard]] std::shared_ptr<clients::impl::ICallFutureImpl> async_call(
+        ConnectionID connection_id, messages::MethodNameView method_name,
+        const clients::impl::IParametersSerializer& parameters) override {
+        return connection_list_->async_call(
+            connection_id, method_name, parameters);
+    }
+
+    //! \copydoc msgpack_rpc::servers::impl::IServerImpl::publish
+    std::size_t publish(const std::string& topic,
+        const messages::SerializedMessage& notification) override {
+        return connection_list_->publish(topic, notification);
+    }
+
     //! \copydoc msgpack_rpc::servers::impl::IServerImpl::executor
     [[nodiscard]] std::shared_ptr<executors::IExecutor> executor() override {
         return executor_;
     }
 
 private:
+    /*!
+     * \brief Add methods to subscribe to topics and unsubscribe from them.
+     */
+    void add_topic_methods() {
+        processor_->append(
+            methods::create_functional_method<void(const std::string&)>(
+                messages::MethodName(messages::SUBSCRIBE_TOPIC_METHOD_NAME),
+                [connection_list = connection_list_](
+                    const std::string& topic) {
+                    connection_list->subscribe(topic, get_connection_id());
+                },
+                logger_));
+        processor_->append(
+            methods::create_functional_method<void(const std::string&)>(
+                messages::MethodName(messages::UNSUBSCRIBE_TOPIC_METHOD_NAME),
+                [connection_list = connection_list_](
+                    const std::string& topic) {
+                    connection_list->unsubscribe(topic, get_connection_id());
+                },
+                logger_));
+    }
+
+    /*!
+     * \brief Get the ID of the connection of the request being processed.
+     *
+     * \return ID.
+     */
+    [[nodiscard]] static ConnectionID get_connection_id() {
+        const auto id = current_connection_id();
+        if (!id) {
+            throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
+                "Topics can be subscribed only via connections.");
+        }
+        return *id;
+    }
+
     /*!
      * \brief Start processing of acceptors.
      */
@@ -158,10 +239,24 @@ private:
         for (const auto& acceptor : acceptors_) {
             acceptor->start(
                 [executor = std::weak_ptr<executors::IExecutor>(executor_),
-                    processor = processor_, logger = logger_](
+                    processor = processor_,
+                    server_config = config_,
+                    admission_controller = admission_controller_,
+                    connection_list = connection_list_, logger = logger_](
                     const std::shared_ptr<transport::IConnection>& connection) {
-                    const auto handler = std::make_shared<ServerConnection>(
-                        connection, executor, processor, logger);
+                    if (!admission_controller->try_add_connection()) {
+                        // The connection is closed when destructed.
+                        MSGPACK_RPC_WARN(logger,
+                            "Rejected a connection from {} because the number "
+                            "of connections reached the limit.",
+                            connection->remote_address().to_string());
+                        return;
+                    }
+                    const auto id = connection_list->create_id();
+                    const auto handler = std::make_shared<ServerConnection>(id,
+                        connection, executor, processor, server_config,
+                        admission_controller, logger);
+                    connection_list->add(id, handler);
                     handler->start();
                 });
             MSGPACK_RPC_DEBUG(logger_, "Listening to {}.",
@@ -187,6 +282,15 @@ private:
     //! Executor.
     std::shared_ptr<executors::IAsyncExecutor> executor_;
 
+    //! Configuration.
+    config::ServerConfig config_;
+
+    //! Controller of admission.
+    std::shared_ptr<AdmissionController> admission_controller_;
+
+    //! List of connections.
+    std::shared_ptr<ServerConnectionList> connection_list_;
+
     //! Logger.
     std::shared_ptr<logging::Logger> logger_;
 
@@ -19,28 +19,56 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <map>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 
 #include "msgpack_rpc/addresses/i_address.h"
+#include "msgpack_rpc/clients/impl/call_list.h"
+#include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/executors/async_invoke.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/executors/operation_type.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
 #include "msgpack_rpc/messages/method_name_view.h"
 #include "msgpack_rpc/messages/parsed_message.h"
 #include "msgpack_rpc/messages/parsed_notification.h"
 #include "msgpack_rpc/messages/parsed_request.h"
+#include "msgpack_rpc/messages/parsed_response.h"
+#include "msgpack_rpc/messages/reserved_error_keys.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
 #include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/cancellation_token.h"
 #include "msgpack_rpc/methods/i_method_processor.h"
+#include "msgpack_rpc/methods/request_deadline.h"
+#include "msgpack_rpc/methods/stream_writer.h"
+#include "msgpack_rpc/methods/upload_reader.h"
+#include "msgpack_rpc/servers/admission_controller.h"
+#include "msgpack_rpc/servers/connection_id.h"
+#include "msgpack_rpc/servers/upload_list.h"
+#include "msgpack_rpc/transport/flow_controller.h"
 #include "msgpack_rpc/transport/i_connection.h"
 
 namespace msgpack_rpc::servers {
@@ -48,25 +76,61 @@ namespace msgpack_rpc::servers {
 /*!
  * \brief Class to handle connections in servers.
  */
-class ServerConnection : public std::enable_shared_from_this<ServerConnection> {
+class ServerConnection final
+    : public methods::impl::IStreamChunkSender,
+      public methods::impl::IUploadChunkSource,
+      public std::enable_shared_from_this<ServerConnection> {
 public:
     /*!
      * \brief Constructor.
      *
+     * \param[in] id ID of this connection.
      * \param[in] connection Connection.
      * \param[in] executor Executor.
      * \param[in] processor Processor of methods.
+     * \param[in] config Configuration of the server.
+     * \param[in] admission_controller Controller of admission. This connection
+     * must have been added using
+     * msgpack_rpc::servers::AdmissionController::try_add_connection, and is
+     * removed in the destructor.
      * \param[in] logger Logger.
      */
-    ServerConnection(const std::shared_ptr<transport::IConnection>& connection,
+    ServerConnection(ConnectionID id,
+        const std::shared_ptr<transport::IConnection>& connection,
         std::weak_ptr<executors::IExecutor> executor,
         std::shared_ptr<methods::IMethodProcessor> processor,
+        const config::ServerConfig& config,
+        std::shared_ptr<AdmissionController> admission_controller,
         std::shared_ptr<logging::Logger> logger)
-        : connection_(connection),
+        : id_(id),
+          connection_(connection),
           executor_(std::move(executor)),
           processor_(std::move(processor)),
+          admission_controller_(std::move(admission_controller)),
           logger_(std::move(logger)),
-          formatted_remote_address_(connection->remote_address().to_string()) {}
+          formatted_remote_address_(connection->remote_address().to_string()),
+          flow_controller_(config.flow_control()),
+          max_queued_notifications_(
+              config.notification_queue().max_queued_notifications()),
+          disconnect_slow_consumers_(
+              config.notification_queue().disconnect_slow_consumers()),
+          upload_list_(
+              messages::UPLOAD_WINDOW_SIZE, config.upload_idle_timeout()),
+          call_list_(std::make_shared<clients::impl::CallList>(
+              config.call_timeout(), config.propagate_deadline(), executor_,
+              logger_)) {}
+
+    /*!
+     * \brief Destructor.
+     */
+    ~ServerConnection() override {
+        admission_controller_->remove_connection();
+    }
+
+    ServerConnection(const ServerConnection&) = delete;
+    ServerConnection(ServerConnection&&) = delete;
+    ServerConnection& operator=(const ServerConnection&) = delete;
+    ServerConnection& operator=(ServerConnection&&) = delete;
 
     /*!
      * \brief Start processing.
@@ -80,12 +144,126 @@ public:
                     self->on_received(std::move(message));
                 },
                 [self = this->shared_from_this()]() { self->on_sent(); },
-                [](const Status& /*status*/) {
-                    // No operation when this connection is closed.
+                [self = this->shared_from_this()](const Status& /*status*/) {
+                    self->on_closed();
                 });
         }
     }
 
+    /*!
+     * \brief Send a notification to the client.
+     *
+     * \param[in] notification Serialized notification.
+     *
+     * \note Notifications are sent in the same order as responses, and count
+     * toward flow control. When the client does not consume notifications fast
+     * enough, the oldest notification is dropped or this connection is
+     * closed according to config::NotificationQueueConfig.
+     */
+    void notify(messages::SerializedMessage notification) {
+        MSGPACK_RPC_TRACE(logger_, "{} push a notification (connection id: {})",
+            formatted_remote_address_, id_);
+        {
+            std::unique_lock<std::mutex> lock(message_queue_mutex_);
+            if (is_disconnecting_slow_consumer_) {
+                return;
+            }
+            if (max_queued_notifications_ > 0U &&
+                num_queued_notifications_ >= max_queued_notifications_) {
+                if (disconnect_slow_consumers_) {
+                    is_disconnecting_slow_consumer_ = true;
+                    lock.unlock();
+                    MSGPACK_RPC_WARN(logger_,
+                        "Too many notifications to {} are queued, so close "
+                        "the connection.",
+                        formatted_remote_address_);
+                    const auto connection = connection_.lock();
+                    if (connection) {
+                        connection->async_close();
+                    }
+                    return;
+                }
+                drop_oldest_notification();
+                MSGPACK_RPC_DEBUG(logger_,
+                    "Too many notifications to {} are queued, so drop the "
+                    "oldest one.",
+                    formatted_remote_address_);
+            }
+            push_to_queue(std::move(notification), true);
+        }
+
+        send_next_if_exists();
+    }
+
+    /*!
+     * \brief Asynchronously call a method in the client.
+     *
+     * \param[in] method_name Name of the method.
+     * \param[in] parameters Parameters.
+     * \return Future object to get the result.
+     */
+    [[nodiscard]] std::shared_ptr<clients::impl::ICallFutureImpl> async_call(
+        messages::MethodNameView method_name,
+        const clients::impl::IParametersSerializer& parameters) {
+        const auto [request_id, serialized_request, future] =
+            call_list_->create(method_name, parameters);
+        // Clients don't support cancellation of requests from servers, so
+        // cancelled RPCs are only removed from the list.
+        future->set_cancel_handler(
+            [weak_call_list =
+                    std::weak_ptr<clients::impl::CallList>(call_list_),
+                request_id = request_id] {
+                const auto call_list = weak_call_list.lock();
+                if (call_list) {
+                    (void)call_list->cancel(request_id);
+                }
+            });
+
+        MSGPACK_RPC_DEBUG(logger_, "{} call {} (id: {})",
+            formatted_remote_address_, method_name, request_id);
+
+        // The remaining budget is updated when the request is actually sent.
+        push_message(serialized_request,
+            call_list_->propagate_deadline() ? std::optional(future->deadline())
+                                             : std::nullopt);
+        return future;
+    }
+
+    //! \copydoc msgpack_rpc::methods::impl::IStreamChunkSender::send_stream_chunk
+    [[nodiscard]] bool send_stream_chunk(
+        messages::SerializedMessage chunk) override {
+        {
+            std::unique_lock<std::mutex> lock(message_queue_mutex_);
+            if (is_closed_) {
+                return false;
+            }
+        }
+        push_message(std::move(chunk));
+
+        // Wait until the messages are sent like reading of requests, so that
+        // streams don't queue chunks faster than the client receives them.
+        // Streaming methods call this function in threads dedicated to the
+        // streams, so threads for callbacks are not blocked here.
+        std::unique_lock<std::mutex> lock(message_queue_mutex_);
+        stream_cond_var_.wait(lock,
+            [this] { return is_closed_ || !flow_controller_.is_paused(); });
+        return !is_closed_;
+    }
+
+    //! \copydoc msgpack_rpc::methods::impl::IUploadChunkSource::next_upload_chunk
+    [[nodiscard]] std::optional<messages::ParsedParameters> next_upload_chunk(
+        messages::MessageID request_id) override {
+        auto chunk =
+            upload_list_.next(request_id, methods::current_request_deadline());
+        if (chunk) {
+            // Acknowledgements let the client send the next chunks.
+            push_message(messages::MessageSerializer::serialize_notification(
+                messages::MethodNameView(messages::UPLOAD_ACK_METHOD_NAME),
+                request_id));
+        }
+        return chunk;
+    }
+
 private:
     /*!
      * \brief Process a received message.
@@ -100,17 +278,44 @@ private:
             [this, executor](auto&& concrete_message) {
                 if constexpr (std::is_same_v<messages::ParsedRequest,
                                   std::decay_t<decltype(concrete_message)>>) {
+                    if (!admission_controller_->try_start_request(
+                            num_in_flight_requests_)) {
+                        this->on_rejected_request(concrete_message);
+                        return;
+                    }
+                    auto cancellation_token =
+                        this->register_request(concrete_message.id());
                     executors::async_invoke(executor,
                         executors::OperationType::CALLBACK,
                         [self = this->shared_from_this(),
                             // NOLINTNEXTLINE(bugprone-move-forwarding-reference): This actually always moves rvalue.
-                            request = std::move(concrete_message)] {
-                            self->on_request(request);
+                            request = std::move(concrete_message),
+                            cancellation_token =
+                                std::move(cancellation_token)] {
+                            self->on_request(request, cancellation_token);
                         });
                 } else if constexpr (std::is_same_v<
                                          messages::ParsedNotification,
                                          std::decay_t<
                                              decltype(concrete_message)>>) {
+                    if (concrete_message.method_name() ==
+                        messages::MethodNameView(
+                            messages::CANCEL_REQUEST_METHOD_NAME)) {
+                        this->on_cancel_request(concrete_message);
+                        return;
+                    }
+                    if (concrete_message.method_name() ==
+                        messages::MethodNameView(
+                            messages::UPLOAD_CHUNK_METHOD_NAME)) {
+                        this->on_upload_chunk(concrete_message);
+                        return;
+                    }
+                    if (concrete_message.method_name() ==
+                        messages::MethodNameView(
+                            messages::UPLOAD_END_METHOD_NAME)) {
+                        this->on_upload_end(concrete_message);
+                        return;
+                    }
                     executors::async_invoke(executor,
                         executors::OperationType::CALLBACK,
                         [self = this->shared_from_this(),
@@ -119,7 +324,7 @@ private:
                             self->on_notification(notification);
                         });
                 } else {
-                    this->on_invalid_message();
+                    this->on_response(concrete_message);
                 }
             },
             std::move(message));
@@ -129,24 +334,311 @@ private:
      * \brief Process a request.
      *
      * \param[in] request Request.
+     * \param[in] cancellation_token Token to notify cancellation of the
+     * request.
      */
-    void on_request(const messages::ParsedRequest& request) {
+    void on_request(const messages::ParsedRequest& request,
+        const std::shared_ptr<methods::CancellationToken>& cancellation_token) {
         MSGPACK_RPC_DEBUG(logger_, "{} request {} (id: {})",
             formatted_remote_address_, request.method_name(), request.id());
 
-        auto serialized_response = processor_->call(request);
+        const auto deadline = request.deadline();
+        if (deadline && *deadline <= std::chrono::steady_clock::now()) {
+            // The client no longer waits for the response.
+            unregister_request(request.id(), cancellation_token);
+            admission_controller_->finish_request(num_in_flight_requests_);
+            MSGPACK_RPC_DEBUG(logger_,
+                "{} request {} (id: {}) dropped due to the expired deadline",
+                formatted_remote_address_, request.method_name(),
+                request.id());
+            return;
+        }
+        if (cancellation_token->is_cancelled()) {
+            unregister_request(request.id(), cancellation_token);
+            admission_controller_->finish_request(num_in_flight_requests_);
+            MSGPACK_RPC_DEBUG(logger_,
+                "{} request {} (id: {}) dropped due to cancellation",
+                formatted_remote_address_, request.method_name(),
+                request.id());
+            return;
+        }
+
+        const impl::ConnectionIDScope connection_id_scope(id_);
+        const methods::impl::RequestDeadlineScope deadline_scope(deadline);
+        const methods::impl::CancellationTokenScope cancellation_scope(
+            cancellation_token);
+        const methods::impl::StreamChunkSenderScope stream_scope(this);
+        const methods::impl::UploadChunkSourceScope upload_scope(this);
+        processor_->async_call(request,
+            [self = this->shared_from_this(), request, cancellation_token](
+                messages::SerializedMessage serialized_response) {
+                self->respond(request, cancellation_token,
+                    std::move(serialized_response));
+            });
+    }
+
+    /*!
+     * \brief Send a response of a processed request.
+     *
+     * \param[in] request Request.
+     * \param[in] cancellation_token Token to notify cancellation of the
+     * request.
+     * \param[in] serialized_response Serialized response.
+     */
+    void respond(const messages::ParsedRequest& request,
+        const std::shared_ptr<methods::CancellationToken>& cancellation_token,
+        messages::SerializedMessage serialized_response) {
+        unregister_request(request.id(), cancellation_token);
+        admission_controller_->finish_request(num_in_flight_requests_);
 
         MSGPACK_RPC_DEBUG(logger_, "{} respond {} (id: {})",
             formatted_remote_address_, request.method_name(), request.id());
 
+        push_message(std::move(serialized_response));
+    }
+
+    /*!
+     * \brief Process a request rejected due to the limits of admission
+     * control.
+     *
+     * \param[in] request Request.
+     */
+    void on_rejected_request(const messages::ParsedRequest& request) {
+        MSGPACK_RPC_DEBUG(logger_,
+            "{} request {} (id: {}) rejected due to overload",
+            formatted_remote_address_, request.method_name(), request.id());
+
+        const auto error = std::map<std::string, std::string>{
+            {std::string(messages::ERROR_CODE_KEY),
+                std::string(format_status_code(StatusCode::OVERLOADED))},
+            {std::string(messages::ERROR_MESSAGE_KEY),
+                "Too many requests are in flight in the server."}};
+        push_message(messages::MessageSerializer::serialize_error_response(
+            request.id(), error));
+    }
+
+    /*!
+     * \brief Push a message to the queue and send it.
+     *
+     * \param[in] message Serialized message.
+     * \param[in] deadline Deadline of the request to propagate.
+     */
+    void push_message(messages::SerializedMessage message,
+        std::optional<std::chrono::steady_clock::time_point> deadline =
+            std::nullopt) {
         {
             std::unique_lock<std::mutex> lock(message_queue_mutex_);
-            message_queue_.push(std::move(serialized_response));
+            push_to_queue(std::move(message), false, deadline);
         }
 
         send_next_if_exists();
     }
 
+    /*!
+     * \brief Push a message to the queue.
+     *
+     * \param[in] message Serialized message.
+     * \param[in] is_notification Whether the message is a notification
+     * pushed by notify function.
+     * \param[in] deadline Deadline of the request to propagate.
+     *
+     * \note This function must be called with the lock of
+     * message_queue_mutex_.
+     */
+    void push_to_queue(messages::SerializedMessage message,
+        bool is_notification,
+        std::optional<std::chrono::steady_clock::time_point> deadline =
+            std::nullopt) {
+        const bool should_pause =
+            flow_controller_.on_pushed(message.total_size());
+        message_queue_.push_back(
+            QueuedMessage{std::move(message), is_notification, deadline});
+        if (is_notification) {
+            ++num_queued_notifications_;
+        }
+        if (should_pause) {
+            // Called in the lock so that the order of pausing and
+            // resuming is kept.
+            MSGPACK_RPC_DEBUG(logger_,
+                "Too many messages to {} are queued ({} bytes, {} "
+                "messages), so pause reading.",
+                formatted_remote_address_, flow_controller_.queued_bytes(),
+                flow_controller_.queued_messages());
+            const auto connection = connection_.lock();
+            if (connection) {
+                connection->pause_reading();
+            }
+        }
+    }
+
+    /*!
+     * \brief Remove the oldest notification in the queue.
+     *
+     * \note This function must be called with the lock of
+     * message_queue_mutex_.
+     */
+    void drop_oldest_notification() {
+        const auto iter = std::find_if(message_queue_.begin(),
+            message_queue_.end(),
+            [](const QueuedMessage& queued) { return queued.is_notification; });
+        if (iter == message_queue_.end()) {
+            return;
+        }
+        const std::size_t size = iter->message.total_size();
+        message_queue_.erase(iter);
+        --num_queued_notifications_;
+        on_removed_from_queue(size);
+    }
+
+    /*!
+     * \brief Handle a message removed from the queue.
+     *
+     * \param[in] size Size of the message.
+     *
+     * \note This function must be called with the lock of
+     * message_queue_mutex_.
+     */
+    void on_removed_from_queue(std::size_t size) {
+        if (!flow_controller_.on_popped(size)) {
+            return;
+        }
+        MSGPACK_RPC_DEBUG(logger_,
+            "Messages to {} have been drained, so resume reading.",
+            formatted_remote_address_);
+        const auto connection = connection_.lock();
+        if (connection) {
+            connection->resume_reading();
+        }
+        stream_cond_var_.notify_all();
+    }
+
+    /*!
+     * \brief Register a request which is queued or being processed.
+     *
+     * \param[in] id Message ID of the request.
+     * \return Token to notify cancellation of the request.
+     */
+    [[nodiscard]] std::shared_ptr<methods::CancellationToken>
+    register_request(messages::MessageID id) {
+        auto token = std::make_shared<methods::CancellationToken>();
+        std::unique_lock<std::mutex> lock(running_requests_mutex_);
+        running_requests_.insert_or_assign(id, token);
+        return token;
+    }
+
+    /*!
+     * \brief Unregister a request.
+     *
+     * \param[in] id Message ID of the request.
+     * \param[in] token Token of the request.
+     */
+    void unregister_request(messages::MessageID id,
+        const std::shared_ptr<methods::CancellationToken>& token) {
+        std::unique_lock<std::mutex> lock(running_requests_mutex_);
+        const auto iter = running_requests_.find(id);
+        // Another request with the same ID may have been registered.
+        if (iter != running_requests_.end() && iter->second == token) {
+            running_requests_.erase(iter);
+            upload_list_.remove(id);
+        }
+    }
+
+    /*!
+     * \brief Parse the message ID of the request in a notification of
+     * uploads.
+     *
+     * \param[in] notification Notification.
+     * \return Message ID, or std::nullopt if the ID is invalid or the request
+     * is not running.
+     */
+    [[nodiscard]] std::optional<messages::MessageID> parse_upload_request_id(
+        const messages::ParsedNotification& notification) {
+        messages::MessageID id{};
+        try {
+            const auto& object = notification.parameters().object();
+            if (object.via.array.size == 0U) {
+                throw MsgpackRPCException(StatusCode::INVALID_MESSAGE,
+                    "No message ID of the request.");
+            }
+            id = object.via.array.ptr[0].as<messages::MessageID>();
+        } catch (const std::exception& e) {
+            MSGPACK_RPC_DEBUG(logger_,
+                "{} sent an invalid notification of an upload: {}",
+                formatted_remote_address_, e.what());
+            return std::nullopt;
+        }
+
+        std::unique_lock<std::mutex> lock(running_requests_mutex_);
+        if (running_requests_.count(id) == 0U) {
+            MSGPACK_RPC_DEBUG(logger_,
+                "{} sent a notification of an upload of an unknown request "
+                "(id: {})",
+                formatted_remote_address_, id);
+            return std::nullopt;
+        }
+        return id;
+    }
+
+    /*!
+     * \brief Process a notification of a chunk of an upload.
+     *
+     * \param[in] notification Notification.
+     */
+    void on_upload_chunk(const messages::ParsedNotification& notification) {
+        const auto id = parse_upload_request_id(notification);
+        if (!id) {
+            return;
+        }
+        if (!upload_list_.push(*id, notification.parameters())) {
+            MSGPACK_RPC_WARN(logger_,
+                "{} sent too many chunks of an upload, so close the "
+                "connection.",
+                formatted_remote_address_);
+            const auto connection = connection_.lock();
+            if (connection) {
+                connection->async_close();
+            }
+        }
+    }
+
+    /*!
+     * \brief Process a notification of the end of an upload.
+     *
+     * \param[in] notification Notification.
+     */
+    void on_upload_end(const messages::ParsedNotification& notification) {
+        const auto id = parse_upload_request_id(notification);
+        if (id) {
+            upload_list_.end(*id);
+        }
+    }
+
+    /*!
+     * \brief Process a notification to cancel a request.
+     *
+     * \param[in] notification Notification.
+     */
+    void on_cancel_request(const messages::ParsedNotification& notification) {
+        messages::MessageID id{};
+        try {
+            id = std::get<0>(
+                notification.parameters().as<messages::MessageID>());
+        } catch (const std::exception& e) {
+            MSGPACK_RPC_DEBUG(logger_,
+                "{} sent an invalid notification to cancel a request: {}",
+                formatted_remote_address_, e.what());
+            return;
+        }
+
+        MSGPACK_RPC_DEBUG(logger_, "{} cancel request (id: {})",
+            formatted_remote_address_, id);
+        std::unique_lock<std::mutex> lock(running_requests_mutex_);
+        const auto iter = running_requests_.find(id);
+        if (iter != running_requests_.end()) {
+            iter->second->cancel();
+        }
+    }
+
     /*!
      * \brief Process a notification.
      *
@@ -156,21 +648,19 @@ private:
         MSGPACK_RPC_DEBUG(logger_, "{} notify {}", formatted_remote_address_,
             notification.method_name());
 
+        const impl::ConnectionIDScope connection_id_scope(id_);
         processor_->notify(notification);
     }
 
     /*!
-     * \brief Handle an invalid message.
+     * \brief Process a response of an RPC to the client.
+     *
+     * \param[in] response Response.
      */
-    void on_invalid_message() {
-        MSGPACK_RPC_DEBUG(logger_,
-            "Unexpectedly received a response from {}, so close the "
-            "connection.",
-            formatted_remote_address_);
-        const auto connection = connection_.lock();
-        if (connection) {
-            connection->async_close();
-        }
+    void on_response(const messages::ParsedResponse& response) {
+        MSGPACK_RPC_DEBUG(logger_, "{} responded (id: {})",
+            formatted_remote_address_, response.id());
+        call_list_->handle(response);
     }
 
     /*!
@@ -186,11 +676,20 @@ private:
             MSGPACK_RPC_TRACE(logger_, "No message to be sent for now.");
             return;
         }
-        const auto next_message = std::move(message_queue_.front());
-        message_queue_.pop();
+        auto next_message = std::move(message_queue_.front().message);
+        const auto deadline = message_queue_.front().deadline;
+        if (message_queue_.front().is_notification) {
+            --num_queued_notifications_;
+        }
+        message_queue_.pop_front();
+        sending_message_size_ = next_message.total_size();
         is_sending_.store(true, std::memory_order_relaxed);
         lock.unlock();
 
+        if (deadline) {
+            messages::MessageSerializer::update_request_budget(
+                next_message, *deadline - std::chrono::steady_clock::now());
+        }
         const auto connection = connection_.lock();
         if (connection) {
             MSGPACK_RPC_TRACE(logger_, "Sending next message.");
@@ -203,10 +702,29 @@ private:
      */
     void on_sent() {
         MSGPACK_RPC_TRACE(logger_, "A message has been sent.");
+        {
+            std::unique_lock<std::mutex> lock(message_queue_mutex_);
+            on_removed_from_queue(sending_message_size_);
+        }
         is_sending_.store(false, std::memory_order_release);
         send_next_if_exists();
     }
 
+    /*!
+     * \brief Handle the condition that this connection is closed.
+     */
+    void on_closed() {
+        {
+            std::unique_lock<std::mutex> lock(message_queue_mutex_);
+            is_closed_ = true;
+        }
+        stream_cond_var_.notify_all();
+        upload_list_.close();
+    }
+
+    //! ID of this connection.
+    ConnectionID id_;
+
     //! Connection.
     std::weak_ptr<transport::IConnection> connection_;
 
@@ -216,18 +734,79 @@ private:
     //! Processor of methods.
     std::shared_ptr<methods::IMethodProcessor> processor_;
 
+    //! Controller of admission.
+    std::shared_ptr<AdmissionController> admission_controller_;
+
+    //! Number of requests being processed in this connection.
+    std::atomic<std::size_t> num_in_flight_requests_{0};
+
+    //! Tokens of cancellation of requests queued or being processed.
+    std::unordered_map<messages::MessageID,
+        std::shared_ptr<methods::CancellationToken>>
+        running_requests_{};
+
+    //! Mutex of running_requests_.
+    std::mutex running_requests_mutex_{};
+
     //! Logger.
     std::shared_ptr<logging::Logger> logger_;
 
     //! Formatted remote address for logging.
     std::string formatted_remote_address_;
 
-    //! Messages to be sent.
-    std::queue<messages::SerializedMessage> message_queue_{};
+    /*!
+     * \brief Struct of messages in the queue.
+     */
+    struct QueuedMessage {
+        //! Message.
+        messages::SerializedMessage message;
+
+        //! Whether the message is a notification pushed by notify function.
+        bool is_notification;
+
+        //! Deadline of the request to propagate.
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+    };
+
+    //! Messages to be sent. (Responses, requests and notifications are sent
+    //! in the order of pushing.)
+    std::deque<QueuedMessage> message_queue_{};
 
     //! Mutex of message_queue_.
     std::mutex message_queue_mutex_{};
 
+    //! Flow controller of message_queue_ (protected by message_queue_mutex_).
+    transport::FlowController flow_controller_;
+
+    //! Size of the message being sent (protected by message_queue_mutex_).
+    std::size_t sending_message_size_{0};
+
+    //! Number of notifications in message_queue_ (protected by
+    //! message_queue_mutex_).
+    std::size_t num_queued_notifications_{0};
+
+    //! Maximum number of notifications in message_queue_.
+    std::size_t max_queued_notifications_;
+
+    //! Whether to close this connection when too many notifications are
+    //! queued.
+    bool disconnect_slow_consumers_;
+
+    //! Whether this connection is being closed as a slow consumer.
+    bool is_disconnecting_slow_consumer_{false};
+
+    //! Whether this connection is closed (protected by message_queue_mutex_).
+    bool is_closed_{false};
+
+    //! Condition variable to wait for sending of messages in streams.
+    std::condition_variable stream_cond_var_{};
+
+    //! Chunks of uploads.
+    UploadList upload_list_;
+
+    //! List of RPCs to the client.
+    std::shared_ptr<clients::impl::CallList> call_list_;
+
     //! Whether this connection is sending a message.
     std::atomic<bool> is_sending_{false};
 };
@@ -0,0 +1,297 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of ServerConnectionList class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/servers/connection_id.h"
+#include "msgpack_rpc/servers/server_connection.h"
+
+namespace msgpack_rpc::servers {
+
+/*!
+ * \brief Class of lists of connections in servers.
+ *
+ * Connections are held by weak pointers, and closed connections are removed
+ * lazily together with their subscriptions of topics.
+ */
+class ServerConnectionList {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    ServerConnectionList() = default;
+
+    /*!
+     * \brief Create an ID of a new connection.
+     *
+     * \return ID.
+     */
+    [[nodiscard]] ConnectionID create_id() noexcept {
+        return next_id_.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Add a connection.
+     *
+     * \param[in] id ID of the connection.
+     * \param[in] connection Connection.
+     */
+    void add(
+        ConnectionID id, const std::shared_ptr<ServerConnection>& connection) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (connections_.size() >= purge_threshold_) {
+            remove_closed_connections();
+            purge_threshold_ =
+                std::max(MIN_PURGE_THRESHOLD, connections_.size() * 2U);
+        }
+        connections_.insert_or_assign(id, connection);
+    }
+
+    /*!
+     * \brief Send a notification to a connection.
+     *
+     * \param[in] id ID of the connection.
+     * \param[in] notification Serialized notification.
+     * \retval true The notification is queued to be sent.
+     * \retval false The connection was not found.
+     */
+    bool notify(
+        ConnectionID id, const messages::SerializedMessage& notification) {
+        std::shared_ptr<ServerConnection> connection;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            const auto iter = connections_.find(id);
+            if (iter == connections_.end()) {
+                return false;
+            }
+            connection = iter->second.lock();
+            if (!connection) {
+                connections_.erase(iter);
+                return false;
+            }
+        }
+        connection->notify(notification);
+        return true;
+    }
+
+    /*!
+     * \brief Asynchronously call a method in the client of a connection.
+     *
+     * \param[in] id ID of the connection.
+     * \param[in] method_name Name of the method.
+     * \param[in] parameters Parameters.
+     * \return Future object to get the result.
+     */
+    [[nodiscard]] std::shared_ptr<clients::impl::ICallFutureImpl> async_call(
+        ConnectionID id, messages::MethodNameView method_name,
+        const clients::impl::IParametersSerializer& parameters) {
+        std::shared_ptr<ServerConnection> connection;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            connection = find_connection(id);
+        }
+        if (!connection) {
+            throw MsgpackRPCException(StatusCode::PRECONDITION_NOT_MET,
+                "The connection was not found.");
+        }
+        return connection->async_call(method_name, parameters);
+    }
+
+    /*!
+     * \brief Send a notification to all connections.
+     *
+     * \param[in] notification Serialized notification. This object is shared
+     * by all connections without copying the data.
+     * \return Number of connections to which the notification is queued.
+     */
+    std::size_t notify_all(const messages::SerializedMessage& notification) {
+        std::vector<std::shared_ptr<ServerConnection>> connections;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            connections.reserve(connections_.size());
+            for (auto iter = connections_.begin();
+                 iter != connections_.end();) {
+                auto connection = iter->second.lock();
+                if (connection) {
+                    connections.push_back(std::move(connection));
+                    ++iter;
+                } else {
+                    iter = connections_.erase(iter);
+                }
+            }
+        }
+        for (const auto& connection : connections) {
+            connection->notify(notification);
+        }
+        return connections.size();
+    }
+
+    /*!
+     * \brief Subscribe a connection to a topic.
+     *
+     * \param[in] topic Topic.
+     * \param[in] id ID of the connection.
+     */
+    void subscribe(const std::string& topic, ConnectionID id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        topics_[topic].insert(id);
+    }
+
+    /*!
+     * \brief Unsubscribe a connection from a topic.
+     *
+     * \param[in] topic Topic.
+     * \param[in] id ID of the connection.
+     */
+    void unsubscribe(const std::string& topic, ConnectionID id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = topics_.find(topic);
+        if (iter == topics_.end()) {
+            return;
+        }
+        iter->second.erase(id);
+        if (iter->second.empty()) {
+            topics_.erase(iter);
+        }
+    }
+
+    /*!
+     * \brief Send a notification to connections subscribing a topic.
+     *
+     * \param[in] topic Topic.
+     * \param[in] notification Serialized notification. This object is shared
+     * by all connections without copying the data.
+     * \return Number of connections to which the notification is queued.
+     */
+    std::size_t publish(const std::string& topic,
+        const messages::SerializedMessage& notification) {
+        std::vector<std::shared_ptr<ServerConnection>> connections;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            const auto topic_iter = topics_.find(topic);
+            if (topic_iter == topics_.end()) {
+                return 0U;
+            }
+            auto& subscribers = topic_iter->second;
+            connections.reserve(subscribers.size());
+            for (auto iter = subscribers.begin(); iter != subscribers.end();) {
+                auto connection = find_connection(*iter);
+                if (connection) {
+                    connections.push_back(std::move(connection));
+                    ++iter;
+                } else {
+                    iter = subscribers.erase(iter);
+                }
+            }
+            if (subscribers.empty()) {
+                topics_.erase(topic_iter);
+            }
+        }
+        for (const auto& connection : connections) {
+            connection->notify(notification);
+        }
+        return connections.size();
+    }
+
+private:
+    /*!
+     * \brief Find a connection which has not been closed.
+     *
+     * \param[in] id ID of the connection.
+     * \return Connection. (Null if not found.)
+     *
+     * \note This function must be called with the lock of mutex_.
+     */
+    [[nodiscard]] std::shared_ptr<ServerConnection> find_connection(
+        ConnectionID id) const {
+        const auto iter = connections_.find(id);
+        if (iter == connections_.end()) {
+            return nullptr;
+        }
+        return iter->second.lock();
+    }
+
+    /*!
+     * \brief Remove closed connections.
+     *
+     * \note This function must be called with the lock of mutex_.
+     */
+    void remove_closed_connections() {
+        for (auto iter = connections_.begin(); iter != connections_.end();) {
+            if (iter->second.expired()) {
+                iter = connections_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+        for (auto topic_iter = topics_.begin(); topic_iter != topics_.end();) {
+            auto& subscribers = topic_iter->second;
+            for (auto iter = subscribers.begin(); iter != subscribers.end();) {
+                if (connections_.count(*iter) == 0U) {
+                    iter = subscribers.erase(iter);
+                } else {
+                    ++iter;
+                }
+            }
+            if (subscribers.empty()) {
+                topic_iter = topics_.erase(topic_iter);
+            } else {
+                ++topic_iter;
+            }
+        }
+    }
+
+    //! Minimum number of connections to remove closed connections.
+    static constexpr std::size_t MIN_PURGE_THRESHOLD = 16;
+
+    //! Connections.
+    std::unordered_map<ConnectionID, std::weak_ptr<ServerConnection>>
+        connections_{};
+
+    //! IDs of connections subscribing each topic.
+    std::unordered_map<std::string, std::unordered_set<ConnectionID>>
+        topics_{};
+
+    //! Number of connections to remove closed connections when exceeded.
+    std::size_t purge_threshold_{MIN_PURGE_THRESHOLD};
+
+    //! Mutex of connections_, topics_, and purge_threshold_.
+    std::mutex mutex_{};
+
+    //! ID of the next connection.
+    std::atomic<ConnectionID> next_id_{0};
+};
+
+}  // namespace msgpack_rpc::servers
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of UploadList class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/parsed_parameters.h"
+
+namespace msgpack_rpc::servers {
+
+/*!
+ * \brief Class of lists of chunks of uploads received in a connection.
+ *
+ * \note The number of queued chunks is limited, but their sizes are not.
+ * Memory of an upload is bounded by the number of chunks times the maximum
+ * size of messages in the parser.
+ */
+class UploadList {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] max_queued_chunks Maximum number of chunks queued for an
+     * upload.
+     * \param[in] idle_timeout Timeout of waiting for each chunk.
+     */
+    UploadList(
+        std::size_t max_queued_chunks, std::chrono::nanoseconds idle_timeout)
+        : max_queued_chunks_(max_queued_chunks), idle_timeout_(idle_timeout) {}
+
+    /*!
+     * \brief Push a received chunk.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] chunk Parameters of the notification of the chunk.
+     * \retval true The chunk has been queued.
+     * \retval false Too many chunks have been queued.
+     */
+    [[nodiscard]] bool push(
+        messages::MessageID request_id, messages::ParsedParameters chunk) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            auto& upload = uploads_[request_id];
+            if (upload.chunks.size() >= max_queued_chunks_) {
+                return false;
+            }
+            upload.chunks.push_back(std::move(chunk));
+        }
+        cond_var_.notify_all();
+        return true;
+    }
+
+    /*!
+     * \brief Handle the end of an upload.
+     *
+     * \param[in] request_id Message ID of the request.
+     */
+    void end(messages::MessageID request_id) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            uploads_[request_id].is_ended = true;
+        }
+        cond_var_.notify_all();
+    }
+
+    /*!
+     * \brief Get the next chunk of an upload.
+     *
+     * \param[in] request_id Message ID of the request.
+     * \param[in] deadline Deadline of the request, if any.
+     * \return Parameters of the notification of the chunk, or std::nullopt if
+     * the upload has ended.
+     *
+     * \throw MsgpackRPCException No chunk was received until the deadline or
+     * within the idle timeout (StatusCode::TIMEOUT), or the connection has
+     * been closed.
+     *
+     * \note This function waits until the next chunk is received.
+     */
+    [[nodiscard]] std::optional<messages::ParsedParameters> next(
+        messages::MessageID request_id,
+        std::optional<std::chrono::steady_clock::time_point> deadline =
+            std::nullopt) {
+        auto wait_deadline = std::chrono::steady_clock::now() + idle_timeout_;
+        if (deadline) {
+            wait_deadline = std::min(wait_deadline, *deadline);
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        // References to values in std::unordered_map are not invalidated
+        // until the values are erased.
+        auto& upload = uploads_[request_id];
+        if (!cond_var_.wait_until(lock, wait_deadline, [this, &upload] {
+                return is_closed_ || !upload.chunks.empty() || upload.is_ended;
+            })) {
+            throw MsgpackRPCException(StatusCode::TIMEOUT,
+                "Chunks of an upload couldn't be received within a timeout.");
+        }
+        if (!upload.chunks.empty()) {
+            auto chunk = std::move(upload.chunks.front());
+            upload.chunks.pop_front();
+            return chunk;
+        }
+        if (upload.is_ended) {
+            return std::nullopt;
+        }
+        throw MsgpackRPCException(StatusCode::CONNECTION_FAILURE,
+            "Connection of the upload has been closed.");
+    }
+
+    /*!
+     * \brief Remove an upload.
+     *
+     * \param[in] request_id Message ID of the request.
+     *
+     * \note This function must not be called while next function is called
+     * for the same upload.
+     */
+    void remove(messages::MessageID request_id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        uploads_.erase(request_id);
+    }
+
+    /*!
+     * \brief Handle the condition that the connection is closed.
+     */
+    void close() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            is_closed_ = true;
+        }
+        cond_var_.notify_all();
+    }
+
+private:
+    //! Struct of uploads.
+    struct Upload {
+        //! Received chunks not read yet.
+        std::deque<messages::ParsedParameters> chunks{};
+
+        //! Whether the upload has ended.
+        bool is_ended{false};
+    };
+
+    //! Maximum number of chunks queued for an upload.
+    std::size_t max_queued_chunks_;
+
+    //! Timeout of waiting for each chunk.
+    std::chrono::nanoseconds idle_timeout_;
+
+    //! Uploads.
+    std::unordered_map<messages::MessageID, Upload> uploads_{};
+
+    //! Whether the connection is closed.
+    bool is_closed_{false};
+
+    //! Mutex of uploads_ and is_closed_.
+    std::mutex mutex_{};
+
+    //! Condition variable to wait for chunks.
+    std::condition_variable cond_var_{};
+};
+
+}  // namespace msgpack_rpc::servers
@@ -37,14 +37,19 @@
 #include "msgpack_rpc/addresses/unix_socket_address.h"
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/socket_config.h"
+#include "msgpack_rpc/executors/asio_context_type.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/executors/operation_type.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/transport/apply_socket_config.h"
 #include "msgpack_rpc/transport/background_task_state_machine.h"
 #include "msgpack_rpc/transport/connection.h"
 #include "msgpack_rpc/transport/connection_list.h"
 #include "msgpack_rpc/transport/i_acceptor.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport {
 
@@ -77,17 +82,28 @@ public:
      * \param[in] local_address Local address.
      * \param[in] executor Executor.
      * \param[in] message_parser_config Configuration of the parser of messages.
+     * \param[in] socket_config Configuration of socket options.
+     * \param[in] compression_config Configuration of compression of messages.
+     * \param[in] traffic_capture Object to capture traffic. (Null to disable
+     * capture.)
      * \param[in] logger Logger.
      */
     Acceptor(const ConcreteAddress& local_address,
         const std::shared_ptr<executors::IExecutor>& executor,
         const config::MessageParserConfig& message_parser_config,
+        const config::SocketConfig& socket_config,
+        const config::CompressionConfig& compression_config,
+        std::shared_ptr<TrafficCapture> traffic_capture,
         std::shared_ptr<logging::Logger> logger)
-        : acceptor_(executor->context(executors::OperationType::TRANSPORT),
-              local_address.asio_address()),
+        : acceptor_(create_asio_acceptor(
+              executor->context(executors::OperationType::TRANSPORT),
+              local_address, socket_config)),
           executor_(executor),
           local_address_(acceptor_.local_endpoint()),
           message_parser_config_(message_parser_config),
+          socket_config_(socket_config),
+          compression_config_(compression_config),
+          traffic_capture_(std::move(traffic_capture)),
           log_name_(fmt::format("Acceptor(local={})", local_address_)),
           logger_(std::move(logger)),
           connection_list_(std::make_shared<ConnectionList<ConnectionType>>()) {
@@ -120,6 +136,29 @@ public:
     }
 
 private:
+    /*!
+     * \brief Create an acceptor in asio library.
+     *
+     * \param[in] context Context in asio library.
+     * \param[in] local_address Local address.
+     * \param[in] socket_config Configuration of socket options.
+     * \return Acceptor listening to the address.
+     */
+    [[nodiscard]] static AsioAcceptor create_asio_acceptor(
+        executors::AsioContextType& context,
+        const ConcreteAddress& local_address,
+        const config::SocketConfig& socket_config) {
+        // Same procedure as the constructor of acceptors in asio library
+        // except for the backlog.
+        AsioAcceptor acceptor(context);
+        const auto& endpoint = local_address.asio_address();
+        acceptor.open(endpoint.protocol());
+        acceptor.set_option(typename AsioAcceptor::reuse_address(true));
+        acceptor.bind(endpoint);
+        acceptor.listen(listen_backlog_of(socket_config));
+        return acceptor;
+    }
+
     /*!
      * \brief Asynchronously accept a connection.
      */
@@ -151,8 +190,13 @@ private:
 
         MSGPACK_RPC_TRACE(logger_, "({}) Accepted a connection from {}.",
             log_name_, fmt::streamed(socket_->remote_endpoint()));
+        apply_socket_config(*socket_, socket_config_, logger_, log_name_);
         auto connection = std::make_shared<ConnectionType>(std::move(*socket_),
-            message_parser_config_, logger_, connection_list_);
+            message_parser_config_, compression_config_, traffic_capture_,
+            logger_, connection_list_);
+        if (socket_config_.tcp_quick_ack()) {
+            connection->enable_tcp_quick_ack();
+        }
         connection_list_->append(connection);
         on_connection_(std::move(connection));
 
@@ -215,6 +259,15 @@ private:
     //! Configuration of parsers of messages.
     config::MessageParserConfig message_parser_config_;
 
+    //! Configuration of socket options.
+    config::SocketConfig socket_config_;
+
+    //! Configuration of compression of messages.
+    config::CompressionConfig compression_config_;
+
+    //! Object to capture traffic. (Null if capture is disabled.)
+    std::shared_ptr<TrafficCapture> traffic_capture_;
+
     //! Name of the connection for logs.
     std::string log_name_;
 
@@ -0,0 +1,312 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of apply_socket_config function.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include <asio/error_code.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/socket_base.hpp>
+
+#include "msgpack_rpc/config/socket_config.h"
+#include "msgpack_rpc/logging/logger.h"
+
+namespace msgpack_rpc::transport {
+
+namespace impl {
+
+/*!
+ * \brief Class of socket options with integer values not provided in asio
+ * library.
+ *
+ * This class can be used both to set and to get options.
+ *
+ * \tparam Level Level of the option.
+ * \tparam Name Name of the option.
+ */
+template <int Level, int Name>
+class IntegerSocketOption {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] value Value.
+     */
+    explicit IntegerSocketOption(int value = 0) noexcept : value_(value) {}
+
+    /*!
+     * \brief Get the value.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] int value() const noexcept { return value_; }
+
+    /*!
+     * \brief Get the level of the option.
+     *
+     * \tparam Protocol Type of the protocol.
+     * \return Level.
+     */
+    template <typename Protocol>
+    [[nodiscard]] int level(const Protocol& /*protocol*/) const noexcept {
+        return Level;
+    }
+
+    /*!
+     * \brief Get the name of the option.
+     *
+     * \tparam Protocol Type of the protocol.
+     * \return Name.
+     */
+    template <typename Protocol>
+    [[nodiscard]] int name(const Protocol& /*protocol*/) const noexcept {
+        return Name;
+    }
+
+    /*!
+     * \brief Get the pointer to the value.
+     *
+     * \tparam Protocol Type of the protocol.
+     * \return Pointer.
+     */
+    template <typename Protocol>
+    [[nodiscard]] const void* data(
+        const Protocol& /*protocol*/) const noexcept {
+        return &value_;
+    }
+
+    /*!
+     * \brief Get the pointer to the value to write.
+     *
+     * \tparam Protocol Type of the protocol.
+     * \return Pointer.
+     */
+    template <typename Protocol>
+    [[nodiscard]] void* data(const Protocol& /*protocol*/) noexcept {
+        return &value_;
+    }
+
+    /*!
+     * \brief Get the size of the value.
+     *
+     * \tparam Protocol Type of the protocol.
+     * \return Size.
+     */
+    template <typename Protocol>
+    [[nodiscard]] std::size_t size(
+        const Protocol& /*protocol*/) const noexcept {
+        return sizeof(value_);
+    }
+
+    /*!
+     * \brief Check the size of the value written by the OS.
+     *
+     * \tparam Protocol Type of the protocol.
+     * \param[in] size Size.
+     */
+    template <typename Protocol>
+    void resize(const Protocol& /*protocol*/, std::size_t size) const {
+        if (size != sizeof(value_)) {
+            throw std::length_error("Invalid size of a socket option.");
+        }
+    }
+
+private:
+    //! Value.
+    int value_;
+};
+
+/*!
+ * \brief Convert a duration to an integer value of socket options.
+ *
+ * \tparam Unit Type of the unit of the option.
+ * \param[in] value Duration.
+ * \return Integer value rounded up.
+ */
+template <typename Unit>
+[[nodiscard]] int to_socket_option_value(std::chrono::nanoseconds value) {
+    return static_cast<int>(std::chrono::ceil<Unit>(value).count());
+}
+
+/*!
+ * \brief Set an option to a socket, and write a log on failure.
+ *
+ * Failures are not fatal because some options are not supported in some
+ * platforms.
+ *
+ * \tparam AsioSocket Type of the socket in asio library.
+ * \tparam Option Type of the option.
+ * \param[in] socket Socket.
+ * \param[in] option Option.
+ * \param[in] option_name Name of the option for logs.
+ * \param[in] logger Logger.
+ * \param[in] log_name Name of the caller for logs.
+ */
+template <typename AsioSocket, typename Option>
+void set_socket_option(AsioSocket& socket, const Option& option,
+    std::string_view option_name,
+    const std::shared_ptr<logging::Logger>& logger,
+    std::string_view log_name) {
+    asio::error_code error;
+    socket.set_option(option, error);
+    if (error) {
+        MSGPACK_RPC_WARN(logger, "({}) Failed to set {}: {}", log_name,
+            option_name, error.message());
+    }
+}
+
+}  // namespace impl
+
+/*!
+ * \brief Apply a configuration of socket options to a socket.
+ *
+ * Options specific to TCP are applied only to TCP sockets. Other sockets are
+ * left unchanged.
+ *
+ * \tparam AsioSocket Type of the socket in asio library.
+ * \param[in] socket Socket.
+ * \param[in] config Configuration of socket options.
+ * \param[in] logger Logger.
+ * \param[in] log_name Name of the caller for logs.
+ */
+template <typename AsioSocket>
+void apply_socket_config(AsioSocket& socket, const config::SocketConfig& config,
+    const std::shared_ptr<logging::Logger>& logger,
+    std::string_view log_name) {
+    if constexpr (std::is_same_v<AsioSocket, asio::ip::tcp::socket>) {
+        using impl::set_socket_option;
+
+        set_socket_option(socket,
+            asio::ip::tcp::no_delay(config.tcp_no_delay()), "TCP_NODELAY",
+            logger, log_name);
+        if (config.send_buffer_size() > 0U) {
+            set_socket_option(socket,
+                asio::socket_base::send_buffer_size(
+                    static_cast<int>(config.send_buffer_size())),
+                "SO_SNDBUF", logger, log_name);
+        }
+        if (config.receive_buffer_size() > 0U) {
+            set_socket_option(socket,
+                asio::socket_base::receive_buffer_size(
+                    static_cast<int>(config.receive_buffer_size())),
+                "SO_RCVBUF", logger, log_name);
+        }
+        if (config.keep_alive()) {
+            set_socket_option(socket, asio::socket_base::keep_alive(true),
+                "SO_KEEPALIVE", logger, log_name);
+#ifdef TCP_KEEPIDLE
+            if (config.keep_alive_idle_time() > std::chrono::nanoseconds(0)) {
+                set_socket_option(socket,
+                    impl::IntegerSocketOption<IPPROTO_TCP, TCP_KEEPIDLE>(
+                        impl::to_socket_option_value<std::chrono::seconds>(
+                            config.keep_alive_idle_time())),
+                    "TCP_KEEPIDLE", logger, log_name);
+            }
+#endif
+#ifdef TCP_KEEPINTVL
+            if (config.keep_alive_interval() > std::chrono::nanoseconds(0)) {
+                set_socket_option(socket,
+                    impl::IntegerSocketOption<IPPROTO_TCP, TCP_KEEPINTVL>(
+                        impl::to_socket_option_value<std::chrono::seconds>(
+                            config.keep_alive_interval())),
+                    "TCP_KEEPINTVL", logger, log_name);
+            }
+#endif
+#ifdef TCP_KEEPCNT
+            if (config.keep_alive_count() > 0U) {
+                set_socket_option(socket,
+                    impl::IntegerSocketOption<IPPROTO_TCP, TCP_KEEPCNT>(
+                        static_cast<int>(config.keep_alive_count())),
+                    "TCP_KEEPCNT", logger, log_name);
+            }
+#endif
+        }
+#ifdef TCP_QUICKACK
+        if (config.tcp_quick_ack()) {
+            set_socket_option(socket,
+                impl::IntegerSocketOption<IPPROTO_TCP, TCP_QUICKACK>(1),
+                "TCP_QUICKACK", logger, log_name);
+        }
+#endif
+#ifdef SO_BUSY_POLL
+        if (config.busy_poll_time() > std::chrono::nanoseconds(0)) {
+            set_socket_option(socket,
+                impl::IntegerSocketOption<SOL_SOCKET, SO_BUSY_POLL>(
+                    impl::to_socket_option_value<std::chrono::microseconds>(
+                        config.busy_poll_time())),
+                "SO_BUSY_POLL", logger, log_name);
+        }
+#endif
+    } else {
+        (void)socket;
+        (void)config;
+        (void)logger;
+        (void)log_name;
+    }
+}
+
+/*!
+ * \brief Enable TCP_QUICKACK of a socket again.
+ *
+ * Linux clears TCP_QUICKACK automatically after some exchanges, so this
+ * function must be called after each read to keep sending ACKs immediately.
+ * Sockets other than TCP sockets are left unchanged.
+ *
+ * \tparam AsioSocket Type of the socket in asio library.
+ * \param[in] socket Socket.
+ * \param[in] logger Logger.
+ * \param[in] log_name Name of the caller for logs.
+ */
+template <typename AsioSocket>
+void reapply_tcp_quick_ack(AsioSocket& socket,
+    const std::shared_ptr<logging::Logger>& logger,
+    std::string_view log_name) {
+#ifdef TCP_QUICKACK
+    if constexpr (std::is_same_v<AsioSocket, asio::ip::tcp::socket>) {
+        impl::set_socket_option(socket,
+            impl::IntegerSocketOption<IPPROTO_TCP, TCP_QUICKACK>(1),
+            "TCP_QUICKACK", logger, log_name);
+        return;
+    }
+#endif
+    (void)socket;
+    (void)logger;
+    (void)log_name;
+}
+
+/*!
+ * \brief Get the backlog of acceptors from a configuration of socket options.
+ *
+ * \param[in] config Configuration of socket options.
+ * \return Backlog.
+ */
+[[nodiscard]] inline int listen_backlog_of(const config::SocketConfig& config) {
+    if (config.listen_backlog() == 0U) {
+        return asio::socket_base::max_listen_connections;
+    }
+    return static_cast<int>(config.listen_backlog());
+}
+
+}  // namespace msgpack_rpc::transport
@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -27,6 +28,8 @@
 #include <string_view>
 #include <system_error>
 #include <utility>
+#include <variant>
+#include <vector>
 
 #include <asio/buffer.hpp>
 #include <asio/error.hpp>
@@ -39,15 +42,27 @@
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/messages/buffer_view.h"
+#include "msgpack_rpc/messages/impl/message_compression.h"
 #include "msgpack_rpc/messages/message_parser.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/message_type.h"
+#include "msgpack_rpc/messages/method_name_view.h"
 #include "msgpack_rpc/messages/parsed_message.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+#include "msgpack_rpc/messages/raw_message.h"
+#include "msgpack_rpc/messages/raw_message_parser.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
 #include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/transport/apply_socket_config.h"
 #include "msgpack_rpc/transport/background_task_state_machine.h"
 #include "msgpack_rpc/transport/connection_list.h"
 #include "msgpack_rpc/transport/i_connection.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
+#include "msgpack_rpc/transport/traffic_recorder.h"
 
 namespace msgpack_rpc::transport {
 
@@ -73,22 +88,43 @@ public:
      *
      * \param[in] socket Socket.
      * \param[in] message_parser_config Configuration of the parser of messages.
+     * \param[in] compression_config Configuration of compression of messages.
+     * \param[in] traffic_capture Object to capture traffic. (Null to disable
+     * capture.)
      * \param[in] logger Logger.
      * \param[in] connection_list List of connections.
      */
     Connection(AsioSocket&& socket,
         const config::MessageParserConfig& message_parser_config,
+        const config::CompressionConfig& compression_config,
+        std::shared_ptr<TrafficCapture> traffic_capture,
         std::shared_ptr<logging::Logger> logger,
         const std::shared_ptr<ConnectionList<Connection>>& connection_list =
             nullptr)
         : socket_(std::move(socket)),
           message_parser_(message_parser_config),
+          raw_message_parser_(message_parser_config),
+          compression_config_(compression_config),
+          traffic_recorder_(traffic_capture
+                  ? std::make_unique<TrafficRecorder>(
+                        std::move(traffic_capture))
+                  : nullptr),
           local_address_(socket_.local_endpoint()),
           remote_address_(socket_.remote_endpoint()),
           log_name_(fmt::format("Connection(local={}, remote={})",
               local_address_, remote_address_)),
           logger_(std::move(logger)),
-          connection_list_(connection_list) {}
+          connection_list_(connection_list) {
+        if (traffic_recorder_) {
+            // Parsers are used only while this object is alive.
+            const auto record = [recorder = traffic_recorder_.get()](
+                                    const char* data, std::size_t size) {
+                recorder->record_received(data, size);
+            };
+            message_parser_.set_framed_message_handler(record);
+            raw_message_parser_.set_framed_message_handler(record);
+        }
+    }
 
     Connection(const Connection&) = delete;
     Connection(Connection&&) = delete;
@@ -105,6 +141,13 @@ public:
         }
     }
 
+    /*!
+     * \brief Enable TCP_QUICKACK again after each read.
+     *
+     * \note This function must be called before start or start_raw function.
+     */
+    void enable_tcp_quick_ack() noexcept { tcp_quick_ack_ = true; }
+
     //! \copydoc msgpack_rpc::transport::IConnection::start
     void start(MessageReceivedCallback on_received, MessageSentCallback on_sent,
         ConnectionClosedCallback on_closed) override {
@@ -121,6 +164,24 @@ public:
             [self = this->shared_from_this()] { self->async_read_next(); });
     }
 
+    //! \copydoc msgpack_rpc::transport::IConnection::start_raw
+    void start_raw(RawMessageReceivedCallback on_received,
+        MessageSentCallback on_sent,
+        ConnectionClosedCallback on_closed) override {
+        state_machine_.handle_start_request();
+        // Only one thread can enter here.
+
+        on_raw_received_ = std::move(on_received);
+        on_sent_ = std::move(on_sent);
+        on_closed_ = std::move(on_closed);
+        is_raw_ = true;
+
+        state_machine_.handle_processing_started();
+
+        asio::post(socket_.get_executor(),
+            [self = this->shared_from_this()] { self->async_read_next(); });
+    }
+
     //! \copydoc msgpack_rpc::transport::IConnection::async_send
     void async_send(const messages::SerializedMessage& message) override {
         if (!state_machine_.is_processing()) {
@@ -140,6 +201,24 @@ public:
         });
     }
 
+    //! \copydoc msgpack_rpc::transport::IConnection::pause_reading
+    void pause_reading() override {
+        is_reading_paused_.store(true, std::memory_order_release);
+        MSGPACK_RPC_TRACE(logger_, "({}) Pause reading.", log_name_);
+    }
+
+    //! \copydoc msgpack_rpc::transport::IConnection::resume_reading
+    void resume_reading() override {
+        is_reading_paused_.store(false, std::memory_order_release);
+        if (!is_reading_stopped_.exchange(false, std::memory_order_acq_rel)) {
+            // Reading hasn't been stopped yet.
+            return;
+        }
+        MSGPACK_RPC_TRACE(logger_, "({}) Resume reading.", log_name_);
+        asio::post(socket_.get_executor(),
+            [self = this->shared_from_this()] { self->async_read_next(); });
+    }
+
     //! \copydoc msgpack_rpc::transport::IConnection::local_address
     [[nodiscard]] const addresses::IAddress& local_address()
         const noexcept override {
@@ -157,7 +236,8 @@ private:
      * \brief Asynchronously read next bytes.
      */
     void async_read_next() {
-        const auto buffer = message_parser_.prepare_buffer();
+        const auto buffer = is_raw_ ? raw_message_parser_.prepare_buffer()
+                                    : message_parser_.prepare_buffer();
         socket_.async_read_some(asio::buffer(buffer.data(), buffer.size()),
             [self = this->shared_from_this()](const asio::error_code& error,
                 std::size_t size) { self->process_read_bytes(error, size); });
@@ -191,8 +271,46 @@ private:
         }
 
         MSGPACK_RPC_TRACE(logger_, "({}) Read {} bytes.", log_name_, size);
-        message_parser_.consumed(size);
+        if (tcp_quick_ack_) {
+            reapply_tcp_quick_ack(socket_, logger_, log_name_);
+        }
+        if (is_raw_) {
+            raw_message_parser_.consumed(size);
+            if (!process_raw_messages()) {
+                return;
+            }
+        } else {
+            message_parser_.consumed(size);
+            if (!process_messages()) {
+                return;
+            }
+        }
 
+        if (!state_machine_.is_processing()) {
+            return;
+        }
+        if (is_reading_paused_.load(std::memory_order_acquire)) {
+            is_reading_stopped_.store(true, std::memory_order_release);
+            // Check again because resume_reading may have been called before
+            // is_reading_stopped_ was set.
+            if (is_reading_paused_.load(std::memory_order_acquire) ||
+                !is_reading_stopped_.exchange(
+                    false, std::memory_order_acq_rel)) {
+                MSGPACK_RPC_TRACE(
+                    logger_, "({}) Reading has been paused.", log_name_);
+                return;
+            }
+        }
+        async_read_next();
+    }
+
+    /*!
+     * \brief Parse and process received messages.
+     *
+     * \retval true Messages were processed.
+     * \retval false This connection was closed due to invalid data.
+     */
+    bool process_messages() {
         while (true) {
             std::optional<messages::ParsedMessage> message;
             try {
@@ -201,25 +319,83 @@ private:
                 MSGPACK_RPC_ERROR(
                     logger_, "({}) {}", log_name_, e.status().message());
                 close_in_thread(e.status());
-                return;
+                return false;
             }
-            if (message) {
-                MSGPACK_RPC_TRACE(
-                    logger_, "({}) Received a message.", log_name_, size);
-                on_received_(std::move(*message));
-                message.reset();
-            } else {
+            if (!message) {
                 MSGPACK_RPC_TRACE(logger_,
                     "({}) More bytes are needed to parse a message.",
                     log_name_);
-                break;
+                return true;
             }
+            MSGPACK_RPC_TRACE(logger_, "({}) Received a message.", log_name_);
+            if (handle_compression_advertisement(*message)) {
+                continue;
+            }
+            on_received_(std::move(*message));
         }
+    }
 
-        if (!state_machine_.is_processing()) {
-            return;
+    /*!
+     * \brief Parse and process received messages without decoding parameters
+     * and results.
+     *
+     * \retval true Messages were processed.
+     * \retval false This connection was closed due to invalid data.
+     */
+    bool process_raw_messages() {
+        while (true) {
+            std::optional<messages::RawMessage> message;
+            try {
+                message = raw_message_parser_.try_parse();
+            } catch (const MsgpackRPCException& e) {
+                MSGPACK_RPC_ERROR(
+                    logger_, "({}) {}", log_name_, e.status().message());
+                close_in_thread(e.status());
+                return false;
+            }
+            if (!message) {
+                MSGPACK_RPC_TRACE(logger_,
+                    "({}) More bytes are needed to parse a message.",
+                    log_name_);
+                return true;
+            }
+            MSGPACK_RPC_TRACE(
+                logger_, "({}) Received a raw message.", log_name_);
+            if (message->type() == messages::MessageType::NOTIFICATION &&
+                message->method_name() ==
+                    messages::MethodNameView(
+                        messages::COMPRESSION_METHOD_NAME)) {
+                // Compression is disabled without decoding messages.
+                continue;
+            }
+            on_raw_received_(std::move(*message));
         }
-        async_read_next();
+    }
+
+    /*!
+     * \brief Handle a notification advertising support of compression.
+     *
+     * \param[in] message Received message.
+     * \return Whether the message was a notification advertising support of
+     * compression.
+     */
+    bool handle_compression_advertisement(
+        const messages::ParsedMessage& message) {
+        const auto* notification =
+            std::get_if<messages::ParsedNotification>(&message);
+        if (notification == nullptr ||
+            notification->method_name() !=
+                messages::MethodNameView(messages::COMPRESSION_METHOD_NAME)) {
+            return false;
+        }
+        if (messages::impl::is_compression_algorithm_supported(
+                notification->parameters())) {
+            is_compression_supported_by_peer_.store(
+                true, std::memory_order_release);
+            MSGPACK_RPC_TRACE(
+                logger_, "({}) Peer supports compression.", log_name_);
+        }
+        return true;
     }
 
     /*!
@@ -228,6 +404,79 @@ private:
      * \param[in] message Message.
      */
     void async_send_in_thread(const messages::SerializedMessage& message) {
+        if (traffic_recorder_) {
+            traffic_recorder_->record_sent(message);
+        }
+        if (compression_config_.enabled() && !is_raw_) {
+            async_send_compressible_in_thread(message);
+            return;
+        }
+        async_send_message_in_thread(message);
+    }
+
+    /*!
+     * \brief Asynchronously send a message with compression enabled in this
+     * thread.
+     *
+     * \param[in] message Message.
+     *
+     * \note The notification advertising support of compression is written
+     * together with the first message, and messages are compressed only after
+     * the peer advertises support of compression.
+     */
+    void async_send_compressible_in_thread(
+        const messages::SerializedMessage& message) {
+        std::vector<messages::SerializedMessage> parts;
+        if (!is_compression_advertised_) {
+            is_compression_advertised_ = true;
+            parts.push_back(
+                messages::MessageSerializer::serialize_notification(
+                    messages::MethodNameView(
+                        messages::COMPRESSION_METHOD_NAME),
+                    messages::COMPRESSION_ALGORITHM_NAME));
+        }
+        std::optional<messages::SerializedMessage> compressed;
+        if (is_compression_supported_by_peer_.load(std::memory_order_acquire) &&
+            message.total_size() >= compression_config_.min_message_size()) {
+            compressed = messages::impl::compress_message(message);
+        }
+        parts.push_back(compressed ? std::move(*compressed) : message);
+        if (parts.size() == 1U) {
+            async_send_message_in_thread(parts.front());
+            return;
+        }
+
+        std::vector<asio::const_buffer> buffers;
+        std::size_t total_size = 0;
+        for (const auto& part : parts) {
+            part.for_each_buffer(
+                [&buffers](const char* data, std::size_t size) {
+                    buffers.emplace_back(data, size);
+                });
+            total_size += part.total_size();
+        }
+        // The messages captured in the handler keep the buffers alive.
+        asio::async_write(socket_, buffers,
+            [self = this->shared_from_this(), parts = std::move(parts),
+                total_size](
+                const asio::error_code& error, std::size_t /*size*/) {
+                self->on_sent(error, total_size);
+            });
+        MSGPACK_RPC_TRACE(logger_, "({}) Sending {} bytes in {} buffers.",
+            log_name_, total_size, buffers.size());
+    }
+
+    /*!
+     * \brief Asynchronously send a serialized message as is in this thread.
+     *
+     * \param[in] message Message.
+     */
+    void async_send_message_in_thread(
+        const messages::SerializedMessage& message) {
+        if (message.has_external_binaries()) {
+            async_send_external_in_thread(message);
+            return;
+        }
         asio::async_write(socket_,
             asio::const_buffer(message.data(), message.size()),
             [self = this->shared_from_this(), message](
@@ -238,6 +487,31 @@ private:
             logger_, "({}) Sending {} bytes.", log_name_, message.size());
     }
 
+    /*!
+     * \brief Asynchronously send a message with external binaries in this
+     * thread.
+     *
+     * \param[in] message Message.
+     *
+     * \note External binaries are written directly from buffers of users
+     * using a gather write.
+     */
+    void async_send_external_in_thread(
+        const messages::SerializedMessage& message) {
+        std::vector<asio::const_buffer> buffers;
+        message.for_each_buffer([&buffers](const char* data, std::size_t size) {
+            buffers.emplace_back(data, size);
+        });
+        // The message captured in the handler keeps the buffers alive.
+        asio::async_write(socket_, buffers,
+            [self = this->shared_from_this(), message](
+                const asio::error_code& error, std::size_t /*size*/) {
+                self->on_sent(error, message.total_size());
+            });
+        MSGPACK_RPC_TRACE(logger_, "({}) Sending {} bytes in {} buffers.",
+            log_name_, message.total_size(), buffers.size());
+    }
+
     /*!
      * \brief Handle the result of send operation.
      *
@@ -290,6 +564,12 @@ private:
     //! Callback function when a message is received.
     MessageReceivedCallback on_received_{};
 
+    //! Callback function when a message is received without decoding.
+    RawMessageReceivedCallback on_raw_received_{};
+
+    //! Whether messages are received without decoding.
+    bool is_raw_{false};
+
     //! Callback function when a message is sent.
     MessageSentCallback on_sent_{};
 
@@ -299,6 +579,24 @@ private:
     //! Parser of messages.
     messages::MessageParser message_parser_;
 
+    //! Parser of messages without decoding.
+    messages::RawMessageParser raw_message_parser_;
+
+    //! Configuration of compression of messages.
+    config::CompressionConfig compression_config_;
+
+    //! Whether support of compression has been advertised to the peer.
+    bool is_compression_advertised_{false};
+
+    //! Whether the peer supports compression.
+    std::atomic<bool> is_compression_supported_by_peer_{false};
+
+    //! Recorder of traffic. (Null if capture is disabled.)
+    std::unique_ptr<TrafficRecorder> traffic_recorder_;
+
+    //! Whether to enable TCP_QUICKACK again after each read.
+    bool tcp_quick_ack_{false};
+
     //! Address of the local endpoint.
     ConcreteAddress local_address_;
 
@@ -314,6 +612,12 @@ private:
     //! State machine.
     BackgroundTaskStateMachine state_machine_{};
 
+    //! Whether reading is requested to be paused.
+    std::atomic<bool> is_reading_paused_{false};
+
+    //! Whether reading has been stopped due to pause_reading.
+    std::atomic<bool> is_reading_stopped_{false};
+
     //! List of connections.
     std::weak_ptr<ConnectionList<Connection>> connection_list_;
 };
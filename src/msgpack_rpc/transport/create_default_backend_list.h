@@ -22,11 +22,15 @@
 #include <memory>
 
 #include "msgpack_rpc/config.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/socket_config.h"
+#include "msgpack_rpc/config/traffic_capture_config.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/transport/backend_list.h"
 #include "msgpack_rpc/transport/backends.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport {
 
@@ -36,18 +40,29 @@ namespace msgpack_rpc::transport {
  * \param[in] executor Executor.
  * \param[in] message_parser_config Configuration of parsers of messages.
  * \param[in] logger Logger.
+ * \param[in] socket_config Configuration of socket options.
+ * \param[in] compression_config Configuration of compression of messages.
+ * \param[in] traffic_capture_config Configuration of capture of traffic.
  * \return List of backends.
+ *
+ * \note Parameters are in the same order as create_tcp_backend function.
  */
 [[nodiscard]] inline BackendList create_default_backend_list(
     const std::shared_ptr<executors::IExecutor> &executor,
     const config::MessageParserConfig &message_parser_config,
-    const std::shared_ptr<logging::Logger> &logger) {
+    const std::shared_ptr<logging::Logger> &logger,
+    const config::SocketConfig &socket_config = config::SocketConfig(),
+    const config::CompressionConfig &compression_config =
+        config::CompressionConfig(),
+    const config::TrafficCaptureConfig &traffic_capture_config =
+        config::TrafficCaptureConfig()) {
+    const auto traffic_capture = create_traffic_capture(traffic_capture_config);
     BackendList backends;
-    backends.append(
-        create_tcp_backend(executor, message_parser_config, logger));
+    backends.append(create_tcp_backend(executor, message_parser_config, logger,
+        socket_config, compression_config, traffic_capture));
 #if MSGPACK_RPC_HAS_UNIX_SOCKETS
-    backends.append(
-        create_unix_socket_backend(executor, message_parser_config, logger));
+    backends.append(create_unix_socket_backend(
+        executor, message_parser_config, logger, traffic_capture));
 #endif
     return backends;
 }
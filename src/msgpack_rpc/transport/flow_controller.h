@@ -0,0 +1,200 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of FlowController class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "msgpack_rpc/config/flow_control_config.h"
+
+namespace msgpack_rpc::transport {
+
+/*!
+ * \brief Class to track the size of a queue of messages to be sent and decide
+ * when to apply backpressure.
+ *
+ * Backpressure is applied when the size exceeds the high watermark, and
+ * released when the size becomes lower than or equal to the low watermark.
+ *
+ * \note This class is not thread-safe. Users must protect objects of this class
+ * using the mutex of the queue.
+ */
+class FlowController {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] config Configuration.
+     */
+    explicit FlowController(const config::FlowControlConfig& config) noexcept
+        : high_watermark_bytes_(config.high_watermark_bytes()),
+          low_watermark_bytes_(
+              std::min(config.low_watermark_bytes(), high_watermark_bytes_)),
+          high_watermark_messages_(config.high_watermark_messages()),
+          low_watermark_messages_(std::min(
+              config.low_watermark_messages(), high_watermark_messages_)) {}
+
+    /*!
+     * \brief Handle a message pushed to the queue.
+     *
+     * \param[in] size Size of the message in bytes.
+     * \retval true Backpressure has been applied by this message.
+     * \retval false Otherwise.
+     */
+    [[nodiscard]] bool on_pushed(std::size_t size) noexcept {
+        queued_bytes_ += size;
+        ++queued_messages_;
+        if (is_paused_) {
+            return false;
+        }
+        if (exceeds(queued_bytes_, high_watermark_bytes_) ||
+            exceeds(queued_messages_, high_watermark_messages_)) {
+            is_paused_ = true;
+            return true;
+        }
+        return false;
+    }
+
+    /*!
+     * \brief Check whether a message can be pushed without exceeding the high
+     * watermarks.
+     *
+     * \param[in] size Size of the message in bytes.
+     * \retval true The message can be pushed.
+     * \retval false Otherwise.
+     *
+     * \note A message is always accepted when the queue is empty and
+     * backpressure is not applied, so that messages larger than the high
+     * watermark can be sent.
+     */
+    [[nodiscard]] bool can_push(std::size_t size) const noexcept {
+        if (is_paused_) {
+            return false;
+        }
+        if (queued_messages_ == 0U) {
+            return true;
+        }
+        return !exceeds(queued_bytes_ + size, high_watermark_bytes_) &&
+            !exceeds(queued_messages_ + 1U, high_watermark_messages_);
+    }
+
+    /*!
+     * \brief Handle a message removed from the queue.
+     *
+     * \param[in] size Size of the message in bytes.
+     * \retval true Backpressure has been released by this message.
+     * \retval false Otherwise.
+     */
+    [[nodiscard]] bool on_popped(std::size_t size) noexcept {
+        queued_bytes_ -= std::min(size, queued_bytes_);
+        if (queued_messages_ > 0U) {
+            --queued_messages_;
+        }
+        if (!is_paused_) {
+            return false;
+        }
+        if (is_drained(
+                queued_bytes_, high_watermark_bytes_, low_watermark_bytes_) &&
+            is_drained(queued_messages_, high_watermark_messages_,
+                low_watermark_messages_)) {
+            is_paused_ = false;
+            return true;
+        }
+        return false;
+    }
+
+    /*!
+     * \brief Check whether backpressure is applied.
+     *
+     * \retval true Backpressure is applied.
+     * \retval false Otherwise.
+     */
+    [[nodiscard]] bool is_paused() const noexcept { return is_paused_; }
+
+    /*!
+     * \brief Get the number of bytes in the queue.
+     *
+     * \return Number of bytes.
+     */
+    [[nodiscard]] std::size_t queued_bytes() const noexcept {
+        return queued_bytes_;
+    }
+
+    /*!
+     * \brief Get the number of messages in the queue.
+     *
+     * \return Number of messages.
+     */
+    [[nodiscard]] std::size_t queued_messages() const noexcept {
+        return queued_messages_;
+    }
+
+private:
+    /*!
+     * \brief Check whether a value exceeds a watermark.
+     *
+     * \param[in] value Value.
+     * \param[in] watermark Watermark. (Zero for no limit.)
+     * \retval true The value exceeds the watermark.
+     * \retval false Otherwise.
+     */
+    [[nodiscard]] static bool exceeds(
+        std::size_t value, std::size_t watermark) noexcept {
+        return watermark > 0U && value > watermark;
+    }
+
+    /*!
+     * \brief Check whether a value has been drained to a low watermark.
+     *
+     * \param[in] value Value.
+     * \param[in] high_watermark High watermark. (Zero for no limit.)
+     * \param[in] low_watermark Low watermark.
+     * \retval true The value is lower than or equal to the low watermark, or
+     * no limit is set.
+     * \retval false Otherwise.
+     */
+    [[nodiscard]] static bool is_drained(std::size_t value,
+        std::size_t high_watermark, std::size_t low_watermark) noexcept {
+        return high_watermark == 0U || value <= low_watermark;
+    }
+
+    //! High watermark of the number of bytes.
+    std::size_t high_watermark_bytes_;
+
+    //! Low watermark of the number of bytes.
+    std::size_t low_watermark_bytes_;
+
+    //! High watermark of the number of messages.
+    std::size_t high_watermark_messages_;
+
+    //! Low watermark of the number of messages.
+    std::size_t low_watermark_messages_;
+
+    //! Number of bytes in the queue.
+    std::size_t queued_bytes_{0};
+
+    //! Number of messages in the queue.
+    std::size_t queued_messages_{0};
+
+    //! Whether backpressure is applied.
+    bool is_paused_{false};
+};
+
+}  // namespace msgpack_rpc::transport
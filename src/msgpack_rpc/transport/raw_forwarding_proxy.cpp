@@ -0,0 +1,43 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions for proxies forwarding messages without
+ * decoding parameters and results.
+ */
+#include "msgpack_rpc/transport/raw_forwarding_proxy.h"
+
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "msgpack_rpc/transport/raw_forwarding_proxy_impl.h"
+
+namespace msgpack_rpc::transport {
+
+std::shared_ptr<IRawForwardingProxy> create_raw_forwarding_proxy(
+    std::vector<std::shared_ptr<IConnection>> upstreams,
+    IRawForwardingProxy::Router router,
+    std::chrono::nanoseconds request_timeout,
+    const config::FlowControlConfig& flow_control_config,
+    std::shared_ptr<logging::Logger> logger) {
+    return std::make_shared<RawForwardingProxy>(std::move(upstreams),
+        std::move(router), request_timeout, flow_control_config,
+        std::move(logger));
+}
+
+}  // namespace msgpack_rpc::transport
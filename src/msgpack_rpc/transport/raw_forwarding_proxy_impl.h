@@ -0,0 +1,825 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of RawForwardingProxy class.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "msgpack_rpc/common/status.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/flow_control_config.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/message_type.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/raw_message.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/transport/flow_controller.h"
+#include "msgpack_rpc/transport/i_connection.h"
+#include "msgpack_rpc/transport/i_raw_forwarding_proxy.h"
+
+namespace msgpack_rpc::transport {
+
+/*!
+ * \brief Class of proxies forwarding messages without decoding parameters and
+ * results.
+ */
+class RawForwardingProxy final
+    : public IRawForwardingProxy,
+      public std::enable_shared_from_this<RawForwardingProxy> {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] upstreams Upstream connections.
+     * \param[in] router Function to select upstream connections.
+     * \param[in] request_timeout Timeout of requests forwarded to upstream
+     * connections.
+     * \param[in] flow_control_config Configuration of flow control of queues
+     * of messages sent to connections.
+     * \param[in] logger Logger.
+     */
+    RawForwardingProxy(std::vector<std::shared_ptr<IConnection>> upstreams,
+        Router router, std::chrono::nanoseconds request_timeout,
+        const config::FlowControlConfig& flow_control_config,
+        std::shared_ptr<logging::Logger> logger)
+        : router_(std::move(router)),
+          request_timeout_(
+              std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                  request_timeout)),
+          flow_control_config_(flow_control_config),
+          logger_(std::move(logger)) {
+        upstreams_.reserve(upstreams.size());
+        for (auto& connection : upstreams) {
+            auto reading_pause = std::make_shared<ReadingPause>(connection);
+            auto send_queue =
+                std::make_shared<SendQueue>(connection, flow_control_config_);
+            upstreams_.push_back(Upstream{std::move(connection),
+                std::move(reading_pause), std::move(send_queue)});
+        }
+    }
+
+    //! \copydoc msgpack_rpc::transport::IRawForwardingProxy::start
+    void start() override {
+        for (std::size_t i = 0; i < upstreams_.size(); ++i) {
+            upstreams_[i].connection->start_raw(
+                [weak_self = weak_from_this(), i](
+                    messages::RawMessage message) {
+                    const auto self = weak_self.lock();
+                    if (self) {
+                        self->on_upstream_received(i, message);
+                    }
+                },
+                [weak_send_queue =
+                        std::weak_ptr<SendQueue>(upstreams_[i].send_queue)] {
+                    const auto send_queue = weak_send_queue.lock();
+                    if (send_queue) {
+                        send_queue->on_sent();
+                    }
+                },
+                [weak_self = weak_from_this(), i](const Status& status) {
+                    const auto self = weak_self.lock();
+                    if (self) {
+                        self->on_upstream_closed(i, status);
+                    }
+                });
+        }
+    }
+
+    //! \copydoc msgpack_rpc::transport::IRawForwardingProxy::add_downstream
+    void add_downstream(std::shared_ptr<IConnection> connection) override {
+        auto reading_pause = std::make_shared<ReadingPause>(connection);
+        auto send_queue =
+            std::make_shared<SendQueue>(connection, flow_control_config_);
+        const auto downstream =
+            std::make_shared<Downstream>(Downstream{std::move(connection),
+                std::move(reading_pause), std::move(send_queue)});
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (is_stopped_) {
+                lock.unlock();
+                downstream->connection->async_close();
+                return;
+            }
+            downstreams_.insert(downstream);
+        }
+        MSGPACK_RPC_DEBUG(logger_, "Add a downstream connection from {}.",
+            downstream->connection->remote_address().to_string());
+        const auto weak_downstream = std::weak_ptr<Downstream>(downstream);
+        downstream->connection->start_raw(
+            [weak_self = weak_from_this(), weak_downstream](
+                messages::RawMessage message) {
+                const auto self = weak_self.lock();
+                const auto locked_downstream = weak_downstream.lock();
+                if (self && locked_downstream) {
+                    self->on_downstream_received(locked_downstream, message);
+                }
+            },
+            [weak_downstream] {
+                const auto locked_downstream = weak_downstream.lock();
+                if (locked_downstream) {
+                    locked_downstream->send_queue->on_sent();
+                }
+            },
+            [weak_self = weak_from_this(), weak_downstream](
+                const Status& /*status*/) {
+                const auto self = weak_self.lock();
+                const auto locked_downstream = weak_downstream.lock();
+                if (self && locked_downstream) {
+                    self->on_downstream_closed(locked_downstream);
+                }
+            });
+    }
+
+    //! \copydoc msgpack_rpc::transport::IRawForwardingProxy::stop
+    void stop() override {
+        std::vector<std::shared_ptr<IConnection>> connections;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (is_stopped_) {
+                return;
+            }
+            is_stopped_ = true;
+            for (const auto& upstream : upstreams_) {
+                connections.push_back(upstream.connection);
+            }
+            for (const auto& downstream : downstreams_) {
+                connections.push_back(downstream->connection);
+            }
+        }
+        for (const auto& connection : connections) {
+            connection->async_close();
+        }
+    }
+
+private:
+    /*!
+     * \brief Class to pause reading from connections.
+     *
+     * Reading from a connection can be paused by multiple queues, and is
+     * resumed when all the queues have resumed it.
+     */
+    class ReadingPause {
+    public:
+        /*!
+         * \brief Constructor.
+         *
+         * \param[in] connection Connection.
+         */
+        explicit ReadingPause(std::shared_ptr<IConnection> connection)
+            : connection_(std::move(connection)) {}
+
+        /*!
+         * \brief Pause reading.
+         */
+        void pause() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (num_pauses_++ == 0U) {
+                connection_->pause_reading();
+            }
+        }
+
+        /*!
+         * \brief Resume reading.
+         */
+        void resume() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (num_pauses_ > 0U && --num_pauses_ == 0U) {
+                connection_->resume_reading();
+            }
+        }
+
+    private:
+        //! Connection.
+        std::shared_ptr<IConnection> connection_;
+
+        //! Mutex of the number of pauses.
+        std::mutex mutex_{};
+
+        //! Number of queues pausing reading.
+        std::size_t num_pauses_{0};
+    };
+
+    /*!
+     * \brief Class of queues of messages sent to connections.
+     *
+     * Connections don't queue messages by themselves, so a message is sent
+     * only after the previous message has been sent. When the queue exceeds
+     * the high watermark, reading from the connections which push messages is
+     * paused until the queue is drained, as servers do for their connections.
+     */
+    class SendQueue {
+    public:
+        /*!
+         * \brief Constructor.
+         *
+         * \param[in] connection Connection.
+         * \param[in] flow_control_config Configuration of flow control.
+         */
+        SendQueue(std::shared_ptr<IConnection> connection,
+            const config::FlowControlConfig& flow_control_config)
+            : connection_(std::move(connection)),
+              flow_controller_(flow_control_config) {}
+
+        /*!
+         * \brief Send a message.
+         *
+         * \param[in] message Message.
+         * \param[in] source Connection from which the message came. (Null
+         * for messages created by proxies.)
+         */
+        void send(messages::SerializedMessage message,
+            const std::shared_ptr<ReadingPause>& source = nullptr) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (is_closed_) {
+                    return;
+                }
+                (void)flow_controller_.on_pushed(message.total_size());
+                messages_.push(std::move(message));
+                if (source && flow_controller_.is_paused() &&
+                    paused_sources_.insert(source).second) {
+                    // Called in the lock so that the order of pausing and
+                    // resuming is kept.
+                    source->pause();
+                }
+                if (is_sending_) {
+                    return;
+                }
+                is_sending_ = true;
+            }
+            send_next();
+        }
+
+        /*!
+         * \brief Handle the condition that a message is sent.
+         */
+        void on_sent() {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (flow_controller_.on_popped(sending_message_size_)) {
+                    resume_sources();
+                }
+                sending_message_size_ = 0;
+            }
+            send_next();
+        }
+
+        /*!
+         * \brief Handle the condition that the connection is closed.
+         *
+         * Messages in the queue are discarded, and reading from the
+         * connections paused by this queue is resumed.
+         */
+        void close() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            is_closed_ = true;
+            messages_ = std::queue<messages::SerializedMessage>();
+            resume_sources();
+        }
+
+    private:
+        /*!
+         * \brief Send the next message if exists.
+         */
+        void send_next() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (messages_.empty() || is_closed_) {
+                is_sending_ = false;
+                return;
+            }
+            const auto message = std::move(messages_.front());
+            messages_.pop();
+            sending_message_size_ = message.total_size();
+            lock.unlock();
+            connection_->async_send(message);
+        }
+
+        /*!
+         * \brief Resume reading from the connections paused by this queue.
+         *
+         * \note This function must be called with the lock of mutex_.
+         */
+        void resume_sources() {
+            for (const auto& source : paused_sources_) {
+                source->resume();
+            }
+            paused_sources_.clear();
+        }
+
+        //! Connection.
+        std::shared_ptr<IConnection> connection_;
+
+        //! Mutex of the queue.
+        std::mutex mutex_{};
+
+        //! Messages waiting to be sent.
+        std::queue<messages::SerializedMessage> messages_{};
+
+        //! Flow controller of the queue.
+        FlowController flow_controller_;
+
+        //! Connections from which reading is paused by this queue.
+        std::unordered_set<std::shared_ptr<ReadingPause>> paused_sources_{};
+
+        //! Size of the message being sent.
+        std::size_t sending_message_size_{0};
+
+        //! Whether a message is being sent.
+        bool is_sending_{false};
+
+        //! Whether the connection has been closed.
+        bool is_closed_{false};
+    };
+
+    /*!
+     * \brief Struct of downstream connections.
+     */
+    struct Downstream;
+
+    /*!
+     * \brief Struct of requests forwarded to upstream connections.
+     */
+    struct ForwardedRequest {
+        //! Index of the upstream connection.
+        std::size_t upstream_index;
+
+        //! Message ID in the upstream connection.
+        messages::MessageID upstream_id;
+    };
+
+    /*!
+     * \brief Struct of requests waiting for responses from upstream
+     * connections.
+     */
+    struct PendingRequest {
+        //! Downstream connection.
+        std::weak_ptr<Downstream> downstream;
+
+        //! Message ID in the downstream connection.
+        messages::MessageID downstream_id;
+
+        //! Deadline of the response.
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    /*!
+     * \brief Struct of requests which timed out.
+     */
+    struct ExpiredRequest {
+        //! Downstream connection. (Null if closed.)
+        std::shared_ptr<Downstream> downstream;
+
+        //! Message ID in the downstream connection.
+        messages::MessageID downstream_id;
+
+        //! Queue of messages sent to the upstream connection.
+        std::shared_ptr<SendQueue> upstream_send_queue;
+
+        //! Message ID in the upstream connection.
+        messages::MessageID upstream_id;
+    };
+
+    struct Downstream {
+        //! Connection.
+        std::shared_ptr<IConnection> connection;
+
+        //! Object to pause reading from this connection.
+        std::shared_ptr<ReadingPause> reading_pause;
+
+        //! Queue of messages sent to this connection.
+        std::shared_ptr<SendQueue> send_queue;
+
+        //! Requests forwarded to upstream connections. (Key: message ID in
+        //! this connection.)
+        std::unordered_map<messages::MessageID, ForwardedRequest>
+            forwarded_requests{};
+    };
+
+    /*!
+     * \brief Struct of upstream connections.
+     */
+    struct Upstream {
+        //! Connection.
+        std::shared_ptr<IConnection> connection;
+
+        //! Object to pause reading from this connection.
+        std::shared_ptr<ReadingPause> reading_pause;
+
+        //! Queue of messages sent to this connection.
+        std::shared_ptr<SendQueue> send_queue;
+
+        //! Next message ID.
+        messages::MessageID next_id{0};
+
+        //! Requests waiting for responses. (Key: message ID in this
+        //! connection.)
+        std::unordered_map<messages::MessageID, PendingRequest>
+            pending_requests{};
+
+        //! Whether this connection has been closed.
+        bool is_closed{false};
+    };
+
+    /*!
+     * \brief Process a message from a downstream connection.
+     *
+     * \param[in] downstream Downstream connection.
+     * \param[in] message Message.
+     */
+    void on_downstream_received(const std::shared_ptr<Downstream>& downstream,
+        const messages::RawMessage& message) {
+        switch (message.type()) {
+        case messages::MessageType::REQUEST:
+            forward_request(downstream, message);
+            return;
+        case messages::MessageType::NOTIFICATION:
+            forward_notification_to_upstream(downstream, message);
+            return;
+        case messages::MessageType::RESPONSE:
+            MSGPACK_RPC_WARN(logger_,
+                "Unexpected response from a downstream connection {}.",
+                downstream->connection->remote_address().to_string());
+            return;
+        }
+    }
+
+    /*!
+     * \brief Forward a request to an upstream connection.
+     *
+     * \param[in] downstream Downstream connection.
+     * \param[in] request Request.
+     */
+    void forward_request(const std::shared_ptr<Downstream>& downstream,
+        const messages::RawMessage& request) {
+        const messages::MessageID downstream_id = *request.id();
+        const auto index = route(request.method_name());
+        const auto now = std::chrono::steady_clock::now();
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto expired_requests = remove_expired_requests(now);
+        if (!index || upstreams_[*index].is_closed) {
+            lock.unlock();
+            fail_expired_requests(expired_requests);
+            MSGPACK_RPC_DEBUG(logger_,
+                "No upstream connection for {} (id: {}) from {}.",
+                request.method_name(), downstream_id,
+                downstream->connection->remote_address().to_string());
+            downstream->send_queue->send(
+                messages::MessageSerializer::serialize_error_response(
+                    downstream_id,
+                    std::string(
+                        format_status_code(StatusCode::CONNECTION_FAILURE))),
+                downstream->reading_pause);
+            return;
+        }
+        Upstream& upstream = upstreams_[*index];
+        messages::MessageID upstream_id = upstream.next_id++;
+        while (upstream.pending_requests.count(upstream_id) > 0U) {
+            upstream_id = upstream.next_id++;
+        }
+        upstream.pending_requests.emplace(upstream_id,
+            PendingRequest{
+                downstream, downstream_id, calculate_deadline(now)});
+        downstream->forwarded_requests.insert_or_assign(
+            downstream_id, ForwardedRequest{*index, upstream_id});
+        const auto send_queue = upstream.send_queue;
+        lock.unlock();
+        fail_expired_requests(expired_requests);
+
+        MSGPACK_RPC_TRACE(logger_, "Forward {} (id: {} -> {}) to upstream {}.",
+            request.method_name(), downstream_id, upstream_id, *index);
+        send_queue->send(request.serialize_with_id(upstream_id),
+            downstream->reading_pause);
+    }
+
+    /*!
+     * \brief Forward a notification from a downstream connection to an
+     * upstream connection.
+     *
+     * \param[in] downstream Downstream connection.
+     * \param[in] notification Notification.
+     */
+    void forward_notification_to_upstream(
+        const std::shared_ptr<Downstream>& downstream,
+        const messages::RawMessage& notification) {
+        if (!notification.id()) {
+            const auto index = route(notification.method_name());
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (!index || upstreams_[*index].is_closed) {
+                return;
+            }
+            const auto send_queue = upstreams_[*index].send_queue;
+            lock.unlock();
+            send_queue->send(
+                notification.serialize(), downstream->reading_pause);
+            return;
+        }
+
+        // Notifications related to requests are forwarded to the upstream
+        // connections of the requests.
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter =
+            downstream->forwarded_requests.find(*notification.id());
+        if (iter == downstream->forwarded_requests.end()) {
+            return;
+        }
+        const ForwardedRequest forwarded = iter->second;
+        Upstream& upstream = upstreams_[forwarded.upstream_index];
+        if (notification.method_name() ==
+            messages::MethodNameView(messages::CANCEL_REQUEST_METHOD_NAME)) {
+            // Clients don't wait for responses of cancelled requests.
+            downstream->forwarded_requests.erase(iter);
+            upstream.pending_requests.erase(forwarded.upstream_id);
+        }
+        if (upstream.is_closed) {
+            return;
+        }
+        const auto send_queue = upstream.send_queue;
+        lock.unlock();
+        send_queue->send(notification.serialize_with_id(forwarded.upstream_id),
+            downstream->reading_pause);
+    }
+
+    /*!
+     * \brief Process a message from an upstream connection.
+     *
+     * \param[in] index Index of the upstream connection.
+     * \param[in] message Message.
+     */
+    void on_upstream_received(
+        std::size_t index, const messages::RawMessage& message) {
+        if (message.type() == messages::MessageType::REQUEST ||
+            !message.id()) {
+            MSGPACK_RPC_DEBUG(logger_,
+                "Drop a message {} from upstream {} which cannot be routed.",
+                message.method_name(), index);
+            return;
+        }
+
+        const messages::MessageID upstream_id = *message.id();
+        std::unique_lock<std::mutex> lock(mutex_);
+        Upstream& upstream = upstreams_[index];
+        const auto iter = upstream.pending_requests.find(upstream_id);
+        if (iter == upstream.pending_requests.end()) {
+            MSGPACK_RPC_DEBUG(logger_,
+                "Drop a message for unknown request (id: {}) from upstream "
+                "{}.",
+                upstream_id, index);
+            return;
+        }
+        const PendingRequest pending = iter->second;
+        const auto downstream = pending.downstream.lock();
+        if (message.type() == messages::MessageType::RESPONSE) {
+            upstream.pending_requests.erase(iter);
+            if (downstream) {
+                downstream->forwarded_requests.erase(pending.downstream_id);
+            }
+        }
+        const auto reading_pause = upstream.reading_pause;
+        lock.unlock();
+
+        if (downstream) {
+            downstream->send_queue->send(
+                message.serialize_with_id(pending.downstream_id),
+                reading_pause);
+        }
+    }
+
+    /*!
+     * \brief Process a closed upstream connection.
+     *
+     * \param[in] index Index of the upstream connection.
+     * \param[in] status Status.
+     */
+    void on_upstream_closed(std::size_t index, const Status& status) {
+        MSGPACK_RPC_WARN(logger_, "Upstream {} closed: {}", index,
+            status.message());
+        std::vector<std::pair<std::shared_ptr<Downstream>, messages::MessageID>>
+            failed_requests;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            Upstream& upstream = upstreams_[index];
+            upstream.is_closed = true;
+            upstream.send_queue->close();
+            for (const auto& [upstream_id, pending] :
+                upstream.pending_requests) {
+                auto downstream = pending.downstream.lock();
+                if (downstream) {
+                    downstream->forwarded_requests.erase(pending.downstream_id);
+                    failed_requests.emplace_back(
+                        std::move(downstream), pending.downstream_id);
+                }
+            }
+            upstream.pending_requests.clear();
+        }
+
+        const auto error = std::string(
+            format_status_code(StatusCode::CONNECTION_FAILURE));
+        for (const auto& [downstream, downstream_id] : failed_requests) {
+            downstream->send_queue->send(
+                messages::MessageSerializer::serialize_error_response(
+                    downstream_id, error));
+        }
+    }
+
+    /*!
+     * \brief Process a closed downstream connection.
+     *
+     * \param[in] downstream Downstream connection.
+     */
+    void on_downstream_closed(const std::shared_ptr<Downstream>& downstream) {
+        MSGPACK_RPC_DEBUG(logger_, "Downstream connection from {} closed.",
+            downstream->connection->remote_address().to_string());
+        std::vector<std::pair<std::shared_ptr<SendQueue>, messages::MessageID>>
+            cancelled_requests;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            downstreams_.erase(downstream);
+            downstream->send_queue->close();
+            for (const auto& [downstream_id, forwarded] :
+                downstream->forwarded_requests) {
+                Upstream& upstream = upstreams_[forwarded.upstream_index];
+                upstream.pending_requests.erase(forwarded.upstream_id);
+                if (!upstream.is_closed) {
+                    cancelled_requests.emplace_back(
+                        upstream.send_queue, forwarded.upstream_id);
+                }
+            }
+            downstream->forwarded_requests.clear();
+        }
+
+        // Requests no one waits for are cancelled in servers.
+        for (const auto& [send_queue, upstream_id] : cancelled_requests) {
+            send_queue->send(
+                messages::MessageSerializer::serialize_notification(
+                    messages::MethodNameView(
+                        messages::CANCEL_REQUEST_METHOD_NAME),
+                    upstream_id));
+        }
+    }
+
+    /*!
+     * \brief Calculate the deadline of a request.
+     *
+     * \param[in] now Current time.
+     * \return Deadline.
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point calculate_deadline(
+        std::chrono::steady_clock::time_point now) const noexcept {
+        if (request_timeout_ >=
+            std::chrono::steady_clock::time_point::max() - now) {
+            return std::chrono::steady_clock::time_point::max();
+        }
+        return now + request_timeout_;
+    }
+
+    /*!
+     * \brief Remove requests which timed out.
+     *
+     * All requests are checked at most once in the timeout of requests, so
+     * that requests without responses don't stay forever.
+     *
+     * \param[in] now Current time.
+     * \return Removed requests.
+     *
+     * \note This function must be called with the lock of mutex_.
+     */
+    [[nodiscard]] std::vector<ExpiredRequest> remove_expired_requests(
+        std::chrono::steady_clock::time_point now) {
+        std::vector<ExpiredRequest> expired_requests;
+        if (now < next_sweep_time_) {
+            return expired_requests;
+        }
+        next_sweep_time_ = calculate_deadline(now);
+        for (Upstream& upstream : upstreams_) {
+            for (auto iter = upstream.pending_requests.begin();
+                 iter != upstream.pending_requests.end();) {
+                const PendingRequest& pending = iter->second;
+                if (now < pending.deadline) {
+                    ++iter;
+                    continue;
+                }
+                auto downstream = pending.downstream.lock();
+                if (downstream) {
+                    downstream->forwarded_requests.erase(pending.downstream_id);
+                }
+                expired_requests.push_back(ExpiredRequest{std::move(downstream),
+                    pending.downstream_id, upstream.send_queue, iter->first});
+                iter = upstream.pending_requests.erase(iter);
+            }
+        }
+        return expired_requests;
+    }
+
+    /*!
+     * \brief Respond errors to requests which timed out, and cancel them in
+     * upstream connections.
+     *
+     * \param[in] expired_requests Requests which timed out.
+     */
+    void fail_expired_requests(
+        const std::vector<ExpiredRequest>& expired_requests) {
+        if (expired_requests.empty()) {
+            return;
+        }
+        MSGPACK_RPC_DEBUG(logger_, "{} forwarded requests timed out.",
+            expired_requests.size());
+        const auto error =
+            std::string(format_status_code(StatusCode::TIMEOUT));
+        for (const auto& expired : expired_requests) {
+            if (expired.downstream) {
+                expired.downstream->send_queue->send(
+                    messages::MessageSerializer::serialize_error_response(
+                        expired.downstream_id, error));
+            }
+            expired.upstream_send_queue->send(
+                messages::MessageSerializer::serialize_notification(
+                    messages::MethodNameView(
+                        messages::CANCEL_REQUEST_METHOD_NAME),
+                    expired.upstream_id));
+        }
+    }
+
+    /*!
+     * \brief Select an upstream connection.
+     *
+     * \param[in] method_name Method name.
+     * \return Index of the upstream connection. Null if no connection is
+     * selected.
+     */
+    [[nodiscard]] std::optional<std::size_t> route(
+        messages::MethodNameView method_name) {
+        try {
+            const std::size_t index = router_(method_name);
+            if (index < upstreams_.size()) {
+                return index;
+            }
+            MSGPACK_RPC_ERROR(logger_,
+                "Invalid index of an upstream connection for {}: {}",
+                method_name, index);
+        } catch (const std::exception& e) {
+            MSGPACK_RPC_ERROR(logger_, "Failed to route {}: {}", method_name,
+                e.what());
+        }
+        return std::nullopt;
+    }
+
+    //! Function to select upstream connections.
+    Router router_;
+
+    //! Timeout of requests forwarded to upstream connections.
+    std::chrono::steady_clock::duration request_timeout_;
+
+    //! Configuration of flow control of queues.
+    config::FlowControlConfig flow_control_config_;
+
+    //! Logger.
+    std::shared_ptr<logging::Logger> logger_;
+
+    //! Mutex of connections and requests.
+    std::mutex mutex_{};
+
+    //! Upstream connections.
+    std::vector<Upstream> upstreams_{};
+
+    //! Downstream connections.
+    std::unordered_set<std::shared_ptr<Downstream>> downstreams_{};
+
+    //! Time to check the deadlines of requests next time.
+    std::chrono::steady_clock::time_point next_sweep_time_{};
+
+    //! Whether this proxy has been stopped.
+    bool is_stopped_{false};
+};
+
+}  // namespace msgpack_rpc::transport
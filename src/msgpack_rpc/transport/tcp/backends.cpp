@@ -23,15 +23,20 @@
 #include <utility>
 
 #include "msgpack_rpc/transport/tcp/tcp_backend.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport {
 
 std::shared_ptr<IBackend> create_tcp_backend(
     const std::shared_ptr<executors::IExecutor>& executor,
     const config::MessageParserConfig& message_parser_config,
-    std::shared_ptr<logging::Logger> logger) {
-    return std::make_shared<tcp::TCPBackend>(
-        executor, message_parser_config, std::move(logger));
+    std::shared_ptr<logging::Logger> logger,
+    const config::SocketConfig& socket_config,
+    const config::CompressionConfig& compression_config,
+    std::shared_ptr<TrafficCapture> traffic_capture) {
+    return std::make_shared<tcp::TCPBackend>(executor, message_parser_config,
+        socket_config, compression_config, std::move(traffic_capture),
+        std::move(logger));
 }
 
 }  // namespace msgpack_rpc::transport
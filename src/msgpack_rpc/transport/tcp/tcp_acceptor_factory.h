@@ -39,7 +39,9 @@
 #include "msgpack_rpc/addresses/uri.h"
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/socket_config.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/executors/operation_type.h"
 #include "msgpack_rpc/logging/log_level.h"
@@ -48,6 +50,7 @@
 #include "msgpack_rpc/transport/i_acceptor.h"
 #include "msgpack_rpc/transport/i_acceptor_factory.h"
 #include "msgpack_rpc/transport/tcp/tcp_acceptor.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport::tcp {
 
@@ -70,13 +73,23 @@ public:
      *
      * \param[in] executor Executor.
      * \param[in] message_parser_config Configuration of parsers of messages.
+     * \param[in] socket_config Configuration of socket options.
+     * \param[in] compression_config Configuration of compression of messages.
+     * \param[in] traffic_capture Object to capture traffic. (Null to disable
+     * capture.)
      * \param[in] logger Logger.
      */
     TCPAcceptorFactory(std::shared_ptr<executors::IExecutor> executor,
         const config::MessageParserConfig& message_parser_config,
+        const config::SocketConfig& socket_config,
+        const config::CompressionConfig& compression_config,
+        std::shared_ptr<TrafficCapture> traffic_capture,
         std::shared_ptr<logging::Logger> logger)
         : executor_(std::move(executor)),
           message_parser_config_(message_parser_config),
+          socket_config_(socket_config),
+          compression_config_(compression_config),
+          traffic_capture_(std::move(traffic_capture)),
           resolver_(executor_->context(executors::OperationType::TRANSPORT)),
           scheme_("tcp"),
           log_name_(fmt::format("AcceptorFactory({})", scheme_)),
@@ -92,8 +105,9 @@ public:
         for (const auto& entry : resolved_endpoints) {
             const auto local_address = ConcreteAddress(entry.endpoint());
             std::shared_ptr<IAcceptor> acceptor =
-                std::make_shared<AcceptorType>(
-                    local_address, executor_, message_parser_config_, logger_);
+                std::make_shared<AcceptorType>(local_address, executor_,
+                    message_parser_config_, socket_config_, compression_config_,
+                    traffic_capture_, logger_);
             acceptors.push_back(std::move(acceptor));
         }
 
@@ -145,6 +159,15 @@ private:
     //! Configuration of parsers of messages.
     config::MessageParserConfig message_parser_config_;
 
+    //! Configuration of socket options.
+    config::SocketConfig socket_config_;
+
+    //! Configuration of compression of messages.
+    config::CompressionConfig compression_config_;
+
+    //! Object to capture traffic. (Null if capture is disabled.)
+    std::shared_ptr<TrafficCapture> traffic_capture_;
+
     //! Resolver.
     AsioResolver resolver_;
 
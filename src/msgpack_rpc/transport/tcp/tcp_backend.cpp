@@ -25,17 +25,26 @@
 #include "msgpack_rpc/addresses/schemes.h"
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/socket_config.h"
 #include "msgpack_rpc/transport/tcp/tcp_acceptor_factory.h"
 #include "msgpack_rpc/transport/tcp/tcp_connector.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport::tcp {
 
 TCPBackend::TCPBackend(const std::shared_ptr<executors::IExecutor>& executor,
     const config::MessageParserConfig& message_parser_config,
+    const config::SocketConfig& socket_config,
+    const config::CompressionConfig& compression_config,
+    std::shared_ptr<TrafficCapture> traffic_capture,
     std::shared_ptr<logging::Logger> logger)
     : executor_(executor),
       message_parser_config_(message_parser_config),
+      socket_config_(socket_config),
+      compression_config_(compression_config),
+      traffic_capture_(std::move(traffic_capture)),
       logger_(std::move(logger)) {}
 
 std::string_view TCPBackend::scheme() const noexcept {
@@ -43,13 +52,14 @@ std::string_view TCPBackend::scheme() const noexcept {
 }
 
 std::shared_ptr<IAcceptorFactory> TCPBackend::create_acceptor_factory() {
-    return std::make_shared<TCPAcceptorFactory>(
-        executor(), message_parser_config_, logger_);
+    return std::make_shared<TCPAcceptorFactory>(executor(),
+        message_parser_config_, socket_config_, compression_config_,
+        traffic_capture_, logger_);
 }
 
 std::shared_ptr<IConnector> TCPBackend::create_connector() {
-    return std::make_shared<TCPConnector>(
-        executor(), message_parser_config_, logger_);
+    return std::make_shared<TCPConnector>(executor(), message_parser_config_,
+        socket_config_, compression_config_, traffic_capture_, logger_);
 }
 
 TCPBackend::~TCPBackend() noexcept = default;
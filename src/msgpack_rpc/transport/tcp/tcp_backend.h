@@ -22,12 +22,15 @@
 #include <memory>
 #include <string_view>
 
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/socket_config.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/transport/i_acceptor_factory.h"
 #include "msgpack_rpc/transport/i_backend.h"
 #include "msgpack_rpc/transport/i_connector.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport::tcp {
 
@@ -41,10 +44,17 @@ public:
      *
      * \param[in] executor Executor.
      * \param[in] message_parser_config Configuration of parsers of messages.
+     * \param[in] socket_config Configuration of socket options.
+     * \param[in] compression_config Configuration of compression of messages.
+     * \param[in] traffic_capture Object to capture traffic. (Null to disable
+     * capture.)
      * \param[in] logger Logger.
      */
     TCPBackend(const std::shared_ptr<executors::IExecutor>& executor,
         const config::MessageParserConfig& message_parser_config,
+        const config::SocketConfig& socket_config,
+        const config::CompressionConfig& compression_config,
+        std::shared_ptr<TrafficCapture> traffic_capture,
         std::shared_ptr<logging::Logger> logger);
 
     //! \copydoc msgpack_rpc::transport::IBackend::scheme
@@ -79,6 +89,15 @@ private:
     //! Configuration of parsers of messages.
     config::MessageParserConfig message_parser_config_;
 
+    //! Configuration of socket options.
+    config::SocketConfig socket_config_;
+
+    //! Configuration of compression of messages.
+    config::CompressionConfig compression_config_;
+
+    //! Object to capture traffic. (Null if capture is disabled.)
+    std::shared_ptr<TrafficCapture> traffic_capture_;
+
     //! Logger.
     std::shared_ptr<logging::Logger> logger_;
 };
@@ -41,13 +41,17 @@
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/socket_config.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/executors/operation_type.h"
 #include "msgpack_rpc/logging/log_level.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/transport/apply_socket_config.h"
 #include "msgpack_rpc/transport/connection.h"
 #include "msgpack_rpc/transport/i_connector.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport::tcp {
 
@@ -77,13 +81,23 @@ public:
      *
      * \param[in] executor Executor.
      * \param[in] message_parser_config Configuration of parsers of messages.
+     * \param[in] socket_config Configuration of socket options.
+     * \param[in] compression_config Configuration of compression of messages.
+     * \param[in] traffic_capture Object to capture traffic. (Null to disable
+     * capture.)
      * \param[in] logger Logger.
      */
     TCPConnector(const std::shared_ptr<executors::IExecutor>& executor,
         const config::MessageParserConfig& message_parser_config,
+        const config::SocketConfig& socket_config,
+        const config::CompressionConfig& compression_config,
+        std::shared_ptr<TrafficCapture> traffic_capture,
         std::shared_ptr<logging::Logger> logger)
         : executor_(executor),
           message_parser_config_(message_parser_config),
+          socket_config_(socket_config),
+          compression_config_(compression_config),
+          traffic_capture_(std::move(traffic_capture)),
           resolver_(executor->context(executors::OperationType::TRANSPORT)),
           scheme_("tcp"),
           log_name_(fmt::format("Connector({})", scheme_)),
@@ -170,9 +184,14 @@ private:
         }
         MSGPACK_RPC_TRACE(logger_, "({}) Connected to {}.", log_name_,
             fmt::streamed(asio_address));
+        apply_socket_config(socket, socket_config_, logger_, log_name_);
 
-        auto connection = std::make_shared<ConnectionType>(
-            std::move(socket), message_parser_config_, logger_);
+        auto connection = std::make_shared<ConnectionType>(std::move(socket),
+            message_parser_config_, compression_config_, traffic_capture_,
+            logger_);
+        if (socket_config_.tcp_quick_ack()) {
+            connection->enable_tcp_quick_ack();
+        }
         on_connected(Status(), std::move(connection));
     }
 
@@ -198,6 +217,15 @@ private:
     //! Configuration of parsers of messages.
     config::MessageParserConfig message_parser_config_;
 
+    //! Configuration of socket options.
+    config::SocketConfig socket_config_;
+
+    //! Configuration of compression of messages.
+    config::CompressionConfig compression_config_;
+
+    //! Object to capture traffic. (Null if capture is disabled.)
+    std::shared_ptr<TrafficCapture> traffic_capture_;
+
     //! Resolver.
     AsioResolver resolver_;
 
@@ -0,0 +1,291 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of classes to capture traffic.
+ */
+#include "msgpack_rpc/transport/traffic_capture.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ios>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/traffic_capture_config.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+namespace msgpack_rpc::transport {
+
+namespace {
+
+//! Magic bytes at the beginning of files.
+constexpr std::string_view TRAFFIC_CAPTURE_MAGIC = "MPRPCCAP";
+
+//! Version of the format of files.
+constexpr std::uint32_t TRAFFIC_CAPTURE_VERSION = 1;
+
+//! Size of the header of files.
+constexpr std::size_t TRAFFIC_CAPTURE_FILE_HEADER_SIZE =
+    TRAFFIC_CAPTURE_MAGIC.size() + sizeof(std::uint32_t);
+
+//! Size of headers of records.
+constexpr std::size_t TRAFFIC_CAPTURE_RECORD_HEADER_SIZE =
+    sizeof(std::uint64_t) + sizeof(std::uint32_t) + sizeof(std::uint8_t) +
+    sizeof(std::uint32_t);
+
+//! Number of bits in a byte.
+constexpr unsigned int BITS_PER_BYTE = 8;
+
+/*!
+ * \brief Write an integer in little endian.
+ *
+ * \tparam Integer Type of the integer.
+ * \param[out] output Pointer to the output.
+ * \param[in] value Value.
+ * \return Pointer to the next output.
+ */
+template <typename Integer>
+char* write_little_endian(char* output, Integer value) noexcept {
+    for (std::size_t i = 0; i < sizeof(Integer); ++i) {
+        output[i] = static_cast<char>(
+            static_cast<std::uint8_t>(value >> (i * BITS_PER_BYTE)));
+    }
+    return output + sizeof(Integer);
+}
+
+/*!
+ * \brief Read an integer in little endian.
+ *
+ * \tparam Integer Type of the integer.
+ * \param[in] input Pointer to the input.
+ * \return Value.
+ */
+template <typename Integer>
+Integer read_little_endian(const char* input) noexcept {
+    Integer value = 0;
+    for (std::size_t i = 0; i < sizeof(Integer); ++i) {
+        value |= static_cast<Integer>(
+            static_cast<Integer>(static_cast<std::uint8_t>(input[i]))
+            << (i * BITS_PER_BYTE));
+    }
+    return value;
+}
+
+/*!
+ * \brief Normalize a path of a file.
+ *
+ * \param[in] path Path.
+ * \return Normalized path.
+ */
+std::string normalize_path(const std::filesystem::path& path) {
+    std::error_code error;
+    auto normalized = std::filesystem::weakly_canonical(path, error);
+    if (error) {
+        normalized = std::filesystem::absolute(path, error);
+        if (error) {
+            normalized = path;
+        }
+    }
+    return normalized.string();
+}
+
+//! Mutex of paths of files used by TrafficCapture objects.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex used_paths_mutex;
+
+//! Normalized paths of files used by TrafficCapture objects.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unordered_set<std::string> used_paths;
+
+}  // namespace
+
+TrafficCapture::TrafficCapture(std::string_view file_path)
+    : normalized_path_(normalize_path(std::filesystem::path(file_path))),
+      next_connection_id_(0),
+      start_time_(std::chrono::steady_clock::now()) {
+    {
+        std::unique_lock<std::mutex> lock(used_paths_mutex);
+        if (!used_paths.insert(normalized_path_).second) {
+            throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+                fmt::format(
+                    "A file to capture traffic is already used in this "
+                    "process: {}.",
+                    file_path));
+        }
+    }
+
+    file_.open(std::filesystem::path(file_path),
+        std::ios::binary | std::ios::trunc);
+    if (!file_) {
+        std::unique_lock<std::mutex> lock(used_paths_mutex);
+        used_paths.erase(normalized_path_);
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            fmt::format("Failed to open a file to capture traffic: {}.",
+                file_path));
+    }
+
+    std::array<char, TRAFFIC_CAPTURE_FILE_HEADER_SIZE> header{};
+    char* position = std::copy(TRAFFIC_CAPTURE_MAGIC.begin(),
+        TRAFFIC_CAPTURE_MAGIC.end(), header.data());
+    write_little_endian(position, TRAFFIC_CAPTURE_VERSION);
+    file_.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+TrafficCapture::~TrafficCapture() noexcept {
+    try {
+        flush();
+    } catch (...) {
+        // Errors in destructors cannot be handled.
+    }
+    try {
+        file_.close();
+        std::unique_lock<std::mutex> lock(used_paths_mutex);
+        used_paths.erase(normalized_path_);
+    } catch (...) {
+        // Errors in destructors cannot be handled.
+    }
+}
+
+std::uint32_t TrafficCapture::register_connection() noexcept {
+    return next_connection_id_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TrafficCapture::record(std::uint32_t connection_id,
+    TrafficDirection direction, const char* data, std::size_t size) {
+    if (size > std::numeric_limits<std::uint32_t>::max()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    write_record_header(
+        connection_id, direction, static_cast<std::uint32_t>(size));
+    file_.write(data, static_cast<std::streamsize>(size));
+}
+
+void TrafficCapture::record(std::uint32_t connection_id,
+    TrafficDirection direction, const messages::SerializedMessage& message) {
+    const std::size_t size = message.total_size();
+    if (size > std::numeric_limits<std::uint32_t>::max()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    write_record_header(
+        connection_id, direction, static_cast<std::uint32_t>(size));
+    message.for_each_buffer([this](const char* data, std::size_t buffer_size) {
+        file_.write(data, static_cast<std::streamsize>(buffer_size));
+    });
+}
+
+void TrafficCapture::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    file_.flush();
+}
+
+void TrafficCapture::write_record_header(std::uint32_t connection_id,
+    TrafficDirection direction, std::uint32_t size) {
+    // The steady clock keeps intervals of records even if the system clock
+    // is adjusted.
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start_time_);
+
+    std::array<char, TRAFFIC_CAPTURE_RECORD_HEADER_SIZE> header{};
+    char* position = header.data();
+    position = write_little_endian(
+        position, static_cast<std::uint64_t>(timestamp.count()));
+    position = write_little_endian(position, connection_id);
+    position =
+        write_little_endian(position, static_cast<std::uint8_t>(direction));
+    write_little_endian(position, size);
+    file_.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+TrafficCaptureReader::TrafficCaptureReader(std::string_view file_path)
+    : file_(std::filesystem::path(file_path), std::ios::binary) {
+    if (!file_) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            fmt::format(
+                "Failed to open a file of captured traffic: {}.", file_path));
+    }
+
+    std::array<char, TRAFFIC_CAPTURE_FILE_HEADER_SIZE> header{};
+    file_.read(header.data(), static_cast<std::streamsize>(header.size()));
+    const auto magic =
+        std::string_view(header.data(), TRAFFIC_CAPTURE_MAGIC.size());
+    if (!file_ || magic != TRAFFIC_CAPTURE_MAGIC) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            fmt::format("Not a file of captured traffic: {}.", file_path));
+    }
+    const auto version = read_little_endian<std::uint32_t>(
+        header.data() + TRAFFIC_CAPTURE_MAGIC.size());
+    if (version != TRAFFIC_CAPTURE_VERSION) {
+        throw MsgpackRPCException(StatusCode::INVALID_ARGUMENT,
+            fmt::format("Unsupported version of files of captured traffic: {}.",
+                version));
+    }
+}
+
+std::optional<CapturedMessage> TrafficCaptureReader::next() {
+    std::array<char, TRAFFIC_CAPTURE_RECORD_HEADER_SIZE> header{};
+    file_.read(header.data(), static_cast<std::streamsize>(header.size()));
+    if (!file_) {
+        return std::nullopt;
+    }
+
+    const char* position = header.data();
+    CapturedMessage message{};
+    message.timestamp = std::chrono::nanoseconds(
+        static_cast<std::int64_t>(read_little_endian<std::uint64_t>(position)));
+    position += sizeof(std::uint64_t);
+    message.connection_id = read_little_endian<std::uint32_t>(position);
+    position += sizeof(std::uint32_t);
+    message.direction = static_cast<TrafficDirection>(
+        read_little_endian<std::uint8_t>(position));
+    position += sizeof(std::uint8_t);
+    const auto size = read_little_endian<std::uint32_t>(position);
+
+    message.data.resize(size);
+    file_.read(message.data.data(), static_cast<std::streamsize>(size));
+    if (!file_) {
+        return std::nullopt;
+    }
+    return message;
+}
+
+std::shared_ptr<TrafficCapture> create_traffic_capture(
+    const config::TrafficCaptureConfig& config) {
+    if (!config.enabled()) {
+        return nullptr;
+    }
+    return std::make_shared<TrafficCapture>(config.file_path());
+}
+
+}  // namespace msgpack_rpc::transport
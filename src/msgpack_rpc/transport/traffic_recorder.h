@@ -0,0 +1,77 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of TrafficRecorder class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
+
+namespace msgpack_rpc::transport {
+
+/*!
+ * \brief Class to record traffic of a connection.
+ *
+ * Received messages are recorded as framed by parsers of messages, so that
+ * compressed messages are recorded after decompression for replays (refer to
+ * messages::MessageParser::set_framed_message_handler).
+ */
+class TrafficRecorder {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] capture Object to capture traffic.
+     */
+    explicit TrafficRecorder(std::shared_ptr<TrafficCapture> capture)
+        : capture_(std::move(capture)),
+          connection_id_(capture_->register_connection()) {}
+
+    /*!
+     * \brief Record a received message.
+     *
+     * \param[in] data Pointer to the data of the message.
+     * \param[in] size Size of the data of the message.
+     */
+    void record_received(const char* data, std::size_t size) {
+        capture_->record(connection_id_, TrafficDirection::INBOUND, data, size);
+    }
+
+    /*!
+     * \brief Record a sent message.
+     *
+     * \param[in] message Message.
+     */
+    void record_sent(const messages::SerializedMessage& message) {
+        capture_->record(connection_id_, TrafficDirection::OUTBOUND, message);
+    }
+
+private:
+    //! Object to capture traffic.
+    std::shared_ptr<TrafficCapture> capture_;
+
+    //! ID of the connection.
+    std::uint32_t connection_id_;
+};
+
+}  // namespace msgpack_rpc::transport
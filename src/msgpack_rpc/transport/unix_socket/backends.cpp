@@ -27,6 +27,7 @@
 #include <utility>
 
 #include "msgpack_rpc/transport/i_backend.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 #include "msgpack_rpc/transport/unix_socket/unix_socket_backend.h"
 
 namespace msgpack_rpc::transport {
@@ -34,9 +35,10 @@ namespace msgpack_rpc::transport {
 std::shared_ptr<IBackend> create_unix_socket_backend(
     const std::shared_ptr<executors::IExecutor>& executor,
     const config::MessageParserConfig& message_parser_config,
-    std::shared_ptr<logging::Logger> logger) {
-    return std::make_shared<unix_socket::UnixSocketBackend>(
-        executor, message_parser_config, std::move(logger));
+    std::shared_ptr<logging::Logger> logger,
+    std::shared_ptr<TrafficCapture> traffic_capture) {
+    return std::make_shared<unix_socket::UnixSocketBackend>(executor,
+        message_parser_config, std::move(traffic_capture), std::move(logger));
 }
 
 }  // namespace msgpack_rpc::transport
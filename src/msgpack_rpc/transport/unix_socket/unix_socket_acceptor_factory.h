@@ -34,12 +34,15 @@
 
 #include "msgpack_rpc/addresses/unix_socket_address.h"
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/socket_config.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/transport/acceptor.h"
 #include "msgpack_rpc/transport/i_acceptor.h"
 #include "msgpack_rpc/transport/i_acceptor_factory.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 #include "msgpack_rpc/transport/unix_socket/unix_socket_acceptor.h"
 
 namespace msgpack_rpc::transport::unix_socket {
@@ -62,14 +65,18 @@ public:
      *
      * \param[in] executor Executor.
      * \param[in] message_parser_config Configuration of parsers of messages.
+     * \param[in] traffic_capture Object to capture traffic. (Null to disable
+     * capture.)
      * \param[in] logger Logger.
      * \param[in] scheme Scheme.
      */
     UnixSocketAcceptorFactory(std::shared_ptr<executors::IExecutor> executor,
         const config::MessageParserConfig& message_parser_config,
+        std::shared_ptr<TrafficCapture> traffic_capture,
         std::shared_ptr<logging::Logger> logger, std::string_view scheme)
         : executor_(std::move(executor)),
           message_parser_config_(message_parser_config),
+          traffic_capture_(std::move(traffic_capture)),
           scheme_(scheme),
           log_name_(fmt::format("AcceptorFactory({})", scheme_)),
           logger_(std::move(logger)) {}
@@ -79,8 +86,9 @@ public:
         const addresses::URI& uri) override {
         const ConcreteAddress local_address(uri.host_or_path());
         return std::vector<std::shared_ptr<IAcceptor>>{
-            std::make_shared<AcceptorType>(
-                local_address, executor_, message_parser_config_, logger_)};
+            std::make_shared<AcceptorType>(local_address, executor_,
+                message_parser_config_, config::SocketConfig(),
+                config::CompressionConfig(), traffic_capture_, logger_)};
     }
 
 private:
@@ -90,6 +98,9 @@ private:
     //! Configuration of parsers of messages.
     config::MessageParserConfig message_parser_config_;
 
+    //! Object to capture traffic. (Null if capture is disabled.)
+    std::shared_ptr<TrafficCapture> traffic_capture_;
+
     //! Scheme.
     std::string scheme_;
 
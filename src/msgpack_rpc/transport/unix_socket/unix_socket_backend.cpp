@@ -40,9 +40,11 @@ namespace msgpack_rpc::transport::unix_socket {
 UnixSocketBackend::UnixSocketBackend(
     const std::shared_ptr<executors::IExecutor>& executor,
     const config::MessageParserConfig& message_parser_config,
+    std::shared_ptr<TrafficCapture> traffic_capture,
     std::shared_ptr<logging::Logger> logger)
     : executor_(executor),
       message_parser_config_(message_parser_config),
+      traffic_capture_(std::move(traffic_capture)),
       logger_(std::move(logger)) {}
 
 std::string_view UnixSocketBackend::scheme() const noexcept {
@@ -51,12 +53,14 @@ std::string_view UnixSocketBackend::scheme() const noexcept {
 
 std::shared_ptr<IAcceptorFactory> UnixSocketBackend::create_acceptor_factory() {
     return std::make_shared<UnixSocketAcceptorFactory>(executor(),
-        message_parser_config_, logger_, addresses::UNIX_SOCKET_SCHEME);
+        message_parser_config_, traffic_capture_, logger_,
+        addresses::UNIX_SOCKET_SCHEME);
 }
 
 std::shared_ptr<IConnector> UnixSocketBackend::create_connector() {
     return std::make_shared<UnixSocketConnector>(executor(),
-        message_parser_config_, logger_, addresses::UNIX_SOCKET_SCHEME);
+        message_parser_config_, traffic_capture_, logger_,
+        addresses::UNIX_SOCKET_SCHEME);
 }
 
 UnixSocketBackend::~UnixSocketBackend() noexcept = default;
@@ -32,6 +32,7 @@
 #include "msgpack_rpc/transport/i_acceptor_factory.h"
 #include "msgpack_rpc/transport/i_backend.h"
 #include "msgpack_rpc/transport/i_connector.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport::unix_socket {
 
@@ -45,10 +46,13 @@ public:
      *
      * \param[in] executor Executor.
      * \param[in] message_parser_config Configuration of parsers of messages.
+     * \param[in] traffic_capture Object to capture traffic. (Null to disable
+     * capture.)
      * \param[in] logger Logger.
      */
     UnixSocketBackend(const std::shared_ptr<executors::IExecutor>& executor,
         const config::MessageParserConfig& message_parser_config,
+        std::shared_ptr<TrafficCapture> traffic_capture,
         std::shared_ptr<logging::Logger> logger);
 
     //! \copydoc msgpack_rpc::transport::IBackend::scheme
@@ -83,6 +87,9 @@ private:
     //! Configuration of parsers of messages.
     config::MessageParserConfig message_parser_config_;
 
+    //! Object to capture traffic. (Null if capture is disabled.)
+    std::shared_ptr<TrafficCapture> traffic_capture_;
+
     //! Logger.
     std::shared_ptr<logging::Logger> logger_;
 };
@@ -40,12 +40,14 @@
 #include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/executors/operation_type.h"
 #include "msgpack_rpc/logging/logger.h"
 #include "msgpack_rpc/transport/connection.h"
 #include "msgpack_rpc/transport/i_connector.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
 
 namespace msgpack_rpc::transport::unix_socket {
 
@@ -73,14 +75,18 @@ public:
      *
      * \param[in] executor Executor.
      * \param[in] message_parser_config Configuration of parsers of messages.
+     * \param[in] traffic_capture Object to capture traffic. (Null to disable
+     * capture.)
      * \param[in] logger Logger.
      * \param[in] scheme Scheme.
      */
     UnixSocketConnector(const std::shared_ptr<executors::IExecutor>& executor,
         const config::MessageParserConfig& message_parser_config,
+        std::shared_ptr<TrafficCapture> traffic_capture,
         std::shared_ptr<logging::Logger> logger, std::string_view scheme)
         : executor_(executor),
           message_parser_config_(message_parser_config),
+          traffic_capture_(std::move(traffic_capture)),
           scheme_(scheme),
           log_name_(fmt::format("Connector({})", scheme_)),
           logger_(std::move(logger)) {}
@@ -128,8 +134,9 @@ private:
         MSGPACK_RPC_TRACE(logger_, "({}) Connected to {}.", log_name_,
             fmt::streamed(asio_address));
 
-        auto connection = std::make_shared<ConnectionType>(
-            std::move(socket), message_parser_config_, logger_);
+        auto connection = std::make_shared<ConnectionType>(std::move(socket),
+            message_parser_config_, config::CompressionConfig(),
+            traffic_capture_, logger_);
         on_connected(Status(), std::move(connection));
     }
 
@@ -155,6 +162,9 @@ private:
     //! Configuration of parsers of messages.
     config::MessageParserConfig message_parser_config_;
 
+    //! Object to capture traffic. (Null if capture is disabled.)
+    std::shared_ptr<TrafficCapture> traffic_capture_;
+
     //! Scheme.
     std::string scheme_;
 
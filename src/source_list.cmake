@@ -7,27 +7,50 @@ set(SOURCE_FILES
     msgpack_rpc/common/msgpack_rpc_exception.cpp
     msgpack_rpc/common/status.cpp
     msgpack_rpc/common/status_code.cpp
+    msgpack_rpc/config/admission_control_config.cpp
     msgpack_rpc/config/client_config.cpp
+    msgpack_rpc/config/compression_config.cpp
     msgpack_rpc/config/config_parser.cpp
     msgpack_rpc/config/executor_config.cpp
+    msgpack_rpc/config/flow_control_config.cpp
     msgpack_rpc/config/logging_config.cpp
     msgpack_rpc/config/message_parser_config.cpp
+    msgpack_rpc/config/notification_queue_config.cpp
     msgpack_rpc/config/reconnection_config.cpp
+    msgpack_rpc/config/response_cache_config.cpp
     msgpack_rpc/config/server_config.cpp
+    msgpack_rpc/config/socket_config.cpp
     msgpack_rpc/config/toml/parse_toml.cpp
+    msgpack_rpc/config/traffic_capture_config.cpp
     msgpack_rpc/executors/general_executor.cpp
     msgpack_rpc/executors/single_thread_executor.cpp
     msgpack_rpc/executors/wrapping_executor.cpp
     msgpack_rpc/logging/log_sinks.cpp
+    msgpack_rpc/messages/impl/message_compression.cpp
+    msgpack_rpc/messages/impl/message_framer.cpp
+    msgpack_rpc/messages/impl/raw_message_scanner.cpp
     msgpack_rpc/messages/impl/serialization_buffer.cpp
     msgpack_rpc/messages/message_parser.cpp
     msgpack_rpc/messages/message_type.cpp
+    msgpack_rpc/messages/raw_message.cpp
+    msgpack_rpc/messages/raw_message_parser.cpp
+    msgpack_rpc/messages/raw_result.cpp
     msgpack_rpc/messages/serialized_message.cpp
+    msgpack_rpc/methods/batch_method_options.cpp
+    msgpack_rpc/methods/cancellation_token.cpp
+    msgpack_rpc/methods/method_cache.cpp
+    msgpack_rpc/methods/method_cache_options.cpp
     msgpack_rpc/methods/method_exception.cpp
     msgpack_rpc/methods/method_processor.cpp
+    msgpack_rpc/methods/request_deadline.cpp
+    msgpack_rpc/methods/stream_writer.cpp
+    msgpack_rpc/methods/upload_reader.cpp
+    msgpack_rpc/servers/connection_id.cpp
     msgpack_rpc/servers/impl/i_server_builder_impl.cpp
+    msgpack_rpc/transport/raw_forwarding_proxy.cpp
     msgpack_rpc/transport/tcp/backends.cpp
     msgpack_rpc/transport/tcp/tcp_backend.cpp
+    msgpack_rpc/transport/traffic_capture.cpp
     msgpack_rpc/transport/unix_socket/backends.cpp
     msgpack_rpc/transport/unix_socket/unix_socket_backend.cpp
     msgpack_rpc/util/format_msgpack_object.cpp
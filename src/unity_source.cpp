@@ -6,27 +6,50 @@
 #include "msgpack_rpc/common/msgpack_rpc_exception.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/common/status.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/common/status_code.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/config/admission_control_config.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/config/client_config.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/config/compression_config.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/config/config_parser.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/config/executor_config.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/config/flow_control_config.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/config/logging_config.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/config/message_parser_config.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/config/notification_queue_config.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/config/reconnection_config.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/config/response_cache_config.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/config/server_config.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/config/socket_config.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/config/toml/parse_toml.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/config/traffic_capture_config.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/executors/general_executor.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/executors/single_thread_executor.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/executors/wrapping_executor.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/logging/log_sinks.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/messages/impl/message_compression.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/messages/impl/message_framer.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/messages/impl/raw_message_scanner.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/messages/impl/serialization_buffer.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/messages/message_parser.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/messages/message_type.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/messages/raw_message.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/messages/raw_message_parser.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/messages/raw_result.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/messages/serialized_message.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/methods/batch_method_options.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/methods/cancellation_token.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/methods/method_cache.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/methods/method_cache_options.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/methods/method_exception.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/methods/method_processor.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/methods/request_deadline.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/methods/stream_writer.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/methods/upload_reader.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/servers/connection_id.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/servers/impl/i_server_builder_impl.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/transport/raw_forwarding_proxy.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/transport/tcp/backends.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/transport/tcp/tcp_backend.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "msgpack_rpc/transport/traffic_capture.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/transport/unix_socket/backends.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/transport/unix_socket/unix_socket_backend.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "msgpack_rpc/util/format_msgpack_object.cpp"  // NOLINT(bugprone-suspicious-include)
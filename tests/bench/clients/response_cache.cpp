@@ -0,0 +1,133 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmark of caches of responses in clients.
+ */
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <msgpack.hpp>
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/plot_option.h>
+
+#include "msgpack_rpc/clients/impl/response_cache.h"
+#include "msgpack_rpc/config/response_cache_config.h"
+#include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+
+using msgpack_rpc::clients::impl::MethodResponseCache;
+
+class ResponseCacheFixture : public stat_bench::FixtureBase {
+public:
+    ResponseCacheFixture() {
+        this->add_param<std::size_t>("entries")
+            ->add(16)    // NOLINT
+            ->add(1024)  // NOLINT
+#ifdef NDEBUG
+            ->add(65536)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        max_entries_ = context.get_param<std::size_t>("entries");
+
+        cache_ = std::make_unique<MethodResponseCache>(
+            msgpack_rpc::config::ResponseCacheConfig()
+                .time_to_live(std::chrono::hours(1))
+                .max_entries(max_entries_));
+
+        // Twice the limit so that some keys are always out of the cache.
+        keys_.clear();
+        const std::size_t num_keys = 2U * max_entries_;
+        for (std::size_t i = 0; i < num_keys; ++i) {
+            const auto serialized =
+                msgpack_rpc::messages::MessageSerializer::
+                    serialize_notification("method", i);
+            keys_.emplace_back(serialized.data(), serialized.size());
+        }
+
+        const auto zone = std::make_shared<msgpack::zone>();
+        const auto object = msgpack::object(std::string(64, 'a'), *zone);
+        result_.emplace(
+            msgpack_rpc::messages::CallResult::create_result(object, zone));
+
+        now_ = MethodResponseCache::Clock::now();
+        for (std::size_t i = 0; i < max_entries_; ++i) {
+            cache_->insert(keys_[i], *result_, now_);
+        }
+    }
+
+    void tear_down(stat_bench::InvocationContext& /*context*/) override {
+        // Check that the memory is bounded by the limit of entries.
+        if (cache_->statistics().num_entries() > max_entries_) {
+            throw std::runtime_error("Too many entries in a cache.");
+        }
+        cache_.reset();
+        keys_.clear();
+    }
+
+protected:
+    //! Maximum number of entries.
+    std::size_t max_entries_{};
+
+    //! Cache.
+    std::unique_ptr<MethodResponseCache> cache_{};
+
+    //! Keys.
+    std::vector<std::string> keys_{};
+
+    //! Result.
+    std::optional<msgpack_rpc::messages::CallResult> result_{};
+
+    //! Current time.
+    MethodResponseCache::Clock::time_point now_{};
+};
+
+STAT_BENCH_GROUP("response_cache")
+    .add_parameter_to_time_line_plot(
+        "entries", stat_bench::PlotOption::log_parameter);
+
+STAT_BENCH_CASE_F(ResponseCacheFixture, "response_cache", "hit") {
+    std::size_t index = 0;
+    STAT_BENCH_MEASURE() {
+        stat_bench::do_not_optimize(cache_->find(keys_[index], now_));
+        index = (index + 1U) % max_entries_;
+    };
+}
+
+STAT_BENCH_CASE_F(ResponseCacheFixture, "response_cache", "miss_and_insert") {
+    // Keys are used cyclically, so every key has been evicted when used.
+    std::size_t index = max_entries_;
+    STAT_BENCH_MEASURE() {
+        const auto& key = keys_[index];
+        if (!cache_->find(key, now_)) {
+            cache_->insert(key, *result_, now_);
+        }
+        index = (index + 1U) % keys_.size();
+    };
+}
+
+STAT_BENCH_MAIN
@@ -47,24 +47,44 @@ def run(build_dir_str: str, samples: int) -> None:
     with open(str(msgpack_output_path), mode="rb") as output_file:
         output_data = msgpack.unpack(output_file)
     protocol_list = []
+    socket_list = []
+    handler_list = []
+    compression_list = []
     data_size_list = []
     duration_list = []
     for measurement in output_data["measurements"]:
         if measurement["measurement_type"] != "Processing Time":
             continue
         protocol = str(measurement["params"]["type"])
+        socket = str(measurement["params"]["socket"])
+        handler = str(measurement["params"]["handler"])
+        compression = str(measurement["params"]["compression"])
         data_size = str(measurement["params"]["size"])
         durations = measurement["durations"]["values"][0]
         num_samples = len(durations)
         protocol_list = protocol_list + [protocol] * num_samples
+        socket_list = socket_list + [socket] * num_samples
+        handler_list = handler_list + [handler] * num_samples
+        compression_list = compression_list + [compression] * num_samples
         data_size_list = data_size_list + [data_size] * num_samples
         duration_list = duration_list + durations
     protocol_key = "Protocol"
+    socket_key = "Socket Options"
+    handler_key = "Handler"
+    compression_key = "Compression"
+    handler_compression_key = "Handler / Compression"
     data_size_key = "Data Size [byte]"
     duration_key = "Processing Time [sec]"
     data_frame = pandas.DataFrame(
         {
             protocol_key: protocol_list,
+            socket_key: socket_list,
+            handler_key: handler_list,
+            compression_key: compression_list,
+            handler_compression_key: [
+                f"{handler} / {compression}"
+                for handler, compression in zip(handler_list, compression_list)
+            ],
             data_size_key: data_size_list,
             duration_key: duration_list,
         }
@@ -75,6 +95,8 @@ def run(build_dir_str: str, samples: int) -> None:
         x=data_size_key,
         y=duration_key,
         color=protocol_key,
+        facet_col=socket_key,
+        facet_row=handler_compression_key,
         log_y=True,
     )
     figure.write_image(str(bench_output_path / "violin.png"))
@@ -88,6 +110,8 @@ def run(build_dir_str: str, samples: int) -> None:
         x=data_size_key,
         y=duration_key,
         color=protocol_key,
+        facet_col=socket_key,
+        facet_row=handler_compression_key,
         log_y=True,
     )
     figure.write_image(str(bench_output_path / "box.png"))
@@ -0,0 +1,98 @@
+"""Execute benchmarks of latencies under loads."""
+
+import pathlib
+import subprocess
+
+import click
+import pandas
+import plotly.express
+
+MIN_RATE = 1000.0
+MAX_RATE = 10000.0
+RATES = 5
+DURATION = 3.0
+
+
+@click.command()
+@click.option("-b", "--build-dir", "build_dir_str", required=True)
+@click.option("--min-rate", "min_rate", default=MIN_RATE, type=float)
+@click.option("--max-rate", "max_rate", default=MAX_RATE, type=float)
+@click.option("--rates", "rates", default=RATES, type=int)
+@click.option("--duration", "duration", default=DURATION, type=float)
+def run(
+    build_dir_str: str,
+    min_rate: float,
+    max_rate: float,
+    rates: int,
+    duration: float,
+) -> None:
+    build_dir_path = pathlib.Path(build_dir_str).absolute()
+    bin_dir_path = build_dir_path / "bin"
+    server_path = bin_dir_path / "bench_echo_server"
+    client_path = bin_dir_path / "bench_echo_client_load"
+    bench_output_path = build_dir_path / "bench" / "echo_load"
+    csv_output_path = bench_output_path / "result.csv"
+
+    bench_output_path.mkdir(parents=True, exist_ok=True)
+
+    server_process = subprocess.Popen([str(server_path)])
+    try:
+        subprocess.run(
+            [
+                str(client_path),
+                "--min-rate",
+                str(min_rate),
+                "--max-rate",
+                str(max_rate),
+                "--rates",
+                str(rates),
+                "--duration",
+                str(duration),
+                "--output",
+                str(csv_output_path),
+            ],
+            check=True,
+        )
+    finally:
+        server_process.terminate()
+        server_process.wait(1)
+        assert server_process.returncode == 0
+
+    data_frame = pandas.read_csv(str(csv_output_path))
+
+    protocol_key = "Protocol"
+    throughput_key = "Throughput [req/sec]"
+    percentile_key = "Percentile"
+    corrected_key = "Corrected Latency [sec]"
+    uncorrected_key = "Uncorrected Latency [sec]"
+    latency_type_key = "Latency Type"
+    latency_key = "Latency [sec]"
+
+    data_frame[percentile_key] = data_frame[percentile_key].astype(str)
+    data_frame = data_frame.melt(
+        id_vars=[protocol_key, throughput_key, percentile_key],
+        value_vars=[corrected_key, uncorrected_key],
+        var_name=latency_type_key,
+        value_name=latency_key,
+    )
+
+    figure = plotly.express.line(
+        data_frame,
+        x=throughput_key,
+        y=latency_key,
+        color=percentile_key,
+        facet_col=protocol_key,
+        facet_row=latency_type_key,
+        markers=True,
+        log_y=True,
+        width=1000,
+    )
+    figure.write_html(
+        str(bench_output_path / "latency.html"),
+        include_plotlyjs="cdn",
+    )
+    figure.write_image(str(bench_output_path / "latency.png"))
+
+
+if __name__ == "__main__":
+    run()
@@ -20,6 +20,7 @@
 #include "msgpack_rpc/clients/client.h"
 
 #include <cstdlib>
+#include <random>
 #include <string>
 
 #include <stat_bench/benchmark_macros.h>
@@ -33,6 +34,7 @@
 #include "common.h"
 #include "msgpack_rpc/clients/client_builder.h"
 #include "msgpack_rpc/config.h"
+#include "msgpack_rpc/config/client_config.h"
 
 class EchoFixture : public stat_bench::FixtureBase {
 public:
@@ -44,6 +46,15 @@ public:
             ->add("Unix")
 #endif
             ;
+        this->add_param<std::string>("socket")
+            ->add("default")
+            ->add("nagle")
+            ->add("tuned");
+        this->add_param<std::string>("handler")->add("copy")->add("view");
+        this->add_param<std::string>("compression")
+            ->add("off")
+            ->add("repetitive")
+            ->add("random");
         this->add_param<std::size_t>("size")
             ->add(0)
             ->add(1)
@@ -73,34 +84,101 @@ public:
             std::abort();
         }
 
+        const auto socket_profile_str =
+            context.get_param<std::string>("socket");
+        if (socket_profile_str == "default") {
+            socket_profile_ = msgpack_rpc_test::SocketProfile::DEFAULT;
+        } else if (socket_profile_str == "nagle") {
+            socket_profile_ = msgpack_rpc_test::SocketProfile::NAGLE;
+        } else if (socket_profile_str == "tuned") {
+            socket_profile_ = msgpack_rpc_test::SocketProfile::TUNED;
+        } else {
+            // This won't be executed unless a bug exists.
+            std::abort();
+        }
+
+        const auto compression_profile_str =
+            context.get_param<std::string>("compression");
+        if (compression_profile_str == "off") {
+            compression_profile_ = msgpack_rpc_test::CompressionProfile::OFF;
+        } else if (compression_profile_str == "repetitive") {
+            compression_profile_ =
+                msgpack_rpc_test::CompressionProfile::REPETITIVE;
+        } else if (compression_profile_str == "random") {
+            compression_profile_ = msgpack_rpc_test::CompressionProfile::RANDOM;
+        } else {
+            // This won't be executed unless a bug exists.
+            std::abort();
+        }
+
         auto command_client =
             msgpack_rpc::clients::ClientBuilder()
                 .connect_to(msgpack_rpc_test::COMMAND_SERVER_URI)
                 .build();
         server_uri_ = command_client.call<std::string>(
-            "prepare", static_cast<int>(server_type_));
+            "prepare", static_cast<int>(server_type_),
+            static_cast<int>(socket_profile_),
+            static_cast<int>(compression_profile_));
+
+        const auto handler_str = context.get_param<std::string>("handler");
+        if (handler_str == "copy") {
+            method_name_ = "echo";
+        } else if (handler_str == "view") {
+            method_name_ = "echo_view";
+        } else {
+            // This won't be executed unless a bug exists.
+            std::abort();
+        }
 
         data_size_ = context.get_param<std::size_t>("size");
     }
 
     [[nodiscard]] msgpack_rpc::clients::Client prepare_client() const {
-        auto client = msgpack_rpc::clients::ClientBuilder()
+        msgpack_rpc::config::ClientConfig client_config;
+        msgpack_rpc_test::apply_socket_profile(
+            socket_profile_, client_config.socket());
+        msgpack_rpc_test::apply_compression_profile(
+            compression_profile_, client_config.compression());
+        auto client = msgpack_rpc::clients::ClientBuilder(client_config)
                           .connect_to(server_uri_)
                           .build();
         return client;
     }
 
     [[nodiscard]] std::string create_data() const {
-        return std::string(data_size_, 'a');
+        if (compression_profile_ !=
+            msgpack_rpc_test::CompressionProfile::RANDOM) {
+            return std::string(data_size_, 'a');
+        }
+        std::mt19937 engine;  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+        std::uniform_int_distribution<int> dist(0, 255);  // NOLINT
+        std::string data(data_size_, '\0');
+        for (char& c : data) {
+            c = static_cast<char>(dist(engine));
+        }
+        return data;
+    }
+
+    [[nodiscard]] const std::string& method_name() const noexcept {
+        return method_name_;
     }
 
 private:
     //! Type of the server.
     msgpack_rpc_test::ServerType server_type_{};
 
+    //! Profile of socket options.
+    msgpack_rpc_test::SocketProfile socket_profile_{};
+
+    //! Profile of compression.
+    msgpack_rpc_test::CompressionProfile compression_profile_{};
+
     //! URI of the server.
     std::string server_uri_{};
 
+    //! Name of the method to call.
+    std::string method_name_{};
+
     //! Size of the data.
     std::size_t data_size_{};
 };
@@ -122,7 +200,8 @@ STAT_BENCH_CASE_F(EchoFixture, "echo", "echo") {
     const auto data = create_data();
 
     STAT_BENCH_MEASURE() {
-        stat_bench::do_not_optimize(client.call<std::string>("echo", data));
+        stat_bench::do_not_optimize(
+            client.call<std::string>(method_name(), data));
     };
 }
 
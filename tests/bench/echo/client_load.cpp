@@ -0,0 +1,499 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of open-loop load generators for benchmarks.
+ *
+ * Requests are issued at a fixed arrival rate regardless of responses, and
+ * latencies are measured from the times when requests were scheduled to be
+ * sent, so that queueing delays in clients are not omitted (coordinated
+ * omission).
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <lyra/lyra.hpp>
+
+#include "common.h"
+#include "latency_histogram.h"
+#include "msgpack_rpc/clients/call_future.h"
+#include "msgpack_rpc/clients/client.h"
+#include "msgpack_rpc/clients/client_builder.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/config.h"
+#include "msgpack_rpc/config/client_config.h"
+
+namespace {
+
+/*!
+ * \brief Struct of parameters of loads.
+ */
+struct LoadParameters {
+    //! Rate of requests in all connections. [req/sec]
+    double rate;
+
+    //! Duration to issue requests.
+    std::chrono::nanoseconds duration;
+
+    //! Data sent in requests.
+    std::string data;
+
+    //! Timeout of each request.
+    std::chrono::nanoseconds timeout;
+};
+
+/*!
+ * \brief Struct of results of loads.
+ */
+struct LoadResult {
+    //! Latencies measured from the scheduled times of requests.
+    msgpack_rpc_test::LatencyHistogram corrected_latencies{};
+
+    //! Latencies measured from the actual times of requests.
+    msgpack_rpc_test::LatencyHistogram uncorrected_latencies{};
+
+    //! Number of failed requests.
+    std::uint64_t num_errors{0};
+
+    //! Time when the last response was received.
+    std::chrono::steady_clock::time_point last_response_time{};
+
+    /*!
+     * \brief Add another result.
+     *
+     * \param[in] other Another result.
+     */
+    void merge(const LoadResult& other) {
+        corrected_latencies.merge(other.corrected_latencies);
+        uncorrected_latencies.merge(other.uncorrected_latencies);
+        num_errors += other.num_errors;
+        last_response_time =
+            std::max(last_response_time, other.last_response_time);
+    }
+};
+
+/*!
+ * \brief Struct of requests waiting for responses.
+ */
+struct PendingCall {
+    //! Time when the request was scheduled to be sent.
+    std::chrono::steady_clock::time_point scheduled_time;
+
+    //! Time when the request was actually sent.
+    std::chrono::steady_clock::time_point sent_time;
+
+    //! Future of the response.
+    msgpack_rpc::clients::CallFuture<std::string> future;
+
+    //! Time when the RPC finished.
+    std::chrono::steady_clock::time_point finished_time{};
+};
+
+/*!
+ * \brief Class of workers issuing requests to some connections.
+ *
+ * Requests are issued at the scheduled times, and the time when each RPC
+ * finishes is recorded by a completion handler of the RPC, so that responses
+ * are measured independently of the order of requests.
+ *
+ * \note Failed RPCs are recorded at the timeout in the histograms of
+ * latencies, so that failures are not omitted from percentiles.
+ */
+class LoadWorker {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] clients Clients used in this worker.
+     * \param[in] params Parameters.
+     * \param[in] start_time Time to start issuing requests.
+     * \param[in] interval Interval of requests in this worker.
+     */
+    LoadWorker(std::vector<msgpack_rpc::clients::Client*> clients,
+        const LoadParameters& params,
+        std::chrono::steady_clock::time_point start_time,
+        std::chrono::nanoseconds interval)
+        : clients_(std::move(clients)),
+          params_(params),
+          start_time_(start_time),
+          interval_(interval) {}
+
+    /*!
+     * \brief Run this worker and wait for all responses.
+     *
+     * \return Result.
+     */
+    [[nodiscard]] LoadResult run() {
+        send();
+        wait();
+        return summarize();
+    }
+
+private:
+    /*!
+     * \brief Issue requests.
+     */
+    void send() {
+        const auto end_time = start_time_ + params_.duration;
+        std::size_t client_index = 0;
+        for (std::uint64_t i = 0;; ++i) {
+            const auto scheduled_time = start_time_ +
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    interval_ * i);
+            if (scheduled_time >= end_time) {
+                break;
+            }
+            // When this thread is behind the schedule, requests are sent
+            // immediately without skipping them.
+            std::this_thread::sleep_until(scheduled_time);
+
+            const auto sent_time = std::chrono::steady_clock::now();
+            auto future = clients_[client_index]->async_call<std::string>(
+                "echo", params_.data);
+            client_index = (client_index + 1U) % clients_.size();
+
+            // Elements of std::deque are not moved by push_back function.
+            PendingCall& call = pending_calls_.emplace_back(
+                PendingCall{scheduled_time, sent_time, future});
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ++num_unfinished_calls_;
+            }
+            future.add_completion_handler([this, &call] {
+                const auto finished_time = std::chrono::steady_clock::now();
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    call.finished_time = finished_time;
+                    --num_unfinished_calls_;
+                }
+                cond_var_.notify_one();
+            });
+        }
+    }
+
+    /*!
+     * \brief Wait for all RPCs to finish.
+     */
+    void wait() {
+        // RPCs finish with timeouts of clients, but RPCs are cancelled after
+        // a margin to make sure that this function returns.
+        constexpr auto margin = std::chrono::seconds(1);
+        const auto deadline =
+            std::chrono::steady_clock::now() + params_.timeout + margin;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (cond_var_.wait_until(lock, deadline,
+                    [this] { return num_unfinished_calls_ == 0U; })) {
+                return;
+            }
+        }
+        for (auto& call : pending_calls_) {
+            call.future.cancel();
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_var_.wait(lock, [this] { return num_unfinished_calls_ == 0U; });
+    }
+
+    /*!
+     * \brief Summarize the results of finished RPCs.
+     *
+     * \return Result.
+     */
+    [[nodiscard]] LoadResult summarize() {
+        LoadResult result;
+        for (auto& call : pending_calls_) {
+            try {
+                // The RPC has already finished, so this doesn't wait.
+                (void)call.future.get_result_within(
+                    std::chrono::nanoseconds(0));
+            } catch (const msgpack_rpc::MsgpackRPCException& /*e*/) {
+                ++result.num_errors;
+                result.corrected_latencies.record(params_.timeout);
+                result.uncorrected_latencies.record(params_.timeout);
+                continue;
+            }
+            result.corrected_latencies.record(
+                call.finished_time - call.scheduled_time);
+            result.uncorrected_latencies.record(
+                call.finished_time - call.sent_time);
+            result.last_response_time =
+                std::max(result.last_response_time, call.finished_time);
+        }
+        return result;
+    }
+
+    //! Clients.
+    std::vector<msgpack_rpc::clients::Client*> clients_;
+
+    //! Parameters.
+    const LoadParameters& params_;
+
+    //! Time to start issuing requests.
+    std::chrono::steady_clock::time_point start_time_;
+
+    //! Interval of requests.
+    std::chrono::nanoseconds interval_;
+
+    //! Requests issued in this worker.
+    std::deque<PendingCall> pending_calls_{};
+
+    //! Mutex of the states of RPCs.
+    std::mutex mutex_{};
+
+    //! Condition variable to notify finished RPCs.
+    std::condition_variable cond_var_{};
+
+    //! Number of RPCs not finished yet.
+    std::size_t num_unfinished_calls_{0};
+};
+
+/*!
+ * \brief Apply a load to a server.
+ *
+ * \param[in] clients Clients. (One connection for each client.)
+ * \param[in] num_threads Number of threads to issue requests.
+ * \param[in] params Parameters.
+ * \param[out] throughput Throughput. [req/sec]
+ * \return Result.
+ */
+[[nodiscard]] LoadResult apply_load(
+    std::vector<msgpack_rpc::clients::Client>& clients,
+    std::size_t num_threads, const LoadParameters& params,
+    double& throughput) {
+    const auto interval = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>(
+            static_cast<double>(num_threads) / params.rate));
+    constexpr auto start_delay = std::chrono::milliseconds(10);
+    const auto start_time = std::chrono::steady_clock::now() + start_delay;
+
+    std::vector<std::unique_ptr<LoadWorker>> workers;
+    for (std::size_t t = 0; t < num_threads; ++t) {
+        std::vector<msgpack_rpc::clients::Client*> worker_clients;
+        for (std::size_t c = t; c < clients.size(); c += num_threads) {
+            worker_clients.push_back(&clients[c]);
+        }
+        // Threads start at different offsets so that requests of all threads
+        // arrive at a uniform rate.
+        const auto worker_start_time = start_time +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                interval * t / num_threads);
+        workers.push_back(std::make_unique<LoadWorker>(
+            std::move(worker_clients), params, worker_start_time, interval));
+    }
+
+    std::vector<LoadResult> results(num_threads);
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back(
+            [&results, &workers, t] { results[t] = workers[t]->run(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    LoadResult result;
+    for (const auto& worker_result : results) {
+        result.merge(worker_result);
+    }
+    const double duration_sec =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            result.last_response_time - start_time)
+            .count();
+    // Histograms of latencies include failed RPCs recorded at the timeout.
+    const std::uint64_t num_responses =
+        result.corrected_latencies.total_count() - result.num_errors;
+    throughput = (duration_sec > 0.0)
+        ? static_cast<double>(num_responses) / duration_sec
+        : 0.0;
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    constexpr double default_min_rate = 1000.0;
+    constexpr double default_max_rate = 10000.0;
+    constexpr std::size_t default_num_rates = 5;
+    constexpr double default_duration_sec = 3.0;
+    constexpr std::size_t default_num_connections = 4;
+    constexpr std::size_t default_num_threads = 2;
+    constexpr std::size_t default_data_size = 1024;
+    double min_rate = default_min_rate;
+    double max_rate = default_max_rate;
+    std::size_t num_rates = default_num_rates;
+    double duration_sec = default_duration_sec;
+    std::size_t num_connections = default_num_connections;
+    std::size_t num_threads = default_num_threads;
+    std::size_t data_size = default_data_size;
+    std::string output_file_path;
+    const auto cli =
+        lyra::cli()
+            .add_argument(lyra::opt(min_rate, "Rate")
+                    .name("--min-rate")
+                    .help("Set the minimum rate of requests. [req/sec]"))
+            .add_argument(lyra::opt(max_rate, "Rate")
+                    .name("--max-rate")
+                    .help("Set the maximum rate of requests. [req/sec]"))
+            .add_argument(lyra::opt(num_rates, "Number of rates")
+                    .name("--rates")
+                    .help("Set the number of rates between the minimum and "
+                          "maximum rates in a logarithmic scale."))
+            .add_argument(lyra::opt(duration_sec, "Duration")
+                    .name("--duration")
+                    .help("Set the duration of each rate in seconds."))
+            .add_argument(lyra::opt(num_connections, "Number of connections")
+                    .name("--connections")
+                    .help("Set the number of connections."))
+            .add_argument(lyra::opt(num_threads, "Number of threads")
+                    .name("--threads")
+                    .help("Set the number of threads to issue requests."))
+            .add_argument(lyra::opt(data_size, "Data size")
+                    .name("--size")
+                    .help("Set the size of data in requests. [byte]"))
+            .add_argument(lyra::opt(output_file_path, "File path")
+                    .name("--output")
+                    .required()
+                    .help("Set the file path of the output."));
+    const auto result = cli.parse({argc, argv});
+    if (!result) {
+        std::cerr << result.message() << "\n\n" << cli << std::endl;
+        return 1;
+    }
+    if (min_rate <= 0.0 || max_rate < min_rate || num_rates == 0U ||
+        duration_sec <= 0.0 || num_connections == 0U || num_threads == 0U ||
+        num_threads > num_connections) {
+        std::cerr << "Invalid parameters.\n\n" << cli << std::endl;
+        return 1;
+    }
+
+    const std::vector<msgpack_rpc_test::ServerType> server_types{
+        msgpack_rpc_test::ServerType::TCP4, msgpack_rpc_test::ServerType::TCP6
+#if MSGPACK_RPC_HAS_UNIX_SOCKETS
+        ,
+        msgpack_rpc_test::ServerType::UNIX_SOCKET
+#endif
+    };
+
+    std::vector<double> rates;
+    rates.reserve(num_rates);
+    for (std::size_t i = 0; i < num_rates; ++i) {
+        const double ratio = (num_rates == 1U)
+            ? 0.0
+            : static_cast<double>(i) / static_cast<double>(num_rates - 1U);
+        rates.push_back(min_rate * std::pow(max_rate / min_rate, ratio));
+    }
+
+    constexpr auto timeout = std::chrono::seconds(10);
+    LoadParameters params{0.0,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double>(duration_sec)),
+        std::string(data_size, 'a'), timeout};
+
+    constexpr double percent50 = 50.0;
+    constexpr double percent90 = 90.0;
+    constexpr double percent99 = 99.0;
+    constexpr double percent999 = 99.9;
+    constexpr double percent100 = 100.0;
+    const std::vector<double> percents{
+        percent50, percent90, percent99, percent999, percent100};
+
+    auto command_client = msgpack_rpc::clients::ClientBuilder()
+                              .connect_to(msgpack_rpc_test::COMMAND_SERVER_URI)
+                              .build();
+
+    std::ofstream output(output_file_path);
+    fmt::print(output,
+        "Protocol,Target Rate [req/sec],Throughput [req/sec],Errors,"
+        "Percentile,Corrected Latency [sec],Uncorrected Latency [sec]\n");
+
+    for (const msgpack_rpc_test::ServerType server_type : server_types) {
+        const std::string server_uri = command_client.call<std::string>(
+            "prepare", static_cast<int>(server_type),
+            static_cast<int>(msgpack_rpc_test::SocketProfile::DEFAULT),
+            static_cast<int>(msgpack_rpc_test::CompressionProfile::OFF));
+
+        std::vector<msgpack_rpc::clients::Client> clients;
+        clients.reserve(num_connections);
+        for (std::size_t i = 0; i < num_connections; ++i) {
+            clients.push_back(
+                msgpack_rpc::clients::ClientBuilder(
+                    msgpack_rpc::config::ClientConfig().call_timeout(timeout))
+                    .connect_to(server_uri)
+                    .build());
+        }
+
+        std::string_view server_type_str;
+        switch (server_type) {
+        case msgpack_rpc_test::ServerType::TCP4:
+            server_type_str = "TCPv4";
+            break;
+        case msgpack_rpc_test::ServerType::TCP6:
+            server_type_str = "TCPv6";
+            break;
+        case msgpack_rpc_test::ServerType::UNIX_SOCKET:
+            server_type_str = "Unix";
+            break;
+        }
+
+        for (const double rate : rates) {
+            params.rate = rate;
+            double throughput = 0.0;
+            const LoadResult load_result =
+                apply_load(clients, num_threads, params, throughput);
+
+            fmt::print("{}: target={:.0f} req/sec, throughput={:.0f} req/sec, "
+                       "errors={}, p99={:.3f} ms (uncorrected: {:.3f} ms)\n",
+                server_type_str, rate, throughput, load_result.num_errors,
+                std::chrono::duration_cast<
+                    std::chrono::duration<double, std::milli>>(
+                    load_result.corrected_latencies.percentile(percent99))
+                    .count(),
+                std::chrono::duration_cast<
+                    std::chrono::duration<double, std::milli>>(
+                    load_result.uncorrected_latencies.percentile(percent99))
+                    .count());
+            for (const double percent : percents) {
+                fmt::print(output, "{},{},{},{},{},{},{}\n", server_type_str,
+                    rate, throughput, load_result.num_errors, percent,
+                    std::chrono::duration_cast<std::chrono::duration<double>>(
+                        load_result.corrected_latencies.percentile(percent))
+                        .count(),
+                    std::chrono::duration_cast<std::chrono::duration<double>>(
+                        load_result.uncorrected_latencies.percentile(percent))
+                        .count());
+            }
+        }
+    }
+
+    return 0;
+}
@@ -86,7 +86,9 @@ int main(int argc, char** argv) {
 
     for (const msgpack_rpc_test::ServerType server_type : server_types) {
         const std::string server_uri = command_client.call<std::string>(
-            "prepare", static_cast<int>(server_type));
+            "prepare", static_cast<int>(server_type),
+            static_cast<int>(msgpack_rpc_test::SocketProfile::DEFAULT),
+            static_cast<int>(msgpack_rpc_test::CompressionProfile::OFF));
         auto client = msgpack_rpc::clients::ClientBuilder()
                           .connect_to(server_uri)
                           .build();
@@ -19,8 +19,13 @@
  */
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <string_view>
 
+#include "msgpack_rpc/config/compression_config.h"
+#include "msgpack_rpc/config/socket_config.h"
+
 namespace msgpack_rpc_test {
 
 /*!
@@ -44,4 +49,70 @@ enum class ServerType {
     UNIX_SOCKET,
 };
 
+/*!
+ * \brief Type of socket options for benchmarks.
+ */
+enum class SocketProfile {
+    //! Default options.
+    DEFAULT,
+
+    //! Nagle's algorithm enabled (TCP_NODELAY disabled).
+    NAGLE,
+
+    //! Options tuned for large messages and low latency.
+    TUNED,
+};
+
+/*!
+ * \brief Apply a profile of socket options to a configuration.
+ *
+ * \param[in] profile Profile.
+ * \param[out] config Configuration.
+ */
+inline void apply_socket_profile(
+    SocketProfile profile, msgpack_rpc::config::SocketConfig& config) {
+    switch (profile) {
+    case SocketProfile::DEFAULT:
+        break;
+    case SocketProfile::NAGLE:
+        config.tcp_no_delay(false);
+        break;
+    case SocketProfile::TUNED: {
+        constexpr std::size_t buffer_size = 4U * 1024U * 1024U;
+        constexpr auto busy_poll_time = std::chrono::microseconds(50);
+        config.tcp_no_delay(true)
+            .send_buffer_size(buffer_size)
+            .receive_buffer_size(buffer_size)
+            .tcp_quick_ack(true)
+            .busy_poll_time(busy_poll_time);
+        break;
+    }
+    }
+}
+
+/*!
+ * \brief Type of compression of messages and data for benchmarks.
+ */
+enum class CompressionProfile {
+    //! Compression disabled.
+    OFF,
+
+    //! Compression enabled with repetitive data, which is compressed well.
+    REPETITIVE,
+
+    //! Compression enabled with random data, which is not compressed.
+    RANDOM,
+};
+
+/*!
+ * \brief Apply a profile of compression to a configuration.
+ *
+ * \param[in] profile Profile.
+ * \param[out] config Configuration.
+ */
+inline void apply_compression_profile(CompressionProfile profile,
+    msgpack_rpc::config::CompressionConfig& config) {
+    config.enabled(profile != CompressionProfile::OFF);
+}
+
 }  // namespace msgpack_rpc_test
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of LatencyHistogram class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace msgpack_rpc_test {
+
+/*!
+ * \brief Class of histograms of latencies with bounded relative errors.
+ *
+ * Values are counted in buckets whose widths grow with values as in HDR
+ * histograms, so that the relative error of percentiles is bounded by
+ * \f$ 2^{-(\mathrm{SUB\_BUCKET\_BITS} - 1)} \f$ (less than 1%) for any range of
+ * latencies with a fixed memory usage.
+ */
+class LatencyHistogram {
+public:
+    //! Number of bits of sub-buckets.
+    static constexpr std::size_t SUB_BUCKET_BITS = 8;
+
+    //! Number of sub-buckets in the first bucket.
+    static constexpr std::uint64_t SUB_BUCKET_COUNT = std::uint64_t{1}
+        << SUB_BUCKET_BITS;
+
+    //! Number of sub-buckets in the other buckets.
+    static constexpr std::uint64_t HALF_SUB_BUCKET_COUNT =
+        SUB_BUCKET_COUNT / 2U;
+
+    //! Number of bits of values.
+    static constexpr std::size_t VALUE_BITS = 64;
+
+    /*!
+     * \brief Constructor.
+     */
+    LatencyHistogram()
+        : counts_(static_cast<std::size_t>(SUB_BUCKET_COUNT +
+              (VALUE_BITS - SUB_BUCKET_BITS) * HALF_SUB_BUCKET_COUNT)) {}
+
+    /*!
+     * \brief Record a latency.
+     *
+     * \param[in] latency Latency. Negative values are recorded as zero.
+     */
+    void record(std::chrono::nanoseconds latency) {
+        const auto value = static_cast<std::uint64_t>(
+            std::max<std::chrono::nanoseconds::rep>(latency.count(), 0));
+        ++counts_[index_of(value)];
+        ++total_count_;
+        max_value_ = std::max(max_value_, value);
+    }
+
+    /*!
+     * \brief Add counts in another histogram.
+     *
+     * \param[in] other Another histogram.
+     */
+    void merge(const LatencyHistogram& other) {
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        total_count_ += other.total_count_;
+        max_value_ = std::max(max_value_, other.max_value_);
+    }
+
+    /*!
+     * \brief Get the number of recorded latencies.
+     *
+     * \return Number of recorded latencies.
+     */
+    [[nodiscard]] std::uint64_t total_count() const noexcept {
+        return total_count_;
+    }
+
+    /*!
+     * \brief Get a percentile of latencies.
+     *
+     * \param[in] percent Percent of the percentile in [0, 100].
+     * \return Latency. (The largest value equivalent to the bucket of the
+     * percentile, and the maximum latency for 100.)
+     */
+    [[nodiscard]] std::chrono::nanoseconds percentile(double percent) const {
+        if (total_count_ == 0U) {
+            return std::chrono::nanoseconds(0);
+        }
+        constexpr double max_percent = 100.0;
+        if (percent >= max_percent) {
+            return to_duration(max_value_);
+        }
+        const auto rank = std::max<std::uint64_t>(
+            static_cast<std::uint64_t>(std::ceil(percent / max_percent *
+                static_cast<double>(total_count_))),
+            1U);
+        std::uint64_t cumulative_count = 0;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            cumulative_count += counts_[i];
+            if (cumulative_count >= rank) {
+                return to_duration(
+                    std::min(highest_equivalent_value(i), max_value_));
+            }
+        }
+        return to_duration(max_value_);
+    }
+
+private:
+    /*!
+     * \brief Get the index of the bucket of a value.
+     *
+     * \param[in] value Value.
+     * \return Index.
+     */
+    [[nodiscard]] static std::size_t index_of(std::uint64_t value) noexcept {
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<std::size_t>(value);
+        }
+        std::size_t shift = 0;
+        while ((value >> shift) >= SUB_BUCKET_COUNT) {
+            ++shift;
+        }
+        return static_cast<std::size_t>(SUB_BUCKET_COUNT +
+            (shift - 1U) * HALF_SUB_BUCKET_COUNT +
+            ((value >> shift) - HALF_SUB_BUCKET_COUNT));
+    }
+
+    /*!
+     * \brief Get the largest value in the bucket of an index.
+     *
+     * \param[in] index Index.
+     * \return Value.
+     */
+    [[nodiscard]] static std::uint64_t highest_equivalent_value(
+        std::size_t index) noexcept {
+        if (index < SUB_BUCKET_COUNT) {
+            return index;
+        }
+        const std::uint64_t offset = index - SUB_BUCKET_COUNT;
+        const std::uint64_t shift = offset / HALF_SUB_BUCKET_COUNT + 1U;
+        const std::uint64_t sub_bucket =
+            offset % HALF_SUB_BUCKET_COUNT + HALF_SUB_BUCKET_COUNT;
+        return ((sub_bucket + 1U) << shift) - 1U;
+    }
+
+    /*!
+     * \brief Convert a value to a duration.
+     *
+     * \param[in] value Value.
+     * \return Duration.
+     */
+    [[nodiscard]] static std::chrono::nanoseconds to_duration(
+        std::uint64_t value) noexcept {
+        return std::chrono::nanoseconds(
+            static_cast<std::chrono::nanoseconds::rep>(value));
+    }
+
+    //! Counts in buckets.
+    std::vector<std::uint64_t> counts_;
+
+    //! Number of recorded values.
+    std::uint64_t total_count_{0};
+
+    //! Maximum value.
+    std::uint64_t max_value_{0};
+};
+
+}  // namespace msgpack_rpc_test
@@ -0,0 +1,563 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of a tool to replay captured traffic for benchmarks.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <ratio>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <lyra/lyra.hpp>
+
+#include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status.h"
+#include "msgpack_rpc/config/executor_config.h"
+#include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/executors/i_async_executor.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/impl/raw_message_scanner.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_type.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/raw_message.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/transport/backend_list.h"
+#include "msgpack_rpc/transport/create_default_backend_list.h"
+#include "msgpack_rpc/transport/i_connection.h"
+#include "msgpack_rpc/transport/traffic_capture.h"
+
+namespace {
+
+/*!
+ * \brief Struct of messages to replay.
+ */
+struct ReplayedMessage {
+    //! Time when the message was captured.
+    std::chrono::nanoseconds timestamp;
+
+    //! ID of the connection in the capture.
+    std::uint32_t connection_id;
+
+    //! Message.
+    msgpack_rpc::messages::RawMessage message;
+};
+
+/*!
+ * \brief Load messages to replay from a file of captured traffic.
+ *
+ * Requests and notifications in the given direction are loaded in the order
+ * of capture. Responses, notifications advertising compression, and messages
+ * which cannot be scanned are skipped. (Compressed messages received are
+ * captured after decompression.)
+ *
+ * \param[in] file_path Path of the file.
+ * \param[in] direction Direction of messages to replay.
+ * \param[out] num_skipped Number of skipped messages.
+ * \return Messages.
+ */
+std::vector<ReplayedMessage> load_messages(const std::string& file_path,
+    msgpack_rpc::transport::TrafficDirection direction,
+    std::size_t& num_skipped) {
+    using msgpack_rpc::messages::MessageType;
+    using msgpack_rpc::messages::MethodNameView;
+
+    msgpack_rpc::transport::TrafficCaptureReader reader(file_path);
+    std::vector<ReplayedMessage> messages;
+    num_skipped = 0;
+    while (auto captured = reader.next()) {
+        if (captured->direction != direction) {
+            continue;
+        }
+        const std::size_t size = captured->data.size();
+        auto buffer = std::make_shared<const std::vector<char>>(
+            std::move(captured->data));
+        try {
+            auto message = msgpack_rpc::messages::impl::scan_raw_message(
+                std::move(buffer), 0, size);
+            if (message.type() == MessageType::RESPONSE ||
+                (message.type() == MessageType::NOTIFICATION &&
+                    message.method_name() ==
+                        MethodNameView(
+                            msgpack_rpc::messages::COMPRESSION_METHOD_NAME))) {
+                ++num_skipped;
+                continue;
+            }
+            messages.push_back(ReplayedMessage{captured->timestamp,
+                captured->connection_id, std::move(message)});
+        } catch (const msgpack_rpc::MsgpackRPCException& /*e*/) {
+            ++num_skipped;
+        }
+    }
+    return messages;
+}
+
+/*!
+ * \brief Class to replay messages to a server.
+ *
+ * One connection is created for each connection in the capture, and messages
+ * are sent from one thread in the order of capture, so that the order of
+ * messages in each connection and the interleaving of connections are
+ * preserved.
+ */
+class Replayer {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] logger Logger.
+     */
+    explicit Replayer(
+        const std::shared_ptr<msgpack_rpc::logging::Logger>& logger)
+        : executor_(msgpack_rpc::executors::create_executor(
+              logger, msgpack_rpc::config::ExecutorConfig())),
+          backends_(msgpack_rpc::transport::create_default_backend_list(
+              executor_, msgpack_rpc::config::MessageParserConfig(), logger)) {
+        executor_->start();
+    }
+
+    Replayer(const Replayer&) = delete;
+    Replayer(Replayer&&) = delete;
+    Replayer& operator=(const Replayer&) = delete;
+    Replayer& operator=(Replayer&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~Replayer() {
+        for (auto& [connection_id, state] : connections_) {
+            state.connection->async_close();
+        }
+        executor_->stop();
+    }
+
+    /*!
+     * \brief Connect to a server for each connection in the capture.
+     *
+     * \param[in] uri URI of the server.
+     * \param[in] messages Messages to replay.
+     */
+    void connect(const msgpack_rpc::addresses::URI& uri,
+        const std::vector<ReplayedMessage>& messages) {
+        const auto connector = backends_.find(uri.scheme())->create_connector();
+        for (const auto& message : messages) {
+            if (connections_.count(message.connection_id) > 0) {
+                continue;
+            }
+            std::promise<std::shared_ptr<msgpack_rpc::transport::IConnection>>
+                promise;
+            auto future = promise.get_future();
+            connector->async_connect(uri,
+                [&promise](const msgpack_rpc::Status& status,
+                    std::shared_ptr<msgpack_rpc::transport::IConnection>
+                        connection) {
+                    if (status.code() != msgpack_rpc::StatusCode::SUCCESS) {
+                        promise.set_exception(std::make_exception_ptr(
+                            msgpack_rpc::MsgpackRPCException(status)));
+                        return;
+                    }
+                    promise.set_value(std::move(connection));
+                });
+            auto connection = future.get();
+
+            const std::uint32_t connection_id = message.connection_id;
+            connection->start_raw(
+                [this, connection_id](
+                    msgpack_rpc::messages::RawMessage response) {
+                    on_received(connection_id, response);
+                },
+                [this, connection_id] { on_sent(connection_id); },
+                [this, connection_id](const msgpack_rpc::Status& /*status*/) {
+                    on_closed(connection_id);
+                });
+            std::unique_lock<std::mutex> lock(mutex_);
+            connections_.emplace(
+                connection_id, ConnectionState{std::move(connection)});
+        }
+    }
+
+    /*!
+     * \brief Send messages.
+     *
+     * \param[in] messages Messages.
+     * \param[in] rate Rate of replay relative to the capture. Zero sends
+     * messages at the maximum rate.
+     */
+    void send(const std::vector<ReplayedMessage>& messages, double rate) {
+        if (messages.empty()) {
+            return;
+        }
+        start_time_ = std::chrono::steady_clock::now();
+        const auto first_timestamp = messages.front().timestamp;
+        for (const auto& message : messages) {
+            if (rate > 0.0) {
+                const auto offset = std::chrono::duration_cast<
+                    std::chrono::steady_clock::duration>(
+                    (message.timestamp - first_timestamp) / rate);
+                std::this_thread::sleep_until(start_time_ + offset);
+            }
+            send(message);
+        }
+    }
+
+    /*!
+     * \brief Wait for responses.
+     *
+     * \param[in] timeout Timeout.
+     */
+    void wait(std::chrono::nanoseconds timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_var_.wait_for(lock, timeout, [this] { return num_waiting_ == 0; });
+    }
+
+    /*!
+     * \brief Write the summary of results.
+     *
+     * \param[in] num_skipped Number of messages skipped in loading.
+     *
+     * \note Requests skipped due to duplicate message IDs are counted as
+     * skipped messages too.
+     */
+    void write_summary(std::size_t num_skipped) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::sort(latencies_.begin(), latencies_.end());
+        const double duration_sec =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                last_response_time_ - start_time_)
+                .count();
+
+        fmt::print("Connections: {}\n", connections_.size());
+        fmt::print(
+            "Sent messages: {} (requests: {}, skipped: {}, duplicate request "
+            "IDs: {})\n",
+            num_sent_messages_, num_sent_requests_,
+            num_skipped + num_duplicate_requests_, num_duplicate_requests_);
+        fmt::print("Responses: {} (lost: {})\n", latencies_.size(),
+            num_sent_requests_ - latencies_.size());
+        if (latencies_.empty() || duration_sec <= 0.0) {
+            return;
+        }
+        fmt::print("Throughput: {:.1f} responses/sec\n",
+            static_cast<double>(latencies_.size()) / duration_sec);
+        constexpr double percentile50 = 0.5;
+        constexpr double percentile90 = 0.9;
+        constexpr double percentile99 = 0.99;
+        constexpr double percentile999 = 0.999;
+        fmt::print(
+            "Latency [us]: p50={:.1f}, p90={:.1f}, p99={:.1f}, p99.9={:.1f}, "
+            "max={:.1f}\n",
+            percentile(percentile50), percentile(percentile90),
+            percentile(percentile99), percentile(percentile999),
+            to_microseconds(latencies_.back()));
+    }
+
+    /*!
+     * \brief Write latencies to a file.
+     *
+     * \param[in] file_path File path.
+     */
+    void write_latencies(const std::string& file_path) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::ofstream output(file_path);
+        fmt::print(output, "Latency [sec]\n");
+        for (const auto& latency : latencies_) {
+            fmt::print(output, "{}\n",
+                std::chrono::duration_cast<std::chrono::duration<double>>(
+                    latency)
+                    .count());
+        }
+    }
+
+private:
+    /*!
+     * \brief Struct of states of connections.
+     */
+    struct ConnectionState {
+        //! Connection.
+        std::shared_ptr<msgpack_rpc::transport::IConnection> connection;
+
+        //! Time when requests waiting for responses were sent.
+        std::unordered_map<msgpack_rpc::messages::MessageID,
+            std::chrono::steady_clock::time_point>
+            waiting_requests{};
+
+        //! Messages waiting for the previous message to be sent, because
+        //! connections don't queue messages by themselves.
+        std::queue<msgpack_rpc::messages::SerializedMessage> send_queue{};
+
+        //! Whether a message is being sent.
+        bool is_sending{false};
+    };
+
+    /*!
+     * \brief Send a message.
+     *
+     * \param[in] message Message.
+     */
+    void send(const ReplayedMessage& message) {
+        std::shared_ptr<msgpack_rpc::transport::IConnection> connection;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            auto& state = connections_.at(message.connection_id);
+            if (!state.connection) {
+                return;
+            }
+            connection = state.connection;
+            if (message.message.type() ==
+                msgpack_rpc::messages::MessageType::REQUEST) {
+                const bool is_inserted =
+                    state.waiting_requests
+                        .emplace(*message.message.id(),
+                            std::chrono::steady_clock::now())
+                        .second;
+                if (!is_inserted) {
+                    // Duplicate IDs cannot be distinguished in responses.
+                    ++num_duplicate_requests_;
+                    return;
+                }
+                ++num_sent_requests_;
+                ++num_waiting_;
+            }
+            ++num_sent_messages_;
+            if (state.is_sending) {
+                state.send_queue.push(message.message.serialize());
+                return;
+            }
+            state.is_sending = true;
+        }
+        connection->async_send(message.message.serialize());
+    }
+
+    /*!
+     * \brief Handle a sent message.
+     *
+     * \param[in] connection_id ID of the connection.
+     */
+    void on_sent(std::uint32_t connection_id) {
+        std::shared_ptr<msgpack_rpc::transport::IConnection> connection;
+        std::optional<msgpack_rpc::messages::SerializedMessage> next_message;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            auto& state = connections_.at(connection_id);
+            if (state.send_queue.empty()) {
+                state.is_sending = false;
+                return;
+            }
+            connection = state.connection;
+            next_message.emplace(std::move(state.send_queue.front()));
+            state.send_queue.pop();
+        }
+        connection->async_send(*next_message);
+    }
+
+    /*!
+     * \brief Handle a received message.
+     *
+     * \param[in] connection_id ID of the connection.
+     * \param[in] message Message.
+     */
+    void on_received(std::uint32_t connection_id,
+        const msgpack_rpc::messages::RawMessage& message) {
+        if (message.type() != msgpack_rpc::messages::MessageType::RESPONSE ||
+            !message.id()) {
+            return;
+        }
+        const auto received_time = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto& waiting_requests =
+            connections_.at(connection_id).waiting_requests;
+        const auto iter = waiting_requests.find(*message.id());
+        if (iter == waiting_requests.end()) {
+            return;
+        }
+        latencies_.push_back(received_time - iter->second);
+        waiting_requests.erase(iter);
+        last_response_time_ = received_time;
+        --num_waiting_;
+        if (num_waiting_ == 0) {
+            cond_var_.notify_all();
+        }
+    }
+
+    /*!
+     * \brief Handle a closed connection.
+     *
+     * \param[in] connection_id ID of the connection.
+     */
+    void on_closed(std::uint32_t connection_id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = connections_.find(connection_id);
+        if (iter == connections_.end()) {
+            return;
+        }
+        num_waiting_ -= iter->second.waiting_requests.size();
+        iter->second.waiting_requests.clear();
+        cond_var_.notify_all();
+    }
+
+    /*!
+     * \brief Calculate a percentile of latencies.
+     *
+     * \param[in] ratio Ratio of the percentile.
+     * \return Latency in microseconds.
+     */
+    [[nodiscard]] double percentile(double ratio) const {
+        const auto rank = static_cast<std::size_t>(
+            std::ceil(ratio * static_cast<double>(latencies_.size())));
+        const std::size_t index = std::min(
+            std::max<std::size_t>(rank, 1U) - 1U, latencies_.size() - 1U);
+        return to_microseconds(latencies_[index]);
+    }
+
+    /*!
+     * \brief Convert a duration to microseconds.
+     *
+     * \param[in] duration Duration.
+     * \return Duration in microseconds.
+     */
+    [[nodiscard]] static double to_microseconds(
+        std::chrono::nanoseconds duration) {
+        return std::chrono::duration_cast<
+            std::chrono::duration<double, std::micro>>(duration)
+            .count();
+    }
+
+    //! Executor.
+    std::shared_ptr<msgpack_rpc::executors::IAsyncExecutor> executor_;
+
+    //! Backends.
+    msgpack_rpc::transport::BackendList backends_;
+
+    //! Mutex of the states.
+    std::mutex mutex_{};
+
+    //! Condition variable to wait for responses.
+    std::condition_variable cond_var_{};
+
+    //! States of connections.
+    std::unordered_map<std::uint32_t, ConnectionState> connections_{};
+
+    //! Number of sent messages.
+    std::size_t num_sent_messages_{0};
+
+    //! Number of sent requests.
+    std::size_t num_sent_requests_{0};
+
+    //! Number of requests not sent because of message IDs duplicate with
+    //! requests waiting for responses.
+    std::size_t num_duplicate_requests_{0};
+
+    //! Number of requests waiting for responses.
+    std::size_t num_waiting_{0};
+
+    //! Latencies of requests.
+    std::vector<std::chrono::nanoseconds> latencies_{};
+
+    //! Time when replay started.
+    std::chrono::steady_clock::time_point start_time_{};
+
+    //! Time when the last response was received.
+    std::chrono::steady_clock::time_point last_response_time_{};
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string capture_file_path;
+    std::string server_uri;
+    double rate = 1.0;
+    std::string direction_str = "inbound";
+    constexpr double default_timeout_sec = 60.0;
+    double timeout_sec = default_timeout_sec;
+    std::string output_file_path;
+    const auto cli =
+        lyra::cli()
+            .add_argument(lyra::opt(capture_file_path, "File path")
+                    .name("--capture")
+                    .required()
+                    .help("Set the file path of the captured traffic."))
+            .add_argument(lyra::opt(server_uri, "URI")
+                    .name("--server")
+                    .required()
+                    .help("Set the URI of the server."))
+            .add_argument(lyra::opt(rate, "Rate")
+                    .name("--rate")
+                    .help("Set the rate of replay relative to the capture. "
+                          "Zero replays at the maximum rate."))
+            .add_argument(lyra::opt(direction_str, "Direction")
+                    .name("--direction")
+                    .choices("inbound", "outbound")
+                    .help("Set the direction of messages to replay. Use "
+                          "\"inbound\" for captures in servers, and "
+                          "\"outbound\" for captures in clients."))
+            .add_argument(lyra::opt(timeout_sec, "Timeout")
+                    .name("--timeout")
+                    .help("Set the timeout to wait for responses in seconds."))
+            .add_argument(lyra::opt(output_file_path, "File path")
+                    .name("--output")
+                    .help("Set the file path to write latencies."));
+    const auto result = cli.parse({argc, argv});
+    if (!result) {
+        std::cerr << result.message() << "\n\n" << cli << std::endl;
+        return 1;
+    }
+    if (rate < 0.0) {
+        std::cerr << "Rate must not be negative." << std::endl;
+        return 1;
+    }
+
+    const auto direction = (direction_str == "inbound")
+        ? msgpack_rpc::transport::TrafficDirection::INBOUND
+        : msgpack_rpc::transport::TrafficDirection::OUTBOUND;
+    std::size_t num_skipped = 0;
+    const auto messages =
+        load_messages(capture_file_path, direction, num_skipped);
+
+    const auto logger = msgpack_rpc::logging::Logger::create();
+    Replayer replayer(logger);
+    replayer.connect(msgpack_rpc::addresses::URI::parse(server_uri), messages);
+    replayer.send(messages, rate);
+    replayer.wait(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>(timeout_sec)));
+
+    replayer.write_summary(num_skipped);
+    if (!output_file_path.empty()) {
+        replayer.write_latencies(output_file_path);
+    }
+
+    return 0;
+}
@@ -22,12 +22,14 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <fmt/format.h>
 
 #include "common.h"
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/servers/server_builder.h"
 
 int main() {
@@ -36,14 +38,26 @@ int main() {
     auto command_server =
         msgpack_rpc::servers::ServerBuilder()
             .listen_to(msgpack_rpc_test::COMMAND_SERVER_URI)
-            .add_method<std::string(int)>("prepare",
-                [&echo_server](int server_type_number) -> std::string {
+            .add_method<std::string(int, int, int)>("prepare",
+                [&echo_server](int server_type_number,
+                    int socket_profile_number,
+                    int compression_profile_number) -> std::string {
                     const auto server_type =
                         static_cast<msgpack_rpc_test::ServerType>(
                             server_type_number);
                     echo_server.reset();
 
-                    auto builder = msgpack_rpc::servers::ServerBuilder();
+                    msgpack_rpc::config::ServerConfig server_config;
+                    msgpack_rpc_test::apply_socket_profile(
+                        static_cast<msgpack_rpc_test::SocketProfile>(
+                            socket_profile_number),
+                        server_config.socket());
+                    msgpack_rpc_test::apply_compression_profile(
+                        static_cast<msgpack_rpc_test::CompressionProfile>(
+                            compression_profile_number),
+                        server_config.compression());
+                    auto builder =
+                        msgpack_rpc::servers::ServerBuilder(server_config);
                     switch (server_type) {
                     case msgpack_rpc_test::ServerType::TCP4:
                         builder.listen_to("tcp://127.0.0.1:0");
@@ -59,6 +73,9 @@ int main() {
                     }
                     builder.add_method<std::string(std::string)>(
                         "echo", [](const std::string& str) { return str; });
+                    builder.add_method<std::string_view(std::string_view)>(
+                        "echo_view",
+                        [](std::string_view str) { return str; });
                     echo_server = builder.build();
 
                     return fmt::format(
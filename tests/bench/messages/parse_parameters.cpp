@@ -0,0 +1,156 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmark of parsing parameters with nested structures.
+ */
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include <msgpack.hpp>
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+
+#include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/messages/message_parser.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/parsed_message.h"
+#include "msgpack_rpc/messages/parsed_request.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+struct Point {
+    double x{};
+    double y{};
+
+    MSGPACK_DEFINE(x, y);
+};
+
+struct Polygon {
+    std::string name{};
+    std::vector<Point> points{};
+
+    MSGPACK_DEFINE(name, points);
+};
+
+struct Scene {
+    std::vector<Polygon> polygons{};
+
+    MSGPACK_DEFINE(polygons);
+};
+
+namespace {
+
+[[nodiscard]] Scene create_scene() {
+    constexpr std::size_t num_polygons = 100;
+    constexpr std::size_t num_points = 100;
+    Scene scene;
+    scene.polygons.resize(num_polygons);
+    for (std::size_t i = 0; i < num_polygons; ++i) {
+        auto& polygon = scene.polygons[i];
+        polygon.name = "polygon" + std::to_string(i);
+        polygon.points.resize(num_points);
+        for (std::size_t j = 0; j < num_points; ++j) {
+            polygon.points[j].x = static_cast<double>(i);
+            polygon.points[j].y = static_cast<double>(j);
+        }
+    }
+    return scene;
+}
+
+[[nodiscard]] msgpack_rpc::messages::SerializedMessage create_request() {
+    return msgpack_rpc::messages::MessageSerializer::serialize_request(
+        "draw", 1, create_scene());
+}
+
+[[nodiscard]] std::vector<std::vector<double>> create_matrix() {
+    constexpr std::size_t num_rows = 100;
+    constexpr std::size_t num_columns = 200;
+    std::vector<std::vector<double>> matrix(
+        num_rows, std::vector<double>(num_columns));
+    for (std::size_t i = 0; i < num_rows; ++i) {
+        for (std::size_t j = 0; j < num_columns; ++j) {
+            matrix[i][j] = static_cast<double>(i * num_columns + j);
+        }
+    }
+    return matrix;
+}
+
+}  // namespace
+
+STAT_BENCH_CASE("parse_parameters", "unpack") {
+    const auto request = create_request();
+
+    STAT_BENCH_MEASURE() {
+        stat_bench::do_not_optimize(
+            msgpack::unpack(request.data(), request.size()));
+    };
+}
+
+STAT_BENCH_CASE("parse_parameters", "convert") {
+    const auto request = create_request();
+    const auto object = msgpack::unpack(request.data(), request.size());
+    constexpr std::size_t parameters_index = 3;
+    const auto& parameters = object->via.array.ptr[parameters_index];
+
+    STAT_BENCH_MEASURE() {
+        stat_bench::do_not_optimize(parameters.as<std::tuple<Scene>>());
+    };
+}
+
+STAT_BENCH_CASE("parse_parameters", "parse_request") {
+    const auto request = create_request();
+    msgpack_rpc::config::MessageParserConfig config;
+    config.read_buffer_size(request.size());
+    msgpack_rpc::messages::MessageParser parser{config};
+
+    STAT_BENCH_MEASURE() {
+        const auto buffer = parser.prepare_buffer();
+        std::memcpy(buffer.data(), request.data(), request.size());
+        parser.consumed(request.size());
+        const auto message = parser.try_parse();
+        const auto& parsed_request =
+            std::get<msgpack_rpc::messages::ParsedRequest>(message.value());
+        stat_bench::do_not_optimize(
+            parsed_request.parameters().as<Scene>());
+    };
+}
+
+STAT_BENCH_CASE("parse_parameters", "parse_request_directly") {
+    // Parameters of built-in types are decoded without trees of objects.
+    const auto request =
+        msgpack_rpc::messages::MessageSerializer::serialize_request(
+            "multiply", 1, create_matrix());
+    msgpack_rpc::config::MessageParserConfig config;
+    config.read_buffer_size(request.size());
+    msgpack_rpc::messages::MessageParser parser{config};
+
+    STAT_BENCH_MEASURE() {
+        const auto buffer = parser.prepare_buffer();
+        std::memcpy(buffer.data(), request.data(), request.size());
+        parser.consumed(request.size());
+        const auto message = parser.try_parse();
+        const auto& parsed_request =
+            std::get<msgpack_rpc::messages::ParsedRequest>(message.value());
+        stat_bench::do_not_optimize(
+            parsed_request.parameters().as<std::vector<std::vector<double>>>());
+    };
+}
+
+STAT_BENCH_MAIN
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmark of fan-out of notifications to subscribers of topics.
+ */
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/plot_option.h>
+
+#include "msgpack_rpc/addresses/tcp_address.h"
+#include "msgpack_rpc/config/admission_control_config.h"
+#include "msgpack_rpc/config/server_config.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/i_method_processor.h"
+#include "msgpack_rpc/methods/method_processor.h"
+#include "msgpack_rpc/servers/admission_controller.h"
+#include "msgpack_rpc/servers/server_connection.h"
+#include "msgpack_rpc/servers/server_connection_list.h"
+#include "msgpack_rpc/transport/i_connection.h"
+
+/*!
+ * \brief Class of connections which complete sending immediately.
+ */
+class NullConnection final : public msgpack_rpc::transport::IConnection {
+public:
+    void start(MessageReceivedCallback /*on_received*/,
+        MessageSentCallback on_sent,
+        ConnectionClosedCallback /*on_closed*/) override {
+        on_sent_ = std::move(on_sent);
+    }
+
+    void start_raw(RawMessageReceivedCallback /*on_received*/,
+        MessageSentCallback on_sent,
+        ConnectionClosedCallback /*on_closed*/) override {
+        on_sent_ = std::move(on_sent);
+    }
+
+    void async_send(
+        const msgpack_rpc::messages::SerializedMessage& message) override {
+        stat_bench::do_not_optimize(message.data());
+        on_sent_();
+    }
+
+    void async_close() override {}
+
+    void pause_reading() override {}
+
+    void resume_reading() override {}
+
+    [[nodiscard]] const msgpack_rpc::addresses::IAddress& local_address()
+        const noexcept override {
+        return address_;
+    }
+
+    [[nodiscard]] const msgpack_rpc::addresses::IAddress& remote_address()
+        const noexcept override {
+        return address_;
+    }
+
+private:
+    //! Address.
+    msgpack_rpc::addresses::TCPAddress address_{"127.0.0.1", 0};
+
+    //! Callback function called when a message is sent.
+    MessageSentCallback on_sent_{};
+};
+
+class FanOutFixture : public stat_bench::FixtureBase {
+public:
+    FanOutFixture() {
+        this->add_param<std::size_t>("subscribers")
+            ->add(1)
+            ->add(1000)  // NOLINT
+#ifdef NDEBUG
+            ->add(10000)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        const auto num_subscribers =
+            context.get_param<std::size_t>("subscribers");
+
+        const auto logger = msgpack_rpc::logging::Logger::create();
+        const auto processor =
+            std::shared_ptr<msgpack_rpc::methods::IMethodProcessor>(
+                msgpack_rpc::methods::create_method_processor(logger));
+        const auto admission_controller =
+            std::make_shared<msgpack_rpc::servers::AdmissionController>(
+                msgpack_rpc::config::AdmissionControlConfig());
+
+        connection_list_ =
+            std::make_shared<msgpack_rpc::servers::ServerConnectionList>();
+        connections_.clear();
+        server_connections_.clear();
+        for (std::size_t i = 0; i < num_subscribers; ++i) {
+            const auto connection = std::make_shared<NullConnection>();
+            (void)admission_controller->try_add_connection();
+            const auto id = connection_list_->create_id();
+            const auto server_connection =
+                std::make_shared<msgpack_rpc::servers::ServerConnection>(id,
+                    connection,
+                    std::weak_ptr<msgpack_rpc::executors::IExecutor>(),
+                    processor, msgpack_rpc::config::ServerConfig(),
+                    admission_controller, logger);
+            connection_list_->add(id, server_connection);
+            connection_list_->subscribe(topic_, id);
+            server_connection->start();
+            connections_.push_back(connection);
+            server_connections_.push_back(server_connection);
+        }
+    }
+
+    void tear_down(stat_bench::InvocationContext& /*context*/) override {
+        server_connections_.clear();
+        connections_.clear();
+        connection_list_.reset();
+    }
+
+protected:
+    //! Topic.
+    std::string topic_{"topic"};
+
+    //! List of connections.
+    std::shared_ptr<msgpack_rpc::servers::ServerConnectionList>
+        connection_list_{};
+
+    //! Connections.
+    std::vector<std::shared_ptr<NullConnection>> connections_{};
+
+    //! Connections in the server.
+    std::vector<std::shared_ptr<msgpack_rpc::servers::ServerConnection>>
+        server_connections_{};
+};
+
+STAT_BENCH_GROUP("fan_out")
+    .add_parameter_to_time_line_plot(
+        "subscribers", stat_bench::PlotOption::log_parameter);
+
+STAT_BENCH_CASE_F(FanOutFixture, "fan_out", "publish") {
+    const auto data = std::string(1024, 'a');  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        const auto notification =
+            msgpack_rpc::messages::MessageSerializer::serialize_notification(
+                topic_, data);
+        stat_bench::do_not_optimize(
+            connection_list_->publish(topic_, notification));
+    };
+}
+
+STAT_BENCH_CASE_F(FanOutFixture, "fan_out", "serialize_per_subscriber") {
+    const auto data = std::string(1024, 'a');  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        for (const auto& server_connection : server_connections_) {
+            server_connection->notify(
+                msgpack_rpc::messages::MessageSerializer::
+                    serialize_notification(topic_, data));
+        }
+    };
+}
+
+STAT_BENCH_MAIN
@@ -0,0 +1,449 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmark of throughput of servers with concurrent clients.
+ */
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <time.h>  // NOLINT: clock_gettime
+
+#include <fmt/format.h>
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/measurement_config.h>
+#include <stat_bench/plot_option.h>
+
+#include "msgpack_rpc/clients/call_future.h"
+#include "msgpack_rpc/clients/client.h"
+#include "msgpack_rpc/clients/client_builder.h"
+#include "msgpack_rpc/config/server_config.h"
+#include "msgpack_rpc/servers/server.h"
+#include "msgpack_rpc/servers/server_builder.h"
+
+namespace {
+
+/*!
+ * \brief Get the CPU time of a clock.
+ *
+ * \param[in] clock_id ID of the clock.
+ * \return CPU time in seconds.
+ */
+[[nodiscard]] double cpu_time(clockid_t clock_id) noexcept {
+    timespec time{};
+    (void)clock_gettime(clock_id, &time);
+    constexpr double nanoseconds_per_second = 1e+9;
+    return static_cast<double>(time.tv_sec) +
+        static_cast<double>(time.tv_nsec) / nanoseconds_per_second;
+}
+
+/*!
+ * \brief Struct of the numbers of notifications received in the server.
+ */
+struct ReceivedCounts {
+    //! Mutex.
+    std::mutex mutex{};
+
+    //! Condition variable to notify received notifications.
+    std::condition_variable cond_var{};
+
+    //! Number of notifications received for each connection.
+    std::vector<std::size_t> counts{};
+};
+
+}  // namespace
+
+/*!
+ * \brief Class of fixtures of servers and clients with varying concurrency.
+ *
+ * Parameters:
+ *
+ * - transport_threads: number of transport threads in the server.
+ * - callback_threads: number of callback threads in the server.
+ * - connections: number of clients, each of which has one connection.
+ * - depth: maximum number of messages in flight in each connection.
+ */
+class ThroughputFixture : public stat_bench::FixtureBase {
+public:
+    ThroughputFixture() {
+        this->add_param<std::size_t>("transport_threads")
+            ->add(1)
+            ->add(2)
+#ifdef NDEBUG
+            ->add(4)  // NOLINT
+#endif
+            ;
+        this->add_param<std::size_t>("callback_threads")
+            ->add(1)
+            ->add(2)
+#ifdef NDEBUG
+            ->add(4)  // NOLINT
+#endif
+            ;
+        this->add_param<std::size_t>("connections")
+            ->add(1)
+            ->add(4)  // NOLINT
+#ifdef NDEBUG
+            ->add(16)  // NOLINT
+#endif
+            ;
+        this->add_param<std::size_t>("depth")
+            ->add(1)
+            ->add(16)  // NOLINT
+#ifdef NDEBUG
+            ->add(128)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        const auto num_connections =
+            context.get_param<std::size_t>("connections");
+        depth_ = context.get_param<std::size_t>("depth");
+        messages_per_connection_ = TOTAL_MESSAGES / num_connections;
+
+        received_counts_ = std::make_shared<ReceivedCounts>();
+        received_counts_->counts.resize(num_connections);
+
+        msgpack_rpc::config::ServerConfig server_config;
+        server_config.executor()
+            .num_transport_threads(
+                context.get_param<std::size_t>("transport_threads"))
+            .num_callback_threads(
+                context.get_param<std::size_t>("callback_threads"));
+        server_ = msgpack_rpc::servers::ServerBuilder(server_config)
+                      .listen_to("tcp://127.0.0.1:0")
+                      .add_method<std::string(std::string)>(
+                          "echo", [](const std::string& str) { return str; })
+                      .add_method<void(std::size_t, std::string)>("receive",
+                          [received_counts = received_counts_](
+                              std::size_t index, const std::string& /*str*/) {
+                              {
+                                  std::unique_lock<std::mutex> lock(
+                                      received_counts->mutex);
+                                  ++received_counts->counts.at(index);
+                              }
+                              received_counts->cond_var.notify_all();
+                          })
+                      .build();
+        const auto server_uri =
+            fmt::format("{}", server_->local_endpoint_uris().front());
+
+        clients_.clear();
+        clients_.reserve(num_connections);
+        for (std::size_t i = 0; i < num_connections; ++i) {
+            clients_.push_back(msgpack_rpc::clients::ClientBuilder()
+                                   .connect_to(server_uri)
+                                   .build());
+        }
+
+        // Threads are created here so that the creation of threads is not
+        // measured.
+        is_stopping_ = false;
+        task_generation_ = 0;
+        workers_.clear();
+        workers_.reserve(num_connections);
+        for (std::size_t i = 0; i < num_connections; ++i) {
+            workers_.emplace_back([this, i] { run_worker(i); });
+        }
+    }
+
+    void tear_down(stat_bench::InvocationContext& /*context*/) override {
+        {
+            std::unique_lock<std::mutex> lock(worker_mutex_);
+            is_stopping_ = true;
+        }
+        task_cond_var_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+        workers_.clear();
+        clients_.clear();
+        server_.reset();
+        received_counts_.reset();
+    }
+
+    /*!
+     * \brief Run a function for each connection in parallel.
+     *
+     * \param[in] task Function taking the index of the connection.
+     * \return CPU time of the threads running the function in seconds.
+     */
+    double run_in_parallel(std::function<void(std::size_t)> task) {
+        std::unique_lock<std::mutex> lock(worker_mutex_);
+        task_ = std::move(task);
+        ++task_generation_;
+        num_finished_workers_ = 0;
+        worker_cpu_time_ = 0.0;
+        lock.unlock();
+        task_cond_var_.notify_all();
+
+        lock.lock();
+        finished_cond_var_.wait(
+            lock, [this] { return num_finished_workers_ == workers_.size(); });
+        return worker_cpu_time_;
+    }
+
+    /*!
+     * \brief Send requests in a connection keeping at most depth requests in
+     * flight.
+     *
+     * \param[in] index Index of the connection.
+     */
+    void send_requests(std::size_t index) {
+        auto& client = clients_[index];
+        std::deque<msgpack_rpc::clients::CallFuture<std::string>> futures;
+        for (std::size_t i = 0; i < messages_per_connection_; ++i) {
+            if (futures.size() >= depth_) {
+                stat_bench::do_not_optimize(futures.front().get_result());
+                futures.pop_front();
+            }
+            futures.push_back(client.async_call<std::string>("echo", data_));
+        }
+        for (auto& future : futures) {
+            stat_bench::do_not_optimize(future.get_result());
+        }
+    }
+
+    /*!
+     * \brief Send notifications in a connection keeping at most depth
+     * notifications not processed in the server.
+     *
+     * \param[in] index Index of the connection.
+     */
+    void send_notifications(std::size_t index) {
+        auto& client = clients_[index];
+        auto& received_counts = *received_counts_;
+        std::unique_lock<std::mutex> lock(received_counts.mutex);
+        const std::size_t& received_count = received_counts.counts.at(index);
+        const std::size_t initial_count = received_count;
+        lock.unlock();
+        for (std::size_t i = 0; i < messages_per_connection_; ++i) {
+            lock.lock();
+            received_counts.cond_var.wait(lock, [&] {
+                return initial_count + i - received_count < depth_;
+            });
+            lock.unlock();
+            client.notify("receive", index, data_);
+        }
+        const std::size_t final_count =
+            initial_count + messages_per_connection_;
+        lock.lock();
+        received_counts.cond_var.wait(
+            lock, [&] { return received_count >= final_count; });
+    }
+
+    /*!
+     * \brief Get the number of messages in a sample.
+     *
+     * \return Number of messages.
+     */
+    [[nodiscard]] std::size_t num_messages() const noexcept {
+        return messages_per_connection_ * clients_.size();
+    }
+
+    /*!
+     * \brief Run a function for each connection in parallel and calculate the
+     * CPU time per message.
+     *
+     * \param[in] task Function taking the index of the connection.
+     * \return CPU time per message in seconds.
+     *
+     * \note CPU time includes threads of the server and internal threads of
+     * clients, but excludes the threads running the function.
+     */
+    [[nodiscard]] double run_and_measure_cpu_time(
+        std::function<void(std::size_t)> task) {
+        const double process_before = cpu_time(CLOCK_PROCESS_CPUTIME_ID);
+        const double workers = run_in_parallel(std::move(task));
+        const double process_after = cpu_time(CLOCK_PROCESS_CPUTIME_ID);
+        return (process_after - process_before - workers) /
+            static_cast<double>(num_messages());
+    }
+
+    /*!
+     * \brief Get the number of bytes of data in a sample.
+     *
+     * \return Number of bytes.
+     */
+    [[nodiscard]] std::size_t num_bytes() const noexcept {
+        return num_messages() * data_.size();
+    }
+
+private:
+    /*!
+     * \brief Run tasks in a worker thread.
+     *
+     * \param[in] index Index of the connection.
+     */
+    void run_worker(std::size_t index) {
+        std::size_t finished_generation = 0;
+        std::unique_lock<std::mutex> lock(worker_mutex_);
+        while (true) {
+            task_cond_var_.wait(lock, [this, &finished_generation] {
+                return is_stopping_ || task_generation_ != finished_generation;
+            });
+            if (is_stopping_) {
+                return;
+            }
+            finished_generation = task_generation_;
+            lock.unlock();
+
+            const double before = cpu_time(CLOCK_THREAD_CPUTIME_ID);
+            task_(index);
+            const double after = cpu_time(CLOCK_THREAD_CPUTIME_ID);
+
+            lock.lock();
+            worker_cpu_time_ += after - before;
+            ++num_finished_workers_;
+            if (num_finished_workers_ == workers_.size()) {
+                finished_cond_var_.notify_one();
+            }
+        }
+    }
+
+    //! Number of messages in all connections in a sample.
+#ifdef NDEBUG
+    static constexpr std::size_t TOTAL_MESSAGES = 4096;
+#else
+    static constexpr std::size_t TOTAL_MESSAGES = 256;
+#endif
+
+    //! Size of data in messages.
+    static constexpr std::size_t DATA_SIZE = 1024;
+
+    //! Data sent in messages.
+    std::string data_ = std::string(DATA_SIZE, 'a');
+
+    //! Maximum number of messages in flight in each connection.
+    std::size_t depth_{};
+
+    //! Number of messages in each connection in a sample.
+    std::size_t messages_per_connection_{};
+
+    //! Number of notifications received in the server for each connection.
+    std::shared_ptr<ReceivedCounts> received_counts_{};
+
+    //! Server.
+    std::optional<msgpack_rpc::servers::Server> server_{};
+
+    //! Clients.
+    std::vector<msgpack_rpc::clients::Client> clients_{};
+
+    //! Threads sending messages in each connection.
+    std::vector<std::thread> workers_{};
+
+    //! Mutex of the states of the workers.
+    std::mutex worker_mutex_{};
+
+    //! Condition variable to notify new tasks to the workers.
+    std::condition_variable task_cond_var_{};
+
+    //! Condition variable to notify finished tasks.
+    std::condition_variable finished_cond_var_{};
+
+    //! Task of the workers.
+    std::function<void(std::size_t)> task_{};
+
+    //! Generation of the task, incremented for each task.
+    std::size_t task_generation_{0};
+
+    //! Number of workers which finished the current task.
+    std::size_t num_finished_workers_{0};
+
+    //! CPU time of the workers in the current task in seconds.
+    double worker_cpu_time_{0.0};
+
+    //! Whether the workers are stopping.
+    bool is_stopping_{false};
+};
+
+STAT_BENCH_GROUP("throughput")
+    .add_parameter_to_time_line_plot(
+        "connections", stat_bench::PlotOption::log_parameter)
+    .add_parameter_to_output_line_plot("connections", "Messages",
+        stat_bench::PlotOption::log_parameter)
+    .add_parameter_to_output_line_plot(
+        "depth", "Messages", stat_bench::PlotOption::log_parameter)
+    .add_parameter_to_output_line_plot("depth", "Bytes",
+        stat_bench::PlotOption::log_parameter)
+    .add_parameter_to_output_line_plot("transport_threads", "Messages")
+    .add_parameter_to_output_line_plot("callback_threads", "Messages")
+    .add_parameter_to_output_line_plot("connections", "CPU Time per Message",
+        stat_bench::PlotOption::log_parameter)
+    .clear_measurement_configs()
+    .add_measurement_config(stat_bench::MeasurementConfig()
+            .type("Processing Time")
+            .iterations(1)
+            .samples(10)  // NOLINT
+            .warming_up_samples(1));
+
+STAT_BENCH_CASE_F(ThroughputFixture, "throughput", "requests") {
+    const auto messages_stat = STAT_BENCH_CONTEXT_NAME.add_custom_stat(
+        "Messages",
+        stat_bench::CustomOutputAnalysisType::rate_per_processing_time);
+    const auto bytes_stat = STAT_BENCH_CONTEXT_NAME.add_custom_stat("Bytes",
+        stat_bench::CustomOutputAnalysisType::rate_per_processing_time);
+    const auto cpu_time_stat =
+        STAT_BENCH_CONTEXT_NAME.add_custom_stat("CPU Time per Message");
+
+    STAT_BENCH_MEASURE_INDEXED(thread_index, sample_index, iteration_index) {
+        static_cast<void>(thread_index);
+        const double cpu_time_per_message = run_and_measure_cpu_time(
+            [this](std::size_t index) { send_requests(index); });
+        messages_stat->add(sample_index, iteration_index,
+            static_cast<double>(num_messages()));
+        bytes_stat->add(
+            sample_index, iteration_index, static_cast<double>(num_bytes()));
+        cpu_time_stat->add(
+            sample_index, iteration_index, cpu_time_per_message);
+    };
+}
+
+STAT_BENCH_CASE_F(ThroughputFixture, "throughput", "notifications") {
+    const auto messages_stat = STAT_BENCH_CONTEXT_NAME.add_custom_stat(
+        "Messages",
+        stat_bench::CustomOutputAnalysisType::rate_per_processing_time);
+    const auto bytes_stat = STAT_BENCH_CONTEXT_NAME.add_custom_stat("Bytes",
+        stat_bench::CustomOutputAnalysisType::rate_per_processing_time);
+    const auto cpu_time_stat =
+        STAT_BENCH_CONTEXT_NAME.add_custom_stat("CPU Time per Message");
+
+    STAT_BENCH_MEASURE_INDEXED(thread_index, sample_index, iteration_index) {
+        static_cast<void>(thread_index);
+        const double cpu_time_per_message = run_and_measure_cpu_time(
+            [this](std::size_t index) { send_notifications(index); });
+        messages_stat->add(sample_index, iteration_index,
+            static_cast<double>(num_messages()));
+        bytes_stat->add(
+            sample_index, iteration_index, static_cast<double>(num_bytes()));
+        cpu_time_stat->add(
+            sample_index, iteration_index, cpu_time_per_message);
+    };
+}
+
+STAT_BENCH_MAIN
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of a client requesting concurrently to measure
+ * goodput of servers.
+ */
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <fmt/format.h>
+#include <lyra/lyra.hpp>
+
+#include "msgpack_rpc/clients/call_future.h"
+#include "msgpack_rpc/clients/client.h"
+#include "msgpack_rpc/clients/client_builder.h"
+#include "msgpack_rpc/clients/server_exception.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/client_config.h"
+#include "msgpack_rpc/config/config_parser.h"
+#include "msgpack_rpc/config/logging_config.h"
+#include "msgpack_rpc/logging/logger.h"
+
+int main(int argc, const char** argv) {
+    std::uint32_t test_seconds{3U};
+    std::uint32_t concurrency{1U};
+    std::uint32_t work_milliseconds{10U};
+    std::string config_file_path;
+    std::string server_uri;
+    std::string log_file_path = "request_concurrently.log";
+    std::string result_file_path = "request_concurrently.json";
+    const auto cli = lyra::cli()
+                         .add_argument(lyra::opt(test_seconds, "seconds")
+                                 .name("--seconds")
+                                 .name("-s")
+                                 .optional()
+                                 .help("Number of test seconds."))
+                         .add_argument(lyra::opt(concurrency, "number")
+                                 .name("--concurrency")
+                                 .optional()
+                                 .help("Number of concurrent requests."))
+                         .add_argument(lyra::opt(work_milliseconds, "ms")
+                                 .name("--work")
+                                 .optional()
+                                 .help("Time of work in each request."))
+                         .add_argument(lyra::opt(config_file_path, "path")
+                                 .name("--config")
+                                 .required()
+                                 .help("Configuration file path."))
+                         .add_argument(lyra::opt(server_uri, "URI")
+                                 .name("--uri")
+                                 .required()
+                                 .help("Server URI."))
+                         .add_argument(lyra::opt(log_file_path, "path")
+                                 .name("--log")
+                                 .optional()
+                                 .help("Log file path."))
+                         .add_argument(lyra::opt(result_file_path, "path")
+                                 .name("--result")
+                                 .optional()
+                                 .help("Result file path."));
+    const auto result = cli.parse({argc, argv});
+    if (!result) {
+        std::cerr << result.message() << "\n\n";
+        std::cerr << cli << std::endl;
+        return 1;
+    }
+    const auto test_duration = std::chrono::seconds(test_seconds);
+
+    msgpack_rpc::config::ConfigParser config_parser;
+    config_parser.parse(config_file_path);
+
+    const auto logger =
+        msgpack_rpc::logging::Logger::create(msgpack_rpc::config::LoggingConfig(
+            config_parser.logging_config("durability_test"))
+                .file_path(log_file_path));
+    MSGPACK_RPC_INFO(
+        logger, "Test duration: {} seconds", test_duration.count());
+    MSGPACK_RPC_INFO(logger, "Concurrency: {}", concurrency);
+    MSGPACK_RPC_INFO(logger, "Server URI: {}", server_uri);
+
+    auto client = msgpack_rpc::clients::ClientBuilder(
+        config_parser.client_config("durability_test"), logger)
+                      .connect_to(server_uri)
+                      .build();
+
+    std::uint64_t num_succeeded = 0;
+    std::uint64_t num_overloaded = 0;
+    std::uint64_t num_failed = 0;
+    std::deque<msgpack_rpc::clients::CallFuture<void>> futures;
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto finish_time = start_time + test_duration;
+    while (true) {
+        const bool is_running = std::chrono::steady_clock::now() < finish_time;
+        if (is_running) {
+            while (futures.size() < concurrency) {
+                futures.push_back(
+                    client.async_call<void>("work", work_milliseconds));
+            }
+        } else if (futures.empty()) {
+            break;
+        }
+
+        try {
+            futures.front().get_result();
+            ++num_succeeded;
+        } catch (const msgpack_rpc::MsgpackRPCException& e) {
+            if (e.status().code() == msgpack_rpc::StatusCode::OVERLOADED) {
+                ++num_overloaded;
+                // Back off as clients should do for overloaded servers.
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            } else {
+                MSGPACK_RPC_ERROR(logger, "Request failed: {}", e.what());
+                ++num_failed;
+            }
+        }
+        futures.pop_front();
+    }
+    const double elapsed_seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - start_time)
+            .count();
+
+    MSGPACK_RPC_INFO(logger,
+        "Finished with {} successful requests, {} overloaded requests, and "
+        "{} failed requests in {:.3f} seconds.",
+        num_succeeded, num_overloaded, num_failed, elapsed_seconds);
+
+    std::ofstream result_file(result_file_path);
+    result_file << fmt::format(
+        R"({{"succeeded": {}, "overloaded": {}, "failed": {}, )"
+        R"("seconds": {}}})",
+        num_succeeded, num_overloaded, num_failed, elapsed_seconds);
+
+    return num_failed == 0U ? 0 : 1;
+}
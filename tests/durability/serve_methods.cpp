@@ -17,8 +17,11 @@
  * \file
  * \brief Implementation of a server for durability tests.
  */
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <fmt/ranges.h>
@@ -73,6 +76,12 @@ int main(int argc, const char** argv) {
         "echo", [](const std::string& str) { return str; });
     builder.add_method<int(int, int)>(
         "add", [](int x, int y) { return x + y; });
+    builder.add_method<void(std::uint32_t)>(
+        "work", [](std::uint32_t milliseconds) {
+            // Simulate a heavy process.
+            std::this_thread::sleep_for(
+                std::chrono::milliseconds(milliseconds));
+        });
 
     auto server = builder.build();
     server.run_until_signal();
@@ -0,0 +1,174 @@
+"""Test of goodput of overloaded servers."""
+
+import datetime
+import json
+import pathlib
+import shutil
+
+import pytomlpp
+
+from .process_executor import DEFAULT_PROCESS_WAIT_TIME, ProcessExecutor
+
+THIS_DIR = pathlib.Path(__file__).absolute().parent
+
+CONFIG_FILE_PATH = THIS_DIR / "overload_config.toml"
+
+
+def _read_capacity() -> int:
+    """Read the capacity of the server in overload_config.toml.
+
+    The capacity is the maximum number of in-flight requests, which must equal
+    the number of callback threads so that the server is saturated at capacity
+    and requests exceeding it are rejected.
+    """
+    server_config = pytomlpp.load(str(CONFIG_FILE_PATH))["server"]["durability_test"]
+    capacity = int(server_config["admission_control"]["max_in_flight_requests"])
+    num_callback_threads = int(server_config["executor"]["num_callback_threads"])
+    assert capacity == num_callback_threads
+    return capacity
+
+
+# Capacity of the server.
+CAPACITY = _read_capacity()
+
+# Minimum ratio of goodput under overload to goodput at capacity.
+MIN_GOODPUT_RATIO = 0.8
+
+
+def _request_concurrently(
+    *,
+    bin_dir_path: pathlib.Path,
+    current_log_dir_path: pathlib.Path,
+    test_duration: datetime.timedelta,
+    server_uri: str,
+    num_clients: int,
+) -> tuple[float, int]:
+    """Request from clients concurrently.
+
+    Returns:
+        Goodput (successful requests per second) and the number of
+        overloaded requests.
+    """
+    config_file_path = CONFIG_FILE_PATH
+
+    processes: list[ProcessExecutor] = []
+    result_file_paths: list[pathlib.Path] = []
+    for i in range(num_clients):
+        name = f"client_{num_clients}_{i}"
+        result_file_paths.append(current_log_dir_path / f"{name}.json")
+        processes.append(
+            ProcessExecutor(
+                [
+                    str(bin_dir_path / "durability_request_concurrently"),
+                    "--config",
+                    str(config_file_path),
+                    "--uri",
+                    server_uri,
+                    "--log",
+                    f"{name}.log",
+                    "--result",
+                    str(result_file_paths[-1]),
+                    "--seconds",
+                    str(int(test_duration.total_seconds())),
+                    "--concurrency",
+                    str(CAPACITY),
+                ],
+                cwd=str(current_log_dir_path),
+                log_prefix=name,
+            )
+        )
+    for process in processes:
+        process.wait(test_duration.total_seconds() * 2.0 + DEFAULT_PROCESS_WAIT_TIME)
+        process.stop()
+        assert process.returncode == 0
+
+    goodput = 0.0
+    num_overloaded = 0
+    for result_file_path in result_file_paths:
+        with open(result_file_path, encoding="utf-8") as file:
+            result = json.load(file)
+        goodput += float(result["succeeded"]) / float(result["seconds"])
+        num_overloaded += int(result["overloaded"])
+    return goodput, num_overloaded
+
+
+def _check_overload(
+    *,
+    bin_dir_path: pathlib.Path,
+    current_log_dir_path: pathlib.Path,
+    test_duration: datetime.timedelta,
+    server_uri: str,
+) -> None:
+    config_file_path = CONFIG_FILE_PATH
+
+    with ProcessExecutor(
+        [
+            str(bin_dir_path / "durability_serve_methods"),
+            "--config",
+            str(config_file_path),
+            "--uri",
+            server_uri,
+            "--log",
+            "server.log",
+        ],
+        cwd=str(current_log_dir_path),
+        log_prefix="server",
+    ) as server_process:
+        goodput_at_capacity, _ = _request_concurrently(
+            bin_dir_path=bin_dir_path,
+            current_log_dir_path=current_log_dir_path,
+            test_duration=test_duration,
+            server_uri=server_uri,
+            num_clients=1,
+        )
+        goodput_under_overload, num_overloaded = _request_concurrently(
+            bin_dir_path=bin_dir_path,
+            current_log_dir_path=current_log_dir_path,
+            test_duration=test_duration,
+            server_uri=server_uri,
+            num_clients=2,
+        )
+
+    assert server_process.returncode == 0
+    assert num_overloaded > 0
+    assert goodput_under_overload >= MIN_GOODPUT_RATIO * goodput_at_capacity
+
+
+def test_overload_tcp_v4(
+    bin_dir_path: pathlib.Path,
+    log_parent_dir_path: pathlib.Path,
+    test_duration: datetime.timedelta,
+) -> None:
+    """Test of goodput at twice the capacity of a server (TCPv4)."""
+    current_log_dir_path = log_parent_dir_path / "test_overload_tcp_v4"
+    if current_log_dir_path.exists():
+        shutil.rmtree(str(current_log_dir_path))
+    current_log_dir_path.mkdir(exist_ok=True, parents=True)
+
+    server_uri = "tcp://127.0.0.1:12345"
+    _check_overload(
+        bin_dir_path=bin_dir_path,
+        current_log_dir_path=current_log_dir_path,
+        test_duration=test_duration,
+        server_uri=server_uri,
+    )
+
+
+def test_overload_unix(
+    bin_dir_path: pathlib.Path,
+    log_parent_dir_path: pathlib.Path,
+    test_duration: datetime.timedelta,
+) -> None:
+    """Test of goodput at twice the capacity of a server (Unix sockets)."""
+    current_log_dir_path = log_parent_dir_path / "test_overload_unix"
+    if current_log_dir_path.exists():
+        shutil.rmtree(str(current_log_dir_path))
+    current_log_dir_path.mkdir(exist_ok=True, parents=True)
+
+    server_uri = "unix://durability_overload.sock"
+    _check_overload(
+        bin_dir_path=bin_dir_path,
+        current_log_dir_path=current_log_dir_path,
+        test_duration=test_duration,
+        server_uri=server_uri,
+    )
@@ -19,7 +19,10 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <msgpack.hpp>
@@ -60,6 +63,28 @@ namespace msgpack_rpc_test {
         std::get<msgpack_rpc::messages::ParsedRequest>(parsed_message)));
 }
 
+/*!
+ * \brief Parse requests serialized in a buffer.
+ *
+ * \param[in] message Serialized messages.
+ * \return Requests.
+ */
+[[nodiscard]] inline std::vector<msgpack_rpc::messages::ParsedRequest>
+parse_requests(const msgpack_rpc::messages::SerializedMessage& message) {
+    std::vector<msgpack_rpc::messages::ParsedRequest> requests;
+    std::size_t offset = 0;
+    while (offset < message.size()) {
+        auto parsed_message =
+            msgpack_rpc::messages::impl::parse_message_from_object(
+                msgpack::unpack(message.data(), message.size(), offset));
+        REQUIRE(std::holds_alternative<msgpack_rpc::messages::ParsedRequest>(
+            parsed_message));
+        requests.push_back(std::move(
+            std::get<msgpack_rpc::messages::ParsedRequest>(parsed_message)));
+    }
+    return requests;
+}
+
 /*!
  * \brief Parse a response.
  *
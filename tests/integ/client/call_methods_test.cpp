@@ -17,22 +17,38 @@
  * \file
  * \brief Test to call methods from clients.
  */
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_tostring.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <fmt/ranges.h>
+#include <msgpack.hpp>
 
 #include "create_test_logger.h"
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/clients/batch_future.h"
+#include "msgpack_rpc/clients/call_batch.h"
 #include "msgpack_rpc/clients/call_future.h"
 #include "msgpack_rpc/clients/client.h"
 #include "msgpack_rpc/clients/client_builder.h"
+#include "msgpack_rpc/clients/stream_reader.h"
+#include "msgpack_rpc/clients/upload_writer.h"
 #include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/messages/binary_view.h"
+#include "msgpack_rpc/messages/external_binary.h"
+#include "msgpack_rpc/messages/raw_result.h"
+#include "msgpack_rpc/methods/method_cache.h"
+#include "msgpack_rpc/methods/stream_writer.h"
+#include "msgpack_rpc/methods/upload_reader.h"
 #include "msgpack_rpc/servers/server.h"
 #include "msgpack_rpc/servers/server_builder.h"
 
@@ -41,6 +57,10 @@ SCENARIO("Call methods") {
     using msgpack_rpc::clients::Client;
     using msgpack_rpc::clients::ClientBuilder;
     using msgpack_rpc::config::ServerConfig;
+    using msgpack_rpc::messages::BinaryView;
+    using msgpack_rpc::messages::ExternalBinary;
+    using msgpack_rpc::messages::RawResult;
+    using msgpack_rpc::methods::MethodCache;
     using msgpack_rpc::servers::ServerBuilder;
 
     const auto logger = msgpack_rpc_test::create_test_logger();
@@ -62,12 +82,71 @@ SCENARIO("Call methods") {
         server_builder.add_method<std::string()>(
             "get_message", []() { return "Sample text."; });
 
+        server_builder.add_method<std::size_t(BinaryView)>(
+            "get_binary_size", [](BinaryView binary) { return binary.size(); });
+
+        const std::string large_binary(1024 * 1024, 'a');  // NOLINT
+        server_builder.add_method<ExternalBinary()>(
+            "get_large_binary", [&large_binary] {
+                return ExternalBinary(
+                    large_binary.data(), large_binary.size(), [] {});
+            });
+
+        server_builder.add_method<RawResult(int)>(
+            "get_serialized_number", [](int x) {
+                msgpack::sbuffer buffer;
+                msgpack::pack(buffer, x);
+                return RawResult(std::string(buffer.data(), buffer.size()));
+            });
+
         int number = 0;
         server_builder.add_method<int()>(
             "get_number", [&number]() { return number; });
         server_builder.add_method<void(int)>(
             "set_number", [&number](int val) { number = val; });
 
+        std::atomic<std::size_t> max_batch_size{0};
+        server_builder.add_batch_method<int(int, int)>("add_in_batch",
+            [&max_batch_size](
+                const std::vector<std::tuple<int, int>>& parameters) {
+                std::size_t current = max_batch_size.load();
+                while (current < parameters.size() &&
+                    !max_batch_size.compare_exchange_weak(
+                        current, parameters.size())) {
+                }
+                std::vector<int> results;
+                results.reserve(parameters.size());
+                for (const auto& [x, y] : parameters) {
+                    results.push_back(x + y);
+                }
+                return results;
+            });
+
+        int num_cached_method_calls = 0;
+        const auto cache = std::make_shared<MethodCache>();
+        server_builder.add_method<int(int)>(
+            "square_with_cache",
+            [&num_cached_method_calls](int x) {
+                ++num_cached_method_calls;
+                return x * x;
+            },
+            cache);
+
+        server_builder.add_streaming_method<int(int)>("count_in_stream",
+            [](msgpack_rpc::methods::StreamWriter<int>& writer, int num) {
+                for (int i = 0; i < num; ++i) {
+                    writer.write(i);
+                }
+            });
+        server_builder.add_upload_method<int(int), int>("sum_upload",
+            [](msgpack_rpc::methods::UploadReader<int>& reader, int initial) {
+                int sum = initial;
+                while (const auto chunk = reader.next()) {
+                    sum += *chunk;
+                }
+                return sum;
+            });
+
         auto server = server_builder.build();
 
         const auto uris = server.local_endpoint_uris();
@@ -136,6 +215,94 @@ SCENARIO("Call methods") {
 
                 CHECK(client.call<int>("get_number") == value);
             }
+
+            THEN("The client can call methods in a batch") {
+                auto batch = client.batch();
+                static constexpr int num_calls = 200;
+                std::vector<msgpack_rpc::clients::CallFuture<int>> futures;
+                futures.reserve(num_calls);
+                for (int i = 0; i < num_calls; ++i) {
+                    futures.push_back(batch.add<int>("add", i, 1));
+                }
+                auto echo_future =
+                    batch.add<std::string>("echo", std::string("batch"));
+                CHECK(batch.size() == num_calls + 1U);
+
+                auto batch_future = batch.send();
+                CHECK_NOTHROW(batch_future.wait_all());
+
+                CHECK(batch_future.num_finished_calls() == num_calls + 1U);
+                for (int i = 0; i < num_calls; ++i) {
+                    auto& future = futures.at(static_cast<std::size_t>(i));
+                    CHECK(future.get_result() == i + 1);
+                }
+                CHECK(echo_future.get_result() == "Reply to batch");
+            }
+
+            THEN("The client can call methods processing requests in batches") {
+                auto batch = client.batch();
+                static constexpr int num_calls = 200;
+                std::vector<msgpack_rpc::clients::CallFuture<int>> futures;
+                futures.reserve(num_calls);
+                for (int i = 0; i < num_calls; ++i) {
+                    futures.push_back(batch.add<int>("add_in_batch", i, 2));
+                }
+                batch.send().wait_all();
+
+                for (int i = 0; i < num_calls; ++i) {
+                    auto& future = futures.at(static_cast<std::size_t>(i));
+                    CHECK(future.get_result() == i + 2);
+                }
+                CHECK(max_batch_size.load() > 1U);
+            }
+
+            THEN("The client can call methods with streaming responses") {
+                constexpr int num_chunks = 100;
+                auto reader = client.call_stream<int>(
+                    "count_in_stream", num_chunks);
+
+                for (int i = 0; i < num_chunks; ++i) {
+                    CHECK(reader.next() == std::optional<int>(i));
+                }
+                CHECK(reader.next() == std::nullopt);
+            }
+
+            THEN("The client can send and receive external binaries") {
+                const std::string data(1024 * 1024, 'b');  // NOLINT
+                const ExternalBinary binary{data.data(), data.size(), [] {}};
+
+                CHECK(client.call<std::size_t>("get_binary_size", binary) ==
+                    data.size());
+                CHECK(client.call<std::string>("get_large_binary") ==
+                    large_binary);
+            }
+
+            THEN("The client can call methods returning serialized results") {
+                CHECK(client.call<int>("get_serialized_number", 37) == 37);
+            }
+
+            THEN("The client can call methods with uploads") {
+                // More chunks than the window of uploads are sent.
+                constexpr int num_chunks = 100;
+                auto writer =
+                    client.async_call_upload<int, int>("sum_upload", 1);
+
+                for (int i = 1; i <= num_chunks; ++i) {
+                    writer.write(i);
+                }
+                auto future = writer.finish();
+
+                CHECK(future.get_result() == 5051);
+            }
+
+            THEN("The client can call methods with caches of results") {
+                CHECK(client.call<int>("square_with_cache", 3) == 9);
+                CHECK(client.call<int>("square_with_cache", 3) == 9);
+                CHECK(client.call<int>("square_with_cache", 4) == 16);
+
+                CHECK(num_cached_method_calls == 2);
+                CHECK(cache->statistics().num_hits() == 1U);
+            }
         }
     }
 }
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to call methods with compression of messages.
+ */
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_tostring.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "create_test_logger.h"
+#include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/clients/client.h"
+#include "msgpack_rpc/clients/client_builder.h"
+#include "msgpack_rpc/config/client_config.h"
+#include "msgpack_rpc/config/server_config.h"
+#include "msgpack_rpc/servers/server.h"
+#include "msgpack_rpc/servers/server_builder.h"
+
+SCENARIO("Call methods with compression") {
+    using msgpack_rpc::addresses::URI;
+    using msgpack_rpc::clients::Client;
+    using msgpack_rpc::clients::ClientBuilder;
+    using msgpack_rpc::config::ClientConfig;
+    using msgpack_rpc::config::ServerConfig;
+    using msgpack_rpc::servers::ServerBuilder;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+
+    constexpr std::size_t min_message_size = 128;
+    const bool is_server_compression_enabled = GENERATE(true, false);
+    const bool is_client_compression_enabled = GENERATE(true, false);
+    INFO("Server compression: " << is_server_compression_enabled);
+    INFO("Client compression: " << is_client_compression_enabled);
+
+    GIVEN("A server") {
+        ServerConfig server_config;
+        server_config.compression()
+            .enabled(is_server_compression_enabled)
+            .min_message_size(min_message_size);
+        ServerBuilder server_builder{server_config, logger};
+
+        server_builder.listen_to("tcp://localhost:0");
+
+        server_builder.add_method<std::string(std::string)>(
+            "echo", [](const std::string& str) { return str; });
+
+        auto server = server_builder.build();
+
+        const auto uris = server.local_endpoint_uris();
+        REQUIRE(uris != std::vector<URI>{});  // NOLINT
+
+        WHEN("A client is configured") {
+            ClientConfig client_config;
+            client_config.compression()
+                .enabled(is_client_compression_enabled)
+                .min_message_size(min_message_size);
+            ClientBuilder client_builder{client_config, logger};
+
+            for (const auto& uri : uris) {
+                client_builder.connect_to(uri);
+            }
+
+            Client client = client_builder.build();
+
+            THEN("The client can call methods with small messages") {
+                const std::string param = "abc";
+
+                CHECK(client.call<std::string>("echo", param) == param);
+            }
+
+            THEN("The client can call methods with large messages") {
+                constexpr std::size_t size = 100000;
+                const std::string param(size, 'a');
+
+                // Call twice because messages are compressed after
+                // advertisement of support of compression.
+                CHECK(client.call<std::string>("echo", param) == param);
+                CHECK(client.call<std::string>("echo", param) == param);
+            }
+        }
+    }
+}
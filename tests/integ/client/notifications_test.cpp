@@ -15,12 +15,14 @@
  */
 /*!
  * \file
- * \brief Test of notifications from clients.
+ * \brief Test of notifications from clients and servers.
  */
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -37,6 +39,7 @@
 #include "msgpack_rpc/clients/client_builder.h"
 #include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/servers/connection_id.h"
 #include "msgpack_rpc/servers/server.h"
 #include "msgpack_rpc/servers/server_builder.h"
 
@@ -120,3 +123,166 @@ SCENARIO("Notify to methods") {
         }
     }
 }
+
+SCENARIO("Receive notifications from servers") {
+    using msgpack_rpc::addresses::URI;
+    using msgpack_rpc::clients::Client;
+    using msgpack_rpc::clients::ClientBuilder;
+    using msgpack_rpc::servers::ConnectionID;
+    using msgpack_rpc::servers::ServerBuilder;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+
+    const auto server_uri = GENERATE(std::string_view("tcp://localhost:0"),
+        std::string_view("unix://integ_client_notifications_test.sock"));
+
+    GIVEN("A server") {
+        ServerBuilder server_builder{logger};
+
+        server_builder.listen_to(server_uri);
+
+        std::mutex subscriber_mutex;
+        std::optional<ConnectionID> subscriber;
+        server_builder.add_method<void()>(
+            "subscribe", [&subscriber_mutex, &subscriber] {
+                std::unique_lock<std::mutex> lock(subscriber_mutex);
+                subscriber = msgpack_rpc::servers::current_connection_id();
+            });
+
+        auto server = server_builder.build();
+
+        const auto uris = server.local_endpoint_uris();
+        MSGPACK_RPC_DEBUG(logger, "Server URIs: {}", fmt::join(uris, ", "));
+        REQUIRE(uris != std::vector<URI>{});  // NOLINT
+
+        WHEN("A client with a handler of notifications subscribes") {
+            ClientBuilder client_builder{logger};
+
+            for (const auto& uri : uris) {
+                client_builder.connect_to(uri);
+            }
+
+            std::mutex received_mutex;
+            std::vector<std::string> received;
+            client_builder.add_notification_handler<void(std::string)>(
+                "update", [&received_mutex, &received](std::string str) {
+                    std::unique_lock<std::mutex> lock(received_mutex);
+                    received.push_back(std::move(str));
+                });
+
+            Client client = client_builder.build();
+
+            client.call<void>("subscribe");
+
+            std::optional<ConnectionID> connection_id;
+            {
+                std::unique_lock<std::mutex> lock(subscriber_mutex);
+                connection_id = subscriber;
+            }
+            REQUIRE(connection_id.has_value());
+
+            THEN("The server can notify to the client") {
+                CHECK(server.notify(*connection_id, "update", "one"));
+                CHECK(server.notify_all("update", "all") == 1U);
+
+                AND_THEN("The client receives notifications") {
+                    constexpr auto timeout = std::chrono::seconds(1);
+                    constexpr auto check_cycle = std::chrono::milliseconds(10);
+                    constexpr auto check_count =
+                        static_cast<std::size_t>(timeout / check_cycle);
+                    for (std::size_t i = 0; i <= check_count; ++i) {
+                        {
+                            std::unique_lock<std::mutex> lock(received_mutex);
+                            if (received.size() >= 2U) {
+                                break;
+                            }
+                        }
+                        std::this_thread::sleep_for(check_cycle);
+                    }
+                    std::unique_lock<std::mutex> lock(received_mutex);
+                    CHECK(received == std::vector<std::string>{"one", "all"});
+                }
+            }
+
+            THEN("The server cannot notify to unknown connections") {
+                CHECK_FALSE(server.notify(*connection_id + 1U, "update", "x"));
+            }
+        }
+    }
+}
+
+SCENARIO("Subscribe to topics") {
+    using msgpack_rpc::addresses::URI;
+    using msgpack_rpc::clients::Client;
+    using msgpack_rpc::clients::ClientBuilder;
+    using msgpack_rpc::servers::ServerBuilder;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+
+    const auto server_uri = GENERATE(std::string_view("tcp://localhost:0"),
+        std::string_view("unix://integ_client_notifications_test.sock"));
+
+    GIVEN("A server") {
+        ServerBuilder server_builder{logger};
+
+        server_builder.listen_to(server_uri);
+
+        auto server = server_builder.build();
+
+        const auto uris = server.local_endpoint_uris();
+        MSGPACK_RPC_DEBUG(logger, "Server URIs: {}", fmt::join(uris, ", "));
+        REQUIRE(uris != std::vector<URI>{});  // NOLINT
+
+        WHEN("A client subscribes to a topic") {
+            ClientBuilder client_builder{logger};
+
+            for (const auto& uri : uris) {
+                client_builder.connect_to(uri);
+            }
+
+            std::mutex received_mutex;
+            std::vector<int> received;
+            client_builder.add_notification_handler<void(int)>(
+                "prices", [&received_mutex, &received](int value) {
+                    std::unique_lock<std::mutex> lock(received_mutex);
+                    received.push_back(value);
+                });
+
+            Client client = client_builder.build();
+
+            client.subscribe("prices");
+
+            THEN("The server can publish messages to the client") {
+                CHECK(server.publish("prices", 1) == 1U);
+                CHECK(server.publish("prices", 2) == 1U);
+                CHECK(server.publish("others", 3) == 0U);
+
+                AND_THEN("The client receives the messages") {
+                    constexpr auto timeout = std::chrono::seconds(1);
+                    constexpr auto check_cycle = std::chrono::milliseconds(10);
+                    constexpr auto check_count =
+                        static_cast<std::size_t>(timeout / check_cycle);
+                    for (std::size_t i = 0; i <= check_count; ++i) {
+                        {
+                            std::unique_lock<std::mutex> lock(received_mutex);
+                            if (received.size() >= 2U) {
+                                break;
+                            }
+                        }
+                        std::this_thread::sleep_for(check_cycle);
+                    }
+                    std::unique_lock<std::mutex> lock(received_mutex);
+                    CHECK(received == std::vector<int>{1, 2});
+                }
+            }
+
+            AND_WHEN("The client unsubscribes from the topic") {
+                client.unsubscribe("prices");
+
+                THEN("The server publishes messages to no client") {
+                    CHECK(server.publish("prices", 1) == 0U);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to call methods in clients from servers.
+ */
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_tostring.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <fmt/ranges.h>
+
+#include "create_test_logger.h"
+#include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/clients/client.h"
+#include "msgpack_rpc/clients/client_builder.h"
+#include "msgpack_rpc/clients/server_exception.h"
+#include "msgpack_rpc/logging/logger.h"
+#include "msgpack_rpc/servers/connection_id.h"
+#include "msgpack_rpc/servers/server.h"
+#include "msgpack_rpc/servers/server_builder.h"
+
+SCENARIO("Call methods in clients from servers") {
+    using msgpack_rpc::addresses::URI;
+    using msgpack_rpc::clients::Client;
+    using msgpack_rpc::clients::ClientBuilder;
+    using msgpack_rpc::servers::ConnectionID;
+    using msgpack_rpc::servers::ServerBuilder;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+
+    const auto server_uri = GENERATE(std::string_view("tcp://localhost:0"),
+        std::string_view("unix://integ_client_server_calls_test.sock"));
+
+    GIVEN("A server") {
+        ServerBuilder server_builder{logger};
+
+        server_builder.listen_to(server_uri);
+
+        std::mutex client_id_mutex;
+        std::optional<ConnectionID> client_id;
+        server_builder.add_method<void()>(
+            "register", [&client_id_mutex, &client_id] {
+                std::unique_lock<std::mutex> lock(client_id_mutex);
+                client_id = msgpack_rpc::servers::current_connection_id();
+            });
+
+        auto server = server_builder.build();
+
+        const auto uris = server.local_endpoint_uris();
+        MSGPACK_RPC_DEBUG(logger, "Server URIs: {}", fmt::join(uris, ", "));
+        REQUIRE(uris != std::vector<URI>{});  // NOLINT
+
+        WHEN("A client with methods registers itself to the server") {
+            ClientBuilder client_builder{logger};
+
+            for (const auto& uri : uris) {
+                client_builder.connect_to(uri);
+            }
+
+            client_builder.add_method<int(int, int)>(
+                "add", [](int lhs, int rhs) { return lhs + rhs; });
+
+            Client client = client_builder.build();
+
+            client.call<void>("register");
+
+            std::optional<ConnectionID> connection_id;
+            {
+                std::unique_lock<std::mutex> lock(client_id_mutex);
+                connection_id = client_id;
+            }
+            REQUIRE(connection_id.has_value());
+
+            THEN("The server can call methods in the client") {
+                CHECK(server.call<int>(*connection_id, "add", 2, 3) == 5);
+                CHECK(server.async_call<int>(*connection_id, "add", 4, 5)
+                          .get_result() == 9);
+            }
+
+            THEN("The server receives errors of non-existing methods") {
+                CHECK_THROWS_AS(
+                    server.call<int>(*connection_id, "invalid", 2, 3),
+                    msgpack_rpc::clients::ServerException);
+            }
+
+            THEN("The server cannot call methods in unknown connections") {
+                CHECK_THROWS(
+                    server.call<int>(*connection_id + 1U, "add", 2, 3));
+            }
+        }
+    }
+}
@@ -2,8 +2,10 @@ set(SOURCE_FILES
     call_failure_test.cpp
     call_methods_test.cpp
     catch_event_listener.cpp
+    compression_test.cpp
     create_test_logger.cpp
     many_calls_test.cpp
     notifications_test.cpp
     reconnection_test.cpp
+    server_calls_test.cpp
 )
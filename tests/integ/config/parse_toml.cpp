@@ -4,18 +4,28 @@
 #include <cstdio>
 #include <exception>
 #include <filesystem>
+#include <map>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include <fmt/base.h>
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include "msgpack_rpc/config/admission_control_config.h"
 #include "msgpack_rpc/config/client_config.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/executor_config.h"
+#include "msgpack_rpc/config/flow_control_config.h"
 #include "msgpack_rpc/config/logging_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/notification_queue_config.h"
 #include "msgpack_rpc/config/reconnection_config.h"
+#include "msgpack_rpc/config/response_cache_config.h"
 #include "msgpack_rpc/config/server_config.h"
+#include "msgpack_rpc/config/socket_config.h"
+#include "msgpack_rpc/config/traffic_capture_config.h"
 #include "msgpack_rpc/logging/log_level.h"
 
 static std::string_view format(msgpack_rpc::logging::LogLevel level) {
@@ -46,8 +56,9 @@ static std::string format(std::chrono::nanoseconds value) {
 static void format(const msgpack_rpc::config::MessageParserConfig& config) {
     fmt::print(stdout,
         "    message_parser:\n"
-        "      read_buffer_size: {}\n",
-        config.read_buffer_size());
+        "      read_buffer_size: {}\n"
+        "      max_message_size: {}\n",
+        config.read_buffer_size(), config.max_message_size());
 }
 
 static void format(const msgpack_rpc::config::ExecutorConfig& config) {
@@ -69,6 +80,88 @@ static void format(const msgpack_rpc::config::ReconnectionConfig& config) {
         format(config.max_jitter_waiting_time()));
 }
 
+static void format(const msgpack_rpc::config::SocketConfig& config) {
+    fmt::print(stdout,
+        "    socket:\n"
+        "      tcp_no_delay: {}\n"
+        "      send_buffer_size: {}\n"
+        "      receive_buffer_size: {}\n"
+        "      keep_alive: {}\n"
+        "      keep_alive_idle_time: {}\n"
+        "      keep_alive_interval: {}\n"
+        "      keep_alive_count: {}\n"
+        "      tcp_quick_ack: {}\n"
+        "      busy_poll_time: {}\n"
+        "      listen_backlog: {}\n",
+        config.tcp_no_delay(), config.send_buffer_size(),
+        config.receive_buffer_size(), config.keep_alive(),
+        format(config.keep_alive_idle_time()),
+        format(config.keep_alive_interval()), config.keep_alive_count(),
+        config.tcp_quick_ack(), format(config.busy_poll_time()),
+        config.listen_backlog());
+}
+
+static void format(const msgpack_rpc::config::CompressionConfig& config) {
+    fmt::print(stdout,
+        "    compression:\n"
+        "      enabled: {}\n"
+        "      min_message_size: {}\n",
+        config.enabled(), config.min_message_size());
+}
+
+static void format(const msgpack_rpc::config::TrafficCaptureConfig& config) {
+    fmt::print(stdout,
+        "    traffic_capture:\n"
+        "      file_path: {}\n",
+        config.file_path());
+}
+
+static void format(const msgpack_rpc::config::FlowControlConfig& config) {
+    fmt::print(stdout,
+        "    flow_control:\n"
+        "      high_watermark_bytes: {}\n"
+        "      low_watermark_bytes: {}\n"
+        "      high_watermark_messages: {}\n"
+        "      low_watermark_messages: {}\n",
+        config.high_watermark_bytes(), config.low_watermark_bytes(),
+        config.high_watermark_messages(), config.low_watermark_messages());
+}
+
+static void format(const msgpack_rpc::config::AdmissionControlConfig& config) {
+    fmt::print(stdout,
+        "    admission_control:\n"
+        "      max_connections: {}\n"
+        "      max_in_flight_per_connection: {}\n"
+        "      max_in_flight_requests: {}\n",
+        config.max_connections(), config.max_in_flight_per_connection(),
+        config.max_in_flight_requests());
+}
+
+static void format(const msgpack_rpc::config::NotificationQueueConfig& config) {
+    fmt::print(stdout,
+        "    notification_queue:\n"
+        "      max_queued_notifications: {}\n"
+        "      disconnect_slow_consumers: {}\n",
+        config.max_queued_notifications(), config.disconnect_slow_consumers());
+}
+
+static void format(
+    const std::unordered_map<std::string,
+        msgpack_rpc::config::ResponseCacheConfig>& configs) {
+    fmt::print(stdout, "    response_caches:\n");
+    const std::map<std::string, msgpack_rpc::config::ResponseCacheConfig>
+        sorted_configs(configs.begin(), configs.end());
+    for (const auto& [method_name, config] : sorted_configs) {
+        fmt::print(stdout,
+            "      {}:\n"
+            "        time_to_live: {}\n"
+            "        max_entries: {}\n"
+            "        max_bytes: {}\n",
+            method_name, format(config.time_to_live()), config.max_entries(),
+            config.max_bytes());
+    }
+}
+
 int main(int argc, const char** argv) {
     using msgpack_rpc::config::ClientConfig;
     using msgpack_rpc::config::LoggingConfig;
@@ -106,22 +199,41 @@ int main(int argc, const char** argv) {
             fmt::print(stdout,
                 "  {}:\n"
                 "    uris: [{}]\n"
-                "    call_timeout: {}\n",
+                "    call_timeout: {}\n"
+                "    propagate_deadline: {}\n"
+                "    single_flight_methods: [{}]\n",
                 key, fmt::join(config.uris(), ", "),
-                format(config.call_timeout()));
+                format(config.call_timeout()), config.propagate_deadline(),
+                fmt::join(config.single_flight_methods(), ", "));
             format(config.message_parser());
             format(config.executor());
             format(config.reconnection());
+            format(config.socket());
+            format(config.compression());
+            format(config.traffic_capture());
+            format(config.flow_control());
+            format(config.response_caches());
         }
 
         fmt::print(stdout, "server:\n");
         for (const auto& [key, config] : server_configs) {
             fmt::print(stdout,
                 "  {}:\n"
-                "    uris: [{}]\n",
-                key, fmt::join(config.uris(), ", "));
+                "    uris: [{}]\n"
+                "    upload_idle_timeout: {}\n"
+                "    call_timeout: {}\n"
+                "    propagate_deadline: {}\n",
+                key, fmt::join(config.uris(), ", "),
+                format(config.upload_idle_timeout()),
+                format(config.call_timeout()), config.propagate_deadline());
             format(config.message_parser());
             format(config.executor());
+            format(config.socket());
+            format(config.compression());
+            format(config.traffic_capture());
+            format(config.flow_control());
+            format(config.admission_control());
+            format(config.notification_queue());
         }
 
         return 0;
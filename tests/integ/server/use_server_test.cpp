@@ -18,6 +18,7 @@
  * \brief Test of servers.
  */
 #include <chrono>
+#include <cstdint>
 #include <cstdio>
 #include <functional>
 #include <future>
@@ -25,6 +26,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -54,7 +56,10 @@
 #include "msgpack_rpc/messages/method_name_view.h"
 #include "msgpack_rpc/messages/parsed_message.h"
 #include "msgpack_rpc/messages/parsed_response.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
 #include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/cancellation_token.h"
+#include "msgpack_rpc/methods/request_deadline.h"
 #include "msgpack_rpc/servers/server.h"
 #include "msgpack_rpc/servers/server_builder.h"
 #include "msgpack_rpc/transport/backends.h"
@@ -97,6 +102,28 @@ SCENARIO("Use a server") {
                 promise.set_value(str);
             });
 
+        builder.add_method<std::int64_t()>("remaining_budget", [] {
+            const auto budget = msgpack_rpc::methods::remaining_budget();
+            if (!budget) {
+                return static_cast<std::int64_t>(-1);
+            }
+            return static_cast<std::int64_t>(budget->count());
+        });
+
+        builder.add_method<bool()>("wait_for_cancellation", [] {
+            const auto token =
+                msgpack_rpc::methods::current_cancellation_token();
+            const auto deadline =
+                std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!token->is_cancelled()) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    return false;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return true;
+        });
+
         auto server = builder.build();
 
         const auto uris = server.local_endpoint_uris();
@@ -200,6 +227,120 @@ SCENARIO("Use a server") {
                 }
             }
 
+            AND_WHEN("The client send a request with the remaining budget") {
+                const auto request_id = static_cast<MessageID>(12345);
+                const auto budget = std::chrono::seconds(10);
+                const auto message =
+                    MessageSerializer::serialize_request_with_budget(
+                        "remaining_budget", request_id, budget);
+                on_connected = [&client_connection, &message] {
+                    client_connection->async_send(message);
+                };
+
+                THEN("Server send a response with the remaining budget") {
+                    std::optional<ParsedMessage> received_message;
+                    REQUIRE_CALL(*client_connection_callbacks, on_sent())
+                        .TIMES(1);
+                    REQUIRE_CALL(*client_connection_callbacks, on_received(_))
+                        .TIMES(1)
+                        .LR_SIDE_EFFECT(received_message = _1)
+                        .LR_SIDE_EFFECT(client_connection->async_close());
+                    REQUIRE_CALL(*client_connection_callbacks, on_closed(_))
+                        .TIMES(1);
+
+                    executor->run();
+
+                    REQUIRE(received_message);
+                    REQUIRE(std::holds_alternative<ParsedResponse>(
+                        *received_message));
+                    const auto response =
+                        std::get<ParsedResponse>(*received_message);
+                    CHECK(response.id() == request_id);
+                    const auto remaining_budget = std::chrono::nanoseconds(
+                        response.result().result_as<std::int64_t>());
+                    CHECK(remaining_budget > std::chrono::seconds(0));
+                    CHECK(remaining_budget <= budget);
+                }
+            }
+
+            AND_WHEN("The client send a request with an expired deadline") {
+                const auto expired_request_id = static_cast<MessageID>(12345);
+                const auto expired_message =
+                    MessageSerializer::serialize_request_with_budget("add",
+                        expired_request_id, std::chrono::nanoseconds(0), 2, 3);
+                const auto request_id = static_cast<MessageID>(12346);
+                const auto message = MessageSerializer::serialize_request(
+                    "add", request_id, 2, 3);
+                on_connected = [&client_connection, &expired_message] {
+                    client_connection->async_send(expired_message);
+                };
+
+                THEN("Server drops the expired request") {
+                    std::optional<ParsedMessage> received_message;
+                    bool is_second_sent = false;
+                    // Send the second request after the first one is sent.
+                    ALLOW_CALL(*client_connection_callbacks, on_sent())
+                        .LR_SIDE_EFFECT(if (!is_second_sent) {
+                            is_second_sent = true;
+                            client_connection->async_send(message);
+                        });
+                    REQUIRE_CALL(*client_connection_callbacks, on_received(_))
+                        .TIMES(1)
+                        .LR_SIDE_EFFECT(received_message = _1)
+                        .LR_SIDE_EFFECT(client_connection->async_close());
+                    REQUIRE_CALL(*client_connection_callbacks, on_closed(_))
+                        .TIMES(1);
+
+                    executor->run();
+
+                    REQUIRE(received_message);
+                    REQUIRE(std::holds_alternative<ParsedResponse>(
+                        *received_message));
+                    const auto response =
+                        std::get<ParsedResponse>(*received_message);
+                    CHECK(response.id() == request_id);
+                }
+            }
+
+            AND_WHEN("The client cancels a request") {
+                const auto request_id = static_cast<MessageID>(12345);
+                const auto message = MessageSerializer::serialize_request(
+                    "wait_for_cancellation", request_id);
+                const auto cancel_message =
+                    MessageSerializer::serialize_notification(
+                        msgpack_rpc::messages::CANCEL_REQUEST_METHOD_NAME,
+                        request_id);
+                on_connected = [&client_connection, &message] {
+                    client_connection->async_send(message);
+                };
+
+                THEN("Server notifies the cancellation to the method") {
+                    std::optional<ParsedMessage> received_message;
+                    bool is_cancel_sent = false;
+                    ALLOW_CALL(*client_connection_callbacks, on_sent())
+                        .LR_SIDE_EFFECT(if (!is_cancel_sent) {
+                            is_cancel_sent = true;
+                            client_connection->async_send(cancel_message);
+                        });
+                    REQUIRE_CALL(*client_connection_callbacks, on_received(_))
+                        .TIMES(1)
+                        .LR_SIDE_EFFECT(received_message = _1)
+                        .LR_SIDE_EFFECT(client_connection->async_close());
+                    REQUIRE_CALL(*client_connection_callbacks, on_closed(_))
+                        .TIMES(1);
+
+                    executor->run();
+
+                    REQUIRE(received_message);
+                    REQUIRE(std::holds_alternative<ParsedResponse>(
+                        *received_message));
+                    const auto response =
+                        std::get<ParsedResponse>(*received_message);
+                    CHECK(response.id() == request_id);
+                    CHECK(response.result().result_as<bool>());
+                }
+            }
+
             AND_WHEN("The client send a notification") {
                 const auto message = MessageSerializer::serialize_notification(
                     "write", "Test string.");
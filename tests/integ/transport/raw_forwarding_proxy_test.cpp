@@ -0,0 +1,244 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of proxies forwarding messages without decoding parameters and
+ * results.
+ */
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "create_test_logger.h"
+#include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/flow_control_config.h"
+#include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/executors/async_invoke.h"
+#include "msgpack_rpc/executors/i_single_thread_executor.h"
+#include "msgpack_rpc/executors/operation_type.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/parsed_message.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+#include "msgpack_rpc/transport/backends.h"
+#include "msgpack_rpc/transport/i_acceptor.h"
+#include "msgpack_rpc/transport/i_acceptor_factory.h"
+#include "msgpack_rpc/transport/i_backend.h"
+#include "msgpack_rpc/transport/i_connection.h"
+#include "msgpack_rpc/transport/i_connector.h"
+#include "msgpack_rpc/transport/i_raw_forwarding_proxy.h"
+#include "msgpack_rpc/transport/raw_forwarding_proxy.h"
+
+SCENARIO("Forward messages with a raw forwarding proxy") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::Status;
+    using msgpack_rpc::StatusCode;
+    using msgpack_rpc::addresses::URI;
+    using msgpack_rpc::config::FlowControlConfig;
+    using msgpack_rpc::config::MessageParserConfig;
+    using msgpack_rpc::executors::OperationType;
+    using msgpack_rpc::messages::MessageSerializer;
+    using msgpack_rpc::messages::MethodNameView;
+    using msgpack_rpc::messages::ParsedMessage;
+    using msgpack_rpc::messages::ParsedNotification;
+    using msgpack_rpc::transport::IAcceptor;
+    using msgpack_rpc::transport::IConnection;
+    using msgpack_rpc::transport::IRawForwardingProxy;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+
+    const auto executor =
+        msgpack_rpc::executors::create_single_thread_executor(logger);
+    const auto post = [&executor](std::function<void()> function) {
+        msgpack_rpc::executors::async_invoke(
+            executor, OperationType::CALLBACK, std::move(function));
+    };
+
+    const auto backend = msgpack_rpc::transport::create_tcp_backend(
+        executor, MessageParserConfig(), logger);
+    const auto uri = URI::parse("tcp://127.0.0.1:0");
+    const auto request_timeout = std::chrono::seconds(10);
+
+    GIVEN("A proxy between clients and a server") {
+        std::shared_ptr<IAcceptor> server_acceptor;
+        std::shared_ptr<IAcceptor> proxy_acceptor;
+        std::shared_ptr<IConnection> server_connection;
+        std::shared_ptr<IRawForwardingProxy> proxy;
+        std::vector<std::shared_ptr<IConnection>> client_connections;
+        bool is_finished = false;
+
+        const auto finish = [&] {
+            if (is_finished) {
+                return;
+            }
+            is_finished = true;
+            proxy->stop();
+            proxy_acceptor->stop();
+            server_acceptor->stop();
+            server_connection->async_close();
+            for (const auto& connection : client_connections) {
+                connection->async_close();
+            }
+        };
+
+        WHEN("Clients send many large messages concurrently") {
+            constexpr std::size_t num_clients = 4;
+            constexpr std::size_t num_messages_per_client = 16;
+            constexpr std::size_t message_size = 256 * 1024;
+            const auto method_name = MethodNameView("test_proxy");
+
+            const auto create_data = [](std::size_t client_index,
+                                         std::size_t sequence) {
+                constexpr std::size_t num_chars = 26;
+                return std::string(message_size,
+                    static_cast<char>(
+                        'a' + (client_index + sequence) % num_chars));
+            };
+
+            std::vector<std::vector<std::size_t>> received_sequences(
+                num_clients);
+            std::size_t num_received = 0;
+            std::size_t num_broken_messages = 0;
+
+            const auto on_server_received = [&](ParsedMessage message) {
+                const auto* notification =
+                    std::get_if<ParsedNotification>(&message);
+                if (notification == nullptr) {
+                    ++num_broken_messages;
+                    return;
+                }
+                const auto [client_index, sequence, data] =
+                    notification->parameters()
+                        .as<std::size_t, std::size_t, std::string>();
+                if (client_index >= num_clients ||
+                    data != create_data(client_index, sequence)) {
+                    ++num_broken_messages;
+                } else {
+                    received_sequences[client_index].push_back(sequence);
+                }
+                ++num_received;
+                if (num_received == num_clients * num_messages_per_client) {
+                    finish();
+                }
+            };
+
+            const auto start_client = [&](std::size_t client_index) {
+                const auto connector = backend->create_connector();
+                const auto proxy_uri = proxy_acceptor->local_address().to_uri();
+                connector->async_connect(proxy_uri,
+                    [&, client_index](const Status& status,
+                        std::shared_ptr<IConnection> connection) {
+                        if (status.code() != StatusCode::SUCCESS) {
+                            throw MsgpackRPCException(status);
+                        }
+                        client_connections.push_back(connection);
+
+                        // Connections send messages one by one.
+                        const auto weak_connection =
+                            std::weak_ptr<IConnection>(connection);
+                        auto next_sequence = std::make_shared<std::size_t>(0);
+                        const auto send_next = [&, client_index,
+                                                   weak_connection,
+                                                   next_sequence] {
+                            const auto locked = weak_connection.lock();
+                            if (!locked ||
+                                *next_sequence >= num_messages_per_client) {
+                                return;
+                            }
+                            const std::size_t sequence = (*next_sequence)++;
+                            locked->async_send(
+                                MessageSerializer::serialize_notification(
+                                    method_name, client_index, sequence,
+                                    create_data(client_index, sequence)));
+                        };
+                        connection->start([](ParsedMessage /*message*/) {},
+                            send_next, [](const Status& /*status*/) {});
+                        send_next();
+                    });
+            };
+
+            post([&] {
+                const auto server_acceptors =
+                    backend->create_acceptor_factory()->create(uri);
+                REQUIRE(server_acceptors.size() == 1);
+                server_acceptor = server_acceptors.front();
+                server_acceptor->start(
+                    [&](const std::shared_ptr<IConnection>& connection) {
+                        server_connection = connection;
+                        server_connection->start(on_server_received, [] {},
+                            [&](const Status& /*status*/) { finish(); });
+                    });
+
+                const auto connector = backend->create_connector();
+                connector->async_connect(
+                    server_acceptor->local_address().to_uri(),
+                    [&](const Status& status,
+                        std::shared_ptr<IConnection> connection) {
+                        if (status.code() != StatusCode::SUCCESS) {
+                            throw MsgpackRPCException(status);
+                        }
+                        proxy = msgpack_rpc::transport::
+                            create_raw_forwarding_proxy(
+                                {std::move(connection)},
+                                [](MethodNameView /*method_name*/) {
+                                    return static_cast<std::size_t>(0);
+                                },
+                                request_timeout, FlowControlConfig(), logger);
+                        proxy->start();
+
+                        const auto proxy_acceptors =
+                            backend->create_acceptor_factory()->create(uri);
+                        REQUIRE(proxy_acceptors.size() == 1);
+                        proxy_acceptor = proxy_acceptors.front();
+                        proxy_acceptor->start(
+                            [&](const std::shared_ptr<IConnection>&
+                                    connection) {
+                                proxy->add_downstream(connection);
+                            });
+
+                        for (std::size_t i = 0; i < num_clients; ++i) {
+                            start_client(i);
+                        }
+                    });
+            });
+
+            THEN("The server receives all messages without corruption") {
+                executor->run();
+
+                CHECK(num_broken_messages == 0U);
+                CHECK(num_received == num_clients * num_messages_per_client);
+                std::vector<std::size_t> expected_sequences;
+                for (std::size_t i = 0; i < num_messages_per_client; ++i) {
+                    expected_sequences.push_back(i);
+                }
+                for (const auto& sequences : received_sequences) {
+                    CHECK(sequences == expected_sequences);
+                }
+            }
+        }
+    }
+}
@@ -3,5 +3,6 @@ set(SOURCE_FILES
     catch_event_listener.cpp
     connector_test.cpp
     create_test_logger.cpp
+    raw_forwarding_proxy_test.cpp
     send_message_test.cpp
 )
@@ -1,5 +1,6 @@
-#include "acceptor_test.cpp"         // NOLINT(bugprone-suspicious-include)
-#include "catch_event_listener.cpp"  // NOLINT(bugprone-suspicious-include)
-#include "connector_test.cpp"        // NOLINT(bugprone-suspicious-include)
-#include "create_test_logger.cpp"    // NOLINT(bugprone-suspicious-include)
-#include "send_message_test.cpp"     // NOLINT(bugprone-suspicious-include)
+#include "acceptor_test.cpp"              // NOLINT(bugprone-suspicious-include)
+#include "catch_event_listener.cpp"       // NOLINT(bugprone-suspicious-include)
+#include "connector_test.cpp"             // NOLINT(bugprone-suspicious-include)
+#include "create_test_logger.cpp"         // NOLINT(bugprone-suspicious-include)
+#include "raw_forwarding_proxy_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "send_message_test.cpp"          // NOLINT(bugprone-suspicious-include)
@@ -83,6 +83,85 @@ def test_invalid_call_timeout_sec(value: typing.Any, config_checker: ConfigCheck
     config_checker.assert_invalid(config_data)
 
 
+@pytest.mark.parametrize(
+    "value",
+    [
+        True,
+        False,
+    ],
+)
+def test_correct_propagate_deadline(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "propagate_deadline": value,
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        1,
+    ],
+)
+def test_invalid_propagate_deadline(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "propagate_deadline": value,
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        [],
+        ["get_item"],
+        ["get_item", "get_user"],
+    ],
+)
+def test_correct_single_flight_methods(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "single_flight_methods": value,
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        "get_item",
+        123,
+        [123],
+    ],
+)
+def test_invalid_single_flight_methods(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "single_flight_methods": value,
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
 @pytest.mark.parametrize(
     "value",
     [
@@ -127,6 +206,50 @@ def test_invalid_read_buffer_size(value: typing.Any, config_checker: ConfigCheck
     config_checker.assert_invalid(config_data)
 
 
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        1,
+        2,
+        1000,
+    ],
+)
+def test_correct_max_message_size(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "message_parser": {
+                    "max_message_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        0,
+        -1,
+        -10,
+    ],
+)
+def test_invalid_max_message_size(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "message_parser": {
+                    "max_message_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
 @pytest.mark.parametrize(
     "value",
     [
@@ -351,3 +474,485 @@ def test_invalid_max_jitter_waiting_time_sec(
         }
     }
     config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        True,
+        False,
+    ],
+)
+def test_correct_tcp_no_delay(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "socket": {
+                    "tcp_no_delay": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        1,
+    ],
+)
+def test_invalid_tcp_no_delay(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "socket": {
+                    "tcp_no_delay": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        1048576,
+    ],
+)
+def test_correct_send_buffer_size(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "socket": {
+                    "send_buffer_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+    ],
+)
+def test_invalid_send_buffer_size(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "socket": {
+                    "send_buffer_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0.0,
+        0.001,
+        60.0,
+    ],
+)
+def test_correct_keep_alive_idle_time_sec(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "socket": {
+                    "keep_alive_idle_time_sec": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -0.001,
+    ],
+)
+def test_invalid_keep_alive_idle_time_sec(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "socket": {
+                    "keep_alive_idle_time_sec": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        True,
+        False,
+    ],
+)
+def test_correct_compression_enabled(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "compression": {
+                    "enabled": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        1,
+    ],
+)
+def test_invalid_compression_enabled(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "compression": {
+                    "enabled": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        1,
+        16384,
+    ],
+)
+def test_correct_compression_min_message_size(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "compression": {
+                    "min_message_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        0,
+    ],
+)
+def test_invalid_compression_min_message_size(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "compression": {
+                    "min_message_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        "",
+        "capture.bin",
+        "directory/capture.bin",
+    ],
+)
+def test_correct_traffic_capture_file_path(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "traffic_capture": {
+                    "file_path": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        123,
+    ],
+)
+def test_invalid_traffic_capture_file_path(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "traffic_capture": {
+                    "file_path": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        67108864,
+    ],
+)
+def test_correct_high_watermark_bytes(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "flow_control": {
+                    "high_watermark_bytes": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_high_watermark_bytes(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "flow_control": {
+                    "high_watermark_bytes": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        33554432,
+    ],
+)
+def test_correct_low_watermark_bytes(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "flow_control": {
+                    "low_watermark_bytes": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_low_watermark_bytes(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "flow_control": {
+                    "low_watermark_bytes": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        1024,
+    ],
+)
+def test_correct_high_watermark_messages(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "flow_control": {
+                    "high_watermark_messages": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_high_watermark_messages(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "flow_control": {
+                    "high_watermark_messages": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        512,
+    ],
+)
+def test_correct_low_watermark_messages(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "flow_control": {
+                    "low_watermark_messages": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_low_watermark_messages(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "client": {
+            "example": {
+                "flow_control": {
+                    "low_watermark_messages": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        {},
+        {"get_item": {}},
+        {"get_item": {"time_to_live_sec": 0.5, "max_entries": 1}},
+        {"get_item": {"max_bytes": 1024}},
+    ],
+)
+def test_correct_response_caches(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "response_caches": value,
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        "get_item",
+        {"get_item": 1},
+        {"get_item": {"time_to_live_sec": 0.0}},
+        {"get_item": {"max_entries": 0}},
+        {"get_item": {"max_bytes": 0}},
+        {"get_item": {"invalid": 1}},
+    ],
+)
+def test_invalid_response_caches(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "client": {
+            "example": {
+                "response_caches": value,
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
@@ -45,6 +45,123 @@ def test_invalid_uris(value: typing.Any, config_checker: ConfigChecker):
     config_checker.assert_invalid(config_data)
 
 
+@pytest.mark.parametrize(
+    "value",
+    [
+        0.00001,
+        1.0,
+    ],
+)
+def test_correct_upload_idle_timeout_sec(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "upload_idle_timeout_sec": value,
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        0.0,
+        -0.000001,
+    ],
+)
+def test_invalid_upload_idle_timeout_sec(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "upload_idle_timeout_sec": value,
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0.00001,
+        1.0,
+    ],
+)
+def test_correct_call_timeout_sec(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "call_timeout_sec": value,
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        0.0,
+        -0.000001,
+    ],
+)
+def test_invalid_call_timeout_sec(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "call_timeout_sec": value,
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        True,
+        False,
+    ],
+)
+def test_correct_propagate_deadline(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "propagate_deadline": value,
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        1,
+    ],
+)
+def test_invalid_propagate_deadline(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "propagate_deadline": value,
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
 @pytest.mark.parametrize(
     "value",
     [
@@ -89,6 +206,50 @@ def test_invalid_read_buffer_size(value: typing.Any, config_checker: ConfigCheck
     config_checker.assert_invalid(config_data)
 
 
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        1,
+        2,
+        1000,
+    ],
+)
+def test_correct_max_message_size(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "message_parser": {
+                    "max_message_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        0,
+        -1,
+        -10,
+    ],
+)
+def test_invalid_max_message_size(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "message_parser": {
+                    "max_message_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
 @pytest.mark.parametrize(
     "value",
     [
@@ -179,3 +340,714 @@ def test_invalid_num_callback_threads(value: typing.Any, config_checker: ConfigC
         }
     }
     config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        True,
+        False,
+    ],
+)
+def test_correct_tcp_no_delay(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "socket": {
+                    "tcp_no_delay": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        1,
+    ],
+)
+def test_invalid_tcp_no_delay(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "socket": {
+                    "tcp_no_delay": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        1048576,
+    ],
+)
+def test_correct_send_buffer_size(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "socket": {
+                    "send_buffer_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+    ],
+)
+def test_invalid_send_buffer_size(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "socket": {
+                    "send_buffer_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0.0,
+        0.001,
+        60.0,
+    ],
+)
+def test_correct_keep_alive_idle_time_sec(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "socket": {
+                    "keep_alive_idle_time_sec": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -0.001,
+    ],
+)
+def test_invalid_keep_alive_idle_time_sec(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "socket": {
+                    "keep_alive_idle_time_sec": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        4096,
+    ],
+)
+def test_correct_listen_backlog(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "socket": {
+                    "listen_backlog": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+    ],
+)
+def test_invalid_listen_backlog(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "socket": {
+                    "listen_backlog": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        True,
+        False,
+    ],
+)
+def test_correct_compression_enabled(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "compression": {
+                    "enabled": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        1,
+    ],
+)
+def test_invalid_compression_enabled(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "compression": {
+                    "enabled": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        1,
+        16384,
+    ],
+)
+def test_correct_compression_min_message_size(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "compression": {
+                    "min_message_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        0,
+    ],
+)
+def test_invalid_compression_min_message_size(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "compression": {
+                    "min_message_size": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        "",
+        "capture.bin",
+        "directory/capture.bin",
+    ],
+)
+def test_correct_traffic_capture_file_path(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "traffic_capture": {
+                    "file_path": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        123,
+    ],
+)
+def test_invalid_traffic_capture_file_path(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "traffic_capture": {
+                    "file_path": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        67108864,
+    ],
+)
+def test_correct_high_watermark_bytes(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "flow_control": {
+                    "high_watermark_bytes": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_high_watermark_bytes(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "flow_control": {
+                    "high_watermark_bytes": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        33554432,
+    ],
+)
+def test_correct_low_watermark_bytes(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "flow_control": {
+                    "low_watermark_bytes": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_low_watermark_bytes(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "flow_control": {
+                    "low_watermark_bytes": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        1024,
+    ],
+)
+def test_correct_high_watermark_messages(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "flow_control": {
+                    "high_watermark_messages": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_high_watermark_messages(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "flow_control": {
+                    "high_watermark_messages": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        512,
+    ],
+)
+def test_correct_low_watermark_messages(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "flow_control": {
+                    "low_watermark_messages": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_low_watermark_messages(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "flow_control": {
+                    "low_watermark_messages": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        1024,
+    ],
+)
+def test_correct_max_connections(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "admission_control": {
+                    "max_connections": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_max_connections(value: typing.Any, config_checker: ConfigChecker):
+    config_data = {
+        "server": {
+            "example": {
+                "admission_control": {
+                    "max_connections": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        1024,
+    ],
+)
+def test_correct_max_in_flight_per_connection(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "admission_control": {
+                    "max_in_flight_per_connection": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_max_in_flight_per_connection(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "admission_control": {
+                    "max_in_flight_per_connection": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        1024,
+    ],
+)
+def test_correct_max_in_flight_requests(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "admission_control": {
+                    "max_in_flight_requests": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_max_in_flight_requests(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "admission_control": {
+                    "max_in_flight_requests": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        0,
+        1,
+        1024,
+    ],
+)
+def test_correct_max_queued_notifications(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "notification_queue": {
+                    "max_queued_notifications": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        -1,
+        1.5,
+    ],
+)
+def test_invalid_max_queued_notifications(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "notification_queue": {
+                    "max_queued_notifications": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        True,
+        False,
+    ],
+)
+def test_correct_disconnect_slow_consumers(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "notification_queue": {
+                    "disconnect_slow_consumers": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_valid(config_data)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        None,
+        "Any",
+        1,
+    ],
+)
+def test_invalid_disconnect_slow_consumers(
+    value: typing.Any, config_checker: ConfigChecker
+):
+    config_data = {
+        "server": {
+            "example": {
+                "notification_queue": {
+                    "disconnect_slow_consumers": value,
+                }
+            }
+        }
+    }
+    config_checker.assert_invalid(config_data)
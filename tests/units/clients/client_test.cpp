@@ -30,17 +30,21 @@
 
 #include "impl/mock_call_future_impl.h"
 #include "impl/mock_client_impl.h"
+#include "msgpack_rpc/clients/response_cache_statistics.h"
 #include "msgpack_rpc/clients/server_exception.h"
 #include "msgpack_rpc/common/status.h"
 #include "msgpack_rpc/common/status_code.h"
 #include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/method_name_view.h"
 #include "trompeloeil_catch2.h"
 
 TEST_CASE("msgpack_rpc::clients::Client") {
     using msgpack_rpc::StatusCode;
     using msgpack_rpc::clients::Client;
+    using msgpack_rpc::clients::ResponseCacheStatistics;
     using msgpack_rpc::clients::ServerException;
     using msgpack_rpc::messages::CallResult;
+    using msgpack_rpc::messages::MethodNameView;
     using msgpack_rpc_test::MockCallFutureImpl;
     using msgpack_rpc_test::MockClientImpl;
     using trompeloeil::_;
@@ -96,6 +100,25 @@ TEST_CASE("msgpack_rpc::clients::Client") {
                     CHECK(e.error_as<std::string_view>() == "test message");
                 }
             }
+
+            SECTION("and cancel it") {
+                REQUIRE_CALL(*call_future_impl, cancel()).TIMES(1);
+
+                future.cancel();
+            }
+
+            SECTION("and add a completion handler") {
+                REQUIRE_CALL(*call_future_impl, add_completion_handler(_))
+                    .TIMES(1)
+                    .SIDE_EFFECT(_1());
+                bool is_called = false;
+
+                future.add_completion_handler([&is_called] {
+                    is_called = true;
+                });
+
+                CHECK(is_called);
+            }
         }
 
         SECTION("and call a method synchronously") {
@@ -183,10 +206,49 @@ TEST_CASE("msgpack_rpc::clients::Client") {
             client.call<void>("method1", 3, "abc");
         }
 
+        SECTION("and call a prepared method") {
+            auto prepared_call =
+                client.prepare<std::string(int, std::string)>("method1");
+            CHECK(prepared_call.method_name() == MethodNameView("method1"));
+
+            const auto call_future_impl =
+                std::make_shared<MockCallFutureImpl>();
+            REQUIRE_CALL(*client_impl, async_call(_, _))
+                .WITH(_1 == MethodNameView("method1"))
+                .TIMES(1)
+                .RETURN(call_future_impl);
+
+            const auto result_zone = std::make_shared<msgpack::zone>();
+            const auto result_object = msgpack::object("def", *result_zone);
+            const auto call_result =
+                CallResult::create_result(result_object, result_zone);
+            REQUIRE_CALL(*call_future_impl, get_result())
+                .TIMES(1)
+                .RETURN(call_result);
+
+            const std::string result = prepared_call.call(3, "abc");
+
+            CHECK(result == "def");
+        }
+
         SECTION("and notify to a method") {
             REQUIRE_CALL(*client_impl, notify(_, _)).TIMES(1);
 
             client.notify("method2", "notification");
         }
+
+        SECTION("and get statistics of a cache of responses") {
+            REQUIRE_CALL(*client_impl,
+                response_cache_statistics(MethodNameView("method1")))
+                .TIMES(1)
+                .RETURN(ResponseCacheStatistics(3U, 2U, 1U, 10U));
+
+            const auto statistics = client.response_cache_statistics("method1");
+
+            CHECK(statistics.num_hits() == 3U);
+            CHECK(statistics.num_misses() == 2U);
+            CHECK(statistics.num_entries() == 1U);
+            CHECK(statistics.num_bytes() == 10U);
+        }
     }
 }
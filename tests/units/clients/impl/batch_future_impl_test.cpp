@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of BatchFutureImpl class.
+ */
+#include "msgpack_rpc/clients/impl/batch_future_impl.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+#include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/clients/impl/call_future_impl.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/call_result.h"
+
+TEST_CASE("msgpack_rpc::clients::impl::BatchFutureImpl") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::Status;
+    using msgpack_rpc::StatusCode;
+    using msgpack_rpc::clients::impl::BatchFutureImpl;
+    using msgpack_rpc::clients::impl::CallFutureImpl;
+    using msgpack_rpc::messages::CallResult;
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+    constexpr std::size_t num_calls = 2;
+    const auto batch_future =
+        std::make_shared<BatchFutureImpl>(deadline, num_calls);
+    const auto future1 = std::make_shared<CallFutureImpl>(deadline);
+    const auto future2 = std::make_shared<CallFutureImpl>(deadline);
+    future1->add_completion_handler(
+        [batch_future] { batch_future->on_finished(); });
+    future2->add_completion_handler(
+        [batch_future] { batch_future->on_finished(); });
+
+    const auto timeout = std::chrono::milliseconds(1);
+
+    CHECK(batch_future->num_calls() == num_calls);
+    CHECK(batch_future->num_finished_calls() == 0U);
+
+    SECTION("wait before any RPC finishes") {
+        CHECK_THROWS_AS(
+            batch_future->wait_any_within(timeout), MsgpackRPCException);
+        CHECK_THROWS_AS(
+            batch_future->wait_all_within(timeout), MsgpackRPCException);
+    }
+
+    SECTION("wait after an RPC finishes") {
+        const auto result_zone = std::make_shared<msgpack::zone>();
+        future1->set(CallResult::create_result(
+            msgpack::object(1, *result_zone), result_zone));
+
+        CHECK(batch_future->num_finished_calls() == 1U);
+        CHECK_NOTHROW(batch_future->wait_any());
+        CHECK_THROWS_AS(
+            batch_future->wait_all_within(timeout), MsgpackRPCException);
+    }
+
+    SECTION("wait after all RPCs finish") {
+        const auto result_zone = std::make_shared<msgpack::zone>();
+        future1->set(CallResult::create_result(
+            msgpack::object(1, *result_zone), result_zone));
+        future2->set(Status(StatusCode::TIMEOUT, "Test timeout."));
+
+        CHECK(batch_future->num_finished_calls() == num_calls);
+        CHECK_NOTHROW(batch_future->wait_any());
+        CHECK_NOTHROW(batch_future->wait_all());
+    }
+
+    SECTION("set a handler to a finished RPC") {
+        const auto future3 = std::make_shared<CallFutureImpl>(deadline);
+        future3->cancel();
+
+        bool is_called = false;
+        future3->add_completion_handler([&is_called] { is_called = true; });
+
+        CHECK(is_called);
+    }
+}
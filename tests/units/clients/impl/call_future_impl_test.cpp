@@ -30,11 +30,15 @@
 #include "../../create_test_logger.h"
 #include "msgpack_rpc/clients/impl/call_promise.h.h"
 #include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
 #include "msgpack_rpc/config/executor_config.h"
 #include "msgpack_rpc/executors/i_async_executor.h"
 #include "msgpack_rpc/messages/call_result.h"
 
 TEST_CASE("msgpack_rpc::clients::impl::CallFutureImpl") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::StatusCode;
     using msgpack_rpc::clients::impl::CallFutureImpl;
     using msgpack_rpc::clients::impl::CallPromise;
     using msgpack_rpc::clients::impl::ICallFutureImpl;
@@ -73,10 +77,64 @@ TEST_CASE("msgpack_rpc::clients::impl::CallFutureImpl") {
 
             CHECK(received_result.result_as<std::string_view>() == "abc");
         }
+
+        SECTION("and cancel") {
+            int num_cancel_calls = 0;
+            promise.future()->set_cancel_handler(
+                [&num_cancel_calls] { ++num_cancel_calls; });
+
+            future->cancel();
+
+            CHECK(num_cancel_calls == 0);
+            const CallResult received_result = future->get_result();
+            CHECK(received_result.result_as<std::string_view>() == "abc");
+        }
+    }
+
+    SECTION("cancel") {
+        int num_cancel_calls = 0;
+        promise.future()->set_cancel_handler(
+            [&num_cancel_calls] { ++num_cancel_calls; });
+
+        future->cancel();
+        future->cancel();
+
+        CHECK(num_cancel_calls == 1);
+        try {
+            (void)future->get_result();
+            FAIL();
+        } catch (const MsgpackRPCException& e) {
+            CHECK(e.status().code() == StatusCode::OPERATION_ABORTED);
+        }
     }
 
     SECTION("wait the result without a result") {
         const auto timeout = std::chrono::milliseconds(1);
         REQUIRE_THROWS((void)future->get_result_within(timeout));
     }
+
+    SECTION("call completion handlers") {
+        int num_handler_calls = 0;
+        promise.future()->add_completion_handler(
+            [&num_handler_calls] { ++num_handler_calls; });
+        promise.future()->add_completion_handler(
+            [&num_handler_calls] { ++num_handler_calls; });
+        CHECK_FALSE(promise.future()->is_finished());
+        CHECK_FALSE(promise.future()->try_get_result().has_value());
+
+        const auto result_zone = std::make_shared<msgpack::zone>();
+        const auto result_object = msgpack::object("abc", *result_zone);
+        promise.set(CallResult::create_result(result_object, result_zone));
+
+        CHECK(num_handler_calls == 2);
+        CHECK(promise.future()->is_finished());
+        const auto received_result = promise.future()->try_get_result();
+        REQUIRE(received_result.has_value());
+        CHECK(received_result->result_as<std::string_view>() == "abc");
+
+        promise.future()->add_completion_handler(
+            [&num_handler_calls] { ++num_handler_calls; });
+
+        CHECK(num_handler_calls == 3);
+    }
 }
@@ -20,7 +20,9 @@
 #include "msgpack_rpc/clients/impl/call_list.h"
 
 #include <chrono>
+#include <memory>
 #include <string>
+#include <thread>
 #include <tuple>
 
 #include <catch2/catch_test_macros.hpp>
@@ -42,8 +44,10 @@
 
 TEST_CASE("msgpack_rpc::clients::impl::CallList") {
     using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::Status;
     using msgpack_rpc::StatusCode;
     using msgpack_rpc::clients::impl::Call;
+    using msgpack_rpc::clients::impl::CallFutureImpl;
     using msgpack_rpc::clients::impl::CallList;
     using msgpack_rpc::clients::impl::make_parameters_serializer;
     using msgpack_rpc::messages::MessageID;
@@ -58,7 +62,8 @@ TEST_CASE("msgpack_rpc::clients::impl::CallList") {
     executor->start();
 
     const auto timeout = std::chrono::seconds(1);
-    const auto list = std::make_shared<CallList>(timeout, executor, logger);
+    const auto list =
+        std::make_shared<CallList>(timeout, false, executor, logger);
 
     SECTION("register an RPC") {
         const auto method_name =
@@ -83,6 +88,32 @@ TEST_CASE("msgpack_rpc::clients::impl::CallList") {
             const auto result = future->get_result();
         }
 
+        SECTION("and cancel it") {
+            CHECK(list->cancel(request_id));
+
+            try {
+                (void)future->get_result();
+                FAIL();
+            } catch (const MsgpackRPCException& e) {
+                CHECK(e.status().code() == StatusCode::OPERATION_ABORTED);
+            }
+            CHECK_FALSE(list->cancel(request_id));
+        }
+
+        SECTION("and fail it") {
+            CHECK(list->fail(request_id,
+                Status(StatusCode::OVERLOADED, "Test error.")));
+
+            try {
+                (void)future->get_result();
+                FAIL();
+            } catch (const MsgpackRPCException& e) {
+                CHECK(e.status().code() == StatusCode::OVERLOADED);
+            }
+            CHECK_FALSE(list->fail(request_id,
+                Status(StatusCode::OVERLOADED, "Test error.")));
+        }
+
         SECTION("and try to handle different response") {
             const auto response = create_parsed_successful_response(
                 request.id() + static_cast<MessageID>(1), "def");
@@ -93,7 +124,8 @@ TEST_CASE("msgpack_rpc::clients::impl::CallList") {
 
     SECTION("register an RPC with small timeout") {
         const auto timeout = std::chrono::milliseconds(1);
-        const auto list = std::make_shared<CallList>(timeout, executor, logger);
+        const auto list =
+            std::make_shared<CallList>(timeout, false, executor, logger);
 
         const auto method_name =
             msgpack_rpc::messages::MethodNameView("method1");
@@ -118,6 +150,122 @@ TEST_CASE("msgpack_rpc::clients::impl::CallList") {
         }
     }
 
+    SECTION("extend the timeout of an RPC") {
+        const auto timeout = std::chrono::milliseconds(200);
+        const auto list =
+            std::make_shared<CallList>(timeout, false, executor, logger);
+
+        const auto method_name =
+            msgpack_rpc::messages::MethodNameView("method1");
+        const auto [request_id, serialized_request, future] =
+            list->create(method_name, make_parameters_serializer());
+
+        // Longer than the timeout in total.
+        constexpr int num_extensions = 6;
+        for (int i = 0; i < num_extensions; ++i) {
+            std::this_thread::sleep_for(timeout / 4);
+            list->extend_timeout(request_id);
+        }
+        CHECK_FALSE(future->is_finished());
+
+        try {
+            (void)future->get_result_within(std::chrono::seconds(1));
+            FAIL();
+        } catch (const MsgpackRPCException& e) {
+            CHECK(e.status().code() == StatusCode::TIMEOUT);
+        }
+    }
+
+    SECTION("register an RPC propagating the deadline") {
+        const auto list =
+            std::make_shared<CallList>(timeout, true, executor, logger);
+
+        const auto method_name =
+            msgpack_rpc::messages::MethodNameView("method1");
+        const auto param1 = std::string("abc");
+
+        const auto [request_id, serialized_request, future] =
+            list->create(method_name, make_parameters_serializer(param1));
+
+        const auto request = parse_request(serialized_request);
+        CHECK(request.method_name() == method_name);
+        CHECK(request.id() == request_id);
+        CHECK(request.parameters().as<std::string>() ==
+            std::forward_as_tuple(param1));
+        REQUIRE(request.deadline().has_value());
+        CHECK(
+            *request.deadline() <= std::chrono::steady_clock::now() + timeout);
+    }
+
+    SECTION("register a batch of RPCs") {
+        const auto method_name =
+            msgpack_rpc::messages::MethodNameView("method1");
+        const auto param1 = std::string("abc");
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        const auto [request_id1, serialized_request1] =
+            list->serialize_request(
+                method_name, make_parameters_serializer(param1), deadline);
+        const auto [request_id2, serialized_request2] =
+            list->serialize_request(
+                method_name, make_parameters_serializer(param1), deadline);
+        CHECK(request_id1 != request_id2);
+        CHECK(parse_request(serialized_request1).id() == request_id1);
+        CHECK(parse_request(serialized_request2).id() == request_id2);
+
+        const auto future1 = std::make_shared<CallFutureImpl>(deadline);
+        const auto future2 = std::make_shared<CallFutureImpl>(deadline);
+        list->register_batch({{request_id1, future1}, {request_id2, future2}},
+            deadline);
+
+        SECTION("and handle the responses") {
+            list->handle(create_parsed_successful_response(request_id1, 1));
+            list->handle(create_parsed_successful_response(request_id2, 2));
+
+            CHECK(future1->get_result().result_as<int>() == 1);
+            CHECK(future2->get_result().result_as<int>() == 2);
+        }
+
+        SECTION("and cancel one of them") {
+            CHECK(list->cancel(request_id1));
+            list->handle(create_parsed_successful_response(request_id2, 2));
+
+            CHECK_THROWS(future1->get_result());
+            CHECK(future2->get_result().result_as<int>() == 2);
+        }
+    }
+
+    SECTION("register a batch of RPCs with small timeout") {
+        const auto method_name =
+            msgpack_rpc::messages::MethodNameView("method1");
+        const auto param1 = std::string("abc");
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+
+        const auto [request_id1, serialized_request1] =
+            list->serialize_request(
+                method_name, make_parameters_serializer(param1), deadline);
+        const auto [request_id2, serialized_request2] =
+            list->serialize_request(
+                method_name, make_parameters_serializer(param1), deadline);
+        const auto future1 = std::make_shared<CallFutureImpl>(deadline);
+        const auto future2 = std::make_shared<CallFutureImpl>(deadline);
+        list->register_batch({{request_id1, future1}, {request_id2, future2}},
+            deadline);
+
+        SECTION("and handle timeout") {
+            list->handle(create_parsed_successful_response(request_id1, 1));
+
+            CHECK(future1->get_result().result_as<int>() == 1);
+            try {
+                (void)future2->get_result_within(std::chrono::seconds(1));
+                FAIL();
+            } catch (const MsgpackRPCException& e) {
+                CHECK(e.status().code() == StatusCode::TIMEOUT);
+            }
+        }
+    }
+
     SECTION("register several RPC resulting in different request ID") {
         const auto method_name =
             msgpack_rpc::messages::MethodNameView("method1");
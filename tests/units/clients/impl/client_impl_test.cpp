@@ -24,23 +24,30 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include "../../create_test_logger.h"
+#include "../../methods/mock_method.h"
 #include "../../transport/mock_backend.h"
 #include "../../transport/mock_connection.h"
 #include "../../transport/mock_connector.h"
 #include "msgpack_rpc/addresses/uri.h"
 #include "msgpack_rpc/clients/impl/call_list.h"
 #include "msgpack_rpc/clients/impl/client_connector.h"
+#include "msgpack_rpc/clients/impl/i_batch_future_impl.h"
 #include "msgpack_rpc/clients/impl/i_call_future_impl.h"
 #include "msgpack_rpc/clients/impl/i_client_impl.h"
 #include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/common/status.h"
 #include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/config/flow_control_config.h"
 #include "msgpack_rpc/config/reconnection_config.h"
+#include "msgpack_rpc/config/response_cache_config.h"
 #include "msgpack_rpc/executors/async_invoke.h"
 #include "msgpack_rpc/executors/i_single_thread_executor.h"
 #include "msgpack_rpc/executors/operation_type.h"
@@ -49,6 +56,10 @@
 #include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/message_serializer.h"
 #include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/i_method_processor.h"
+#include "msgpack_rpc/methods/method_processor.h"
 #include "msgpack_rpc/transport/backend_list.h"
 #include "msgpack_rpc/transport/i_connection.h"
 #include "msgpack_rpc_test/create_parsed_messages.h"
@@ -62,20 +73,29 @@ TEST_CASE("msgpack_rpc::clients::impl::ClientImpl") {
     using msgpack_rpc::clients::impl::CallList;
     using msgpack_rpc::clients::impl::ClientConnector;
     using msgpack_rpc::clients::impl::ClientImpl;
+    using msgpack_rpc::clients::impl::IBatchFutureImpl;
     using msgpack_rpc::clients::impl::ICallFutureImpl;
     using msgpack_rpc::clients::impl::IClientImpl;
     using msgpack_rpc::clients::impl::make_parameters_serializer;
+    using msgpack_rpc::config::FlowControlConfig;
     using msgpack_rpc::config::ReconnectionConfig;
+    using msgpack_rpc::config::ResponseCacheConfig;
     using msgpack_rpc::executors::OperationType;
     using msgpack_rpc::messages::MessageID;
     using msgpack_rpc::messages::MessageSerializer;
     using msgpack_rpc::messages::MethodNameView;
+    using msgpack_rpc::messages::SerializedMessage;
     using msgpack_rpc::transport::IConnection;
+    using msgpack_rpc_test::create_parsed_notification;
+    using msgpack_rpc_test::create_parsed_request;
     using msgpack_rpc_test::create_parsed_successful_response;
     using msgpack_rpc_test::MockBackend;
     using msgpack_rpc_test::MockConnection;
     using msgpack_rpc_test::MockConnector;
+    using msgpack_rpc_test::MockMethod;
+    using msgpack_rpc_test::parse_notification;
     using msgpack_rpc_test::parse_request;
+    using msgpack_rpc_test::parse_requests;
     using trompeloeil::_;
 
     const auto logger = msgpack_rpc_test::create_test_logger();
@@ -90,7 +110,17 @@ TEST_CASE("msgpack_rpc::clients::impl::ClientImpl") {
 
     constexpr auto request_timeout = std::chrono::seconds(1);
     const auto call_list =
-        std::make_shared<CallList>(request_timeout, executor, logger);
+        std::make_shared<CallList>(request_timeout, false, executor, logger);
+
+    auto server_method = std::make_unique<MockMethod>();
+    auto& server_method_ref = *server_method;
+    const auto server_method_name = MethodNameView("server_method");
+    ALLOW_CALL(server_method_ref, name())
+        .RETURN(server_method_name);
+    const std::shared_ptr<msgpack_rpc::methods::IMethodProcessor>
+        method_processor =
+            msgpack_rpc::methods::create_method_processor(logger);
+    method_processor->append(std::move(server_method));
 
     msgpack_rpc::transport::BackendList backends;
     const auto backend = std::make_shared<MockBackend>();
@@ -100,6 +130,12 @@ TEST_CASE("msgpack_rpc::clients::impl::ClientImpl") {
 
     const auto server_uris = std::vector<URI>{URI(scheme, "host1")};
 
+    const auto single_flight_methods =
+        std::vector<std::string>{"single_flight_method"};
+    const auto response_caches =
+        std::unordered_map<std::string, ResponseCacheConfig>{
+            {"cached_method", ResponseCacheConfig()}};
+
     SECTION("connect successfully") {
         const auto connection = std::make_shared<MockConnection>();
         IConnection::MessageReceivedCallback on_received =
@@ -118,8 +154,10 @@ TEST_CASE("msgpack_rpc::clients::impl::ClientImpl") {
 
         const auto client_connector = std::make_shared<ClientConnector>(
             executor, backends, server_uris, ReconnectionConfig(), logger);
-        const auto client = std::make_shared<ClientImpl>(
-            client_connector, call_list, async_executor, logger);
+        const auto client = std::make_shared<ClientImpl>(client_connector,
+            call_list, method_processor, async_executor,
+            FlowControlConfig(), single_flight_methods, response_caches,
+            logger);
 
         post([&client] { client->start(); });
 
@@ -160,6 +198,321 @@ TEST_CASE("msgpack_rpc::clients::impl::ClientImpl") {
             CHECK(future->get_result().result_as<std::string>() == "result");
         }
 
+        SECTION("and share an RPC among identical calls") {
+            const auto method_name = MethodNameView("single_flight_method");
+            const auto param1 = std::string("param1");
+
+            std::shared_ptr<ICallFutureImpl> future1;
+            std::shared_ptr<ICallFutureImpl> future2;
+            post([&client, &method_name, &param1, &future1, &future2] {
+                future1 = client->async_call(
+                    method_name, make_parameters_serializer(param1));
+                future2 = client->async_call(
+                    method_name, make_parameters_serializer(param1));
+            });
+
+            REQUIRE_CALL(*connection, async_send(_))
+                .TIMES(1)
+                .LR_SIDE_EFFECT(post(on_sent))
+                .LR_SIDE_EFFECT(post([&on_received, serialized_request = _1] {
+                    const auto request = parse_request(serialized_request);
+                    const auto request_id = request.id();
+                    on_received(create_parsed_successful_response(
+                        request_id, "result"));
+                }));
+
+            REQUIRE_NOTHROW(executor->run());
+
+            CHECK(future1 != future2);
+            CHECK(future1->get_result().result_as<std::string>() == "result");
+            CHECK(future2->get_result().result_as<std::string>() == "result");
+        }
+
+        SECTION("and cancel one of identical calls") {
+            const auto method_name = MethodNameView("single_flight_method");
+            const auto param1 = std::string("param1");
+
+            std::shared_ptr<ICallFutureImpl> future1;
+            std::shared_ptr<ICallFutureImpl> future2;
+            post([&client, &method_name, &param1, &future1, &future2] {
+                future1 = client->async_call(
+                    method_name, make_parameters_serializer(param1));
+                future2 = client->async_call(
+                    method_name, make_parameters_serializer(param1));
+            });
+
+            REQUIRE_CALL(*connection, async_send(_))
+                .TIMES(1)
+                .LR_SIDE_EFFECT(post(on_sent))
+                .LR_SIDE_EFFECT(post([&on_received, &future1,
+                                         serialized_request = _1] {
+                    future1->cancel();
+                    const auto request = parse_request(serialized_request);
+                    on_received(create_parsed_successful_response(
+                        request.id(), "result"));
+                }));
+
+            REQUIRE_NOTHROW(executor->run());
+
+            CHECK_THROWS((void)future1->get_result());
+            CHECK(future2->get_result().result_as<std::string>() == "result");
+        }
+
+        SECTION("and cancel all identical calls") {
+            const auto method_name = MethodNameView("single_flight_method");
+            const auto param1 = std::string("param1");
+
+            std::shared_ptr<ICallFutureImpl> future1;
+            std::shared_ptr<ICallFutureImpl> future2;
+            post([&client, &method_name, &param1, &future1, &future2] {
+                future1 = client->async_call(
+                    method_name, make_parameters_serializer(param1));
+                future2 = client->async_call(
+                    method_name, make_parameters_serializer(param1));
+            });
+
+            std::vector<SerializedMessage> sent_messages;
+            REQUIRE_CALL(*connection, async_send(_))
+                .TIMES(2)
+                .LR_SIDE_EFFECT(sent_messages.push_back(_1))
+                .LR_SIDE_EFFECT(post(on_sent))
+                .LR_SIDE_EFFECT(if (sent_messages.size() == 1U) {
+                    post([&future1, &future2] {
+                        future1->cancel();
+                        future2->cancel();
+                    });
+                });
+
+            REQUIRE_NOTHROW(executor->run());
+
+            REQUIRE(sent_messages.size() == 2U);
+            const auto request = parse_request(sent_messages.at(0));
+            const auto notification = parse_notification(sent_messages.at(1));
+            CHECK(notification.method_name() ==
+                MethodNameView(
+                    msgpack_rpc::messages::CANCEL_REQUEST_METHOD_NAME));
+            CHECK(notification.parameters().as<MessageID>() ==
+                std::make_tuple(request.id()));
+            CHECK_THROWS((void)future1->get_result());
+            CHECK_THROWS((void)future2->get_result());
+        }
+
+        SECTION("and send calls with different parameters separately") {
+            const auto method_name = MethodNameView("single_flight_method");
+            const auto param1 = std::string("param1");
+            const auto param2 = std::string("param2");
+
+            std::shared_ptr<ICallFutureImpl> future1;
+            std::shared_ptr<ICallFutureImpl> future2;
+            post([&client, &method_name, &param1, &param2, &future1,
+                     &future2] {
+                future1 = client->async_call(
+                    method_name, make_parameters_serializer(param1));
+                future2 = client->async_call(
+                    method_name, make_parameters_serializer(param2));
+            });
+
+            REQUIRE_CALL(*connection, async_send(_))
+                .TIMES(2)
+                .LR_SIDE_EFFECT(post(on_sent))
+                .LR_SIDE_EFFECT(post([&on_received, serialized_request = _1] {
+                    const auto request = parse_request(serialized_request);
+                    on_received(create_parsed_successful_response(request.id(),
+                        std::get<0>(request.parameters().as<std::string>())));
+                }));
+
+            REQUIRE_NOTHROW(executor->run());
+
+            CHECK(future1 != future2);
+            CHECK(future1->get_result().result_as<std::string>() == param1);
+            CHECK(future2->get_result().result_as<std::string>() == param2);
+        }
+
+        SECTION("and use a cached response") {
+            const auto method_name = MethodNameView("cached_method");
+            const auto param1 = std::string("param1");
+
+            const auto call = [&client, &method_name, &param1] {
+                return client->async_call(
+                    method_name, make_parameters_serializer(param1));
+            };
+            std::shared_ptr<ICallFutureImpl> future1;
+            std::shared_ptr<ICallFutureImpl> future2;
+            post([&future1, &call] { future1 = call(); });
+
+            REQUIRE_CALL(*connection, async_send(_))
+                .TIMES(1)
+                .LR_SIDE_EFFECT(post(on_sent))
+                .LR_SIDE_EFFECT(post([&on_received, &post, &future2, &call,
+                                         serialized_request = _1] {
+                    const auto request = parse_request(serialized_request);
+                    on_received(create_parsed_successful_response(
+                        request.id(), "result"));
+                    post([&future2, &call] { future2 = call(); });
+                }));
+
+            REQUIRE_NOTHROW(executor->run());
+
+            CHECK(future1->get_result().result_as<std::string>() == "result");
+            CHECK(future2->get_result().result_as<std::string>() == "result");
+            const auto statistics =
+                client->response_cache_statistics(method_name);
+            CHECK(statistics.num_hits() == 1U);
+            CHECK(statistics.num_misses() == 1U);
+            CHECK(statistics.num_entries() == 1U);
+            CHECK_THROWS((void)client->response_cache_statistics(
+                MethodNameView("method1")));
+        }
+
+        SECTION("and call methods in a batch") {
+            const auto method_name = MethodNameView("method1");
+            const auto param1 = std::string("param1");
+            const auto param2 = std::string("param2");
+
+            std::shared_ptr<ICallFutureImpl> future1;
+            std::shared_ptr<ICallFutureImpl> future2;
+            std::shared_ptr<IBatchFutureImpl> batch_future;
+            post([&client, &method_name, &param1, &param2, &future1,
+                     &future2, &batch_future] {
+                const auto batch = client->create_batch();
+                future1 =
+                    batch->add(method_name, make_parameters_serializer(param1));
+                future2 =
+                    batch->add(method_name, make_parameters_serializer(param2));
+                CHECK(batch->size() == 2U);
+                batch_future = batch->send();
+                CHECK_THROWS(batch->send());
+            });
+
+            REQUIRE_CALL(*connection, async_send(_))
+                .TIMES(1)
+                .LR_SIDE_EFFECT(post(on_sent))
+                .LR_SIDE_EFFECT(post([&on_received, serialized_requests = _1] {
+                    const auto requests = parse_requests(serialized_requests);
+                    REQUIRE(requests.size() == 2U);
+                    for (const auto& request : requests) {
+                        on_received(create_parsed_successful_response(
+                            request.id(),
+                            std::get<0>(
+                                request.parameters().as<std::string>())));
+                    }
+                }));
+
+            REQUIRE_NOTHROW(executor->run());
+
+            CHECK_NOTHROW(batch_future->wait_all());
+            CHECK(batch_future->num_finished_calls() == 2U);
+            CHECK(future1->get_result().result_as<std::string>() == param1);
+            CHECK(future2->get_result().result_as<std::string>() == param2);
+        }
+
+        SECTION("and destroy a batch without sending it") {
+            const auto method_name = MethodNameView("method1");
+            const auto param1 = std::string("param1");
+
+            std::shared_ptr<ICallFutureImpl> future1;
+            post([&client, &method_name, &param1, &future1] {
+                const auto batch = client->create_batch();
+                future1 =
+                    batch->add(method_name, make_parameters_serializer(param1));
+            });
+
+            REQUIRE_NOTHROW(executor->run());
+
+            CHECK_THROWS((void)future1->get_result());
+        }
+
+        SECTION("and cancel a call") {
+            const auto method_name = MethodNameView("method1");
+            const auto param1 = std::string("param1");
+
+            std::shared_ptr<ICallFutureImpl> future;
+            post([&client, &method_name, &param1, &future] {
+                future = client->async_call(
+                    method_name, make_parameters_serializer(param1));
+            });
+
+            std::vector<SerializedMessage> sent_messages;
+            REQUIRE_CALL(*connection, async_send(_))
+                .TIMES(2)
+                .LR_SIDE_EFFECT(sent_messages.push_back(_1))
+                .LR_SIDE_EFFECT(post(on_sent))
+                .LR_SIDE_EFFECT(if (sent_messages.size() == 1U) {
+                    post([&future] { future->cancel(); });
+                });
+
+            REQUIRE_NOTHROW(executor->run());
+
+            REQUIRE(sent_messages.size() == 2U);
+            const auto request = parse_request(sent_messages.at(0));
+            const auto notification = parse_notification(sent_messages.at(1));
+            CHECK(notification.method_name() ==
+                MethodNameView(
+                    msgpack_rpc::messages::CANCEL_REQUEST_METHOD_NAME));
+            CHECK(notification.parameters().as<MessageID>() ==
+                std::make_tuple(request.id()));
+            CHECK_THROWS((void)future->get_result());
+        }
+
+        SECTION("and receive a notification from the server") {
+            const auto method_name = MethodNameView("subscribe");
+
+            post([&client, &method_name] {
+                client->notify(method_name, make_parameters_serializer());
+            });
+
+            // Send a notification from the server after a message is sent
+            // from the client, so that the connection has been established.
+            REQUIRE_CALL(*connection, async_send(_))
+                .TIMES(1)
+                .LR_SIDE_EFFECT(post(on_sent))
+                .LR_SIDE_EFFECT(post([&on_received, &server_method_name] {
+                    on_received(create_parsed_notification(
+                        server_method_name, std::string("abc")));
+                }));
+
+            REQUIRE_CALL(server_method_ref, notify(_))
+                .TIMES(1)
+                .WITH(_1.parameters().as<std::string>() ==
+                    std::make_tuple(std::string("abc")));
+
+            REQUIRE_NOTHROW(executor->run());
+        }
+
+        SECTION("and receive a request from the server") {
+            const auto method_name = MethodNameView("subscribe");
+            static constexpr auto request_id = static_cast<MessageID>(37);
+
+            post([&client, &method_name] {
+                client->notify(method_name, make_parameters_serializer());
+            });
+
+            const auto serialized_response =
+                MessageSerializer::serialize_successful_response(
+                    request_id, 7);
+            REQUIRE_CALL(server_method_ref, call(_))
+                .TIMES(1)
+                .WITH(_1.id() == request_id)
+                .RETURN(serialized_response);
+
+            std::vector<SerializedMessage> sent_messages;
+            REQUIRE_CALL(*connection, async_send(_))
+                .TIMES(2)
+                .LR_SIDE_EFFECT(sent_messages.push_back(_1))
+                .LR_SIDE_EFFECT(post(on_sent))
+                .LR_SIDE_EFFECT(if (sent_messages.size() == 1U) {
+                    post([&on_received, &server_method_name] {
+                        on_received(create_parsed_request(
+                            server_method_name, request_id));
+                    });
+                });
+
+            REQUIRE_NOTHROW(executor->run());
+
+            REQUIRE(sent_messages.size() == 2U);
+            CHECK(sent_messages.at(1).data() == serialized_response.data());
+        }
+
         SECTION("and notify to a method") {
             const auto method_name = MethodNameView("method2");
             const int param1 = 123;
@@ -194,8 +547,10 @@ TEST_CASE("msgpack_rpc::clients::impl::ClientImpl") {
 
         const auto client_connector = std::make_shared<ClientConnector>(
             executor, backends, server_uris, ReconnectionConfig(), logger);
-        const auto client = std::make_shared<ClientImpl>(
-            client_connector, call_list, async_executor, logger);
+        const auto client = std::make_shared<ClientImpl>(client_connector,
+            call_list, method_processor, async_executor,
+            FlowControlConfig(), single_flight_methods, response_caches,
+            logger);
 
         post([&client] { client->start(); });
 
@@ -220,12 +575,58 @@ TEST_CASE("msgpack_rpc::clients::impl::ClientImpl") {
         }
     }
 
+    SECTION("reject messages exceeding watermarks without blocking") {
+        const auto client_connector = std::make_shared<ClientConnector>(
+            executor, backends, server_uris, ReconnectionConfig(), logger);
+        FlowControlConfig flow_control_config;
+        flow_control_config.high_watermark_messages(1);
+        const auto client = std::make_shared<ClientImpl>(client_connector,
+            call_list, method_processor, async_executor, flow_control_config,
+            single_flight_methods, response_caches, logger);
+
+        post([&client] { client->start(); });
+
+        // No connection is made, so messages stay in the queue.
+        const auto connector = std::make_shared<MockConnector>();
+        REQUIRE_CALL(*backend, create_connector()).TIMES(1).RETURN(connector);
+        REQUIRE_CALL(*connector, async_connect(_, _)).TIMES(1);
+
+        const auto method_name = MethodNameView("method1");
+        std::shared_ptr<ICallFutureImpl> queued_future;
+        std::shared_ptr<ICallFutureImpl> rejected_future;
+        bool is_notification_rejected = false;
+        post([&] {
+            queued_future =
+                client->async_call(method_name, make_parameters_serializer(1));
+            rejected_future =
+                client->async_call(method_name, make_parameters_serializer(2));
+            try {
+                client->notify(method_name, make_parameters_serializer(3));
+            } catch (const msgpack_rpc::MsgpackRPCException& e) {
+                is_notification_rejected =
+                    e.status().code() == StatusCode::OVERLOADED;
+            }
+            client->stop();
+        });
+
+        REQUIRE_NOTHROW(executor->run());
+
+        try {
+            (void)rejected_future->get_result();
+            FAIL();
+        } catch (const msgpack_rpc::MsgpackRPCException& e) {
+            CHECK(e.status().code() == StatusCode::OVERLOADED);
+        }
+        CHECK(is_notification_rejected);
+    }
+
     SECTION("stop without starting") {
         const auto client_connector = std::make_shared<ClientConnector>(
             executor, backends, server_uris, ReconnectionConfig(), logger);
         const std::shared_ptr<IClientImpl> client =
-            std::make_shared<ClientImpl>(
-                client_connector, call_list, async_executor, logger);
+            std::make_shared<ClientImpl>(client_connector, call_list,
+                method_processor, async_executor, FlowControlConfig(),
+                single_flight_methods, response_caches, logger);
 
         REQUIRE_NOTHROW(client->stop());
         REQUIRE_NOTHROW(executor->run());
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 
 #include "msgpack_rpc/clients/impl/i_call_future_impl.h"
 #include "msgpack_rpc/messages/call_result.h"
@@ -33,6 +34,9 @@ public:
     MAKE_MOCK0(get_result, msgpack_rpc::messages::CallResult(), override);
     MAKE_MOCK1(get_result_within,
         msgpack_rpc::messages::CallResult(std::chrono::nanoseconds), override);
+    MAKE_MOCK0(cancel, void(), override);
+    MAKE_MOCK1(
+        add_completion_handler, void(std::function<void()>), override);
 };
 
 }  // namespace msgpack_rpc_test
@@ -21,9 +21,13 @@
 
 #include <memory>
 
+#include "msgpack_rpc/clients/impl/i_call_batch_impl.h"
 #include "msgpack_rpc/clients/impl/i_call_future_impl.h"
 #include "msgpack_rpc/clients/impl/i_client_impl.h"
+#include "msgpack_rpc/clients/impl/i_stream_reader_impl.h"
+#include "msgpack_rpc/clients/impl/i_upload_writer_impl.h"
 #include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/clients/response_cache_statistics.h"
 #include "msgpack_rpc/executors/i_executor.h"
 #include "msgpack_rpc/messages/method_name_view.h"
 #include "trompeloeil_catch2.h"
@@ -37,6 +41,23 @@ class MockClientImpl final : public msgpack_rpc::clients::impl::IClientImpl {
             msgpack_rpc::messages::MethodNameView,
             const msgpack_rpc::clients::impl::IParametersSerializer&),
         override);
+    MAKE_MOCK2(async_call_stream,
+        std::shared_ptr<msgpack_rpc::clients::impl::IStreamReaderImpl>(
+            msgpack_rpc::messages::MethodNameView,
+            const msgpack_rpc::clients::impl::IParametersSerializer&),
+        override);
+    MAKE_MOCK2(async_call_upload,
+        std::shared_ptr<msgpack_rpc::clients::impl::IUploadWriterImpl>(
+            msgpack_rpc::messages::MethodNameView,
+            const msgpack_rpc::clients::impl::IParametersSerializer&),
+        override);
+    MAKE_MOCK1(response_cache_statistics,
+        msgpack_rpc::clients::ResponseCacheStatistics(
+            msgpack_rpc::messages::MethodNameView),
+        override);
+    MAKE_MOCK0(create_batch,
+        std::shared_ptr<msgpack_rpc::clients::impl::ICallBatchImpl>(),
+        override);
     MAKE_MOCK2(notify,
         void(msgpack_rpc::messages::MethodNameView,
             const msgpack_rpc::clients::impl::IParametersSerializer&),
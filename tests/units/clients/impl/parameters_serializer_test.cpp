@@ -19,6 +19,7 @@
  */
 #include "msgpack_rpc/clients/impl/parameters_serializer.h"
 
+#include <chrono>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -30,6 +31,7 @@
 #include "msgpack_rpc/messages/parsed_notification.h"
 #include "msgpack_rpc/messages/parsed_parameters.h"
 #include "msgpack_rpc/messages/parsed_request.h"
+#include "msgpack_rpc/messages/prepared_method_name.h"
 #include "msgpack_rpc/messages/serialized_message.h"
 #include "msgpack_rpc_test/parse_messages.h"
 
@@ -92,6 +94,23 @@ TEST_CASE("msgpack_rpc::clients::impl::ParametersSerializer") {
                 std::forward_as_tuple(param1));
         }
 
+        SECTION("create serialized request with the remaining budget") {
+            const auto method_name = MethodNameView("method1");
+            const auto request_id = static_cast<MessageID>(12345);
+            const auto budget = std::chrono::seconds(3);
+
+            const SerializedMessage serialized_request =
+                i_params.create_serialized_request_with_budget(
+                    method_name, request_id, budget);
+
+            const auto parsed_request = parse_request(serialized_request);
+            CHECK(parsed_request.method_name() == method_name);
+            CHECK(parsed_request.id() == request_id);
+            CHECK(parsed_request.parameters().as<std::string_view>() ==
+                std::forward_as_tuple(param1));
+            CHECK(parsed_request.deadline().has_value());
+        }
+
         SECTION("create serialized notification") {
             const auto method_name = MethodNameView("method2");
 
@@ -173,3 +192,63 @@ TEST_CASE("msgpack_rpc::clients::impl::ParametersSerializer") {
         }
     }
 }
+
+TEST_CASE("msgpack_rpc::clients::impl::PreparedParametersSerializer") {
+    using msgpack_rpc::clients::impl::IParametersSerializer;
+    using msgpack_rpc::clients::impl::PreparedParametersSerializer;
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::MethodNameView;
+    using msgpack_rpc::messages::PreparedMethodName;
+    using msgpack_rpc::messages::SerializedMessage;
+    using msgpack_rpc_test::parse_notification;
+    using msgpack_rpc_test::parse_request;
+
+    const auto method_name = MethodNameView("namespace.method1");
+    const PreparedMethodName prepared_method_name{method_name};
+    const auto param1 = std::string("abc");
+    const int param2 = 123;
+    const PreparedParametersSerializer<std::string, int> params{
+        prepared_method_name, param1, param2};
+    const IParametersSerializer& i_params = params;
+
+    SECTION("create serialized request") {
+        const auto request_id = static_cast<MessageID>(12345);
+
+        const SerializedMessage serialized_request =
+            i_params.create_serialized_request(method_name, request_id);
+
+        const auto parsed_request = parse_request(serialized_request);
+        CHECK(parsed_request.method_name() == method_name);
+        CHECK(parsed_request.id() == request_id);
+        CHECK(parsed_request.parameters().as<std::string_view, int>() ==
+            std::forward_as_tuple(param1, param2));
+        CHECK(prepared_method_name.size_hint() == serialized_request.size());
+    }
+
+    SECTION("create serialized request with the budget") {
+        const auto request_id = static_cast<MessageID>(12345);
+        const auto budget = std::chrono::seconds(3);
+
+        const SerializedMessage serialized_request =
+            i_params.create_serialized_request_with_budget(
+                method_name, request_id, budget);
+
+        const auto parsed_request = parse_request(serialized_request);
+        CHECK(parsed_request.method_name() == method_name);
+        CHECK(parsed_request.id() == request_id);
+        CHECK(parsed_request.parameters().as<std::string_view, int>() ==
+            std::forward_as_tuple(param1, param2));
+        CHECK(parsed_request.deadline().has_value());
+    }
+
+    SECTION("create serialized notification") {
+        const SerializedMessage serialized_notification =
+            i_params.create_serialized_notification(method_name);
+
+        const auto parsed_notification =
+            parse_notification(serialized_notification);
+        CHECK(parsed_notification.method_name() == method_name);
+        CHECK(parsed_notification.parameters().as<std::string_view, int>() ==
+            std::forward_as_tuple(param1, param2));
+    }
+}
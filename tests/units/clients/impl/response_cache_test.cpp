@@ -0,0 +1,153 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of ResponseCache class.
+ */
+#include "msgpack_rpc/clients/impl/response_cache.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/config/response_cache_config.h"
+#include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+
+namespace {
+
+msgpack_rpc::messages::CallResult create_result(std::string_view value) {
+    const auto zone = std::make_shared<msgpack::zone>();
+    const auto object = msgpack::object(value, *zone);
+    return msgpack_rpc::messages::CallResult::create_result(object, zone);
+}
+
+}  // namespace
+
+TEST_CASE("msgpack_rpc::clients::impl::MethodResponseCache") {
+    using msgpack_rpc::clients::impl::MethodResponseCache;
+    using msgpack_rpc::config::ResponseCacheConfig;
+
+    constexpr auto time_to_live = std::chrono::seconds(1);
+    constexpr std::size_t max_entries = 2;
+    MethodResponseCache cache{ResponseCacheConfig()
+                                  .time_to_live(time_to_live)
+                                  .max_entries(max_entries)};
+
+    const auto now = MethodResponseCache::Clock::now();
+
+    SECTION("find a cached response") {
+        CHECK_FALSE(cache.find("key1", now).has_value());
+
+        cache.insert("key1", create_result("result1"), now);
+        const auto result = cache.find("key1", now + time_to_live / 2);
+
+        REQUIRE(result.has_value());
+        CHECK(result->result_as<std::string>() == "result1");
+        const auto statistics = cache.statistics();
+        CHECK(statistics.num_hits() == 1U);
+        CHECK(statistics.num_misses() == 1U);
+        CHECK(statistics.num_entries() == 1U);
+        CHECK(statistics.num_bytes() == 11U);
+    }
+
+    SECTION("copy a result to a zone of its own size") {
+        std::weak_ptr<msgpack::zone> weak_zone;
+        {
+            const auto result = create_result("result1");
+            weak_zone = result.zone();
+            cache.insert("key1", result, now);
+        }
+
+        CHECK(weak_zone.expired());
+        const auto result = cache.find("key1", now);
+        REQUIRE(result.has_value());
+        CHECK(result->result_as<std::string>() == "result1");
+    }
+
+    SECTION("remove an expired response") {
+        cache.insert("key1", create_result("result1"), now);
+
+        CHECK_FALSE(cache.find("key1", now + time_to_live).has_value());
+        CHECK(cache.statistics().num_entries() == 0U);
+    }
+
+    SECTION("update a cached response") {
+        cache.insert("key1", create_result("result1"), now);
+        cache.insert("key1", create_result("result2"), now + time_to_live);
+
+        const auto result = cache.find("key1", now + time_to_live);
+
+        REQUIRE(result.has_value());
+        CHECK(result->result_as<std::string>() == "result2");
+        CHECK(cache.statistics().num_entries() == 1U);
+    }
+
+    SECTION("remove the least recently used response") {
+        cache.insert("key1", create_result("result1"), now);
+        cache.insert("key2", create_result("result2"), now);
+        CHECK(cache.find("key1", now).has_value());
+
+        cache.insert("key3", create_result("result3"), now);
+
+        CHECK(cache.statistics().num_entries() == max_entries);
+        CHECK(cache.find("key1", now).has_value());
+        CHECK_FALSE(cache.find("key2", now).has_value());
+        CHECK(cache.find("key3", now).has_value());
+    }
+
+    SECTION("remove responses exceeding the number of bytes") {
+        // Each entry has 4 bytes of the key and 7 bytes of the result.
+        constexpr std::size_t max_bytes = 30;
+        constexpr std::size_t many_entries = 10;
+        MethodResponseCache small_cache{ResponseCacheConfig()
+                                            .time_to_live(time_to_live)
+                                            .max_entries(many_entries)
+                                            .max_bytes(max_bytes)};
+
+        small_cache.insert("key1", create_result("result1"), now);
+        small_cache.insert("key2", create_result("result2"), now);
+        small_cache.insert("key3", create_result("result3"), now);
+        small_cache.insert(
+            "key4", create_result(std::string(max_bytes, 'a')), now);
+
+        CHECK(small_cache.statistics().num_entries() == 2U);
+        CHECK_FALSE(small_cache.find("key1", now).has_value());
+        CHECK(small_cache.find("key2", now).has_value());
+        CHECK(small_cache.find("key3", now).has_value());
+        CHECK_FALSE(small_cache.find("key4", now).has_value());
+    }
+}
+
+TEST_CASE("msgpack_rpc::clients::impl::ResponseCache") {
+    using msgpack_rpc::clients::impl::ResponseCache;
+    using msgpack_rpc::config::ResponseCacheConfig;
+    using msgpack_rpc::messages::MethodNameView;
+
+    const ResponseCache cache{std::unordered_map<std::string,
+        ResponseCacheConfig>{{"method1", ResponseCacheConfig()}}};
+
+    SECTION("find the cache of a method") {
+        CHECK(cache.find(MethodNameView("method1")) != nullptr);
+        CHECK(cache.find(MethodNameView("method2")) == nullptr);
+    }
+}
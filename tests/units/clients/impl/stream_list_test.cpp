@@ -0,0 +1,138 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of StreamList class.
+ */
+#include "msgpack_rpc/clients/impl/stream_list.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+#include "../../create_test_logger.h"
+#include "msgpack_rpc/clients/impl/call_future_impl.h"
+#include "msgpack_rpc/clients/impl/call_list.h"
+#include "msgpack_rpc/clients/impl/client_connector.h"
+#include "msgpack_rpc/clients/impl/stream_flow_controller.h"
+#include "msgpack_rpc/clients/impl/stream_reader_impl.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc_test/create_parsed_messages.h"
+
+TEST_CASE("msgpack_rpc::clients::impl::StreamList") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::Status;
+    using msgpack_rpc::StatusCode;
+    using msgpack_rpc::clients::impl::CallFutureImpl;
+    using msgpack_rpc::clients::impl::CallList;
+    using msgpack_rpc::clients::impl::ClientConnector;
+    using msgpack_rpc::clients::impl::StreamFlowController;
+    using msgpack_rpc::clients::impl::StreamList;
+    using msgpack_rpc::clients::impl::StreamReaderImpl;
+    using msgpack_rpc::messages::CallResult;
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::STREAM_CHUNK_METHOD_NAME;
+    using msgpack_rpc_test::create_parsed_notification;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    const auto future = std::make_shared<CallFutureImpl>(deadline);
+    const auto request_id = static_cast<MessageID>(12345);
+    const auto flow_controller = std::make_shared<StreamFlowController>(
+        std::weak_ptr<CallList>(), std::weak_ptr<ClientConnector>(), logger);
+    constexpr std::size_t max_queued_chunks = 4;
+    const auto reader = std::make_shared<StreamReaderImpl>(request_id, future,
+        std::chrono::seconds(1), flow_controller, max_queued_chunks);
+    future->add_completion_handler([reader] { reader->finish(); });
+    StreamList list{logger};
+    list.add(request_id, reader);
+
+    SECTION("read chunks") {
+        list.handle(create_parsed_notification(
+            STREAM_CHUNK_METHOD_NAME, request_id, std::string("abc")));
+        list.handle(create_parsed_notification(
+            STREAM_CHUNK_METHOD_NAME, request_id, std::string("def")));
+        const auto zone = std::make_shared<msgpack::zone>();
+        future->set(CallResult::create_result(msgpack::object(), zone));
+
+        auto chunk = reader->next();
+        REQUIRE(chunk);
+        CHECK(chunk->as<MessageID, std::string>() ==
+            std::make_tuple(request_id, std::string("abc")));
+        chunk = reader->next();
+        REQUIRE(chunk);
+        CHECK(chunk->as<MessageID, std::string>() ==
+            std::make_tuple(request_id, std::string("def")));
+        CHECK_FALSE(reader->next().has_value());
+        CHECK(reader->result().is_success());
+    }
+
+    SECTION("pause reading while too many chunks are queued") {
+        for (std::size_t i = 0; i < max_queued_chunks; ++i) {
+            CHECK_FALSE(flow_controller->is_reading_paused());
+            list.handle(create_parsed_notification(
+                STREAM_CHUNK_METHOD_NAME, request_id, std::string("abc")));
+        }
+        CHECK(flow_controller->is_reading_paused());
+
+        (void)reader->next();
+        CHECK(flow_controller->is_reading_paused());
+        (void)reader->next();
+        CHECK_FALSE(flow_controller->is_reading_paused());
+    }
+
+    SECTION("resume reading when a full reader finishes") {
+        for (std::size_t i = 0; i < max_queued_chunks; ++i) {
+            list.handle(create_parsed_notification(
+                STREAM_CHUNK_METHOD_NAME, request_id, std::string("abc")));
+        }
+        CHECK(flow_controller->is_reading_paused());
+
+        reader->cancel();
+
+        CHECK_FALSE(flow_controller->is_reading_paused());
+    }
+
+    SECTION("ignore chunks of other streams") {
+        list.handle(create_parsed_notification(STREAM_CHUNK_METHOD_NAME,
+            static_cast<MessageID>(request_id + 1), std::string("abc")));
+        list.handle(create_parsed_notification(
+            STREAM_CHUNK_METHOD_NAME, std::string("invalid")));
+        future->set(Status(StatusCode::TIMEOUT, "Timeout."));
+
+        CHECK_FALSE(reader->next().has_value());
+        CHECK_THROWS_AS((void)reader->result(), MsgpackRPCException);
+    }
+
+    SECTION("cancel") {
+        reader->cancel();
+
+        CHECK_FALSE(reader->next().has_value());
+        CHECK_THROWS_AS((void)reader->result(), MsgpackRPCException);
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of UploadList class.
+ */
+#include "msgpack_rpc/clients/impl/upload_list.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../../create_test_logger.h"
+#include "msgpack_rpc/clients/impl/call_future_impl.h"
+#include "msgpack_rpc/clients/impl/message_sender.h"
+#include "msgpack_rpc/clients/impl/upload_writer_impl.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc_test/create_parsed_messages.h"
+
+TEST_CASE("msgpack_rpc::clients::impl::UploadList") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::StatusCode;
+    using msgpack_rpc::clients::impl::CallFutureImpl;
+    using msgpack_rpc::clients::impl::MessageSender;
+    using msgpack_rpc::clients::impl::UploadList;
+    using msgpack_rpc::clients::impl::UploadWriterImpl;
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::SerializedMessage;
+    using msgpack_rpc::messages::UPLOAD_ACK_METHOD_NAME;
+    using msgpack_rpc_test::create_parsed_notification;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+    const auto future = std::make_shared<CallFutureImpl>(deadline);
+    const auto request_id = static_cast<MessageID>(12345);
+    constexpr std::size_t window_size = 1;
+    // Writers without senders count chunks in the window, but fail to send
+    // them, which is used to see whether the window is released.
+    const auto writer = std::make_shared<UploadWriterImpl>(request_id, future,
+        std::weak_ptr<MessageSender>(), window_size, deadline);
+    UploadList list{logger};
+    list.add(request_id, writer);
+    const auto chunk = SerializedMessage("chunk", 5);
+    const auto write_status_code = [&writer, &chunk] {
+        try {
+            writer->write(chunk);
+        } catch (const MsgpackRPCException& e) {
+            return e.status().code();
+        }
+        return StatusCode::SUCCESS;
+    };
+    REQUIRE(write_status_code() == StatusCode::PRECONDITION_NOT_MET);
+
+    SECTION("release the window by acknowledgements") {
+        list.handle(
+            create_parsed_notification(UPLOAD_ACK_METHOD_NAME, request_id));
+
+        CHECK(write_status_code() == StatusCode::PRECONDITION_NOT_MET);
+    }
+
+    SECTION("ignore acknowledgements of other uploads") {
+        list.handle(create_parsed_notification(
+            UPLOAD_ACK_METHOD_NAME, static_cast<MessageID>(request_id + 1)));
+        list.handle(create_parsed_notification(
+            UPLOAD_ACK_METHOD_NAME, std::string("invalid")));
+
+        CHECK(write_status_code() == StatusCode::TIMEOUT);
+    }
+
+    SECTION("ignore acknowledgements of removed uploads") {
+        list.remove(request_id);
+        list.handle(
+            create_parsed_notification(UPLOAD_ACK_METHOD_NAME, request_id));
+
+        CHECK(write_status_code() == StatusCode::TIMEOUT);
+    }
+
+    SECTION("stop writing after the end of the RPC") {
+        writer->on_finished();
+
+        CHECK(write_status_code() == StatusCode::PRECONDITION_NOT_MET);
+    }
+}
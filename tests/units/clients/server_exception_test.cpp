@@ -19,14 +19,21 @@
  */
 #include "msgpack_rpc/clients/server_exception.h"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/reserved_error_keys.h"
+
 TEST_CASE("msgpack_rpc::clients::ServerException") {
+    using msgpack_rpc::StatusCode;
     using msgpack_rpc::clients::ServerException;
+    using msgpack_rpc::messages::ERROR_CODE_KEY;
+    using msgpack_rpc::messages::ERROR_MESSAGE_KEY;
 
     SECTION("create an exception") {
         const auto zone = std::make_shared<msgpack::zone>();
@@ -49,5 +56,41 @@ TEST_CASE("msgpack_rpc::clients::ServerException") {
         SECTION("and get as an object") {
             CHECK(exception.error_as<std::string_view>() == "test message");
         }
+
+        SECTION("and get the status code") {
+            CHECK(exception.status().code() == StatusCode::SERVER_ERROR);
+        }
+    }
+
+    SECTION("create an exception of an overloaded server") {
+        const auto zone = std::make_shared<msgpack::zone>();
+        const auto object = msgpack::object(
+            std::map<std::string, std::string>{
+                {std::string(ERROR_CODE_KEY), "OVERLOADED"},
+                {std::string(ERROR_MESSAGE_KEY), "Too many requests."}},
+            *zone);
+
+        const auto exception = ServerException(object, zone);
+
+        CHECK(exception.status().code() == StatusCode::OVERLOADED);
+    }
+
+    SECTION("create an exception of a method throwing a string OVERLOADED") {
+        const auto zone = std::make_shared<msgpack::zone>();
+        const auto object = msgpack::object("OVERLOADED", *zone);
+
+        const auto exception = ServerException(object, zone);
+
+        CHECK(exception.status().code() == StatusCode::SERVER_ERROR);
+    }
+
+    SECTION("create an exception of a method throwing a map without the key") {
+        const auto zone = std::make_shared<msgpack::zone>();
+        const auto object = msgpack::object(
+            std::map<std::string, std::string>{{"code", "OVERLOADED"}}, *zone);
+
+        const auto exception = ServerException(object, zone);
+
+        CHECK(exception.status().code() == StatusCode::SERVER_ERROR);
     }
 }
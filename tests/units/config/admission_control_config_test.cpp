@@ -0,0 +1,51 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of AdmissionControlConfig class.
+ */
+#include "msgpack_rpc/config/admission_control_config.h"
+
+#include <cstddef>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::config::AdmissionControlConfig") {
+    using msgpack_rpc::config::AdmissionControlConfig;
+
+    AdmissionControlConfig config;
+
+    SECTION("has correct value as default") {
+        CHECK(config.max_connections() == 0U);
+        CHECK(config.max_in_flight_per_connection() == 0U);
+        CHECK(config.max_in_flight_requests() == 0U);
+    }
+
+    SECTION("set limits") {
+        constexpr std::size_t max_connections = 123;
+        constexpr std::size_t max_in_flight_per_connection = 234;
+        constexpr std::size_t max_in_flight_requests = 345;
+
+        config.max_connections(max_connections)
+            .max_in_flight_per_connection(max_in_flight_per_connection)
+            .max_in_flight_requests(max_in_flight_requests);
+
+        CHECK(config.max_connections() == max_connections);
+        CHECK(config.max_in_flight_per_connection() ==
+            max_in_flight_per_connection);
+        CHECK(config.max_in_flight_requests() == max_in_flight_requests);
+    }
+}
@@ -20,16 +20,20 @@
 #include "msgpack_rpc/config/client_config.h"
 
 #include <chrono>
+#include <string>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include "msgpack_rpc/addresses/schemes.h"
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/config/response_cache_config.h"
 
 TEST_CASE("msgpack_rpc::config::ClientConfig") {
     using msgpack_rpc::addresses::TCP_SCHEME;
     using msgpack_rpc::addresses::URI;
     using msgpack_rpc::config::ClientConfig;
+    using msgpack_rpc::config::ResponseCacheConfig;
 
     SECTION("add a URI") {
         ClientConfig config;
@@ -54,6 +58,38 @@ TEST_CASE("msgpack_rpc::config::ClientConfig") {
         CHECK_THROWS(config.call_timeout(std::chrono::seconds(0)));
     }
 
+    SECTION("set whether to propagate deadlines") {
+        ClientConfig config;
+        CHECK_FALSE(config.propagate_deadline());
+
+        config.propagate_deadline(true);
+
+        CHECK(config.propagate_deadline());
+    }
+
+    SECTION("add names of single-flight methods") {
+        ClientConfig config;
+        CHECK(config.single_flight_methods().empty());
+
+        config.add_single_flight_method("method1")
+            .add_single_flight_method("method2");
+
+        CHECK(config.single_flight_methods() ==
+            std::vector<std::string>{"method1", "method2"});
+    }
+
+    SECTION("add caches of responses") {
+        ClientConfig config;
+        CHECK(config.response_caches().empty());
+
+        config.add_response_cache("method1",
+            ResponseCacheConfig().time_to_live(std::chrono::seconds(3)));
+
+        REQUIRE(config.response_caches().size() == 1U);
+        CHECK(config.response_caches().at("method1").time_to_live() ==
+            std::chrono::seconds(3));
+    }
+
     SECTION("get the configuration of parsers of messages") {
         ClientConfig config;
 
@@ -77,4 +113,35 @@ TEST_CASE("msgpack_rpc::config::ClientConfig") {
         CHECK_NOTHROW(
             (void)static_cast<const ClientConfig&>(config).reconnection());
     }
+
+    SECTION("get the configuration of socket options") {
+        ClientConfig config;
+
+        CHECK_NOTHROW((void)config.socket());
+        CHECK_NOTHROW((void)static_cast<const ClientConfig&>(config).socket());
+    }
+
+    SECTION("get the configuration of compression") {
+        ClientConfig config;
+
+        CHECK_NOTHROW((void)config.compression());
+        CHECK_NOTHROW(
+            (void)static_cast<const ClientConfig&>(config).compression());
+    }
+
+    SECTION("get the configuration of capture of traffic") {
+        ClientConfig config;
+
+        CHECK_NOTHROW((void)config.traffic_capture());
+        CHECK_NOTHROW(
+            (void)static_cast<const ClientConfig&>(config).traffic_capture());
+    }
+
+    SECTION("get the configuration of flow control") {
+        ClientConfig config;
+
+        CHECK_NOTHROW((void)config.flow_control());
+        CHECK_NOTHROW(
+            (void)static_cast<const ClientConfig&>(config).flow_control());
+    }
 }
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of CompressionConfig class.
+ */
+#include "msgpack_rpc/config/compression_config.h"
+
+#include <cstddef>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::config::CompressionConfig") {
+    using msgpack_rpc::config::CompressionConfig;
+
+    CompressionConfig config;
+
+    SECTION("has correct value as default") {
+        CHECK_FALSE(config.enabled());
+        CHECK(config.min_message_size() == 16384U);
+    }
+
+    SECTION("enable compression") {
+        constexpr std::size_t min_message_size = 4096;
+
+        config.enabled(true).min_message_size(min_message_size);
+
+        CHECK(config.enabled());
+        CHECK(config.min_message_size() == min_message_size);
+    }
+
+    SECTION("set an invalid minimum size of messages") {
+        CHECK_THROWS(config.min_message_size(0));
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of FlowControlConfig class.
+ */
+#include "msgpack_rpc/config/flow_control_config.h"
+
+#include <cstddef>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::config::FlowControlConfig") {
+    using msgpack_rpc::config::FlowControlConfig;
+
+    FlowControlConfig config;
+
+    SECTION("has correct value as default") {
+        constexpr std::size_t mebibyte = 1024 * 1024;
+        CHECK(config.high_watermark_bytes() == 64U * mebibyte);
+        CHECK(config.low_watermark_bytes() == 32U * mebibyte);
+        CHECK(config.high_watermark_messages() == 0U);
+        CHECK(config.low_watermark_messages() == 0U);
+    }
+
+    SECTION("set watermarks in bytes") {
+        constexpr std::size_t high = 12345;
+        constexpr std::size_t low = 2345;
+
+        config.high_watermark_bytes(high).low_watermark_bytes(low);
+
+        CHECK(config.high_watermark_bytes() == high);
+        CHECK(config.low_watermark_bytes() == low);
+    }
+
+    SECTION("set watermarks in messages") {
+        constexpr std::size_t high = 345;
+        constexpr std::size_t low = 45;
+
+        config.high_watermark_messages(high).low_watermark_messages(low);
+
+        CHECK(config.high_watermark_messages() == high);
+        CHECK(config.low_watermark_messages() == low);
+    }
+}
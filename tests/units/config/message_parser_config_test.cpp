@@ -37,4 +37,18 @@ TEST_CASE("msgpack_rpc::config::MessageParserConfig") {
         constexpr std::size_t value = 0;
         CHECK_THROWS(config.read_buffer_size(value));
     }
+
+    SECTION("set max_message_size") {
+        MessageParserConfig config;
+
+        constexpr std::size_t value = 1;
+        CHECK(config.max_message_size(value).max_message_size() == value);
+    }
+
+    SECTION("set max_message_size to wrong value") {
+        MessageParserConfig config;
+
+        constexpr std::size_t value = 0;
+        CHECK_THROWS(config.max_message_size(value));
+    }
 }
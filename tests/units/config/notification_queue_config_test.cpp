@@ -0,0 +1,47 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of NotificationQueueConfig class.
+ */
+#include "msgpack_rpc/config/notification_queue_config.h"
+
+#include <cstddef>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::config::NotificationQueueConfig") {
+    using msgpack_rpc::config::NotificationQueueConfig;
+
+    NotificationQueueConfig config;
+
+    SECTION("has correct value as default") {
+        constexpr std::size_t default_max_queued_notifications = 1024;
+        CHECK(config.max_queued_notifications() ==
+            default_max_queued_notifications);
+        CHECK_FALSE(config.disconnect_slow_consumers());
+    }
+
+    SECTION("set the limit") {
+        constexpr std::size_t max_queued_notifications = 123;
+
+        config.max_queued_notifications(max_queued_notifications)
+            .disconnect_slow_consumers(true);
+
+        CHECK(config.max_queued_notifications() == max_queued_notifications);
+        CHECK(config.disconnect_slow_consumers());
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of ResponseCacheConfig class.
+ */
+#include "msgpack_rpc/config/response_cache_config.h"
+
+#include <chrono>
+#include <cstddef>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::config::ResponseCacheConfig") {
+    using msgpack_rpc::config::ResponseCacheConfig;
+
+    ResponseCacheConfig config;
+
+    SECTION("has correct value as default") {
+        CHECK(config.time_to_live() == std::chrono::seconds(1));
+        CHECK(config.max_entries() == 1024U);
+        CHECK(config.max_bytes() == 64U * 1024U * 1024U);
+    }
+
+    SECTION("set the limits") {
+        constexpr auto time_to_live = std::chrono::milliseconds(100);
+        constexpr std::size_t max_entries = 123;
+        constexpr std::size_t max_bytes = 4567;
+
+        config.time_to_live(time_to_live)
+            .max_entries(max_entries)
+            .max_bytes(max_bytes);
+
+        CHECK(config.time_to_live() == time_to_live);
+        CHECK(config.max_entries() == max_entries);
+        CHECK(config.max_bytes() == max_bytes);
+    }
+
+    SECTION("set invalid limits") {
+        CHECK_THROWS(config.time_to_live(std::chrono::seconds(0)));
+        CHECK_THROWS(config.max_entries(0U));
+        CHECK_THROWS(config.max_bytes(0U));
+    }
+}
@@ -19,6 +19,8 @@
  */
 #include "msgpack_rpc/config/server_config.h"
 
+#include <chrono>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include "msgpack_rpc/addresses/schemes.h"
@@ -38,6 +40,43 @@ TEST_CASE("msgpack_rpc::config::ServerConfig") {
             std::vector<URI>{URI::parse("tcp://localhost:12345")});
     }
 
+    SECTION("set timeout of waiting for chunks of uploads") {
+        ServerConfig config;
+
+        config.upload_idle_timeout(std::chrono::seconds(2));
+
+        CHECK(config.upload_idle_timeout() == std::chrono::seconds(2));
+    }
+
+    SECTION("set timeout of waiting for chunks of uploads to invalid value") {
+        ServerConfig config;
+
+        CHECK_THROWS(config.upload_idle_timeout(std::chrono::seconds(0)));
+    }
+
+    SECTION("set timeout of RPCs to clients") {
+        ServerConfig config;
+
+        config.call_timeout(std::chrono::seconds(2));
+
+        CHECK(config.call_timeout() == std::chrono::seconds(2));
+    }
+
+    SECTION("set timeout of RPCs to clients to an invalid value") {
+        ServerConfig config;
+
+        CHECK_THROWS(config.call_timeout(std::chrono::seconds(0)));
+    }
+
+    SECTION("set whether to propagate deadlines") {
+        ServerConfig config;
+        CHECK_FALSE(config.propagate_deadline());
+
+        config.propagate_deadline(true);
+
+        CHECK(config.propagate_deadline());
+    }
+
     SECTION("get the configuration of parsers of messages") {
         ServerConfig config;
 
@@ -53,4 +92,51 @@ TEST_CASE("msgpack_rpc::config::ServerConfig") {
         CHECK_NOTHROW(
             (void)static_cast<const ServerConfig&>(config).executor());
     }
+
+    SECTION("get the configuration of socket options") {
+        ServerConfig config;
+
+        CHECK_NOTHROW((void)config.socket());
+        CHECK_NOTHROW((void)static_cast<const ServerConfig&>(config).socket());
+    }
+
+    SECTION("get the configuration of compression") {
+        ServerConfig config;
+
+        CHECK_NOTHROW((void)config.compression());
+        CHECK_NOTHROW(
+            (void)static_cast<const ServerConfig&>(config).compression());
+    }
+
+    SECTION("get the configuration of capture of traffic") {
+        ServerConfig config;
+
+        CHECK_NOTHROW((void)config.traffic_capture());
+        CHECK_NOTHROW(
+            (void)static_cast<const ServerConfig&>(config).traffic_capture());
+    }
+
+    SECTION("get the configuration of flow control") {
+        ServerConfig config;
+
+        CHECK_NOTHROW((void)config.flow_control());
+        CHECK_NOTHROW(
+            (void)static_cast<const ServerConfig&>(config).flow_control());
+    }
+
+    SECTION("get the configuration of admission control") {
+        ServerConfig config;
+
+        CHECK_NOTHROW((void)config.admission_control());
+        CHECK_NOTHROW(
+            (void)static_cast<const ServerConfig&>(config).admission_control());
+    }
+
+    SECTION("get the configuration of queues of notifications") {
+        ServerConfig config;
+
+        CHECK_NOTHROW((void)config.notification_queue());
+        CHECK_NOTHROW((void)static_cast<const ServerConfig&>(config)
+                .notification_queue());
+    }
 }
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of SocketConfig class.
+ */
+#include "msgpack_rpc/config/socket_config.h"
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::config::SocketConfig") {
+    using msgpack_rpc::config::SocketConfig;
+
+    SocketConfig config;
+
+    SECTION("has correct value as default") {
+        CHECK(config.tcp_no_delay());
+        CHECK(config.send_buffer_size() == 0U);
+        CHECK(config.receive_buffer_size() == 0U);
+        CHECK_FALSE(config.keep_alive());
+        CHECK(config.keep_alive_idle_time() == std::chrono::nanoseconds(0));
+        CHECK(config.keep_alive_interval() == std::chrono::nanoseconds(0));
+        CHECK(config.keep_alive_count() == 0U);
+        CHECK_FALSE(config.tcp_quick_ack());
+        CHECK(config.busy_poll_time() == std::chrono::nanoseconds(0));
+        CHECK(config.listen_backlog() == 0U);
+    }
+
+    SECTION("set TCP_NODELAY") {
+        config.tcp_no_delay(false);
+
+        CHECK_FALSE(config.tcp_no_delay());
+    }
+
+    SECTION("set the sizes of buffers") {
+        constexpr std::size_t send_size = 12345;
+        constexpr std::size_t receive_size = 23456;
+
+        config.send_buffer_size(send_size).receive_buffer_size(receive_size);
+
+        CHECK(config.send_buffer_size() == send_size);
+        CHECK(config.receive_buffer_size() == receive_size);
+    }
+
+    SECTION("set too large sizes of buffers") {
+        constexpr auto value =
+            static_cast<std::size_t>(std::numeric_limits<int>::max()) + 1U;
+
+        CHECK_THROWS(config.send_buffer_size(value));
+        CHECK_THROWS(config.receive_buffer_size(value));
+    }
+
+    SECTION("set keep-alive") {
+        constexpr auto idle_time = std::chrono::seconds(30);
+        constexpr auto interval = std::chrono::seconds(5);
+        constexpr std::size_t count = 3;
+
+        config.keep_alive(true)
+            .keep_alive_idle_time(idle_time)
+            .keep_alive_interval(interval)
+            .keep_alive_count(count);
+
+        CHECK(config.keep_alive());
+        CHECK(config.keep_alive_idle_time() == idle_time);
+        CHECK(config.keep_alive_interval() == interval);
+        CHECK(config.keep_alive_count() == count);
+    }
+
+    SECTION("set negative durations of keep-alive") {
+        constexpr auto value = std::chrono::seconds(-1);
+
+        CHECK_THROWS(config.keep_alive_idle_time(value));
+        CHECK_THROWS(config.keep_alive_interval(value));
+    }
+
+    SECTION("set TCP_QUICKACK") {
+        config.tcp_quick_ack(true);
+
+        CHECK(config.tcp_quick_ack());
+    }
+
+    SECTION("set the time of busy polling") {
+        constexpr auto value = std::chrono::microseconds(50);
+
+        config.busy_poll_time(value);
+
+        CHECK(config.busy_poll_time() == value);
+    }
+
+    SECTION("set a negative time of busy polling") {
+        CHECK_THROWS(config.busy_poll_time(std::chrono::microseconds(-1)));
+    }
+
+    SECTION("set the backlog") {
+        constexpr std::size_t value = 1024;
+
+        config.listen_backlog(value);
+
+        CHECK(config.listen_backlog() == value);
+    }
+}
@@ -20,6 +20,7 @@
 #include "msgpack_rpc/config/toml/parse_toml_client_server.h"
 
 #include <chrono>
+#include <string>
 #include <vector>
 
 #include <catch2/catch_test_macros.hpp>
@@ -28,11 +29,18 @@
 #include <toml++/toml.h>
 
 #include "msgpack_rpc/addresses/uri.h"
+#include "msgpack_rpc/config/admission_control_config.h"
 #include "msgpack_rpc/config/client_config.h"
+#include "msgpack_rpc/config/compression_config.h"
 #include "msgpack_rpc/config/executor_config.h"
+#include "msgpack_rpc/config/flow_control_config.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/config/notification_queue_config.h"
 #include "msgpack_rpc/config/reconnection_config.h"
+#include "msgpack_rpc/config/response_cache_config.h"
 #include "msgpack_rpc/config/server_config.h"
+#include "msgpack_rpc/config/socket_config.h"
+#include "msgpack_rpc/config/traffic_capture_config.h"
 
 TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(MessageParserConfig)") {
     using msgpack_rpc::config::toml::impl::parse_toml;
@@ -81,6 +89,40 @@ read_buffer_size = "abc"
         CHECK_THROWS_WITH(parse_toml(test_table, config),
             Catch::Matchers::ContainsSubstring("read_buffer_size"));
     }
+
+    SECTION("parse max_message_size") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_message_size = 12345
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.max_message_size() == 12345);
+    }
+
+    SECTION("parse max_message_size with invalid value") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_message_size = 0
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("max_message_size"));
+    }
+
+    SECTION("parse max_message_size with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_message_size = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("max_message_size"));
+    }
 }
 
 TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(ExecutorConfig)") {
@@ -284,330 +326,1257 @@ max_jitter_waiting_time_sec = "abc"
     }
 }
 
-TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(ClientConfig)") {
-    using msgpack_rpc::addresses::URI;
+TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(SocketConfig)") {
     using msgpack_rpc::config::toml::impl::parse_toml;
 
-    msgpack_rpc::config::ClientConfig config;
+    msgpack_rpc::config::SocketConfig config;
 
     SECTION("parse an empty table") {
         const auto root_table = toml::parse(R"(
 [test]
+
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
     }
 
-    SECTION("parse uris without elements") {
+    SECTION("parse tcp_no_delay") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = []
+tcp_no_delay = false
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        // NOLINTNEXTLINE: for readability of test logs
-        CHECK(config.uris() == std::vector<URI>{});
+        CHECK_FALSE(config.tcp_no_delay());
     }
 
-    SECTION("parse uris with one element") {
+    SECTION("parse tcp_no_delay with invalid type") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = ["tcp://localhost:12345"]
+tcp_no_delay = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("tcp_no_delay"));
+    }
+
+    SECTION("parse send_buffer_size") {
+        const auto root_table = toml::parse(R"(
+[test]
+send_buffer_size = 12345
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        CHECK(
-            config.uris() == std::vector{URI::parse("tcp://localhost:12345")});
+        CHECK(config.send_buffer_size() == 12345);
     }
 
-    SECTION("parse uris with two elements") {
+    SECTION("parse send_buffer_size with invalid value") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = ["tcp://localhost:12345", "tcp://localhost:23456"]
+send_buffer_size = 4294967296
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("send_buffer_size"));
+    }
+
+    SECTION("parse receive_buffer_size") {
+        const auto root_table = toml::parse(R"(
+[test]
+receive_buffer_size = 23456
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        CHECK(config.uris() ==
-            std::vector{URI::parse("tcp://localhost:12345"),
-                URI::parse("tcp://localhost:23456")});
+        CHECK(config.receive_buffer_size() == 23456);
     }
 
-    SECTION("parse uris with invalid type") {
+    SECTION("parse keep_alive") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = "abc"
+keep_alive = true
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
-        CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("uris"));
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.keep_alive());
     }
 
-    SECTION("parse uris with invalid element type") {
+    SECTION("parse keep_alive_idle_time_sec") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = [12345]
+keep_alive_idle_time_sec = 1.5
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
-        CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("uris"));
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.keep_alive_idle_time() == std::chrono::milliseconds(1500));
     }
 
-    SECTION("parse uris with invalid element value") {
+    SECTION("parse keep_alive_idle_time_sec with invalid value") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = ["abc"]
+keep_alive_idle_time_sec = -1.5
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("uris"));
+            Catch::Matchers::ContainsSubstring("keep_alive_idle_time_sec"));
     }
 
-    SECTION("parse call_timeout_sec") {
+    SECTION("parse keep_alive_interval_sec") {
         const auto root_table = toml::parse(R"(
 [test]
-call_timeout_sec = 1.5
+keep_alive_interval_sec = 2.5
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        CHECK(config.call_timeout() == std::chrono::milliseconds(1500));
+        CHECK(config.keep_alive_interval() == std::chrono::milliseconds(2500));
     }
 
-    SECTION("parse call_timeout_sec with invalid value") {
+    SECTION("parse keep_alive_count") {
         const auto root_table = toml::parse(R"(
 [test]
-call_timeout_sec = -1.5
+keep_alive_count = 7
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
-        CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("call_timeout_sec"));
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.keep_alive_count() == 7);
     }
 
-    SECTION("parse call_timeout_sec with invalid type") {
+    SECTION("parse tcp_quick_ack") {
         const auto root_table = toml::parse(R"(
 [test]
-call_timeout_sec = "abc"
+tcp_quick_ack = true
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.tcp_quick_ack());
+    }
+
+    SECTION("parse busy_poll_time_sec") {
+        const auto root_table = toml::parse(R"(
+[test]
+busy_poll_time_sec = 0.25
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.busy_poll_time() == std::chrono::milliseconds(250));
+    }
+
+    SECTION("parse listen_backlog") {
+        const auto root_table = toml::parse(R"(
+[test]
+listen_backlog = 1024
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.listen_backlog() == 1024);
+    }
+
+    SECTION("parse listen_backlog with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+listen_backlog = "abc"
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("call_timeout_sec"));
+            Catch::Matchers::ContainsSubstring("listen_backlog"));
     }
+}
 
-    SECTION("parse message_parser") {
+TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(CompressionConfig)") {
+    using msgpack_rpc::config::toml::impl::parse_toml;
+
+    msgpack_rpc::config::CompressionConfig config;
+
+    SECTION("parse an empty table") {
         const auto root_table = toml::parse(R"(
-[test.message_parser]
-read_buffer_size = 12345
+[test]
+
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
+    }
 
-        CHECK(config.message_parser().read_buffer_size() == 12345);
+    SECTION("parse enabled") {
+        const auto root_table = toml::parse(R"(
+[test]
+enabled = true
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.enabled());
     }
 
-    SECTION("parse message_parser with invalid type") {
+    SECTION("parse enabled with invalid type") {
         const auto root_table = toml::parse(R"(
 [test]
-message_parser = []
+enabled = "abc"
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("message_parser"));
+            Catch::Matchers::ContainsSubstring("enabled"));
     }
 
-    SECTION("parse executor") {
+    SECTION("parse min_message_size") {
         const auto root_table = toml::parse(R"(
-[test.executor]
-num_callback_threads = 11
+[test]
+min_message_size = 4096
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        CHECK(config.executor().num_callback_threads() == 11);
+        CHECK(config.min_message_size() == 4096);
     }
 
-    SECTION("parse executor with invalid type") {
+    SECTION("parse min_message_size with invalid value") {
         const auto root_table = toml::parse(R"(
 [test]
-executor = []
+min_message_size = 0
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("executor"));
+            Catch::Matchers::ContainsSubstring("min_message_size"));
     }
+}
 
-    SECTION("parse reconnection") {
+TEST_CASE(
+    "msgpack_rpc::config::toml::impl::parse_toml(TrafficCaptureConfig)") {
+    using msgpack_rpc::config::toml::impl::parse_toml;
+
+    msgpack_rpc::config::TrafficCaptureConfig config;
+
+    SECTION("parse an empty table") {
         const auto root_table = toml::parse(R"(
-[test.reconnection]
-initial_waiting_time_sec = 1.5
+[test]
+
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        CHECK(config.reconnection().initial_waiting_time() ==
-            std::chrono::milliseconds(1500));
+        CHECK_FALSE(config.enabled());
     }
 
-    SECTION("parse reconnection with invalid type") {
+    SECTION("parse file_path") {
         const auto root_table = toml::parse(R"(
 [test]
-reconnection = []
+file_path = "capture.bin"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.file_path() == "capture.bin");
+    }
+
+    SECTION("parse file_path with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+file_path = 123
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("reconnection"));
+            Catch::Matchers::ContainsSubstring("file_path"));
     }
 }
 
-TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(ServerConfig)") {
-    using msgpack_rpc::addresses::URI;
+TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(FlowControlConfig)") {
     using msgpack_rpc::config::toml::impl::parse_toml;
 
-    msgpack_rpc::config::ServerConfig config;
+    msgpack_rpc::config::FlowControlConfig config;
 
     SECTION("parse an empty table") {
         const auto root_table = toml::parse(R"(
 [test]
+
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
     }
 
-    SECTION("parse uris without elements") {
+    SECTION("parse high_watermark_bytes") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = []
+high_watermark_bytes = 12345
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        // NOLINTNEXTLINE: for readability of test logs
-        CHECK(config.uris() == std::vector<URI>{});
+        CHECK(config.high_watermark_bytes() == 12345);
     }
 
-    SECTION("parse uris with one element") {
+    SECTION("parse high_watermark_bytes with invalid type") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = ["tcp://localhost:12345"]
+high_watermark_bytes = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("high_watermark_bytes"));
+    }
+
+    SECTION("parse low_watermark_bytes") {
+        const auto root_table = toml::parse(R"(
+[test]
+low_watermark_bytes = 2345
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        CHECK(
-            config.uris() == std::vector{URI::parse("tcp://localhost:12345")});
+        CHECK(config.low_watermark_bytes() == 2345);
     }
 
-    SECTION("parse uris with two elements") {
+    SECTION("parse low_watermark_bytes with invalid type") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = ["tcp://localhost:12345", "tcp://localhost:23456"]
+low_watermark_bytes = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("low_watermark_bytes"));
+    }
+
+    SECTION("parse high_watermark_messages") {
+        const auto root_table = toml::parse(R"(
+[test]
+high_watermark_messages = 345
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        CHECK(config.uris() ==
-            std::vector{URI::parse("tcp://localhost:12345"),
-                URI::parse("tcp://localhost:23456")});
+        CHECK(config.high_watermark_messages() == 345);
     }
 
-    SECTION("parse uris with invalid type") {
+    SECTION("parse high_watermark_messages with invalid type") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = "abc"
+high_watermark_messages = "abc"
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("uris"));
+            Catch::Matchers::ContainsSubstring("high_watermark_messages"));
     }
 
-    SECTION("parse uris with invalid element type") {
+    SECTION("parse low_watermark_messages") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = [12345]
+low_watermark_messages = 45
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.low_watermark_messages() == 45);
+    }
+
+    SECTION("parse low_watermark_messages with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+low_watermark_messages = "abc"
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("uris"));
+            Catch::Matchers::ContainsSubstring("low_watermark_messages"));
     }
+}
 
-    SECTION("parse uris with invalid element value") {
+TEST_CASE(
+    "msgpack_rpc::config::toml::impl::parse_toml(AdmissionControlConfig)") {
+    using msgpack_rpc::config::toml::impl::parse_toml;
+
+    msgpack_rpc::config::AdmissionControlConfig config;
+
+    SECTION("parse an empty table") {
         const auto root_table = toml::parse(R"(
 [test]
-uris = ["abc"]
+
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+    }
+
+    SECTION("parse max_connections") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_connections = 123
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.max_connections() == 123);
+    }
+
+    SECTION("parse max_connections with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_connections = "abc"
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("uris"));
+            Catch::Matchers::ContainsSubstring("max_connections"));
     }
 
-    SECTION("parse message_parser") {
+    SECTION("parse max_in_flight_per_connection") {
         const auto root_table = toml::parse(R"(
-[test.message_parser]
-read_buffer_size = 12345
+[test]
+max_in_flight_per_connection = 234
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        CHECK(config.message_parser().read_buffer_size() == 12345);
+        CHECK(config.max_in_flight_per_connection() == 234);
     }
 
-    SECTION("parse message_parser with invalid type") {
+    SECTION("parse max_in_flight_per_connection with invalid type") {
         const auto root_table = toml::parse(R"(
 [test]
-message_parser = []
+max_in_flight_per_connection = "abc"
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("message_parser"));
+            Catch::Matchers::ContainsSubstring("max_in_flight_per_connection"));
     }
 
-    SECTION("parse executor") {
+    SECTION("parse max_in_flight_requests") {
         const auto root_table = toml::parse(R"(
-[test.executor]
-num_callback_threads = 11
+[test]
+max_in_flight_requests = 345
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         REQUIRE_NOTHROW(parse_toml(test_table, config));
 
-        CHECK(config.executor().num_callback_threads() == 11);
+        CHECK(config.max_in_flight_requests() == 345);
     }
 
-    SECTION("parse executor with invalid type") {
+    SECTION("parse max_in_flight_requests with invalid type") {
         const auto root_table = toml::parse(R"(
 [test]
-executor = []
+max_in_flight_requests = "abc"
 )");
         const auto test_table = root_table["test"].ref<toml::table>();
 
         CHECK_THROWS_WITH(parse_toml(test_table, config),
-            Catch::Matchers::ContainsSubstring("executor"));
+            Catch::Matchers::ContainsSubstring("max_in_flight_requests"));
+    }
+}
+
+TEST_CASE(
+    "msgpack_rpc::config::toml::impl::parse_toml(NotificationQueueConfig)") {
+    using msgpack_rpc::config::toml::impl::parse_toml;
+
+    msgpack_rpc::config::NotificationQueueConfig config;
+
+    SECTION("parse an empty table") {
+        const auto root_table = toml::parse(R"(
+[test]
+
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+    }
+
+    SECTION("parse max_queued_notifications") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_queued_notifications = 123
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.max_queued_notifications() == 123);
+    }
+
+    SECTION("parse max_queued_notifications with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_queued_notifications = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("max_queued_notifications"));
+    }
+
+    SECTION("parse disconnect_slow_consumers") {
+        const auto root_table = toml::parse(R"(
+[test]
+disconnect_slow_consumers = true
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.disconnect_slow_consumers());
+    }
+
+    SECTION("parse disconnect_slow_consumers with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+disconnect_slow_consumers = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("disconnect_slow_consumers"));
+    }
+}
+
+TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(ResponseCacheConfig)") {
+    using msgpack_rpc::config::toml::impl::parse_toml;
+
+    msgpack_rpc::config::ResponseCacheConfig config;
+
+    SECTION("parse an empty table") {
+        const auto root_table = toml::parse(R"(
+[test]
+
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+    }
+
+    SECTION("parse time_to_live_sec") {
+        const auto root_table = toml::parse(R"(
+[test]
+time_to_live_sec = 0.5
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.time_to_live() == std::chrono::milliseconds(500));
+    }
+
+    SECTION("parse time_to_live_sec with invalid value") {
+        const auto root_table = toml::parse(R"(
+[test]
+time_to_live_sec = 0.0
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("time_to_live_sec"));
+    }
+
+    SECTION("parse time_to_live_sec with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+time_to_live_sec = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("time_to_live_sec"));
+    }
+
+    SECTION("parse max_entries") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_entries = 123
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.max_entries() == 123);
+    }
+
+    SECTION("parse max_entries with invalid value") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_entries = 0
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("max_entries"));
+    }
+
+    SECTION("parse max_entries with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_entries = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("max_entries"));
+    }
+
+    SECTION("parse max_bytes") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_bytes = 4567
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.max_bytes() == 4567);
+    }
+
+    SECTION("parse max_bytes with invalid value") {
+        const auto root_table = toml::parse(R"(
+[test]
+max_bytes = 0
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("max_bytes"));
+    }
+}
+
+TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(ClientConfig)") {
+    using msgpack_rpc::addresses::URI;
+    using msgpack_rpc::config::toml::impl::parse_toml;
+
+    msgpack_rpc::config::ClientConfig config;
+
+    SECTION("parse an empty table") {
+        const auto root_table = toml::parse(R"(
+[test]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+    }
+
+    SECTION("parse uris without elements") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        // NOLINTNEXTLINE: for readability of test logs
+        CHECK(config.uris() == std::vector<URI>{});
+    }
+
+    SECTION("parse uris with one element") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = ["tcp://localhost:12345"]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(
+            config.uris() == std::vector{URI::parse("tcp://localhost:12345")});
+    }
+
+    SECTION("parse uris with two elements") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = ["tcp://localhost:12345", "tcp://localhost:23456"]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.uris() ==
+            std::vector{URI::parse("tcp://localhost:12345"),
+                URI::parse("tcp://localhost:23456")});
+    }
+
+    SECTION("parse uris with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("uris"));
+    }
+
+    SECTION("parse uris with invalid element type") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = [12345]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("uris"));
+    }
+
+    SECTION("parse uris with invalid element value") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = ["abc"]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("uris"));
+    }
+
+    SECTION("parse call_timeout_sec") {
+        const auto root_table = toml::parse(R"(
+[test]
+call_timeout_sec = 1.5
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.call_timeout() == std::chrono::milliseconds(1500));
+    }
+
+    SECTION("parse call_timeout_sec with invalid value") {
+        const auto root_table = toml::parse(R"(
+[test]
+call_timeout_sec = -1.5
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("call_timeout_sec"));
+    }
+
+    SECTION("parse call_timeout_sec with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+call_timeout_sec = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("call_timeout_sec"));
+    }
+
+    SECTION("parse propagate_deadline") {
+        const auto root_table = toml::parse(R"(
+[test]
+propagate_deadline = true
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.propagate_deadline());
+    }
+
+    SECTION("parse propagate_deadline with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+propagate_deadline = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("propagate_deadline"));
+    }
+
+    SECTION("parse single_flight_methods") {
+        const auto root_table = toml::parse(R"(
+[test]
+single_flight_methods = ["method1", "method2"]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.single_flight_methods() ==
+            std::vector<std::string>{"method1", "method2"});
+    }
+
+    SECTION("parse single_flight_methods with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+single_flight_methods = "method1"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("single_flight_methods"));
+    }
+
+    SECTION("parse single_flight_methods with invalid element type") {
+        const auto root_table = toml::parse(R"(
+[test]
+single_flight_methods = [12345]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("single_flight_methods"));
+    }
+
+    SECTION("parse response_caches") {
+        const auto root_table = toml::parse(R"(
+[test.response_caches.method1]
+time_to_live_sec = 0.5
+max_entries = 123
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        REQUIRE(config.response_caches().size() == 1U);
+        const auto& cache_config = config.response_caches().at("method1");
+        CHECK(cache_config.time_to_live() == std::chrono::milliseconds(500));
+        CHECK(cache_config.max_entries() == 123U);
+    }
+
+    SECTION("parse response_caches with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+response_caches = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("response_caches"));
+    }
+
+    SECTION("parse response_caches with invalid element type") {
+        const auto root_table = toml::parse(R"(
+[test.response_caches]
+method1 = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("response_caches"));
+    }
+
+    SECTION("parse message_parser") {
+        const auto root_table = toml::parse(R"(
+[test.message_parser]
+read_buffer_size = 12345
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.message_parser().read_buffer_size() == 12345);
+    }
+
+    SECTION("parse message_parser with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+message_parser = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("message_parser"));
+    }
+
+    SECTION("parse executor") {
+        const auto root_table = toml::parse(R"(
+[test.executor]
+num_callback_threads = 11
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.executor().num_callback_threads() == 11);
+    }
+
+    SECTION("parse executor with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+executor = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("executor"));
+    }
+
+    SECTION("parse reconnection") {
+        const auto root_table = toml::parse(R"(
+[test.reconnection]
+initial_waiting_time_sec = 1.5
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.reconnection().initial_waiting_time() ==
+            std::chrono::milliseconds(1500));
+    }
+
+    SECTION("parse reconnection with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+reconnection = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("reconnection"));
+    }
+
+    SECTION("parse compression") {
+        const auto root_table = toml::parse(R"(
+[test.compression]
+enabled = true
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.compression().enabled());
+    }
+
+    SECTION("parse compression with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+compression = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("compression"));
+    }
+
+    SECTION("parse traffic_capture") {
+        const auto root_table = toml::parse(R"(
+[test.traffic_capture]
+file_path = "capture.bin"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.traffic_capture().file_path() == "capture.bin");
+    }
+
+    SECTION("parse traffic_capture with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+traffic_capture = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("traffic_capture"));
+    }
+}
+
+TEST_CASE("msgpack_rpc::config::toml::impl::parse_toml(ServerConfig)") {
+    using msgpack_rpc::addresses::URI;
+    using msgpack_rpc::config::toml::impl::parse_toml;
+
+    msgpack_rpc::config::ServerConfig config;
+
+    SECTION("parse an empty table") {
+        const auto root_table = toml::parse(R"(
+[test]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+    }
+
+    SECTION("parse uris without elements") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        // NOLINTNEXTLINE: for readability of test logs
+        CHECK(config.uris() == std::vector<URI>{});
+    }
+
+    SECTION("parse uris with one element") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = ["tcp://localhost:12345"]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(
+            config.uris() == std::vector{URI::parse("tcp://localhost:12345")});
+    }
+
+    SECTION("parse uris with two elements") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = ["tcp://localhost:12345", "tcp://localhost:23456"]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.uris() ==
+            std::vector{URI::parse("tcp://localhost:12345"),
+                URI::parse("tcp://localhost:23456")});
+    }
+
+    SECTION("parse uris with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("uris"));
+    }
+
+    SECTION("parse uris with invalid element type") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = [12345]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("uris"));
+    }
+
+    SECTION("parse uris with invalid element value") {
+        const auto root_table = toml::parse(R"(
+[test]
+uris = ["abc"]
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("uris"));
+    }
+
+    SECTION("parse upload_idle_timeout_sec") {
+        const auto root_table = toml::parse(R"(
+[test]
+upload_idle_timeout_sec = 1.5
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.upload_idle_timeout() == std::chrono::milliseconds(1500));
+    }
+
+    SECTION("parse upload_idle_timeout_sec with invalid value") {
+        const auto root_table = toml::parse(R"(
+[test]
+upload_idle_timeout_sec = -1.5
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("upload_idle_timeout_sec"));
+    }
+
+    SECTION("parse upload_idle_timeout_sec with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+upload_idle_timeout_sec = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("upload_idle_timeout_sec"));
+    }
+
+    SECTION("parse call_timeout_sec") {
+        const auto root_table = toml::parse(R"(
+[test]
+call_timeout_sec = 1.5
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.call_timeout() == std::chrono::milliseconds(1500));
+    }
+
+    SECTION("parse call_timeout_sec with invalid value") {
+        const auto root_table = toml::parse(R"(
+[test]
+call_timeout_sec = -1.5
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("call_timeout_sec"));
+    }
+
+    SECTION("parse call_timeout_sec with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+call_timeout_sec = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("call_timeout_sec"));
+    }
+
+    SECTION("parse propagate_deadline") {
+        const auto root_table = toml::parse(R"(
+[test]
+propagate_deadline = true
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.propagate_deadline());
+    }
+
+    SECTION("parse propagate_deadline with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+propagate_deadline = "abc"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("propagate_deadline"));
+    }
+
+    SECTION("parse message_parser") {
+        const auto root_table = toml::parse(R"(
+[test.message_parser]
+read_buffer_size = 12345
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.message_parser().read_buffer_size() == 12345);
+    }
+
+    SECTION("parse message_parser with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+message_parser = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("message_parser"));
+    }
+
+    SECTION("parse executor") {
+        const auto root_table = toml::parse(R"(
+[test.executor]
+num_callback_threads = 11
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.executor().num_callback_threads() == 11);
+    }
+
+    SECTION("parse executor with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+executor = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("executor"));
+    }
+
+    SECTION("parse compression") {
+        const auto root_table = toml::parse(R"(
+[test.compression]
+enabled = true
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.compression().enabled());
+    }
+
+    SECTION("parse compression with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+compression = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("compression"));
+    }
+
+    SECTION("parse traffic_capture") {
+        const auto root_table = toml::parse(R"(
+[test.traffic_capture]
+file_path = "capture.bin"
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        REQUIRE_NOTHROW(parse_toml(test_table, config));
+
+        CHECK(config.traffic_capture().file_path() == "capture.bin");
+    }
+
+    SECTION("parse traffic_capture with invalid type") {
+        const auto root_table = toml::parse(R"(
+[test]
+traffic_capture = []
+)");
+        const auto test_table = root_table["test"].ref<toml::table>();
+
+        CHECK_THROWS_WITH(parse_toml(test_table, config),
+            Catch::Matchers::ContainsSubstring("traffic_capture"));
     }
 }
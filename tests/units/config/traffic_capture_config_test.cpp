@@ -0,0 +1,40 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of TrafficCaptureConfig class.
+ */
+#include "msgpack_rpc/config/traffic_capture_config.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::config::TrafficCaptureConfig") {
+    using msgpack_rpc::config::TrafficCaptureConfig;
+
+    TrafficCaptureConfig config;
+
+    SECTION("has correct value as default") {
+        CHECK(config.file_path().empty());
+        CHECK_FALSE(config.enabled());
+    }
+
+    SECTION("set the file path") {
+        config.file_path("capture.bin");
+
+        CHECK(config.file_path() == "capture.bin");
+        CHECK(config.enabled());
+    }
+}
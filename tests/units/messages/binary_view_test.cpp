@@ -0,0 +1,86 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of BinaryView class.
+ */
+#include "msgpack_rpc/messages/binary_view.h"
+
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+TEST_CASE("msgpack_rpc::messages::BinaryView") {
+    using msgpack_rpc::messages::BinaryView;
+
+    SECTION("create an empty view") {
+        const BinaryView view;
+
+        CHECK(view.data() == nullptr);
+        CHECK(view.size() == 0U);
+    }
+
+    SECTION("pack and convert") {
+        const auto data = std::string("abc\0def", 7);
+
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, BinaryView(data.data(), data.size()));
+        const auto object_handle =
+            msgpack::unpack(buffer.data(), buffer.size());
+
+        REQUIRE(object_handle->type == msgpack::type::BIN);
+        const auto view = object_handle->as<BinaryView>();
+        CHECK(std::string_view(view.data(), view.size()) == data);
+        CHECK(view.data() == object_handle->via.bin.ptr);
+    }
+
+    SECTION("convert a string") {
+        const auto data = std::string("abc");
+
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, data);
+        const auto object_handle =
+            msgpack::unpack(buffer.data(), buffer.size());
+
+        const auto view = object_handle->as<BinaryView>();
+        CHECK(std::string_view(view.data(), view.size()) == data);
+    }
+
+    SECTION("convert an invalid object") {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, 123);
+        const auto object_handle =
+            msgpack::unpack(buffer.data(), buffer.size());
+
+        CHECK_THROWS_AS(
+            (void)object_handle->as<BinaryView>(), msgpack::type_error);
+    }
+
+    SECTION("create an object with a zone") {
+        const auto data = std::string("abc");
+        msgpack::zone zone;
+
+        const auto object =
+            msgpack::object(BinaryView(data.data(), data.size()), zone);
+
+        REQUIRE(object.type == msgpack::type::BIN);
+        CHECK(std::string_view(object.via.bin.ptr, object.via.bin.size) ==
+            data);
+        CHECK(object.via.bin.ptr != data.data());
+    }
+}
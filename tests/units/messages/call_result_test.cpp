@@ -19,12 +19,35 @@
  */
 #include "msgpack_rpc/messages/call_result.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <msgpack.hpp>
 
+#include "msgpack_rpc/messages/impl/encoded_object.h"
+
+namespace {
+
+template <typename T>
+[[nodiscard]] std::shared_ptr<const msgpack_rpc::messages::impl::EncodedObject>
+create_encoded_object(const T& data) {
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, data);
+    auto bytes = std::make_shared<std::vector<char>>(
+        buffer.data(), buffer.data() + buffer.size());
+    constexpr std::size_t offset = 0;
+    return std::make_shared<const msgpack_rpc::messages::impl::EncodedObject>(
+        std::move(bytes), offset, buffer.size());
+}
+
+}  // namespace
+
 TEST_CASE("msgpack_rpc::messages::CallResult") {
     using msgpack_rpc::messages::CallResult;
 
@@ -67,4 +90,39 @@ TEST_CASE("msgpack_rpc::messages::CallResult") {
 
         CHECK_THROWS(result.error_as<int>());
     }
+
+    SECTION("create a result from bytes") {
+        const std::map<std::string, std::vector<int>> value{{"a", {1, 2}}};
+        const auto result =
+            CallResult::create_result(create_encoded_object(value));
+
+        CHECK(result.is_success());
+        CHECK(result.result_as<std::map<std::string, std::vector<int>>>() ==
+            value);
+        CHECK(result.result_as<std::map<std::string,
+                std::vector<std::int64_t>>>() ==
+            std::map<std::string, std::vector<std::int64_t>>{{"a", {1, 2}}});
+        CHECK(result.object().type == msgpack::type::MAP);
+        CHECK(result.zone() != nullptr);
+        CHECK_THROWS(result.result_as<std::string>());
+        CHECK_THROWS(result.error_as<std::string>());
+    }
+
+    SECTION("create a result from bytes of a type without direct decoding") {
+        const auto value = std::make_tuple(1, std::string("abc"));
+        const auto result =
+            CallResult::create_result(create_encoded_object(value));
+
+        CHECK(result.result_as<std::tuple<int, std::string>>() == value);
+    }
+
+    SECTION("create an error from bytes") {
+        const auto result =
+            CallResult::create_error(create_encoded_object("abc"));
+
+        CHECK(result.is_error());
+        CHECK(result.error_as<std::string>() == "abc");
+        CHECK_THROWS(result.error_as<int>());
+        CHECK_THROWS(result.result_as<std::string>());
+    }
 }
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of ExternalBinary class.
+ */
+#include "msgpack_rpc/messages/external_binary.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/messages/binary_view.h"
+
+TEST_CASE("msgpack_rpc::messages::ExternalBinary") {
+    using msgpack_rpc::messages::BinaryView;
+    using msgpack_rpc::messages::ExternalBinary;
+
+    const auto data = std::string("abc\0def", 7);
+    int num_releases = 0;
+    std::optional<ExternalBinary> binary{
+        ExternalBinary(data.data(), data.size(), [&num_releases] {
+            ++num_releases;
+        })};
+
+    SECTION("get data") {
+        CHECK(binary->data() == data.data());
+        CHECK(binary->size() == data.size());
+        CHECK(binary->view().data() == data.data());
+        CHECK(binary->view().size() == data.size());
+    }
+
+    SECTION("release the buffer after all copies are destroyed") {
+        std::optional<ExternalBinary> copy{*binary};
+
+        binary.reset();
+        CHECK(num_releases == 0);
+
+        copy.reset();
+        CHECK(num_releases == 1);
+    }
+
+    SECTION("pack") {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, *binary);
+        const auto object_handle =
+            msgpack::unpack(buffer.data(), buffer.size());
+
+        REQUIRE(object_handle->type == msgpack::type::BIN);
+        const auto view = object_handle->as<BinaryView>();
+        CHECK(std::string_view(view.data(), view.size()) == data);
+    }
+
+    SECTION("create an object with a zone") {
+        msgpack::zone zone;
+
+        const auto object = msgpack::object(*binary, zone);
+
+        REQUIRE(object.type == msgpack::type::BIN);
+        CHECK(std::string_view(object.via.bin.ptr, object.via.bin.size) ==
+            data);
+        CHECK(object.via.bin.ptr != data.data());
+    }
+}
@@ -0,0 +1,236 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of classes to decode objects in msgpack directly.
+ */
+#include "msgpack_rpc/messages/impl/direct_decoder.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+namespace {
+
+/*!
+ * \brief Serialize an object.
+ *
+ * \tparam T Type of the object.
+ * \param[in] value Object.
+ * \return Serialized data.
+ */
+template <typename T>
+std::string serialize(const T& value) {
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, value);
+    return std::string(buffer.data(), buffer.size());
+}
+
+}  // namespace
+
+TEST_CASE("msgpack_rpc::messages::impl::is_directly_decodable") {
+    using msgpack_rpc::messages::impl::is_directly_decodable_v;
+
+    STATIC_REQUIRE(is_directly_decodable_v<bool>);
+    STATIC_REQUIRE(is_directly_decodable_v<std::int32_t>);
+    STATIC_REQUIRE(is_directly_decodable_v<std::uint64_t>);
+    STATIC_REQUIRE(is_directly_decodable_v<double>);
+    STATIC_REQUIRE(is_directly_decodable_v<std::string>);
+    STATIC_REQUIRE(is_directly_decodable_v<std::vector<std::vector<int>>>);
+    STATIC_REQUIRE(
+        is_directly_decodable_v<std::map<std::string, std::vector<double>>>);
+    STATIC_REQUIRE(is_directly_decodable_v<std::unordered_map<int, bool>>);
+
+    STATIC_REQUIRE_FALSE(is_directly_decodable_v<std::vector<bool>>);
+    STATIC_REQUIRE_FALSE(is_directly_decodable_v<std::vector<char>>);
+    STATIC_REQUIRE_FALSE(is_directly_decodable_v<std::tuple<int>>);
+    STATIC_REQUIRE_FALSE(
+        is_directly_decodable_v<std::map<std::string, std::tuple<int>>>);
+}
+
+TEST_CASE("msgpack_rpc::messages::impl::ParametersDecoder") {
+    using msgpack_rpc::messages::impl::decode_directly;
+    using msgpack_rpc::messages::impl::ParametersDecoder;
+
+    SECTION("decode parameters of various types") {
+        const auto data = serialize(std::make_tuple(1, std::string("ab"),
+            std::vector<int>{1, 2, -3},
+            std::map<std::string, std::vector<double>>{{"k", {1.5, 5.0}}}));
+
+        std::tuple<int, std::string, std::vector<int>,
+            std::map<std::string, std::vector<double>>>
+            parameters;
+        ParametersDecoder<int, std::string, std::vector<int>,
+            std::map<std::string, std::vector<double>>>
+            decoder;
+        decoder.set_target(parameters);
+
+        CHECK(decode_directly(data.data(), data.size(), decoder));
+        CHECK(std::get<0>(parameters) == 1);
+        CHECK(std::get<1>(parameters) == "ab");
+        CHECK(std::get<2>(parameters) == std::vector<int>{1, 2, -3});
+        CHECK(std::get<3>(parameters) ==
+            std::map<std::string, std::vector<double>>{{"k", {1.5, 5.0}}});
+    }
+
+    SECTION("decode nested containers") {
+        const auto data = serialize(std::make_tuple(
+            std::vector<std::vector<std::int64_t>>{{1, 2}, {}},
+            std::unordered_map<int, std::string>{{1, "x"}, {2, "y"}}));
+
+        std::tuple<std::vector<std::vector<std::int64_t>>,
+            std::unordered_map<int, std::string>>
+            parameters;
+        ParametersDecoder<std::vector<std::vector<std::int64_t>>,
+            std::unordered_map<int, std::string>>
+            decoder;
+        decoder.set_target(parameters);
+
+        CHECK(decode_directly(data.data(), data.size(), decoder));
+        CHECK(std::get<0>(parameters) ==
+            std::vector<std::vector<std::int64_t>>{{1, 2}, {}});
+        CHECK(std::get<1>(parameters) ==
+            std::unordered_map<int, std::string>{{1, "x"}, {2, "y"}});
+    }
+
+    SECTION("decode no parameter") {
+        const auto data = serialize(std::make_tuple());
+
+        std::tuple<> parameters;
+        ParametersDecoder<> decoder;
+        decoder.set_target(parameters);
+
+        CHECK(decode_directly(data.data(), data.size(), decoder));
+    }
+
+    SECTION("reject invalid number of parameters") {
+        const auto data = serialize(std::make_tuple(1, 2));
+
+        std::tuple<int> parameters;
+        ParametersDecoder<int> decoder;
+        decoder.set_target(parameters);
+
+        CHECK_FALSE(decode_directly(data.data(), data.size(), decoder));
+        CHECK(decoder.has_invalid_size());
+    }
+
+    SECTION("reject negative integers for unsigned integers") {
+        const auto data = serialize(std::make_tuple(-1));
+
+        std::tuple<unsigned int> parameters;
+        ParametersDecoder<unsigned int> decoder;
+        decoder.set_target(parameters);
+
+        CHECK_FALSE(decode_directly(data.data(), data.size(), decoder));
+        CHECK_FALSE(decoder.has_invalid_size());
+    }
+
+    SECTION("reject integers out of range") {
+        constexpr int value = 256;
+        const auto data = serialize(std::make_tuple(value));
+
+        std::tuple<std::uint8_t> parameters;
+        ParametersDecoder<std::uint8_t> decoder;
+        decoder.set_target(parameters);
+
+        CHECK_FALSE(decode_directly(data.data(), data.size(), decoder));
+    }
+
+    SECTION("reject objects of different types") {
+        const auto data = serialize(std::make_tuple(1));
+
+        std::tuple<std::vector<int>> parameters;
+        ParametersDecoder<std::vector<int>> decoder;
+        decoder.set_target(parameters);
+
+        CHECK_FALSE(decode_directly(data.data(), data.size(), decoder));
+    }
+
+    SECTION("reject maps for arrays") {
+        const auto data = serialize(std::make_tuple(std::map<int, int>{}));
+
+        std::tuple<std::vector<int>> parameters;
+        ParametersDecoder<std::vector<int>> decoder;
+        decoder.set_target(parameters);
+
+        CHECK_FALSE(decode_directly(data.data(), data.size(), decoder));
+    }
+
+    SECTION("reject truncated data") {
+        const auto data = serialize(std::make_tuple(std::string("abc")));
+
+        std::tuple<std::string> parameters;
+        ParametersDecoder<std::string> decoder;
+        decoder.set_target(parameters);
+
+        CHECK_FALSE(decode_directly(data.data(), data.size() - 1, decoder));
+    }
+}
+
+TEST_CASE("msgpack_rpc::messages::impl::DirectDecoder") {
+    using msgpack_rpc::messages::impl::decode_directly;
+    using msgpack_rpc::messages::impl::DirectDecoder;
+
+    SECTION("decode a boolean") {
+        const auto data = serialize(true);
+
+        bool value = false;
+        DirectDecoder<bool> decoder;
+        decoder.set_target(value);
+
+        CHECK(decode_directly(data.data(), data.size(), decoder));
+        CHECK(value);
+    }
+
+    SECTION("decode integers into floating-point numbers") {
+        constexpr int value = -3;
+        const auto data = serialize(value);
+
+        double result = 0.0;
+        DirectDecoder<double> decoder;
+        decoder.set_target(result);
+
+        CHECK(decode_directly(data.data(), data.size(), decoder));
+        CHECK(result == static_cast<double>(value));
+    }
+
+    SECTION("decode binaries into strings") {
+        const auto data = serialize(std::vector<char>{'a', 'b', 'c'});
+
+        std::string result;
+        DirectDecoder<std::string> decoder;
+        decoder.set_target(result);
+
+        CHECK(decode_directly(data.data(), data.size(), decoder));
+        CHECK(result == "abc");
+    }
+
+    SECTION("reject extra bytes") {
+        const auto data = serialize(1) + serialize(2);
+
+        int result = 0;
+        DirectDecoder<int> decoder;
+        decoder.set_target(result);
+
+        CHECK_FALSE(decode_directly(data.data(), data.size(), decoder));
+    }
+}
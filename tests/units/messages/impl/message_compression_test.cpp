@@ -0,0 +1,173 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to compress messages.
+ */
+#include "msgpack_rpc/messages/impl/message_compression.h"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/messages/external_binary.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/parsed_parameters.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+TEST_CASE("msgpack_rpc::messages::impl::compress_message") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::messages::ExternalBinary;
+    using msgpack_rpc::messages::MessageSerializer;
+    using msgpack_rpc::messages::MethodNameView;
+    using msgpack_rpc::messages::SerializedMessage;
+    using msgpack_rpc::messages::impl::compress_message;
+    using msgpack_rpc::messages::impl::decompress_message;
+    using msgpack_rpc::messages::impl::is_compressed_message;
+
+    const auto serialize = [](const auto& data) {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, data);
+        return SerializedMessage(buffer.data(), buffer.size());
+    };
+
+    const auto unpack = [](const SerializedMessage& message) {
+        return msgpack::unpack(message.data(), message.size());
+    };
+
+    constexpr std::size_t max_message_size = 1024 * 1024;
+
+    SECTION("compress and decompress a message") {
+        constexpr std::size_t size = 1000;
+        const auto data = std::make_tuple(2, "method", std::string(size, 'a'));
+        const auto original = serialize(data);
+
+        const auto compressed = compress_message(original);
+        REQUIRE(compressed.has_value());
+        CHECK(compressed->size() < original.size());
+
+        const auto compressed_object = unpack(*compressed);
+        REQUIRE(is_compressed_message(compressed_object.get()));
+
+        const auto decompressed =
+            decompress_message(compressed_object.get(), max_message_size);
+        CHECK(decompressed->as<decltype(data)>() == data);
+    }
+
+    SECTION("compress a message with external binaries") {
+        constexpr std::size_t size = 1000;
+        const std::string binary(size, 'b');
+        const auto original = MessageSerializer::serialize_notification(
+            MethodNameView("method"),
+            ExternalBinary(binary.data(), binary.size(), [] {}));
+        REQUIRE(original.has_external_binaries());
+
+        const auto compressed = compress_message(original);
+        REQUIRE(compressed.has_value());
+        CHECK_FALSE(compressed->has_external_binaries());
+
+        const auto decompressed =
+            decompress_message(unpack(*compressed).get(), max_message_size);
+        const auto result = decompressed->as<
+            std::tuple<int, std::string, std::tuple<std::string>>>();
+        CHECK(std::get<0>(std::get<2>(result)) == binary);
+    }
+
+    SECTION("skip a message not reduced by compression") {
+        const auto original = serialize(std::make_tuple(2, "method"));
+
+        CHECK_FALSE(compress_message(original).has_value());
+    }
+
+    SECTION("check that uncompressed messages are not compressed messages") {
+        const auto original = serialize(std::make_tuple(2, "method"));
+
+        CHECK_FALSE(is_compressed_message(unpack(original).get()));
+    }
+
+    SECTION("decompress invalid data") {
+        constexpr std::size_t size = 1000;
+        const auto original =
+            serialize(std::make_tuple(2, "method", std::string(size, 'a')));
+        const auto compressed = compress_message(original);
+        REQUIRE(compressed.has_value());
+
+        // Break the compressed data.
+        std::string data(compressed->data(), compressed->size());
+        constexpr std::size_t header_size = 10;
+        for (std::size_t i = header_size; i < data.size(); ++i) {
+            data[i] = static_cast<char>(0xFF);
+        }
+        const auto object = msgpack::unpack(data.data(), data.size());
+        REQUIRE(is_compressed_message(object.get()));
+
+        CHECK_THROWS_AS(
+            (void)decompress_message(object.get(), max_message_size),
+            MsgpackRPCException);
+    }
+
+    SECTION("reject a message larger than the maximum size") {
+        constexpr std::size_t size = 1000;
+        const auto original =
+            serialize(std::make_tuple(2, "method", std::string(size, 'a')));
+        const auto compressed = compress_message(original);
+        REQUIRE(compressed.has_value());
+        const auto object = unpack(*compressed);
+        REQUIRE(is_compressed_message(object.get()));
+
+        CHECK_THROWS_AS(
+            (void)decompress_message(object.get(), original.size() - 1U),
+            MsgpackRPCException);
+        CHECK_NOTHROW((void)decompress_message(object.get(), original.size()));
+    }
+}
+
+TEST_CASE("msgpack_rpc::messages::impl::is_compression_algorithm_supported") {
+    using msgpack_rpc::messages::ParsedParameters;
+    using msgpack_rpc::messages::impl::is_compression_algorithm_supported;
+
+    const auto create_parameters = [](const auto& data) {
+        auto zone = std::make_unique<msgpack::zone>();
+        const auto object = msgpack::object(data, *zone);
+        return ParsedParameters(object, std::move(zone));
+    };
+
+    SECTION("check LZ4") {
+        CHECK(is_compression_algorithm_supported(
+            create_parameters(std::make_tuple("lz4"))));
+    }
+
+    SECTION("check other algorithms") {
+        CHECK_FALSE(is_compression_algorithm_supported(
+            create_parameters(std::make_tuple("zstd"))));
+    }
+
+    SECTION("check invalid parameters") {
+        CHECK_FALSE(is_compression_algorithm_supported(
+            create_parameters(std::make_tuple())));
+        CHECK_FALSE(is_compression_algorithm_supported(
+            create_parameters(std::make_tuple(1))));
+    }
+}
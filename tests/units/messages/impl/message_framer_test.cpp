@@ -0,0 +1,148 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of MessageFramer class.
+ */
+#include "msgpack_rpc/messages/impl/message_framer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+TEST_CASE("msgpack_rpc::messages::impl::MessageFramer") {
+    using msgpack_rpc::messages::MessageSerializer;
+    using msgpack_rpc::messages::SerializedMessage;
+    using msgpack_rpc::messages::impl::FramedMessage;
+    using msgpack_rpc::messages::impl::MessageFramer;
+
+    constexpr std::size_t max_message_size = 1024 * 1024;
+
+    const auto to_string = [](const SerializedMessage& message) {
+        const auto flattened = message.flatten();
+        return std::string(flattened.data(), flattened.size());
+    };
+
+    const auto write = [](MessageFramer& framer, const std::string& data) {
+        const auto buffer = framer.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.begin(), data.end(), buffer.data());
+        framer.consumed(data.size());
+    };
+
+    SECTION("find messages received byte by byte") {
+        constexpr std::size_t read_buffer_size = 4;
+        constexpr std::size_t param_size = 100;
+        const auto data1 = to_string(MessageSerializer::serialize_notification(
+            "method", std::string(param_size, 'a'), 1, 2.5));
+        const auto data2 = to_string(
+            MessageSerializer::serialize_successful_response(1, "result"));
+        const auto data = data1 + data2;
+
+        MessageFramer framer{read_buffer_size, max_message_size};
+        std::string found;
+        for (const char byte : data) {
+            write(framer, std::string(1, byte));
+            std::optional<FramedMessage> message;
+            REQUIRE_NOTHROW(message = framer.try_frame());
+            if (message) {
+                found += std::string(
+                    message->buffer->data() + message->offset, message->size);
+                CHECK((found == data1 || found == data));
+            }
+        }
+        CHECK(found == data);
+    }
+
+    SECTION("find multiple messages at once") {
+        const auto data1 =
+            to_string(MessageSerializer::serialize_notification("method1", 1));
+        const auto data2 =
+            to_string(MessageSerializer::serialize_notification("method2", 2));
+
+        constexpr std::size_t read_buffer_size = 1024;
+        MessageFramer framer{read_buffer_size, max_message_size};
+        write(framer, data1 + data2);
+
+        const auto message1 = framer.try_frame();
+        REQUIRE(message1.has_value());
+        CHECK(std::string(message1->buffer->data() + message1->offset,
+                  message1->size) == data1);
+        const auto message2 = framer.try_frame();
+        REQUIRE(message2.has_value());
+        CHECK(std::string(message2->buffer->data() + message2->offset,
+                  message2->size) == data2);
+        CHECK_FALSE(framer.try_frame().has_value());
+    }
+
+    SECTION("throw for invalid data") {
+        const auto invalid_char =
+            static_cast<char>(static_cast<unsigned char>(0xC1));
+        constexpr std::size_t read_buffer_size = 16;
+
+        MessageFramer framer{read_buffer_size, max_message_size};
+        write(framer, std::string(1, invalid_char));
+
+        CHECK_THROWS(framer.try_frame());
+    }
+
+    SECTION("throw for a message larger than the maximum size") {
+        constexpr std::size_t param_size = 100;
+        const auto data = to_string(MessageSerializer::serialize_notification(
+            "method", std::string(param_size, 'a')));
+        constexpr std::size_t read_buffer_size = 1024;
+
+        MessageFramer framer{read_buffer_size, data.size() - 1U};
+        write(framer, data);
+
+        CHECK_THROWS(framer.try_frame());
+    }
+
+    SECTION("throw for a partially received message larger than the maximum "
+            "size") {
+        constexpr std::size_t param_size = 100;
+        const auto data = to_string(MessageSerializer::serialize_notification(
+            "method", std::string(param_size, 'a')));
+        constexpr std::size_t read_buffer_size = 1024;
+        constexpr std::size_t max_size = 50;
+
+        MessageFramer framer{read_buffer_size, max_size};
+        write(framer, data.substr(0, max_size));
+        CHECK_FALSE(framer.try_frame().has_value());
+        write(framer, data.substr(max_size, 1));
+
+        CHECK_THROWS(framer.try_frame());
+    }
+
+    SECTION("find a message of the maximum size") {
+        const auto data =
+            to_string(MessageSerializer::serialize_notification("method", 1));
+        constexpr std::size_t read_buffer_size = 1024;
+
+        MessageFramer framer{read_buffer_size, data.size()};
+        write(framer, data);
+
+        const auto message = framer.try_frame();
+        REQUIRE(message.has_value());
+        CHECK(message->size == data.size());
+    }
+}
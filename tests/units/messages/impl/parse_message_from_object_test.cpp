@@ -19,6 +19,9 @@
  */
 #include "msgpack_rpc/messages/impl/parse_message_from_object.h"
 
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -27,6 +30,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <msgpack.hpp>
 
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/parsed_notification.h"
 #include "msgpack_rpc/messages/parsed_request.h"
@@ -60,6 +64,66 @@ TEST_CASE("msgpack_rpc::messages::impl::parse_message_from_object") {
         CHECK(request.parameters().as<int>() == params);
     }
 
+    SECTION("parse a request with the remaining budget") {
+        auto zone = std::make_unique<msgpack::zone>();
+        const MessageID message_id = 12345;
+        const std::string method_name = "method";
+        const auto params = std::make_tuple(123);
+        const auto budget = std::chrono::seconds(3);
+        const auto extension = std::map<std::string, std::uint64_t>{
+            {"budget_ns",
+                static_cast<std::uint64_t>(
+                    std::chrono::nanoseconds(budget).count())},
+            {"unknown", 0U}};
+        const auto object = msgpack::object(
+            std::make_tuple(0, message_id, method_name, params, extension),
+            *zone);
+        auto object_handle = msgpack::object_handle(object, std::move(zone));
+
+        const auto message =
+            parse_message_from_object(std::move(object_handle));
+
+        REQUIRE(message.index() == 0);
+        const auto request = std::get<ParsedRequest>(message);
+        CHECK(request.id() == message_id);
+        CHECK(request.method_name().name() == method_name);
+        CHECK(request.parameters().as<int>() == params);
+        REQUIRE(request.deadline().has_value());
+        CHECK(*request.deadline() <= std::chrono::steady_clock::now() + budget);
+    }
+
+    SECTION("parse a request with an extension without the budget") {
+        auto zone = std::make_unique<msgpack::zone>();
+        const MessageID message_id = 12345;
+        const std::string method_name = "method";
+        const auto params = std::make_tuple(123);
+        const auto extension = std::map<std::string, std::uint64_t>();
+        const auto object = msgpack::object(
+            std::make_tuple(0, message_id, method_name, params, extension),
+            *zone);
+        auto object_handle = msgpack::object_handle(object, std::move(zone));
+
+        const auto message =
+            parse_message_from_object(std::move(object_handle));
+
+        REQUIRE(message.index() == 0);
+        const auto request = std::get<ParsedRequest>(message);
+        CHECK_FALSE(request.deadline().has_value());
+    }
+
+    SECTION("parse a request with an invalid extension") {
+        auto zone = std::make_unique<msgpack::zone>();
+        const MessageID message_id = 12345;
+        const std::string method_name = "method";
+        const auto params = std::make_tuple(123);
+        const auto object = msgpack::object(
+            std::make_tuple(0, message_id, method_name, params, 1), *zone);
+        auto object_handle = msgpack::object_handle(object, std::move(zone));
+
+        CHECK_THROWS_AS(parse_message_from_object(std::move(object_handle)),
+            msgpack_rpc::MsgpackRPCException);
+    }
+
     SECTION("parse a response") {
         auto zone = std::make_unique<msgpack::zone>();
         const MessageID message_id = 12345;
@@ -0,0 +1,347 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to scan raw messages.
+ */
+#include "msgpack_rpc/messages/impl/raw_message_scanner.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_type.h"
+#include "msgpack_rpc/messages/parsed_message.h"
+#include "msgpack_rpc/messages/parsed_notification.h"
+#include "msgpack_rpc/messages/parsed_request.h"
+#include "msgpack_rpc/messages/parsed_response.h"
+#include "msgpack_rpc/messages/raw_message.h"
+
+namespace {
+
+template <typename T>
+[[nodiscard]] std::string create_data(const T& data) {
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, data);
+    return std::string(buffer.data(), buffer.size());
+}
+
+[[nodiscard]] std::shared_ptr<const std::vector<char>> create_buffer(
+    const std::string& data) {
+    return std::make_shared<const std::vector<char>>(data.begin(), data.end());
+}
+
+}  // namespace
+
+TEST_CASE("msgpack_rpc::messages::impl::find_msgpack_object_size") {
+    using msgpack_rpc::messages::impl::find_msgpack_object_size;
+
+    SECTION("find the size of an object") {
+        constexpr std::size_t long_size = 70000;
+        const auto data = create_data(std::make_tuple(nullptr, true, 1,
+            static_cast<std::uint8_t>(200), static_cast<std::uint16_t>(60000),
+            static_cast<std::uint32_t>(4000000000U),
+            static_cast<std::uint64_t>(10000000000U), -1,
+            static_cast<std::int8_t>(-100), static_cast<std::int16_t>(-30000),
+            static_cast<std::int32_t>(-2000000000),
+            static_cast<std::int64_t>(-10000000000), 1.5F, 2.5,
+            std::string("abc"), std::string(300, 'a'),
+            std::string(long_size, 'b'),
+            std::vector<char>{'b', 'i', 'n'},
+            std::vector<int>(20, 1),
+            std::map<std::string, int>{{"a", 1}, {"b", 2}},
+            msgpack::type::ext(1, "ext", 3),
+            msgpack::type::ext(2, "e", 1)));
+
+        CHECK(find_msgpack_object_size(data.data(), data.size()) ==
+            data.size());
+    }
+
+    SECTION("find the size of an object followed by other data") {
+        const auto data =
+            create_data(std::make_tuple(1, "abc")) + create_data(123);
+
+        CHECK(find_msgpack_object_size(data.data(), data.size()) ==
+            data.size() - 2U);
+    }
+
+    SECTION("find the size of incomplete objects") {
+        const auto data = create_data(std::make_tuple(1, std::string(300, 'a'),
+            std::vector<std::uint32_t>(3, 100000U)));
+
+        for (std::size_t size = 0; size < data.size(); ++size) {
+            INFO("size = " << size);
+            CHECK_FALSE(
+                find_msgpack_object_size(data.data(), size).has_value());
+        }
+    }
+
+    SECTION("find the size of invalid data") {
+        const auto invalid_char =
+            static_cast<char>(static_cast<unsigned char>(0xC1));
+        const std::string data(1, invalid_char);
+
+        CHECK_THROWS(find_msgpack_object_size(data.data(), data.size()));
+    }
+}
+
+TEST_CASE(
+    "msgpack_rpc::messages::impl::continue_finding_msgpack_object_size") {
+    using msgpack_rpc::messages::impl::continue_finding_msgpack_object_size;
+
+    SECTION("find the size of an object received byte by byte") {
+        const auto data = create_data(std::make_tuple(1, std::string(300, 'a'),
+            std::vector<std::uint32_t>(3, 100000U), 2.5));
+
+        std::size_t scanned_size = 0;
+        std::uint64_t num_remaining_objects = 1;
+        for (std::size_t size = 0; size < data.size(); ++size) {
+            INFO("size = " << size);
+            CHECK_FALSE(continue_finding_msgpack_object_size(
+                data.data(), size, scanned_size, num_remaining_objects));
+            CHECK(scanned_size <= size);
+        }
+        CHECK(continue_finding_msgpack_object_size(
+            data.data(), data.size(), scanned_size, num_remaining_objects));
+        CHECK(scanned_size == data.size());
+        CHECK(num_remaining_objects == 0U);
+    }
+}
+
+TEST_CASE("msgpack_rpc::messages::impl::scan_raw_message") {
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::MessageType;
+    using msgpack_rpc::messages::RawMessage;
+    using msgpack_rpc::messages::impl::scan_raw_message;
+
+    SECTION("scan a request") {
+        const MessageID message_id = 12345;
+        const auto data = create_data(
+            std::make_tuple(0, message_id, "method", std::make_tuple(1, 2)));
+        const auto buffer = create_buffer(data);
+
+        const RawMessage message = scan_raw_message(buffer, 0, data.size());
+
+        CHECK(message.type() == MessageType::REQUEST);
+        CHECK(message.id() == message_id);
+        CHECK(message.method_name().name() == "method");
+        CHECK(std::string(message.data(), message.size()) == data);
+    }
+
+    SECTION("scan a request with an extension") {
+        const MessageID message_id = 12345;
+        const auto data = create_data(std::make_tuple(0, message_id, "method",
+            std::make_tuple(1), std::map<std::string, int>{{"budget_ns", 1}}));
+        const auto buffer = create_buffer(data);
+
+        const RawMessage message = scan_raw_message(buffer, 0, data.size());
+
+        CHECK(message.type() == MessageType::REQUEST);
+        CHECK(message.id() == message_id);
+    }
+
+    SECTION("scan a response") {
+        const MessageID message_id = 12345;
+        const auto data =
+            create_data(std::make_tuple(1, message_id, nullptr, "result"));
+        const auto buffer = create_buffer(data);
+
+        const RawMessage message = scan_raw_message(buffer, 0, data.size());
+
+        CHECK(message.type() == MessageType::RESPONSE);
+        CHECK(message.id() == message_id);
+    }
+
+    SECTION("scan a notification") {
+        const auto data =
+            create_data(std::make_tuple(2, "method", std::make_tuple(1)));
+        const auto buffer = create_buffer(data);
+
+        const RawMessage message = scan_raw_message(buffer, 0, data.size());
+
+        CHECK(message.type() == MessageType::NOTIFICATION);
+        CHECK_FALSE(message.id().has_value());
+        CHECK(message.method_name().name() == "method");
+    }
+
+    SECTION("scan a notification with the message ID of a request") {
+        const MessageID message_id = 12345;
+        const auto data = create_data(std::make_tuple(
+            2, "$/streamChunk", std::make_tuple(message_id, "chunk")));
+        const auto buffer = create_buffer(data);
+
+        const RawMessage message = scan_raw_message(buffer, 0, data.size());
+
+        CHECK(message.type() == MessageType::NOTIFICATION);
+        CHECK(message.id() == message_id);
+        CHECK(message.method_name().name() == "$/streamChunk");
+    }
+
+    SECTION("scan a message in the middle of a buffer") {
+        const MessageID message_id = 12345;
+        const auto prefix = create_data(123);
+        const auto data = create_data(
+            std::make_tuple(0, message_id, "method", std::make_tuple(1)));
+        const auto buffer = create_buffer(prefix + data);
+
+        const RawMessage message =
+            scan_raw_message(buffer, prefix.size(), data.size());
+
+        CHECK(message.id() == message_id);
+        CHECK(std::string(message.data(), message.size()) == data);
+    }
+
+    SECTION("scan invalid messages") {
+        const auto check_invalid = [](const std::string& data) {
+            INFO("data size = " << data.size());
+            CHECK_THROWS(scan_raw_message(create_buffer(data), 0, data.size()));
+        };
+
+        check_invalid(create_data(123));
+        check_invalid(create_data(std::make_tuple(0, 1, "method")));
+        check_invalid(
+            create_data(std::make_tuple(3, 1, "method", std::make_tuple())));
+        check_invalid(
+            create_data(std::make_tuple(0, -1, "method", std::make_tuple())));
+        check_invalid(create_data(
+            std::make_tuple(0, 0x100000000U, "method", std::make_tuple())));
+        check_invalid(create_data(std::make_tuple(0, 1, 2, std::make_tuple())));
+        check_invalid(create_data(std::make_tuple(1, 1, nullptr)));
+        check_invalid(create_data(std::make_tuple(2, "method")));
+        check_invalid(create_data(
+            std::make_tuple(2, "$/cancelRequest", std::make_tuple())));
+    }
+}
+
+TEST_CASE("msgpack_rpc::messages::impl::scan_message") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::StatusCode;
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::ParsedMessage;
+    using msgpack_rpc::messages::ParsedNotification;
+    using msgpack_rpc::messages::ParsedRequest;
+    using msgpack_rpc::messages::ParsedResponse;
+    using msgpack_rpc::messages::impl::scan_message;
+
+    SECTION("scan a request") {
+        const MessageID message_id = 12345;
+        const auto prefix = create_data(123);
+        const auto data = create_data(std::make_tuple(0, message_id, "method",
+            std::make_tuple(1, std::string("abc"))));
+        const auto buffer = create_buffer(prefix + data);
+
+        const ParsedMessage message =
+            scan_message(buffer, prefix.size(), data.size());
+
+        const auto request = std::get<ParsedRequest>(message);
+        CHECK(request.id() == message_id);
+        CHECK(request.method_name().name() == "method");
+        CHECK(request.parameters().as<int, std::string>() ==
+            std::make_tuple(1, std::string("abc")));
+        CHECK_FALSE(request.deadline().has_value());
+    }
+
+    SECTION("scan a request with the remaining budget") {
+        const MessageID message_id = 12345;
+        const auto budget = std::chrono::seconds(3);
+        const auto data = create_data(std::make_tuple(0, message_id, "method",
+            std::make_tuple(1),
+            std::map<std::string, std::int64_t>{{"budget_ns",
+                static_cast<std::int64_t>(
+                    std::chrono::nanoseconds(budget).count())}}));
+        const auto buffer = create_buffer(data);
+
+        const ParsedMessage message = scan_message(buffer, 0, data.size());
+
+        const auto request = std::get<ParsedRequest>(message);
+        CHECK(request.parameters().as<int>() == std::make_tuple(1));
+        REQUIRE(request.deadline().has_value());
+        CHECK(*request.deadline() <= std::chrono::steady_clock::now() + budget);
+    }
+
+    SECTION("scan a response") {
+        const MessageID message_id = 12345;
+        const auto data = create_data(std::make_tuple(
+            1, message_id, nullptr, std::vector<int>{1, 2, 3}));
+        const auto buffer = create_buffer(data);
+
+        const ParsedMessage message = scan_message(buffer, 0, data.size());
+
+        const auto response = std::get<ParsedResponse>(message);
+        CHECK(response.id() == message_id);
+        CHECK(response.result().is_success());
+        CHECK(response.result().result_as<std::vector<int>>() ==
+            std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("scan a response with an error") {
+        const MessageID message_id = 12345;
+        const auto data =
+            create_data(std::make_tuple(1, message_id, "error", nullptr));
+        const auto buffer = create_buffer(data);
+
+        const ParsedMessage message = scan_message(buffer, 0, data.size());
+
+        const auto response = std::get<ParsedResponse>(message);
+        CHECK(response.id() == message_id);
+        CHECK(response.result().is_error());
+        CHECK(response.result().error_as<std::string>() == "error");
+    }
+
+    SECTION("scan a notification") {
+        const auto data =
+            create_data(std::make_tuple(2, "method", std::make_tuple(1.5)));
+        const auto buffer = create_buffer(data);
+
+        const ParsedMessage message = scan_message(buffer, 0, data.size());
+
+        const auto notification = std::get<ParsedNotification>(message);
+        CHECK(notification.method_name().name() == "method");
+        CHECK(notification.parameters().as<double>() == std::make_tuple(1.5));
+    }
+
+    SECTION("scan invalid messages") {
+        const auto check_invalid = [](const std::string& data) {
+            INFO("data size = " << data.size());
+            try {
+                (void)scan_message(create_buffer(data), 0, data.size());
+                FAIL("No exception was thrown.");
+            } catch (const MsgpackRPCException& e) {
+                CHECK(e.status().code() == StatusCode::INVALID_MESSAGE);
+            }
+        };
+
+        check_invalid(create_data(std::make_tuple(0, 1, "method", 2)));
+        check_invalid(create_data(std::make_tuple(2, "method", "params")));
+        check_invalid(create_data(
+            std::make_tuple(0, 1, "method", std::make_tuple(), "extension")));
+        check_invalid(create_data(std::make_tuple(1, 1, nullptr)));
+        check_invalid(create_data(std::make_tuple(3, "method")));
+    }
+}
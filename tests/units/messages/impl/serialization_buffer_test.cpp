@@ -19,13 +19,18 @@
  */
 #include "msgpack_rpc/messages/impl/serialization_buffer.h"
 
+#include <cstddef>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include "msgpack_rpc/messages/external_binary.h"
 #include "msgpack_rpc/messages/serialized_message.h"
 
 TEST_CASE("msgpack_rpc::messages::impl::SerializationBuffer") {
+    using msgpack_rpc::messages::ExternalBinary;
     using msgpack_rpc::messages::SerializedMessage;
     using msgpack_rpc::messages::impl::SerializationBuffer;
 
@@ -55,4 +60,78 @@ TEST_CASE("msgpack_rpc::messages::impl::SerializationBuffer") {
         const std::string expected(310, 'a');
         CHECK(std::string_view(message.data(), message.size()) == expected);
     }
+
+    SECTION("create a data with the initial capacity") {
+        constexpr std::size_t initial_capacity = 300;
+        SerializationBuffer buffer{initial_capacity};
+
+        const std::string data1(300, 'a');
+        buffer.write(data1.data(), data1.size());
+
+        const std::string data2(10, 'a');
+        buffer.write(data2.data(), data2.size());
+
+        const SerializedMessage message = buffer.release();
+        const std::string expected(310, 'a');
+        CHECK(std::string_view(message.data(), message.size()) == expected);
+    }
+
+    SECTION("create a serialized message with external binaries") {
+        SerializationBuffer buffer;
+
+        const std::string data1{"abc"};
+        buffer.write(data1.data(), data1.size());
+
+        const std::string data2{"de"};
+        buffer.write_external(ExternalBinary(data2.data(), data2.size(), {}));
+
+        const std::string data3{"f"};
+        buffer.write(data3.data(), data3.size());
+
+        const SerializedMessage message = buffer.release();
+        CHECK(message.has_external_binaries());
+        CHECK(std::string_view(message.data(), message.size()) == "abcf");
+        CHECK(message.total_size() == 6U);
+        std::vector<std::string_view> buffers;
+        message.for_each_buffer(
+            [&buffers](const char* data, std::size_t size) {
+                buffers.emplace_back(data, size);
+            });
+        CHECK(buffers == std::vector<std::string_view>{"abc", "de", "f"});
+        CHECK(buffers.at(1).data() == data2.data());
+        const SerializedMessage flattened = message.flatten();
+        CHECK_FALSE(flattened.has_external_binaries());
+        CHECK(std::string_view(flattened.data(), flattened.size()) ==
+            "abcdef");
+    }
+
+    SECTION("copy a serialized message keeping external binaries") {
+        SerializationBuffer source;
+        const std::string data1{"abc"};
+        source.write(data1.data(), data1.size());
+        const std::string data2{"de"};
+        source.write_external(ExternalBinary(data2.data(), data2.size(), {}));
+        const SerializedMessage source_message = source.release();
+
+        SerializationBuffer buffer;
+        const std::string data0{"x"};
+        buffer.write(data0.data(), data0.size());
+        source_message.for_each_part(
+            [&buffer](const char* data, std::size_t size) {
+                buffer.write(data, size);
+            },
+            [&buffer](const ExternalBinary& binary) {
+                buffer.write_external(binary);
+            });
+
+        const SerializedMessage message = buffer.release();
+        CHECK(std::string_view(message.data(), message.size()) == "xabc");
+        std::vector<std::string_view> buffers;
+        message.for_each_buffer(
+            [&buffers](const char* data, std::size_t size) {
+                buffers.emplace_back(data, size);
+            });
+        CHECK(buffers == std::vector<std::string_view>{"xabc", "de"});
+        CHECK(buffers.at(1).data() == data2.data());
+    }
 }
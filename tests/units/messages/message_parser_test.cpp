@@ -20,26 +20,36 @@
 #include "msgpack_rpc/messages/message_parser.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <variant>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/messages/impl/message_compression.h"
+#include "msgpack_rpc/messages/message_serializer.h"
 #include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/method_name_view.h"
 #include "msgpack_rpc/messages/parsed_message.h"
 #include "msgpack_rpc/messages/parsed_parameters.h"
 #include "msgpack_rpc/messages/parsed_request.h"
+#include "msgpack_rpc/messages/serialized_message.h"
 
 TEST_CASE("msgpack_rpc::messages::MessageParser") {
     using msgpack_rpc::config::MessageParserConfig;
     using msgpack_rpc::messages::MessageID;
     using msgpack_rpc::messages::MessageParser;
+    using msgpack_rpc::messages::MessageSerializer;
+    using msgpack_rpc::messages::MethodNameView;
     using msgpack_rpc::messages::ParsedMessage;
     using msgpack_rpc::messages::ParsedRequest;
+    using msgpack_rpc::messages::SerializedMessage;
 
     const auto create_data = [](const auto& data) {
         msgpack::sbuffer buffer;
@@ -85,6 +95,110 @@ TEST_CASE("msgpack_rpc::messages::MessageParser") {
         CHECK(request.parameters().as<int>() == params);
     }
 
+    SECTION("parse a compressed message") {
+        const MessageID message_id = 12345;
+        const std::string method_name = "method";
+        constexpr std::size_t param_size = 1000;
+        const std::string param(param_size, 'a');
+        const auto original = MessageSerializer::serialize_request(
+            MethodNameView(method_name), message_id, param);
+        const auto compressed =
+            msgpack_rpc::messages::impl::compress_message(original);
+        REQUIRE(compressed.has_value());
+        const SerializedMessage& data = *compressed;
+
+        MessageParserConfig config;
+        MessageParser parser{config};
+
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.data(), data.data() + data.size(), buffer.data());
+        parser.consumed(data.size());
+
+        std::optional<ParsedMessage> message;
+        REQUIRE_NOTHROW(message = parser.try_parse());
+        REQUIRE(message.has_value());
+
+        REQUIRE(message->index() == 0);
+        const auto request = std::get<ParsedRequest>(*message);
+        CHECK(request.id() == message_id);
+        CHECK(request.method_name().name() == method_name);
+        CHECK(std::get<0>(request.parameters().as<std::string>()) == param);
+    }
+
+    SECTION("pass framed messages to the handler") {
+        const auto original = MessageSerializer::serialize_request(
+            MethodNameView("method"), 1, std::string(1000, 'a'));
+        const auto compressed =
+            msgpack_rpc::messages::impl::compress_message(original);
+        REQUIRE(compressed.has_value());
+        const auto notification = MessageSerializer::serialize_notification(
+            MethodNameView("method"), 2);
+        std::string data(compressed->data(), compressed->size());
+        data.append(notification.data(), notification.size());
+
+        MessageParserConfig config;
+        MessageParser parser{config};
+        std::vector<std::string> framed_messages;
+        parser.set_framed_message_handler(
+            [&framed_messages](const char* framed_data, std::size_t size) {
+                framed_messages.emplace_back(framed_data, size);
+            });
+
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.begin(), data.end(), buffer.data());
+        parser.consumed(data.size());
+        REQUIRE(parser.try_parse().has_value());
+        REQUIRE(parser.try_parse().has_value());
+
+        // Compressed messages are passed after decompression.
+        CHECK(framed_messages ==
+            std::vector<std::string>{
+                std::string(original.data(), original.size()),
+                std::string(notification.data(), notification.size())});
+    }
+
+    SECTION("reject a message larger than the maximum size") {
+        constexpr std::size_t param_size = 1000;
+        const auto data = MessageSerializer::serialize_request(
+            MethodNameView("method"), 1, std::string(param_size, 'a'));
+
+        MessageParserConfig config;
+        config.max_message_size(data.size() - 1U);
+        MessageParser parser{config};
+
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.data(), data.data() + data.size(), buffer.data());
+        parser.consumed(data.size());
+
+        CHECK_THROWS_AS(
+            (void)parser.try_parse(), msgpack_rpc::MsgpackRPCException);
+    }
+
+    SECTION("reject a compressed message larger than the maximum size") {
+        constexpr std::size_t param_size = 1000;
+        const auto original = MessageSerializer::serialize_request(
+            MethodNameView("method"), 1, std::string(param_size, 'a'));
+        const auto compressed =
+            msgpack_rpc::messages::impl::compress_message(original);
+        REQUIRE(compressed.has_value());
+        const SerializedMessage& data = *compressed;
+
+        MessageParserConfig config;
+        config.max_message_size(original.size() - 1U);
+        MessageParser parser{config};
+
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.data(), data.data() + data.size(), buffer.data());
+        parser.consumed(data.size());
+
+        CHECK_THROWS_AS(
+            (void)parser.try_parse(), msgpack_rpc::MsgpackRPCException);
+    }
+
     SECTION("parse invalid data") {
         MessageParserConfig config;
         MessageParser parser{config};
@@ -20,17 +20,24 @@
 #include "msgpack_rpc/messages/message_serializer.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
 
 #include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/messages/binary_view.h"
 #include "msgpack_rpc/messages/buffer_view.h"
 #include "msgpack_rpc/messages/call_result.h"
+#include "msgpack_rpc/messages/external_binary.h"
 #include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/message_parser.h"
 #include "msgpack_rpc/messages/method_name_view.h"
@@ -39,10 +46,14 @@
 #include "msgpack_rpc/messages/parsed_parameters.h"
 #include "msgpack_rpc/messages/parsed_request.h"
 #include "msgpack_rpc/messages/parsed_response.h"
+#include "msgpack_rpc/messages/prepared_method_name.h"
+#include "msgpack_rpc/messages/raw_result.h"
 #include "msgpack_rpc/messages/serialized_message.h"
 
 TEST_CASE("msgpack_rpc::messages::MessageSerializer") {
     using msgpack_rpc::config::MessageParserConfig;
+    using msgpack_rpc::messages::BinaryView;
+    using msgpack_rpc::messages::ExternalBinary;
     using msgpack_rpc::messages::MessageID;
     using msgpack_rpc::messages::MessageParser;
     using msgpack_rpc::messages::MessageSerializer;
@@ -51,6 +62,8 @@ TEST_CASE("msgpack_rpc::messages::MessageSerializer") {
     using msgpack_rpc::messages::ParsedNotification;
     using msgpack_rpc::messages::ParsedRequest;
     using msgpack_rpc::messages::ParsedResponse;
+    using msgpack_rpc::messages::PreparedMethodName;
+    using msgpack_rpc::messages::RawResult;
     using msgpack_rpc::messages::SerializedMessage;
 
     const auto parse_data = [](const SerializedMessage& data) {
@@ -84,6 +97,119 @@ TEST_CASE("msgpack_rpc::messages::MessageSerializer") {
             std::forward_as_tuple(param1, param2));
     }
 
+    SECTION("serialize a request with an external binary") {
+        const std::string method_name = "method7";
+        const MessageID message_id = 12345;
+        const std::string binary_data = "binary data";
+        const ExternalBinary param1{
+            binary_data.data(), binary_data.size(), [] {}};
+        const int param2 = 123;
+
+        const auto data = MessageSerializer::serialize_request(
+            MethodNameView(method_name), message_id, param1, param2);
+
+        CHECK(data.has_external_binaries());
+        CHECK(data.total_size() == data.size() + binary_data.size());
+        std::vector<const char*> buffers;
+        data.for_each_buffer(
+            [&buffers](const char* buffer, std::size_t /*size*/) {
+                buffers.push_back(buffer);
+            });
+        REQUIRE(buffers.size() == 3U);
+        CHECK(buffers.at(1) == binary_data.data());
+        const auto message = parse_data(data.flatten());
+        const auto request = std::get<ParsedRequest>(message);
+        CHECK(request.id() == message_id);
+        CHECK(request.method_name().name() == method_name);
+        const auto [parsed_param1, parsed_param2] =
+            request.parameters().as<BinaryView, int>();
+        CHECK(std::string_view(parsed_param1.data(), parsed_param1.size()) ==
+            binary_data);
+        CHECK(parsed_param2 == param2);
+    }
+
+    SECTION("serialize a request with the remaining budget") {
+        const std::string method_name = "method7";
+        const MessageID message_id = 12345;
+        const int param1 = 123;
+        const auto budget = std::chrono::seconds(3);
+
+        const auto data = MessageSerializer::serialize_request_with_budget(
+            MethodNameView(method_name), message_id, budget, param1);
+
+        const auto message = parse_data(data);
+        const auto request = std::get<ParsedRequest>(message);
+        CHECK(request.id() == message_id);
+        CHECK(request.method_name().name() == method_name);
+        CHECK(request.parameters().as<int>() == std::forward_as_tuple(param1));
+        REQUIRE(request.deadline().has_value());
+        CHECK(*request.deadline() <= std::chrono::steady_clock::now() + budget);
+        CHECK(*request.deadline() >
+            std::chrono::steady_clock::now() + std::chrono::seconds(1));
+    }
+
+    SECTION("update the remaining budget of a request") {
+        const std::string method_name = "method7";
+        const MessageID message_id = 12345;
+        const int param1 = 123;
+        auto data = MessageSerializer::serialize_request_with_budget(
+            MethodNameView(method_name), message_id, std::chrono::seconds(3),
+            param1);
+        const auto size = data.size();
+
+        const auto budget = std::chrono::seconds(100);
+        MessageSerializer::update_request_budget(data, budget);
+
+        CHECK(data.size() == size);
+        const auto message = parse_data(data);
+        const auto request = std::get<ParsedRequest>(message);
+        CHECK(request.id() == message_id);
+        CHECK(request.parameters().as<int>() == std::forward_as_tuple(param1));
+        REQUIRE(request.deadline().has_value());
+        CHECK(*request.deadline() <= std::chrono::steady_clock::now() + budget);
+        CHECK(*request.deadline() >
+            std::chrono::steady_clock::now() + std::chrono::seconds(90));
+    }
+
+    SECTION("serialize a request of a prepared method") {
+        const std::string method_name = "namespace.method7";
+        const PreparedMethodName prepared_method_name{method_name};
+        const MessageID message_id = 12345;
+        const int param1 = 123;
+        const std::string param2 = "abc";
+
+        const auto data = MessageSerializer::serialize_request(
+            prepared_method_name, message_id, param1, param2);
+
+        const auto message = parse_data(data);
+        const auto request = std::get<ParsedRequest>(message);
+        CHECK(request.id() == message_id);
+        CHECK(request.method_name().name() == method_name);
+        CHECK(request.parameters().as<int, std::string>() ==
+            std::forward_as_tuple(param1, param2));
+        CHECK(prepared_method_name.size_hint() == data.size());
+    }
+
+    SECTION("serialize a request of a prepared method with the budget") {
+        const std::string method_name = "namespace.method7";
+        const PreparedMethodName prepared_method_name{method_name};
+        const MessageID message_id = 12345;
+        const int param1 = 123;
+        const auto budget = std::chrono::seconds(3);
+
+        const auto data = MessageSerializer::serialize_request_with_budget(
+            prepared_method_name, message_id, budget, param1);
+
+        const auto message = parse_data(data);
+        const auto request = std::get<ParsedRequest>(message);
+        CHECK(request.id() == message_id);
+        CHECK(request.method_name().name() == method_name);
+        CHECK(request.parameters().as<int>() == std::forward_as_tuple(param1));
+        REQUIRE(request.deadline().has_value());
+        CHECK(*request.deadline() <= std::chrono::steady_clock::now() + budget);
+        CHECK(prepared_method_name.size_hint() == data.size());
+    }
+
     SECTION("serialize a request without parameters") {
         const std::string method_name = "method7";
         const MessageID message_id = 12345;
@@ -111,6 +237,87 @@ TEST_CASE("msgpack_rpc::messages::MessageSerializer") {
         CHECK(response.result().result_as<std::string>() == result);
     }
 
+    SECTION("serialize a response with an external binary") {
+        const MessageID message_id = 12345;
+        const std::string binary_data = "binary data";
+        const ExternalBinary result{
+            binary_data.data(), binary_data.size(), [] {}};
+
+        const auto data = MessageSerializer::serialize_successful_response(
+            message_id, result);
+
+        CHECK(data.has_external_binaries());
+        const auto message = parse_data(data.flatten());
+        const auto response = std::get<ParsedResponse>(message);
+        CHECK(response.id() == message_id);
+        const auto parsed_result = response.result().result_as<BinaryView>();
+        CHECK(std::string_view(parsed_result.data(), parsed_result.size()) ==
+            binary_data);
+    }
+
+    SECTION("serialize a response with a raw result") {
+        const MessageID message_id = 12345;
+        const std::string result = "abc";
+        msgpack::sbuffer serialized_result;
+        msgpack::pack(serialized_result, result);
+
+        const auto data = MessageSerializer::serialize_successful_response(
+            message_id,
+            RawResult(serialized_result.data(), serialized_result.size(),
+                [] {}));
+
+        CHECK(data.has_external_binaries());
+        const auto expected_data =
+            MessageSerializer::serialize_successful_response(
+                message_id, result);
+        const auto flattened_data = data.flatten();
+        CHECK(std::string_view(flattened_data.data(), flattened_data.size()) ==
+            std::string_view(expected_data.data(), expected_data.size()));
+    }
+
+    SECTION("serialize a response with a serialized result") {
+        const MessageID message_id = 12345;
+        const std::string result = "abc";
+        msgpack::sbuffer serialized_result;
+        msgpack::pack(serialized_result, result);
+
+        const auto data = MessageSerializer::
+            serialize_successful_response_with_serialized_result(message_id,
+                std::string_view(
+                    serialized_result.data(), serialized_result.size()));
+
+        const auto expected_data =
+            MessageSerializer::serialize_successful_response(
+                message_id, result);
+        CHECK(std::string_view(data.data(), data.size()) ==
+            std::string_view(expected_data.data(), expected_data.size()));
+        const auto message = parse_data(data);
+        const auto response = std::get<ParsedResponse>(message);
+        CHECK(response.id() == message_id);
+        CHECK(response.result().result_as<std::string>() == result);
+    }
+
+    SECTION("serialize a response with a shared serialized result") {
+        const MessageID message_id = 12345;
+        const std::string result = "abc";
+        msgpack::sbuffer serialized_result;
+        msgpack::pack(serialized_result, result);
+        const auto shared_result = std::make_shared<const std::string>(
+            serialized_result.data(), serialized_result.size());
+
+        const auto data = MessageSerializer::
+            serialize_successful_response_with_serialized_result(
+                message_id, shared_result);
+
+        CHECK(data.has_external_binaries());
+        const auto expected_data =
+            MessageSerializer::serialize_successful_response(
+                message_id, result);
+        const auto flattened_data = data.flatten();
+        CHECK(std::string_view(flattened_data.data(), flattened_data.size()) ==
+            std::string_view(expected_data.data(), expected_data.size()));
+    }
+
     SECTION("serialize a response with error") {
         const MessageID message_id = 12345;
         const std::string error = "abc";
@@ -19,13 +19,49 @@
  */
 #include "msgpack_rpc/messages/parsed_parameters.h"
 
+#include <map>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/impl/encoded_object.h"
+
+namespace {
+
+template <typename T>
+[[nodiscard]] std::shared_ptr<const msgpack_rpc::messages::impl::EncodedObject>
+create_encoded_object(const T& data) {
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, data);
+    constexpr std::size_t offset = 3;
+    auto bytes = std::make_shared<std::vector<char>>(offset, 'x');
+    bytes->insert(bytes->end(), buffer.data(), buffer.data() + buffer.size());
+    return std::make_shared<const msgpack_rpc::messages::impl::EncodedObject>(
+        std::move(bytes), offset, buffer.size());
+}
+
+}  // namespace
 
 TEST_CASE("msgpack_rpc::messages::ParsedParameters") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::StatusCode;
     using msgpack_rpc::messages::ParsedParameters;
 
+    const auto status_code_of = [](const auto& function) {
+        try {
+            function();
+        } catch (const MsgpackRPCException& e) {
+            return e.status().code();
+        }
+        return StatusCode::SUCCESS;
+    };
+
     SECTION("convert parameters") {
         auto zone = std::make_unique<msgpack::zone>();
         const int param1 = 123;
@@ -70,4 +106,55 @@ TEST_CASE("msgpack_rpc::messages::ParsedParameters") {
 
         CHECK_THROWS((void)wrapper.as<int, float>());
     }
+
+    SECTION("decode parameters directly from bytes") {
+        const std::map<std::string, std::vector<double>> param1{
+            {"a", {1.5, 2.5}}, {"b", {}}};
+        const std::vector<std::vector<int>> param2{{1, -2}, {3}};
+        const auto wrapper = ParsedParameters(
+            create_encoded_object(std::make_tuple(param1, param2, true)));
+
+        const auto result = wrapper.as<std::map<std::string,
+            std::vector<double>>, std::vector<std::vector<int>>, bool>();
+
+        CHECK(std::get<0>(result) == param1);
+        CHECK(std::get<1>(result) == param2);
+        CHECK(std::get<2>(result));
+    }
+
+    SECTION("decode parameters from bytes via objects") {
+        const auto param1 = std::make_tuple(1, std::string("abc"));
+        const std::vector<char> param2{'a', 'b'};
+        const auto wrapper = ParsedParameters(
+            create_encoded_object(std::make_tuple(param1, param2)));
+
+        const auto result = wrapper.as<std::tuple<int, std::string>,
+            std::vector<char>>();
+
+        CHECK(std::get<0>(result) == param1);
+        CHECK(std::get<1>(result) == param2);
+        CHECK(wrapper.object().via.array.size == 2U);
+    }
+
+    SECTION("decode parameters from bytes with wrong number of parameters") {
+        const auto wrapper = ParsedParameters(
+            create_encoded_object(std::make_tuple(123, std::string("abc"))));
+
+        CHECK(status_code_of([&wrapper] { (void)wrapper.as<int>(); }) ==
+            StatusCode::INVALID_MESSAGE);
+        CHECK(status_code_of([&wrapper] {
+            (void)wrapper.as<int, std::string, float>();
+        }) == StatusCode::INVALID_MESSAGE);
+    }
+
+    SECTION("decode parameters from bytes with wrong types") {
+        const auto wrapper = ParsedParameters(
+            create_encoded_object(std::make_tuple(-1, std::string("abc"))));
+
+        CHECK(status_code_of([&wrapper] {
+            (void)wrapper.as<unsigned int, std::string>();
+        }) == StatusCode::TYPE_ERROR);
+        CHECK(status_code_of([&wrapper] { (void)wrapper.as<int, int>(); }) ==
+            StatusCode::TYPE_ERROR);
+    }
 }
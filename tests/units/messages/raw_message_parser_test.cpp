@@ -0,0 +1,263 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of RawMessageParser class.
+ */
+#include "msgpack_rpc/messages/raw_message_parser.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/config/message_parser_config.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/message_type.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/raw_message.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+
+TEST_CASE("msgpack_rpc::messages::RawMessageParser") {
+    using msgpack_rpc::config::MessageParserConfig;
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::MessageSerializer;
+    using msgpack_rpc::messages::MessageType;
+    using msgpack_rpc::messages::MethodNameView;
+    using msgpack_rpc::messages::RawMessage;
+    using msgpack_rpc::messages::RawMessageParser;
+    using msgpack_rpc::messages::SerializedMessage;
+
+    const auto to_string = [](const SerializedMessage& message) {
+        const auto flattened = message.flatten();
+        return std::string(flattened.data(), flattened.size());
+    };
+
+    SECTION("parse a message") {
+        const MessageID message_id = 12345;
+        const std::string method_name = "method";
+        const auto serialized = MessageSerializer::serialize_request(
+            MethodNameView(method_name), message_id, 123, "abc");
+        const auto data = to_string(serialized);
+        const std::size_t data_size = data.size();
+
+        MessageParserConfig config;
+        RawMessageParser parser{config};
+
+        const auto buffer1 = parser.prepare_buffer();
+        const std::size_t written_size1 = data_size / 2U;
+        REQUIRE(buffer1.size() >= written_size1);
+        std::copy(data.data(), data.data() + written_size1, buffer1.data());
+        parser.consumed(written_size1);
+
+        std::optional<RawMessage> message1;
+        REQUIRE_NOTHROW(message1 = parser.try_parse());
+        CHECK_FALSE(message1.has_value());
+
+        const auto buffer2 = parser.prepare_buffer();
+        REQUIRE(buffer2.size() >= data_size - written_size1);
+        std::copy(data.data() + written_size1, data.data() + data_size,
+            buffer2.data());
+        parser.consumed(data_size - written_size1);
+
+        std::optional<RawMessage> message2;
+        REQUIRE_NOTHROW(message2 = parser.try_parse());
+        REQUIRE(message2.has_value());
+        CHECK(message2->type() == MessageType::REQUEST);
+        CHECK(message2->id() == message_id);
+        CHECK(message2->method_name().name() == method_name);
+        CHECK(std::string(message2->data(), message2->size()) == data);
+
+        std::optional<RawMessage> message3;
+        REQUIRE_NOTHROW(message3 = parser.try_parse());
+        CHECK_FALSE(message3.has_value());
+    }
+
+    SECTION("pass framed messages to the handler") {
+        const auto data = to_string(MessageSerializer::serialize_request(
+            MethodNameView("method"), 1, 123));
+
+        MessageParserConfig config;
+        RawMessageParser parser{config};
+        std::vector<std::string> framed_messages;
+        parser.set_framed_message_handler(
+            [&framed_messages](const char* framed_data, std::size_t size) {
+                framed_messages.emplace_back(framed_data, size);
+            });
+
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.begin(), data.end(), buffer.data());
+        parser.consumed(data.size());
+        REQUIRE(parser.try_parse().has_value());
+
+        CHECK(framed_messages == std::vector<std::string>{data});
+    }
+
+    SECTION("parse messages larger than the buffer") {
+        constexpr std::size_t read_buffer_size = 16;
+        constexpr std::size_t param_size = 1000;
+        const auto data = to_string(MessageSerializer::serialize_notification(
+            "method", std::string(param_size, 'a')));
+
+        MessageParserConfig config;
+        config.read_buffer_size(read_buffer_size);
+        RawMessageParser parser{config};
+
+        std::optional<RawMessage> message;
+        std::size_t written_size = 0;
+        while (!message) {
+            REQUIRE(written_size < data.size());
+            const auto buffer = parser.prepare_buffer();
+            const std::size_t size =
+                std::min(buffer.size(), data.size() - written_size);
+            std::copy(data.data() + written_size,
+                data.data() + written_size + size, buffer.data());
+            parser.consumed(size);
+            written_size += size;
+            REQUIRE_NOTHROW(message = parser.try_parse());
+        }
+        CHECK(written_size == data.size());
+        CHECK(std::string(message->data(), message->size()) == data);
+    }
+
+    SECTION("parse multiple messages at once") {
+        const auto data1 =
+            to_string(MessageSerializer::serialize_notification("method1", 1));
+        const auto data2 = to_string(
+            MessageSerializer::serialize_successful_response(1, "result"));
+        const auto data = data1 + data2;
+
+        MessageParserConfig config;
+        RawMessageParser parser{config};
+
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.data(), data.data() + data.size(), buffer.data());
+        parser.consumed(data.size());
+
+        const auto message1 = parser.try_parse();
+        REQUIRE(message1.has_value());
+        CHECK(message1->type() == MessageType::NOTIFICATION);
+        CHECK(std::string(message1->data(), message1->size()) == data1);
+
+        const auto message2 = parser.try_parse();
+        REQUIRE(message2.has_value());
+        CHECK(message2->type() == MessageType::RESPONSE);
+        CHECK(std::string(message2->data(), message2->size()) == data2);
+
+        // Parsed messages keep the data after the buffer is reused.
+        const auto next_buffer = parser.prepare_buffer();
+        std::fill(next_buffer.data(), next_buffer.data() + next_buffer.size(),
+            static_cast<char>(0));
+        CHECK(std::string(message1->data(), message1->size()) == data1);
+    }
+
+    SECTION("serialize messages") {
+        const MessageID message_id = 12345;
+        const MessageID new_message_id = 7;
+        const auto data = to_string(MessageSerializer::serialize_request(
+            MethodNameView("method"), message_id, 123, "abc"));
+
+        MessageParserConfig config;
+        RawMessageParser parser{config};
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.data(), data.data() + data.size(), buffer.data());
+        parser.consumed(data.size());
+        const auto message = parser.try_parse();
+        REQUIRE(message.has_value());
+
+        CHECK(to_string(message->serialize()) == data);
+        CHECK(to_string(message->serialize_with_id(new_message_id)) ==
+            to_string(MessageSerializer::serialize_request(
+                MethodNameView("method"), new_message_id, 123, "abc")));
+    }
+
+    SECTION("serialize notifications with the message ID of requests") {
+        const MessageID message_id = 12345;
+        const MessageID new_message_id = 7;
+        const auto data = to_string(MessageSerializer::serialize_notification(
+            "$/streamChunk", message_id, "chunk"));
+
+        MessageParserConfig config;
+        RawMessageParser parser{config};
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.data(), data.data() + data.size(), buffer.data());
+        parser.consumed(data.size());
+        const auto message = parser.try_parse();
+        REQUIRE(message.has_value());
+
+        CHECK(message->id() == message_id);
+        CHECK(to_string(message->serialize_with_id(new_message_id)) ==
+            to_string(MessageSerializer::serialize_notification(
+                "$/streamChunk", new_message_id, "chunk")));
+    }
+
+    SECTION("serialize notifications without message IDs") {
+        const auto data =
+            to_string(MessageSerializer::serialize_notification("method", 1));
+
+        MessageParserConfig config;
+        RawMessageParser parser{config};
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.data(), data.data() + data.size(), buffer.data());
+        parser.consumed(data.size());
+        const auto message = parser.try_parse();
+        REQUIRE(message.has_value());
+
+        CHECK_FALSE(message->id().has_value());
+        CHECK_THROWS((void)message->serialize_with_id(1));
+    }
+
+    SECTION("reject a message larger than the maximum size") {
+        constexpr std::size_t param_size = 1000;
+        const auto data = to_string(MessageSerializer::serialize_request(
+            MethodNameView("method"), 1, std::string(param_size, 'a')));
+
+        MessageParserConfig config;
+        config.max_message_size(data.size() - 1U);
+        RawMessageParser parser{config};
+
+        const auto buffer = parser.prepare_buffer();
+        REQUIRE(buffer.size() >= data.size());
+        std::copy(data.begin(), data.end(), buffer.data());
+        parser.consumed(data.size());
+
+        CHECK_THROWS_AS(
+            (void)parser.try_parse(), msgpack_rpc::MsgpackRPCException);
+    }
+
+    SECTION("parse invalid data") {
+        MessageParserConfig config;
+        RawMessageParser parser{config};
+        const auto invalid_char =
+            static_cast<char>(static_cast<unsigned char>(0xC1));
+
+        const auto buffer = parser.prepare_buffer();
+        *(buffer.data()) = invalid_char;
+        parser.consumed(1U);
+        CHECK_THROWS((void)parser.try_parse());
+    }
+}
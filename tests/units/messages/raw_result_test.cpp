@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of RawResult class.
+ */
+#include "msgpack_rpc/messages/raw_result.h"
+
+#include <optional>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <msgpack.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+
+TEST_CASE("msgpack_rpc::messages::RawResult") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::StatusCode;
+    using msgpack_rpc::messages::RawResult;
+
+    msgpack::sbuffer serialized;
+    msgpack::pack(serialized, std::string("abc"));
+    const auto data = std::string(serialized.data(), serialized.size());
+
+    SECTION("create with a buffer owned by callers") {
+        int num_releases = 0;
+        std::optional<RawResult> result{RawResult(data.data(), data.size(),
+            [&num_releases] { ++num_releases; })};
+
+        CHECK(result->data() == data.data());
+        CHECK(result->size() == data.size());
+
+        result.reset();
+        CHECK(num_releases == 1);
+    }
+
+    SECTION("create with data owned by the object") {
+        const RawResult result{data};
+
+        CHECK(std::string(result.data(), result.size()) == data);
+        CHECK(result.data() != data.data());
+    }
+
+    SECTION("reject incomplete data") {
+        int num_releases = 0;
+        const auto incomplete = data.substr(0, data.size() - 1U);
+
+        try {
+            (void)RawResult(incomplete.data(), incomplete.size(),
+                [&num_releases] { ++num_releases; });
+            FAIL();
+        } catch (const MsgpackRPCException& e) {
+            CHECK(e.status().code() == StatusCode::INVALID_ARGUMENT);
+        }
+        CHECK(num_releases == 1);
+    }
+
+    SECTION("reject data with several objects") {
+        CHECK_THROWS_AS(RawResult(data + data), MsgpackRPCException);
+    }
+
+    SECTION("reject invalid data") {
+        // 0xC1 is never used in msgpack format.
+        CHECK_THROWS_AS(RawResult(std::string("\xC1")), MsgpackRPCException);
+    }
+
+    SECTION("pack") {
+        const RawResult result{data};
+
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, result);
+
+        CHECK(std::string(buffer.data(), buffer.size()) == data);
+    }
+
+    SECTION("create an object with a zone") {
+        const RawResult result{data};
+        msgpack::zone zone;
+
+        const auto object = msgpack::object(result, zone);
+
+        CHECK(object.as<std::string>() == "abc");
+    }
+}
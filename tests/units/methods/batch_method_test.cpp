@@ -0,0 +1,351 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of BatchMethod class.
+ */
+#include "msgpack_rpc/methods/batch_method.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "../create_test_logger.h"
+#include "msgpack_rpc/executors/async_invoke.h"
+#include "msgpack_rpc/executors/i_single_thread_executor.h"
+#include "msgpack_rpc/executors/operation_type.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/batch_method_options.h"
+#include "msgpack_rpc/methods/cancellation_token.h"
+#include "msgpack_rpc/methods/i_method.h"
+#include "msgpack_rpc/methods/request_deadline.h"
+#include "msgpack_rpc/servers/connection_id.h"
+#include "msgpack_rpc_test/create_parsed_messages.h"
+#include "msgpack_rpc_test/parse_messages.h"
+
+TEST_CASE("msgpack_rpc::methods::BatchMethod") {
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::MethodName;
+    using msgpack_rpc::messages::SerializedMessage;
+    using msgpack_rpc::methods::BatchMethodOptions;
+    using msgpack_rpc::methods::create_batch_method;
+    using msgpack_rpc::methods::IMethod;
+    using msgpack_rpc_test::create_parsed_notification;
+    using msgpack_rpc_test::create_parsed_request;
+    using msgpack_rpc_test::parse_response;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+
+    const auto method_name = MethodName("test_method");
+
+    std::unordered_map<MessageID, SerializedMessage> responses;
+    const IMethod::ResponseCallback on_response =
+        [&responses](SerializedMessage response) {
+            const auto id = parse_response(response).id();
+            responses.emplace(id, std::move(response));
+        };
+    const auto result_of = [&responses](MessageID id) {
+        return parse_response(responses.at(id)).result();
+    };
+
+    SECTION("with return values") {
+        std::vector<std::size_t> batch_sizes;
+        // Requests sent while processing the first batch.
+        std::vector<MessageID> queued_ids;
+        IMethod* method_ptr = nullptr;
+        BatchMethodOptions options;
+        options.max_batch_size(2);
+        const std::unique_ptr<IMethod> method =
+            create_batch_method<int(int, int)>(
+                method_name,
+                [&](const std::vector<std::tuple<int, int>>& parameters) {
+                    batch_sizes.push_back(parameters.size());
+                    for (const auto id : queued_ids) {
+                        method_ptr->async_call(
+                            create_parsed_request(
+                                method_name, id, static_cast<int>(id), 1),
+                            on_response);
+                    }
+                    queued_ids.clear();
+                    std::vector<int> results;
+                    for (const auto& [lhs, rhs] : parameters) {
+                        results.push_back(lhs + rhs);
+                    }
+                    return results;
+                },
+                options, logger);
+        method_ptr = method.get();
+
+        SECTION("get method name") { CHECK(method->name() == method_name); }
+
+        SECTION("call synchronously") {
+            const auto response =
+                method->call(create_parsed_request(method_name, 1, 2, 3));
+
+            CHECK(parse_response(response).result().result_as<int>() == 5);
+            CHECK(batch_sizes == std::vector<std::size_t>{1});
+        }
+
+        SECTION("call asynchronously") {
+            queued_ids = std::vector<MessageID>{2, 3, 4};
+
+            method->async_call(
+                create_parsed_request(method_name, 1, 2, 3), on_response);
+
+            CHECK(batch_sizes == std::vector<std::size_t>{1, 2, 1});
+            REQUIRE(responses.size() == 4U);
+            CHECK(result_of(1).result_as<int>() == 5);
+            CHECK(result_of(2).result_as<int>() == 3);
+            CHECK(result_of(3).result_as<int>() == 4);
+            CHECK(result_of(4).result_as<int>() == 5);
+        }
+
+        SECTION("call with invalid parameters") {
+            method->async_call(create_parsed_request(method_name, 1, "abc"),
+                on_response);
+
+            CHECK(batch_sizes.empty());
+            REQUIRE(responses.size() == 1U);
+            CHECK_FALSE(result_of(1).is_success());
+        }
+
+        SECTION("notify") {
+            CHECK_NOTHROW(
+                method->notify(create_parsed_notification(method_name, 2, 3)));
+
+            CHECK(batch_sizes == std::vector<std::size_t>{1});
+        }
+    }
+
+    SECTION("with batches in each connection") {
+        using msgpack_rpc::servers::ConnectionID;
+        using msgpack_rpc::servers::impl::ConnectionIDScope;
+
+        std::vector<std::size_t> batch_sizes;
+        bool is_first_call = true;
+        IMethod* method_ptr = nullptr;
+        BatchMethodOptions options;
+        options.batch_across_connections(false);
+        const std::unique_ptr<IMethod> method =
+            create_batch_method<void(int)>(
+                method_name,
+                [&](const std::vector<std::tuple<int>>& parameters) {
+                    batch_sizes.push_back(parameters.size());
+                    if (!is_first_call) {
+                        return;
+                    }
+                    is_first_call = false;
+                    {
+                        const ConnectionIDScope scope(
+                            static_cast<ConnectionID>(2));
+                        method_ptr->async_call(
+                            create_parsed_request(method_name, 2, 0),
+                            on_response);
+                    }
+                    const ConnectionIDScope scope(static_cast<ConnectionID>(1));
+                    method_ptr->async_call(
+                        create_parsed_request(method_name, 3, 0), on_response);
+                    method_ptr->async_call(
+                        create_parsed_request(method_name, 4, 0), on_response);
+                },
+                options, logger);
+        method_ptr = method.get();
+
+        const ConnectionIDScope scope(static_cast<ConnectionID>(1));
+        method->async_call(
+            create_parsed_request(method_name, 1, 0), on_response);
+
+        // The request from another connection is processed in another batch
+        // immediately.
+        CHECK(batch_sizes == std::vector<std::size_t>{1, 1, 2});
+        REQUIRE(responses.size() == 4U);
+        CHECK(result_of(1).is_success());
+        CHECK(result_of(4).is_success());
+    }
+
+    SECTION("with an executor") {
+        using msgpack_rpc::executors::OperationType;
+
+        const auto executor =
+            msgpack_rpc::executors::create_single_thread_executor(logger);
+        std::vector<std::size_t> batch_sizes;
+        BatchMethodOptions options;
+        options.max_batch_size(3);
+        options.max_waiting_time(GENERATE(std::chrono::nanoseconds(0),
+            std::chrono::nanoseconds(std::chrono::milliseconds(10))));
+        const std::unique_ptr<IMethod> method =
+            create_batch_method<int(int, int)>(
+                method_name,
+                [&batch_sizes](
+                    const std::vector<std::tuple<int, int>>& parameters) {
+                    batch_sizes.push_back(parameters.size());
+                    std::vector<int> results;
+                    for (const auto& [lhs, rhs] : parameters) {
+                        results.push_back(lhs + rhs);
+                    }
+                    return results;
+                },
+                options, logger, executor);
+
+        // Requests already posted to the executor are processed in a batch.
+        constexpr MessageID num_requests = 5;
+        for (MessageID id = 1; id <= num_requests; ++id) {
+            msgpack_rpc::executors::async_invoke(executor,
+                OperationType::CALLBACK, [&method, &method_name, &on_response,
+                                             id] {
+                    method->async_call(
+                        create_parsed_request(
+                            method_name, id, static_cast<int>(id), 1),
+                        on_response);
+                });
+        }
+        executor->run();
+
+        CHECK(batch_sizes == std::vector<std::size_t>{3, 2});
+        REQUIRE(responses.size() == num_requests);
+        CHECK(result_of(1).result_as<int>() == 2);
+        CHECK(result_of(5).result_as<int>() == 6);
+    }
+
+    SECTION("destroy with a scheduled task") {
+        const auto executor =
+            msgpack_rpc::executors::create_single_thread_executor(logger);
+        std::size_t num_batches = 0;
+        std::unique_ptr<IMethod> method = create_batch_method<void(int)>(
+            method_name,
+            [&num_batches](const std::vector<std::tuple<int>>& /*parameters*/) {
+                ++num_batches;
+            },
+            BatchMethodOptions(), logger, executor);
+
+        method->async_call(
+            create_parsed_request(method_name, 1, 2), on_response);
+        method.reset();
+        executor->run();
+
+        CHECK(num_batches == 0U);
+        CHECK(responses.empty());
+    }
+
+    SECTION("drop requests cancelled or past their deadlines") {
+        using msgpack_rpc::methods::CancellationToken;
+        using msgpack_rpc::methods::impl::CancellationTokenScope;
+        using msgpack_rpc::methods::impl::RequestDeadlineScope;
+
+        std::vector<std::size_t> batch_sizes;
+        const std::unique_ptr<IMethod> method = create_batch_method<void(int)>(
+            method_name,
+            [&batch_sizes](const std::vector<std::tuple<int>>& parameters) {
+                batch_sizes.push_back(parameters.size());
+            },
+            BatchMethodOptions(), logger);
+
+        {
+            const RequestDeadlineScope deadline_scope(
+                std::chrono::steady_clock::now() - std::chrono::seconds(1));
+            method->async_call(
+                create_parsed_request(method_name, 1, 2), on_response);
+        }
+        {
+            const auto token = std::make_shared<CancellationToken>();
+            token->cancel();
+            const CancellationTokenScope cancellation_scope(token);
+            method->async_call(
+                create_parsed_request(method_name, 2, 2), on_response);
+        }
+        method->async_call(
+            create_parsed_request(method_name, 3, 2), on_response);
+
+        CHECK(batch_sizes == std::vector<std::size_t>{1});
+        REQUIRE(responses.size() == 3U);
+        CHECK_FALSE(result_of(1).is_success());
+        CHECK_FALSE(result_of(2).is_success());
+        CHECK(result_of(3).is_success());
+    }
+
+    SECTION("with exceptions") {
+        const std::unique_ptr<IMethod> method =
+            create_batch_method<int(int)>(
+                method_name,
+                [](const std::vector<std::tuple<int>>& /*parameters*/)
+                    -> std::vector<int> {
+                    throw std::runtime_error("Test message.");
+                },
+                BatchMethodOptions(), logger);
+
+        method->async_call(
+            create_parsed_request(method_name, 1, 2), on_response);
+
+        REQUIRE(responses.size() == 1U);
+        CHECK(result_of(1).error_as<std::string>() == "Test message.");
+    }
+
+    SECTION("with wrong number of results") {
+        const std::unique_ptr<IMethod> method =
+            create_batch_method<int(int)>(
+                method_name,
+                [](const std::vector<std::tuple<int>>& /*parameters*/) {
+                    return std::vector<int>{};
+                },
+                BatchMethodOptions(), logger);
+
+        method->async_call(
+            create_parsed_request(method_name, 1, 2), on_response);
+
+        REQUIRE(responses.size() == 1U);
+        CHECK_FALSE(result_of(1).is_success());
+    }
+}
+
+TEST_CASE("msgpack_rpc::methods::BatchMethodOptions") {
+    using msgpack_rpc::methods::BatchMethodOptions;
+
+    BatchMethodOptions options;
+
+    SECTION("has correct value as default") {
+        CHECK(options.max_batch_size() == 1024U);
+        CHECK(options.max_waiting_time() == std::chrono::nanoseconds(0));
+        CHECK(options.batch_across_connections());
+    }
+
+    SECTION("set values") {
+        constexpr std::size_t max_batch_size = 16;
+        constexpr auto max_waiting_time = std::chrono::microseconds(100);
+
+        options.max_batch_size(max_batch_size)
+            .max_waiting_time(max_waiting_time)
+            .batch_across_connections(false);
+
+        CHECK(options.max_batch_size() == max_batch_size);
+        CHECK(options.max_waiting_time() == max_waiting_time);
+        CHECK_FALSE(options.batch_across_connections());
+    }
+
+    SECTION("set invalid values") {
+        CHECK_THROWS(options.max_batch_size(0));
+        CHECK_THROWS(options.max_waiting_time(std::chrono::microseconds(-1)));
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of CachedMethod class.
+ */
+#include "msgpack_rpc/methods/cached_method.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../create_test_logger.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/functional_method.h"
+#include "msgpack_rpc/methods/i_method.h"
+#include "msgpack_rpc/methods/method_cache.h"
+#include "msgpack_rpc_test/create_parsed_messages.h"
+#include "msgpack_rpc_test/parse_messages.h"
+
+TEST_CASE("msgpack_rpc::methods::CachedMethod") {
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::MethodName;
+    using msgpack_rpc::messages::SerializedMessage;
+    using msgpack_rpc::methods::create_cached_method;
+    using msgpack_rpc::methods::create_functional_method;
+    using msgpack_rpc::methods::IMethod;
+    using msgpack_rpc::methods::MethodCache;
+    using msgpack_rpc_test::create_parsed_notification;
+    using msgpack_rpc_test::create_parsed_request;
+    using msgpack_rpc_test::parse_response;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+    const auto method_name = MethodName("test_method");
+    std::vector<std::string> received_params;
+    const auto cache = std::make_shared<MethodCache>();
+    const std::unique_ptr<IMethod> method = create_cached_method(
+        create_functional_method<std::string(std::string)>(
+            method_name,
+            [&received_params](std::string_view str) {
+                received_params.emplace_back(str);
+                if (str == "error") {
+                    throw std::runtime_error("test error");
+                }
+                return std::string(str) + "!";
+            },
+            logger),
+        cache);
+
+    SECTION("get method name") { CHECK(method->name() == method_name); }
+
+    SECTION("call with the same parameters") {
+        const auto message_id1 = static_cast<MessageID>(1234);
+        const auto message_id2 = static_cast<MessageID>(2345);
+        const auto param = std::string_view("abc");
+
+        const SerializedMessage response1 = method->call(
+            create_parsed_request(method_name, message_id1, param));
+        const SerializedMessage response2 = method->call(
+            create_parsed_request(method_name, message_id2, param));
+
+        CHECK(received_params == std::vector<std::string>{"abc"});
+        const auto parsed_response1 = parse_response(response1);
+        CHECK(parsed_response1.id() == message_id1);
+        CHECK(parsed_response1.result().result_as<std::string>() == "abc!");
+        const auto parsed_response2 = parse_response(response2);
+        CHECK(parsed_response2.id() == message_id2);
+        CHECK(parsed_response2.result().result_as<std::string>() == "abc!");
+        CHECK(cache->statistics().num_hits() == 1U);
+        CHECK(cache->statistics().num_misses() == 1U);
+        CHECK(cache->statistics().num_entries() == 1U);
+    }
+
+    SECTION("call with different parameters") {
+        const auto message_id1 = static_cast<MessageID>(1234);
+        const auto message_id2 = static_cast<MessageID>(2345);
+
+        const SerializedMessage response1 = method->call(
+            create_parsed_request(method_name, message_id1, "abc"));
+        const SerializedMessage response2 = method->call(
+            create_parsed_request(method_name, message_id2, "def"));
+
+        CHECK(received_params == std::vector<std::string>{"abc", "def"});
+        CHECK(parse_response(response1).result().result_as<std::string>() ==
+            "abc!");
+        CHECK(parse_response(response2).result().result_as<std::string>() ==
+            "def!");
+        CHECK(cache->statistics().num_entries() == 2U);
+    }
+
+    SECTION("call asynchronously with the same parameters") {
+        const auto message_id1 = static_cast<MessageID>(1234);
+        const auto message_id2 = static_cast<MessageID>(2345);
+        const auto param = std::string_view("abc");
+        std::vector<SerializedMessage> responses;
+        const auto on_response = [&responses](SerializedMessage response) {
+            responses.push_back(std::move(response));
+        };
+
+        method->async_call(
+            create_parsed_request(method_name, message_id1, param),
+            on_response);
+        method->async_call(
+            create_parsed_request(method_name, message_id2, param),
+            on_response);
+
+        CHECK(received_params == std::vector<std::string>{"abc"});
+        REQUIRE(responses.size() == 2U);
+        CHECK(parse_response(responses.at(0)).id() == message_id1);
+        const auto parsed_response2 = parse_response(responses.at(1));
+        CHECK(parsed_response2.id() == message_id2);
+        CHECK(parsed_response2.result().result_as<std::string>() == "abc!");
+    }
+
+    SECTION("call with errors") {
+        const auto message_id1 = static_cast<MessageID>(1234);
+        const auto message_id2 = static_cast<MessageID>(2345);
+        const auto param = std::string_view("error");
+
+        const SerializedMessage response1 = method->call(
+            create_parsed_request(method_name, message_id1, param));
+        const SerializedMessage response2 = method->call(
+            create_parsed_request(method_name, message_id2, param));
+
+        CHECK(received_params == std::vector<std::string>{"error", "error"});
+        CHECK_FALSE(parse_response(response1).result().is_success());
+        CHECK_FALSE(parse_response(response2).result().is_success());
+        CHECK(cache->statistics().num_entries() == 0U);
+    }
+
+    SECTION("notify") {
+        const auto param = std::string_view("abc");
+
+        method->notify(create_parsed_notification(method_name, param));
+        method->notify(create_parsed_notification(method_name, param));
+
+        CHECK(received_params == std::vector<std::string>{"abc", "abc"});
+        CHECK(cache->statistics().num_entries() == 0U);
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of CancellationToken class.
+ */
+#include "msgpack_rpc/methods/cancellation_token.h"
+
+#include <memory>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::methods::CancellationToken") {
+    using msgpack_rpc::methods::CancellationToken;
+    using msgpack_rpc::methods::current_cancellation_token;
+    using msgpack_rpc::methods::impl::CancellationTokenScope;
+
+    SECTION("cancel") {
+        CancellationToken token;
+        CHECK_FALSE(token.is_cancelled());
+
+        token.cancel();
+
+        CHECK(token.is_cancelled());
+    }
+
+    SECTION("get the current token") {
+        CHECK(current_cancellation_token() == nullptr);
+
+        const auto token = std::make_shared<CancellationToken>();
+        {
+            const CancellationTokenScope scope(token);
+
+            CHECK(current_cancellation_token() == token);
+            {
+                const CancellationTokenScope inner_scope(nullptr);
+
+                CHECK(current_cancellation_token() == nullptr);
+            }
+            CHECK(current_cancellation_token() == token);
+        }
+        CHECK(current_cancellation_token() == nullptr);
+    }
+}
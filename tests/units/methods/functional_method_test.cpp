@@ -27,6 +27,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "../create_test_logger.h"
+#include "msgpack_rpc/messages/binary_view.h"
 #include "msgpack_rpc/messages/call_result.h"
 #include "msgpack_rpc/messages/message_id.h"
 #include "msgpack_rpc/messages/method_name.h"
@@ -39,6 +40,7 @@
 #include "msgpack_rpc_test/parse_messages.h"
 
 TEST_CASE("msgpack_rpc::methods::FunctionalMethod") {
+    using msgpack_rpc::messages::BinaryView;
     using msgpack_rpc::messages::MessageID;
     using msgpack_rpc::messages::MethodName;
     using msgpack_rpc::messages::MethodNameView;
@@ -92,6 +94,38 @@ TEST_CASE("msgpack_rpc::methods::FunctionalMethod") {
         }
     }
 
+    SECTION("with views of parameters") {
+        const auto method_name = MethodName("test_method");
+        std::string received_request_param1;
+        const std::unique_ptr<IMethod> method =
+            create_functional_method<BinaryView(std::string_view, BinaryView)>(
+                method_name,
+                [&received_request_param1](
+                    std::string_view str, BinaryView binary) {
+                    received_request_param1 = str;
+                    return binary;
+                },
+                logger);
+
+        SECTION("call") {
+            const auto message_id = static_cast<MessageID>(1234);
+            const auto param1 = std::string_view("parameter");
+            const auto param2 = std::string("binary");
+            const auto request = create_parsed_request(method_name,
+                message_id, param1, BinaryView(param2.data(), param2.size()));
+
+            const SerializedMessage result = method->call(request);
+
+            CHECK(received_request_param1 == param1);
+            const auto parsed_response = parse_response(result);
+            CHECK(parsed_response.id() == message_id);
+            const auto result_view =
+                parsed_response.result().result_as<BinaryView>();
+            CHECK(std::string_view(result_view.data(), result_view.size()) ==
+                param2);
+        }
+    }
+
     SECTION("with a return type but with exceptions in std::runtime_error") {
         const auto method_name = MethodName("test_method");
         std::string received_request_param1;
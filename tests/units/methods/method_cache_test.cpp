@@ -0,0 +1,109 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of MethodCache class.
+ */
+#include "msgpack_rpc/methods/method_cache.h"
+
+#include <chrono>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "msgpack_rpc/methods/method_cache_options.h"
+
+TEST_CASE("msgpack_rpc::methods::MethodCache") {
+    using msgpack_rpc::methods::MethodCache;
+    using msgpack_rpc::methods::MethodCacheOptions;
+
+    const auto now = MethodCache::Clock::now();
+
+    SECTION("find a cached result") {
+        MethodCache cache;
+        cache.insert("key", "result", now);
+
+        const auto result = cache.find("key", now);
+        REQUIRE(result != nullptr);
+        CHECK(*result == "result");
+        CHECK(cache.find("other", now) == nullptr);
+
+        const auto statistics = cache.statistics();
+        CHECK(statistics.num_hits() == 1U);
+        CHECK(statistics.num_misses() == 1U);
+        CHECK(statistics.num_entries() == 1U);
+        CHECK(statistics.num_bytes() == 9U);
+
+        // Results are shared without copying.
+        CHECK(cache.find("key", now) == result);
+    }
+
+    SECTION("remove expired results") {
+        constexpr auto time_to_live = std::chrono::seconds(1);
+        MethodCache cache{MethodCacheOptions().time_to_live(time_to_live)};
+        cache.insert("key", "result", now);
+
+        CHECK(cache.find("key", now + time_to_live) == nullptr);
+        CHECK(cache.statistics().num_entries() == 0U);
+        CHECK(cache.statistics().num_bytes() == 0U);
+    }
+
+    SECTION("remove least recently used results") {
+        MethodCache cache{MethodCacheOptions().max_entries(2)};
+        cache.insert("key1", "result1", now);
+        cache.insert("key2", "result2", now);
+        (void)cache.find("key1", now);
+        cache.insert("key3", "result3", now);
+
+        CHECK(cache.find("key1", now) != nullptr);
+        CHECK(cache.find("key2", now) == nullptr);
+        CHECK(cache.find("key3", now) != nullptr);
+    }
+
+    SECTION("limit the number of bytes") {
+        MethodCache cache{MethodCacheOptions().max_bytes(20)};
+        cache.insert("key1", "result1", now);
+        cache.insert("key2", "result2", now);
+
+        CHECK(cache.find("key1", now) == nullptr);
+        CHECK(cache.find("key2", now) != nullptr);
+        CHECK(cache.statistics().num_bytes() == 11U);
+
+        cache.insert("key3", "too large result!", now);
+
+        CHECK(cache.find("key3", now) == nullptr);
+        CHECK(cache.find("key2", now) != nullptr);
+    }
+
+    SECTION("replace a cached result") {
+        MethodCache cache;
+        cache.insert("key", "result1", now);
+        cache.insert("key", "result2", now);
+
+        const auto result = cache.find("key", now);
+        REQUIRE(result != nullptr);
+        CHECK(*result == "result2");
+        CHECK(cache.statistics().num_entries() == 1U);
+        CHECK(cache.statistics().num_bytes() == 10U);
+    }
+
+    SECTION("set invalid options") {
+        CHECK_THROWS(MethodCacheOptions().max_entries(0));
+        CHECK_THROWS(MethodCacheOptions().max_bytes(0));
+        CHECK_THROWS(
+            MethodCacheOptions().time_to_live(std::chrono::nanoseconds(0)));
+    }
+}
@@ -20,6 +20,7 @@
 #include "msgpack_rpc/methods/method_processor.h"
 
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -101,6 +102,45 @@ TEST_CASE("msgpack_rpc::methods::MethodProcessor") {
                 CHECK(parsed_response.result().is_error());
             }
 
+            SECTION("and asynchronously call a method") {
+                const auto message_id = static_cast<MessageID>(1234);
+                const auto param1 = std::string_view("parameter");
+                const auto request =
+                    create_parsed_request(method_name1, message_id, param1);
+
+                std::optional<SerializedMessage> result;
+                processor->async_call(request,
+                    [&result](SerializedMessage response) {
+                        result.emplace(std::move(response));
+                    });
+
+                CHECK(received_param1 == param1);
+                REQUIRE(result.has_value());
+                const auto parsed_response = parse_response(*result);
+                CHECK(parsed_response.id() == message_id);
+                CHECK(parsed_response.result().result_as<std::string_view>() ==
+                    param1);
+            }
+
+            SECTION("and asynchronously call a non-existing method") {
+                const auto method_name = MethodName("non-existing method");
+                const auto message_id = static_cast<MessageID>(1234);
+                const auto param1 = std::string_view("parameter");
+                const auto request =
+                    create_parsed_request(method_name, message_id, param1);
+
+                std::optional<SerializedMessage> result;
+                processor->async_call(request,
+                    [&result](SerializedMessage response) {
+                        result.emplace(std::move(response));
+                    });
+
+                REQUIRE(result.has_value());
+                const auto parsed_response = parse_response(*result);
+                CHECK(parsed_response.id() == message_id);
+                CHECK(parsed_response.result().is_error());
+            }
+
             SECTION("and notify to a method") {
                 const auto param1 = std::string_view("parameter");
                 const auto notification =
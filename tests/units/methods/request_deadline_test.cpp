@@ -0,0 +1,71 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to get deadlines of requests.
+ */
+#include "msgpack_rpc/methods/request_deadline.h"
+
+#include <chrono>
+#include <optional>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::methods::remaining_budget") {
+    using msgpack_rpc::methods::current_request_deadline;
+    using msgpack_rpc::methods::remaining_budget;
+    using msgpack_rpc::methods::impl::RequestDeadlineScope;
+
+    SECTION("get without deadlines") {
+        CHECK_FALSE(current_request_deadline().has_value());
+        CHECK_FALSE(remaining_budget().has_value());
+    }
+
+    SECTION("get with a deadline") {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        {
+            const RequestDeadlineScope scope(deadline);
+
+            CHECK(current_request_deadline() == deadline);
+            const auto budget = remaining_budget();
+            REQUIRE(budget.has_value());
+            CHECK(*budget > std::chrono::seconds(5));
+            CHECK(*budget <= std::chrono::seconds(10));
+        }
+        CHECK_FALSE(current_request_deadline().has_value());
+    }
+
+    SECTION("get with a passed deadline") {
+        const auto deadline =
+            std::chrono::steady_clock::now() - std::chrono::seconds(1);
+        const RequestDeadlineScope scope(deadline);
+
+        CHECK(remaining_budget() == std::chrono::nanoseconds(0));
+    }
+
+    SECTION("restore the previous deadline") {
+        const auto outer_deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        const RequestDeadlineScope outer_scope(outer_deadline);
+        {
+            const RequestDeadlineScope inner_scope(std::nullopt);
+
+            CHECK_FALSE(current_request_deadline().has_value());
+        }
+        CHECK(current_request_deadline() == outer_deadline);
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of StreamingMethod class.
+ */
+#include "msgpack_rpc/methods/streaming_method.h"
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../create_test_logger.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/i_method.h"
+#include "msgpack_rpc/methods/stream_writer.h"
+#include "msgpack_rpc_test/create_parsed_messages.h"
+#include "msgpack_rpc_test/parse_messages.h"
+
+namespace {
+
+class TestStreamChunkSender final
+    : public msgpack_rpc::methods::impl::IStreamChunkSender {
+public:
+    [[nodiscard]] bool send_stream_chunk(
+        msgpack_rpc::messages::SerializedMessage chunk) override {
+        chunks.push_back(std::move(chunk));
+        thread_id = std::this_thread::get_id();
+        return is_connected;
+    }
+
+    std::vector<msgpack_rpc::messages::SerializedMessage> chunks{};
+
+    std::thread::id thread_id{};
+
+    bool is_connected{true};
+};
+
+}  // namespace
+
+TEST_CASE("msgpack_rpc::methods::StreamingMethod") {
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::MethodName;
+    using msgpack_rpc::messages::SerializedMessage;
+    using msgpack_rpc::methods::create_streaming_method;
+    using msgpack_rpc::methods::IMethod;
+    using msgpack_rpc::methods::StreamWriter;
+    using msgpack_rpc::methods::impl::StreamChunkSenderScope;
+    using msgpack_rpc_test::create_parsed_request;
+    using msgpack_rpc_test::parse_notification;
+    using msgpack_rpc_test::parse_response;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+    const auto method_name = MethodName("test_method");
+    const std::unique_ptr<IMethod> method =
+        create_streaming_method<int(int)>(
+            method_name,
+            [](StreamWriter<int>& writer, int num_chunks) {
+                if (num_chunks < 0) {
+                    throw std::runtime_error("test error");
+                }
+                for (int i = 0; i < num_chunks; ++i) {
+                    writer.write(i);
+                }
+            },
+            logger);
+    const auto message_id = static_cast<MessageID>(1234);
+    TestStreamChunkSender sender;
+
+    SECTION("get method name") { CHECK(method->name() == method_name); }
+
+    SECTION("call") {
+        const StreamChunkSenderScope scope(&sender);
+
+        const SerializedMessage response =
+            method->call(create_parsed_request(method_name, message_id, 3));
+
+        REQUIRE(sender.chunks.size() == 3U);
+        for (std::size_t i = 0; i < sender.chunks.size(); ++i) {
+            const auto notification = parse_notification(sender.chunks.at(i));
+            CHECK(notification.method_name() ==
+                msgpack_rpc::messages::STREAM_CHUNK_METHOD_NAME);
+            CHECK(notification.parameters().as<MessageID, int>() ==
+                std::make_tuple(message_id, static_cast<int>(i)));
+        }
+        const auto parsed_response = parse_response(response);
+        CHECK(parsed_response.id() == message_id);
+        CHECK(parsed_response.result().is_success());
+    }
+
+    SECTION("call with an error") {
+        const StreamChunkSenderScope scope(&sender);
+
+        const SerializedMessage response =
+            method->call(create_parsed_request(method_name, message_id, -1));
+
+        CHECK(sender.chunks.empty());
+        CHECK(parse_response(response).result().is_error());
+    }
+
+    SECTION("call with a closed connection") {
+        sender.is_connected = false;
+        const StreamChunkSenderScope scope(&sender);
+
+        const SerializedMessage response =
+            method->call(create_parsed_request(method_name, message_id, 3));
+
+        CHECK(sender.chunks.size() == 1U);
+        CHECK(parse_response(response).result().is_error());
+    }
+
+    SECTION("call asynchronously") {
+        const StreamChunkSenderScope scope(&sender);
+        std::promise<SerializedMessage> promise;
+        auto future = promise.get_future();
+
+        method->async_call(create_parsed_request(method_name, message_id, 3),
+            [&promise](SerializedMessage response) {
+                promise.set_value(std::move(response));
+            });
+
+        REQUIRE(future.wait_for(std::chrono::seconds(5)) ==
+            std::future_status::ready);
+        const auto parsed_response = parse_response(future.get());
+        CHECK(parsed_response.id() == message_id);
+        CHECK(parsed_response.result().is_success());
+        CHECK(sender.chunks.size() == 3U);
+        // Streams run in threads dedicated to the calls.
+        CHECK(sender.thread_id != std::this_thread::get_id());
+    }
+
+    SECTION("call asynchronously without a stream") {
+        std::promise<SerializedMessage> promise;
+        auto future = promise.get_future();
+
+        method->async_call(create_parsed_request(method_name, message_id, 3),
+            [&promise](SerializedMessage response) {
+                promise.set_value(std::move(response));
+            });
+
+        REQUIRE(future.wait_for(std::chrono::seconds(0)) ==
+            std::future_status::ready);
+        CHECK(parse_response(future.get()).result().is_error());
+    }
+
+    SECTION("call without a stream") {
+        const SerializedMessage response =
+            method->call(create_parsed_request(method_name, message_id, 3));
+
+        CHECK(parse_response(response).result().is_error());
+    }
+}
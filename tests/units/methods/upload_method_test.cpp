@@ -0,0 +1,170 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of UploadMethod class.
+ */
+#include "msgpack_rpc/methods/upload_method.h"
+
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../create_test_logger.h"
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/method_name.h"
+#include "msgpack_rpc/messages/parsed_parameters.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/methods/i_method.h"
+#include "msgpack_rpc/methods/upload_reader.h"
+#include "msgpack_rpc_test/create_parsed_messages.h"
+#include "msgpack_rpc_test/parse_messages.h"
+
+namespace {
+
+class TestUploadChunkSource final
+    : public msgpack_rpc::methods::impl::IUploadChunkSource {
+public:
+    [[nodiscard]] std::optional<msgpack_rpc::messages::ParsedParameters>
+    next_upload_chunk(msgpack_rpc::messages::MessageID request_id) override {
+        thread_id = std::this_thread::get_id();
+        if (chunks.empty()) {
+            if (is_connected) {
+                return std::nullopt;
+            }
+            throw msgpack_rpc::MsgpackRPCException(
+                msgpack_rpc::StatusCode::CONNECTION_FAILURE, "Closed.");
+        }
+        const auto notification = msgpack_rpc_test::create_parsed_notification(
+            msgpack_rpc::messages::UPLOAD_CHUNK_METHOD_NAME, request_id,
+            chunks.front());
+        chunks.pop_front();
+        return notification.parameters();
+    }
+
+    std::deque<int> chunks{};
+
+    bool is_connected{true};
+
+    std::thread::id thread_id{};
+};
+
+}  // namespace
+
+TEST_CASE("msgpack_rpc::methods::UploadMethod") {
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::MethodName;
+    using msgpack_rpc::messages::SerializedMessage;
+    using msgpack_rpc::methods::create_upload_method;
+    using msgpack_rpc::methods::IMethod;
+    using msgpack_rpc::methods::UploadReader;
+    using msgpack_rpc::methods::impl::UploadChunkSourceScope;
+    using msgpack_rpc_test::create_parsed_request;
+    using msgpack_rpc_test::parse_response;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+    const auto method_name = MethodName("test_method");
+    const std::unique_ptr<IMethod> method =
+        create_upload_method<int(int), int>(
+            method_name,
+            [](UploadReader<int>& reader, int initial_value) {
+                if (initial_value < 0) {
+                    throw std::runtime_error("test error");
+                }
+                int sum = initial_value;
+                while (const auto chunk = reader.next()) {
+                    sum += *chunk;
+                }
+                return sum;
+            },
+            logger);
+    const auto message_id = static_cast<MessageID>(1234);
+    TestUploadChunkSource source;
+
+    SECTION("get method name") { CHECK(method->name() == method_name); }
+
+    SECTION("call") {
+        source.chunks = {1, 2, 3};
+        const UploadChunkSourceScope scope(&source);
+
+        const SerializedMessage response =
+            method->call(create_parsed_request(method_name, message_id, 10));
+
+        CHECK(source.chunks.empty());
+        const auto parsed_response = parse_response(response);
+        CHECK(parsed_response.id() == message_id);
+        REQUIRE(parsed_response.result().is_success());
+        CHECK(parsed_response.result().result_as<int>() == 16);
+    }
+
+    SECTION("call with an error") {
+        const UploadChunkSourceScope scope(&source);
+
+        const SerializedMessage response =
+            method->call(create_parsed_request(method_name, message_id, -1));
+
+        CHECK(parse_response(response).result().is_error());
+    }
+
+    SECTION("call with a closed connection") {
+        source.chunks = {1};
+        source.is_connected = false;
+        const UploadChunkSourceScope scope(&source);
+
+        const SerializedMessage response =
+            method->call(create_parsed_request(method_name, message_id, 0));
+
+        CHECK(parse_response(response).result().is_error());
+    }
+
+    SECTION("call asynchronously") {
+        source.chunks = {1, 2, 3};
+        const UploadChunkSourceScope scope(&source);
+        std::promise<SerializedMessage> promise;
+        auto future = promise.get_future();
+
+        method->async_call(create_parsed_request(method_name, message_id, 10),
+            [&promise](SerializedMessage response) {
+                promise.set_value(std::move(response));
+            });
+
+        REQUIRE(future.wait_for(std::chrono::seconds(5)) ==
+            std::future_status::ready);
+        const auto parsed_response = parse_response(future.get());
+        CHECK(parsed_response.id() == message_id);
+        REQUIRE(parsed_response.result().is_success());
+        CHECK(parsed_response.result().result_as<int>() == 16);
+        // Uploads run in threads dedicated to the calls.
+        CHECK(source.thread_id != std::this_thread::get_id());
+    }
+
+    SECTION("call without an upload") {
+        const SerializedMessage response =
+            method->call(create_parsed_request(method_name, message_id, 0));
+
+        CHECK(parse_response(response).result().is_error());
+    }
+}
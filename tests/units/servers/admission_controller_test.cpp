@@ -0,0 +1,92 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of AdmissionController class.
+ */
+#include "msgpack_rpc/servers/admission_controller.h"
+
+#include <atomic>
+#include <cstddef>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "msgpack_rpc/config/admission_control_config.h"
+
+TEST_CASE("msgpack_rpc::servers::AdmissionController") {
+    using msgpack_rpc::config::AdmissionControlConfig;
+    using msgpack_rpc::servers::AdmissionController;
+
+    SECTION("limit connections") {
+        AdmissionControlConfig config;
+        config.max_connections(2);
+        AdmissionController controller{config};
+
+        CHECK(controller.try_add_connection());
+        CHECK(controller.try_add_connection());
+        CHECK_FALSE(controller.try_add_connection());
+        CHECK(controller.num_connections() == 2U);
+
+        controller.remove_connection();
+        CHECK(controller.try_add_connection());
+    }
+
+    SECTION("limit requests in a connection") {
+        AdmissionControlConfig config;
+        config.max_in_flight_per_connection(2);
+        AdmissionController controller{config};
+        std::atomic<std::size_t> connection1{0};
+        std::atomic<std::size_t> connection2{0};
+
+        CHECK(controller.try_start_request(connection1));
+        CHECK(controller.try_start_request(connection1));
+        CHECK_FALSE(controller.try_start_request(connection1));
+        CHECK(controller.try_start_request(connection2));
+        CHECK(controller.num_in_flight_requests() == 3U);
+
+        controller.finish_request(connection1);
+        CHECK(connection1.load() == 1U);
+        CHECK(controller.try_start_request(connection1));
+    }
+
+    SECTION("limit requests in a server") {
+        AdmissionControlConfig config;
+        config.max_in_flight_requests(2);
+        AdmissionController controller{config};
+        std::atomic<std::size_t> connection1{0};
+        std::atomic<std::size_t> connection2{0};
+
+        CHECK(controller.try_start_request(connection1));
+        CHECK(controller.try_start_request(connection2));
+        CHECK_FALSE(controller.try_start_request(connection1));
+        CHECK(connection1.load() == 1U);
+
+        controller.finish_request(connection2);
+        CHECK(controller.try_start_request(connection1));
+        CHECK(connection1.load() == 2U);
+    }
+
+    SECTION("accept everything without limits") {
+        AdmissionController controller{AdmissionControlConfig()};
+        std::atomic<std::size_t> connection{0};
+
+        constexpr std::size_t num_trials = 1000;
+        for (std::size_t i = 0; i < num_trials; ++i) {
+            CHECK(controller.try_add_connection());
+            CHECK(controller.try_start_request(connection));
+        }
+    }
+}
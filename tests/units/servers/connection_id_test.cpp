@@ -0,0 +1,54 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions of IDs of connections in servers.
+ */
+#include "msgpack_rpc/servers/connection_id.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("msgpack_rpc::servers::current_connection_id") {
+    using msgpack_rpc::servers::ConnectionID;
+    using msgpack_rpc::servers::current_connection_id;
+    using msgpack_rpc::servers::impl::ConnectionIDScope;
+
+    SECTION("get without connections") {
+        CHECK_FALSE(current_connection_id().has_value());
+    }
+
+    SECTION("get with a connection") {
+        constexpr ConnectionID id = 3;
+        {
+            const ConnectionIDScope scope(id);
+
+            CHECK(current_connection_id() == id);
+        }
+        CHECK_FALSE(current_connection_id().has_value());
+    }
+
+    SECTION("restore the previous ID") {
+        constexpr ConnectionID outer_id = 3;
+        constexpr ConnectionID inner_id = 5;
+        const ConnectionIDScope outer_scope(outer_id);
+        {
+            const ConnectionIDScope inner_scope(inner_id);
+
+            CHECK(current_connection_id() == inner_id);
+        }
+        CHECK(current_connection_id() == outer_id);
+    }
+}
@@ -21,6 +21,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 #include <variant>
 
 #include <catch2/catch_test_macros.hpp>
@@ -30,6 +31,9 @@
 #include "../../transport/mock_acceptor.h"
 #include "../../transport/mock_connection.h"
 #include "msgpack_rpc/addresses/tcp_address.h"
+#include "msgpack_rpc/clients/impl/i_call_future_impl.h"
+#include "msgpack_rpc/clients/impl/parameters_serializer.h"
+#include "msgpack_rpc/config/server_config.h"
 #include "msgpack_rpc/executors/async_invoke.h"
 #include "msgpack_rpc/executors/i_single_thread_executor.h"
 #include "msgpack_rpc/executors/operation_type.h"
@@ -44,14 +48,18 @@
 #include "msgpack_rpc/methods/i_method.h"
 #include "msgpack_rpc/methods/i_method_processor.h"
 #include "msgpack_rpc/methods/method_processor.h"
+#include "msgpack_rpc/servers/connection_id.h"
 #include "msgpack_rpc/servers/impl/i_server_impl.h"
 #include "msgpack_rpc/transport/i_acceptor.h"
 #include "msgpack_rpc/transport/i_connection.h"
 #include "msgpack_rpc_test/create_parsed_messages.h"
+#include "msgpack_rpc_test/parse_messages.h"
 #include "trompeloeil_catch2.h"
 
 TEST_CASE("msgpack_rpc::servers::ServerImpl") {
     using msgpack_rpc::addresses::TCPAddress;
+    using msgpack_rpc::clients::impl::ICallFutureImpl;
+    using msgpack_rpc::clients::impl::make_parameters_serializer;
     using msgpack_rpc::executors::OperationType;
     using msgpack_rpc::messages::MessageID;
     using msgpack_rpc::messages::MessageSerializer;
@@ -67,6 +75,7 @@ TEST_CASE("msgpack_rpc::servers::ServerImpl") {
     using msgpack_rpc_test::MockAcceptor;
     using msgpack_rpc_test::MockConnection;
     using msgpack_rpc_test::MockMethod;
+    using msgpack_rpc_test::parse_request;
     using trompeloeil::_;
 
     const auto logger = msgpack_rpc_test::create_test_logger();
@@ -100,7 +109,8 @@ TEST_CASE("msgpack_rpc::servers::ServerImpl") {
 
         const auto server = std::make_shared<ServerImpl>(
             std::vector<std::shared_ptr<IAcceptor>>{acceptor},
-            std::move(processor), executor_wrapper, logger);
+            std::move(processor), executor_wrapper,
+            msgpack_rpc::config::ServerConfig(), logger);
 
         IAcceptor::ConnectionCallback on_connection{
             [](const auto& /*connection*/) { FAIL(); }};
@@ -189,14 +199,75 @@ TEST_CASE("msgpack_rpc::servers::ServerImpl") {
                 }
             }
 
-            SECTION("and receive a response") {
+            SECTION("and notify to all connections") {
+                const auto notification =
+                    MessageSerializer::serialize_notification("update", 1);
+                on_connection_handling_started = [&server, &notification] {
+                    CHECK(server->notify_all(notification) == 1U);
+                };
+
+                REQUIRE_CALL(*connection, async_send(_))
+                    .TIMES(1)
+                    .LR_WITH(_1.data() == notification.data());
+
+                SECTION("then no error happens") {
+                    REQUIRE_NOTHROW(executor->run());
+                }
+            }
+
+            SECTION("and notify to a connection of a notification") {
+                on_connection_handling_started = [&method_name, &on_received] {
+                    const auto notification =
+                        create_parsed_notification(method_name);
+                    on_received(notification);
+                };
+
+                const auto notification =
+                    MessageSerializer::serialize_notification("update", 1);
+                REQUIRE_CALL(method_ref, notify(_))
+                    .TIMES(1)
+                    .LR_SIDE_EFFECT(CHECK(server->notify(
+                        msgpack_rpc::servers::current_connection_id().value(),
+                        notification)));
+
+                REQUIRE_CALL(*connection, async_send(_))
+                    .TIMES(1)
+                    .LR_WITH(_1.data() == notification.data());
+
+                SECTION("then no error happens") {
+                    REQUIRE_NOTHROW(executor->run());
+                }
+            }
+
+            SECTION("and call a method in the client") {
+                std::shared_ptr<ICallFutureImpl> future;
+                on_connection_handling_started = [&server, &future] {
+                    future = server->async_call(0,
+                        MethodNameView("client_method"),
+                        make_parameters_serializer(std::string("abc")));
+                };
+
+                REQUIRE_CALL(*connection, async_send(_))
+                    .TIMES(1)
+                    .LR_SIDE_EFFECT(on_received(
+                        create_parsed_successful_response(
+                            parse_request(_1).id(), std::string("result"))));
+
+                REQUIRE_NOTHROW(executor->run());
+
+                REQUIRE(future);
+                CHECK(future->get_result().result_as<std::string>() ==
+                    "result");
+            }
+
+            SECTION("and receive a response to an unknown request") {
                 on_connection_handling_started = [&on_received] {
                     const auto response =
                         create_parsed_successful_response(123, 0);
                     on_received(response);
                 };
 
-                REQUIRE_CALL(*connection, async_close()).TIMES(1);
+                FORBID_CALL(*connection, async_close());
 
                 SECTION("then no error happens") {
                     REQUIRE_NOTHROW(executor->run());
@@ -204,6 +275,16 @@ TEST_CASE("msgpack_rpc::servers::ServerImpl") {
             }
         }
 
+        SECTION("and notify to an unknown connection") {
+            CHECK_FALSE(server->notify(
+                0, MessageSerializer::serialize_notification("update", 1)));
+        }
+
+        SECTION("and call a method in an unknown connection") {
+            CHECK_THROWS((void)server->async_call(0,
+                MethodNameView("client_method"), make_parameters_serializer()));
+        }
+
         SECTION("and try to start one more time") {
             CHECK_THROWS(server->start());
         }
@@ -221,7 +302,8 @@ TEST_CASE("msgpack_rpc::servers::ServerImpl") {
         const std::shared_ptr<IServerImpl> server =
             std::make_shared<ServerImpl>(
                 std::vector<std::shared_ptr<IAcceptor>>{acceptor},
-                std::move(processor), executor_wrapper, logger);
+                std::move(processor), executor_wrapper,
+            msgpack_rpc::config::ServerConfig(), logger);
 
         REQUIRE_NOTHROW(server->stop());
     }
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of ServerConnection class.
+ */
+#include "msgpack_rpc/servers/server_connection.h"
+
+#include <memory>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../create_test_logger.h"
+#include "../transport/mock_connection.h"
+#include "msgpack_rpc/addresses/tcp_address.h"
+#include "msgpack_rpc/common/status.h"
+#include "msgpack_rpc/config/admission_control_config.h"
+#include "msgpack_rpc/config/server_config.h"
+#include "msgpack_rpc/executors/i_single_thread_executor.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/methods/i_method_processor.h"
+#include "msgpack_rpc/methods/method_processor.h"
+#include "msgpack_rpc/servers/admission_controller.h"
+#include "msgpack_rpc/transport/i_connection.h"
+#include "trompeloeil_catch2.h"
+
+TEST_CASE("msgpack_rpc::servers::ServerConnection") {
+    using msgpack_rpc::addresses::TCPAddress;
+    using msgpack_rpc::config::AdmissionControlConfig;
+    using msgpack_rpc::config::ServerConfig;
+    using msgpack_rpc::messages::MessageSerializer;
+    using msgpack_rpc::servers::AdmissionController;
+    using msgpack_rpc::servers::ServerConnection;
+    using msgpack_rpc::transport::IConnection;
+    using msgpack_rpc_test::MockConnection;
+    using trompeloeil::_;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+    const auto executor =
+        msgpack_rpc::executors::create_single_thread_executor(logger);
+    const auto processor =
+        std::shared_ptr<msgpack_rpc::methods::IMethodProcessor>(
+            msgpack_rpc::methods::create_method_processor(logger));
+
+    const auto connection = std::make_shared<MockConnection>();
+    const auto remote_address = TCPAddress("127.0.0.1", 20000);
+    ALLOW_CALL(*connection, remote_address()).LR_RETURN(remote_address);
+
+    const auto admission_controller =
+        std::make_shared<AdmissionController>(AdmissionControlConfig());
+    REQUIRE(admission_controller->try_add_connection());
+
+    ServerConfig config;
+    config.notification_queue().max_queued_notifications(1);
+
+    const auto notification1 =
+        MessageSerializer::serialize_notification("update", 1);
+    const auto notification2 =
+        MessageSerializer::serialize_notification("update", 2);
+    const auto notification3 =
+        MessageSerializer::serialize_notification("update", 3);
+
+    IConnection::MessageSentCallback on_sent{[] { FAIL(); }};
+    IConnection::ConnectionClosedCallback on_closed{
+        [](const msgpack_rpc::Status& /*status*/) { FAIL(); }};
+    REQUIRE_CALL(*connection, start(_, _, _))
+        .TIMES(1)
+        .LR_SIDE_EFFECT(on_sent = _2)
+        .LR_SIDE_EFFECT(on_closed = _3);
+
+    SECTION("drop the oldest notification of a slow consumer") {
+        const auto server_connection =
+            std::make_shared<ServerConnection>(0, connection, executor,
+                processor, config, admission_controller, logger);
+        server_connection->start();
+
+        trompeloeil::sequence sequence;
+        REQUIRE_CALL(*connection, async_send(_))
+            .LR_WITH(_1.data() == notification1.data())
+            .IN_SEQUENCE(sequence);
+        REQUIRE_CALL(*connection, async_send(_))
+            .LR_WITH(_1.data() == notification3.data())
+            .IN_SEQUENCE(sequence);
+        FORBID_CALL(*connection, async_close());
+        FORBID_CALL(*connection, pause_reading());
+
+        server_connection->notify(notification1);
+        server_connection->notify(notification2);
+        server_connection->notify(notification3);
+        on_sent();
+    }
+
+    SECTION("disconnect a slow consumer") {
+        config.notification_queue().disconnect_slow_consumers(true);
+        const auto server_connection =
+            std::make_shared<ServerConnection>(0, connection, executor,
+                processor, config, admission_controller, logger);
+        server_connection->start();
+
+        REQUIRE_CALL(*connection, async_send(_))
+            .TIMES(1)
+            .LR_WITH(_1.data() == notification1.data());
+        REQUIRE_CALL(*connection, async_close()).TIMES(1);
+
+        server_connection->notify(notification1);
+        server_connection->notify(notification2);
+        server_connection->notify(notification3);
+        server_connection->notify(notification3);
+    }
+
+    SECTION("send notifications and other messages in the order of pushing") {
+        const auto server_connection =
+            std::make_shared<ServerConnection>(0, connection, executor,
+                processor, ServerConfig(), admission_controller, logger);
+        server_connection->start();
+
+        const auto chunk =
+            MessageSerializer::serialize_notification("$/streamChunk", 1);
+        trompeloeil::sequence sequence;
+        REQUIRE_CALL(*connection, async_send(_))
+            .LR_WITH(_1.data() == notification1.data())
+            .IN_SEQUENCE(sequence);
+        REQUIRE_CALL(*connection, async_send(_))
+            .LR_WITH(_1.data() == notification2.data())
+            .IN_SEQUENCE(sequence);
+        REQUIRE_CALL(*connection, async_send(_))
+            .LR_WITH(_1.data() == chunk.data())
+            .IN_SEQUENCE(sequence);
+
+        server_connection->notify(notification1);
+        server_connection->notify(notification2);
+        CHECK(server_connection->send_stream_chunk(chunk));
+        on_sent();
+        on_sent();
+    }
+
+    SECTION("apply flow control to notifications") {
+        ServerConfig flow_control_config;
+        flow_control_config.flow_control()
+            .high_watermark_messages(1)
+            .low_watermark_messages(0);
+        const auto server_connection =
+            std::make_shared<ServerConnection>(0, connection, executor,
+                processor, flow_control_config, admission_controller, logger);
+        server_connection->start();
+
+        trompeloeil::sequence sequence;
+        REQUIRE_CALL(*connection, async_send(_))
+            .LR_WITH(_1.data() == notification1.data())
+            .IN_SEQUENCE(sequence);
+        REQUIRE_CALL(*connection, pause_reading()).IN_SEQUENCE(sequence);
+        REQUIRE_CALL(*connection, async_send(_))
+            .LR_WITH(_1.data() == notification2.data())
+            .IN_SEQUENCE(sequence);
+        REQUIRE_CALL(*connection, resume_reading()).IN_SEQUENCE(sequence);
+
+        server_connection->notify(notification1);
+        server_connection->notify(notification2);
+        on_sent();
+        on_sent();
+    }
+
+    SECTION("wait for sending of chunks of streams") {
+        config.flow_control().high_watermark_messages(1).low_watermark_messages(
+            0);
+        const auto server_connection =
+            std::make_shared<ServerConnection>(0, connection, executor,
+                processor, config, admission_controller, logger);
+        server_connection->start();
+
+        REQUIRE_CALL(*connection, async_send(_))
+            .TIMES(1)
+            .LR_WITH(_1.data() == notification1.data());
+        // Reading is paused unless the connection is closed before the
+        // second chunk is pushed.
+        ALLOW_CALL(*connection, pause_reading());
+        FORBID_CALL(*connection, async_close());
+
+        CHECK(server_connection->send_stream_chunk(notification1));
+        bool is_sent = true;
+        std::thread thread{[&server_connection, &notification2, &is_sent] {
+            is_sent = server_connection->send_stream_chunk(notification2);
+        }};
+        on_closed(msgpack_rpc::Status());
+        thread.join();
+
+        CHECK_FALSE(is_sent);
+        CHECK_FALSE(server_connection->send_stream_chunk(notification3));
+    }
+}
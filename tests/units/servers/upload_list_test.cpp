@@ -0,0 +1,123 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of UploadList class.
+ */
+#include "msgpack_rpc/servers/upload_list.h"
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/common/status_code.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/reserved_method_names.h"
+#include "msgpack_rpc_test/create_parsed_messages.h"
+
+TEST_CASE("msgpack_rpc::servers::UploadList") {
+    using msgpack_rpc::MsgpackRPCException;
+    using msgpack_rpc::StatusCode;
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::UPLOAD_CHUNK_METHOD_NAME;
+    using msgpack_rpc::servers::UploadList;
+    using msgpack_rpc_test::create_parsed_notification;
+
+    constexpr std::size_t max_queued_chunks = 2;
+    constexpr auto idle_timeout = std::chrono::seconds(1);
+    UploadList list{max_queued_chunks, idle_timeout};
+    const auto request_id = static_cast<MessageID>(12345);
+    const auto create_chunk = [request_id](const std::string& data) {
+        const auto notification = create_parsed_notification(
+            UPLOAD_CHUNK_METHOD_NAME, request_id, data);
+        return notification.parameters();
+    };
+
+    SECTION("read chunks") {
+        CHECK(list.push(request_id, create_chunk("abc")));
+        CHECK(list.push(request_id, create_chunk("def")));
+        list.end(request_id);
+
+        auto chunk = list.next(request_id);
+        REQUIRE(chunk);
+        CHECK(chunk->as<MessageID, std::string>() ==
+            std::make_tuple(request_id, std::string("abc")));
+        chunk = list.next(request_id);
+        REQUIRE(chunk);
+        CHECK(chunk->as<MessageID, std::string>() ==
+            std::make_tuple(request_id, std::string("def")));
+        CHECK_FALSE(list.next(request_id).has_value());
+    }
+
+    SECTION("reject too many chunks") {
+        CHECK(list.push(request_id, create_chunk("abc")));
+        CHECK(list.push(request_id, create_chunk("def")));
+        CHECK_FALSE(list.push(request_id, create_chunk("ghi")));
+
+        (void)list.next(request_id);
+        CHECK(list.push(request_id, create_chunk("ghi")));
+    }
+
+    SECTION("wait for chunks") {
+        auto chunk = std::async(std::launch::async,
+            [&list, request_id] { return list.next(request_id); });
+        CHECK(chunk.wait_for(std::chrono::milliseconds(10)) ==
+            std::future_status::timeout);
+
+        CHECK(list.push(request_id, create_chunk("abc")));
+
+        const auto result = chunk.get();
+        REQUIRE(result);
+        CHECK(result->as<MessageID, std::string>() ==
+            std::make_tuple(request_id, std::string("abc")));
+    }
+
+    SECTION("time out while waiting for chunks") {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(10);
+
+        try {
+            (void)list.next(request_id, deadline);
+            FAIL();
+        } catch (const MsgpackRPCException& e) {
+            CHECK(e.status().code() == StatusCode::TIMEOUT);
+        }
+    }
+
+    SECTION("close while waiting for chunks") {
+        auto chunk = std::async(std::launch::async,
+            [&list, request_id] { return list.next(request_id); });
+
+        list.close();
+
+        CHECK_THROWS_AS((void)chunk.get(), MsgpackRPCException);
+    }
+
+    SECTION("remove an upload") {
+        CHECK(list.push(request_id, create_chunk("abc")));
+        CHECK(list.push(request_id, create_chunk("def")));
+
+        list.remove(request_id);
+
+        CHECK(list.push(request_id, create_chunk("ghi")));
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of apply_socket_config function.
+ */
+#include "msgpack_rpc/transport/apply_socket_config.h"
+
+#include <chrono>
+#include <cstddef>
+
+#include <asio/io_context.hpp>
+#include <asio/ip/address_v4.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/socket_base.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../create_test_logger.h"
+#include "msgpack_rpc/config/socket_config.h"
+
+TEST_CASE("msgpack_rpc::transport::apply_socket_config") {
+    using msgpack_rpc::config::SocketConfig;
+    using msgpack_rpc::transport::apply_socket_config;
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+
+    asio::io_context context;
+    asio::ip::tcp::acceptor acceptor(context,
+        asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    asio::ip::tcp::socket client_socket(context);
+    client_socket.connect(acceptor.local_endpoint());
+    asio::ip::tcp::socket socket = acceptor.accept();
+
+    SECTION("apply options to an accepted socket") {
+        constexpr std::size_t buffer_size = 65536;
+        SocketConfig config;
+        config.tcp_no_delay(true)
+            .send_buffer_size(buffer_size)
+            .receive_buffer_size(buffer_size)
+            .keep_alive(true)
+            .keep_alive_idle_time(std::chrono::seconds(30))
+            .keep_alive_interval(std::chrono::seconds(5))
+            .keep_alive_count(3)
+            .tcp_quick_ack(true);
+
+        apply_socket_config(socket, config, logger, "test");
+
+        asio::ip::tcp::no_delay no_delay;
+        socket.get_option(no_delay);
+        CHECK(no_delay.value());
+
+        asio::socket_base::keep_alive keep_alive;
+        socket.get_option(keep_alive);
+        CHECK(keep_alive.value());
+
+        // Some OSs (for example, Linux) report larger buffers than requested.
+        asio::socket_base::send_buffer_size send_buffer_size;
+        socket.get_option(send_buffer_size);
+        CHECK(static_cast<std::size_t>(send_buffer_size.value()) >=
+            buffer_size);
+        asio::socket_base::receive_buffer_size receive_buffer_size;
+        socket.get_option(receive_buffer_size);
+        CHECK(static_cast<std::size_t>(receive_buffer_size.value()) >=
+            buffer_size);
+
+#ifdef TCP_KEEPIDLE
+        msgpack_rpc::transport::impl::IntegerSocketOption<IPPROTO_TCP,
+            TCP_KEEPIDLE>
+            keep_alive_idle_time;
+        socket.get_option(keep_alive_idle_time);
+        CHECK(keep_alive_idle_time.value() == 30);
+#endif
+#ifdef TCP_KEEPINTVL
+        msgpack_rpc::transport::impl::IntegerSocketOption<IPPROTO_TCP,
+            TCP_KEEPINTVL>
+            keep_alive_interval;
+        socket.get_option(keep_alive_interval);
+        CHECK(keep_alive_interval.value() == 5);
+#endif
+#ifdef TCP_KEEPCNT
+        msgpack_rpc::transport::impl::IntegerSocketOption<IPPROTO_TCP,
+            TCP_KEEPCNT>
+            keep_alive_count;
+        socket.get_option(keep_alive_count);
+        CHECK(keep_alive_count.value() == 3);
+#endif
+#ifdef TCP_QUICKACK
+        msgpack_rpc::transport::impl::IntegerSocketOption<IPPROTO_TCP,
+            TCP_QUICKACK>
+            quick_ack;
+        socket.get_option(quick_ack);
+        CHECK(quick_ack.value() != 0);
+#endif
+    }
+
+    SECTION("disable TCP_NODELAY") {
+        SocketConfig config;
+        config.tcp_no_delay(false);
+
+        apply_socket_config(socket, config, logger, "test");
+
+        asio::ip::tcp::no_delay no_delay;
+        socket.get_option(no_delay);
+        CHECK_FALSE(no_delay.value());
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of FlowController class.
+ */
+#include "msgpack_rpc/transport/flow_controller.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "msgpack_rpc/config/flow_control_config.h"
+
+TEST_CASE("msgpack_rpc::transport::FlowController") {
+    using msgpack_rpc::config::FlowControlConfig;
+    using msgpack_rpc::transport::FlowController;
+
+    SECTION("apply backpressure using watermarks in bytes") {
+        FlowControlConfig config;
+        config.high_watermark_bytes(100).low_watermark_bytes(50);
+        FlowController controller{config};
+
+        CHECK_FALSE(controller.on_pushed(60));
+        CHECK_FALSE(controller.on_pushed(40));
+        CHECK_FALSE(controller.is_paused());
+        CHECK(controller.on_pushed(30));
+        CHECK(controller.is_paused());
+        CHECK_FALSE(controller.on_pushed(30));
+        CHECK(controller.queued_bytes() == 160U);
+        CHECK(controller.queued_messages() == 4U);
+
+        CHECK_FALSE(controller.on_popped(60));
+        CHECK(controller.is_paused());
+        CHECK(controller.on_popped(40));
+        CHECK_FALSE(controller.is_paused());
+        CHECK_FALSE(controller.on_popped(30));
+        CHECK(controller.queued_bytes() == 30U);
+        CHECK(controller.queued_messages() == 1U);
+    }
+
+    SECTION("apply backpressure using watermarks in messages") {
+        FlowControlConfig config;
+        config.high_watermark_bytes(0)
+            .high_watermark_messages(2)
+            .low_watermark_messages(0);
+        FlowController controller{config};
+
+        CHECK_FALSE(controller.on_pushed(1));
+        CHECK_FALSE(controller.on_pushed(1));
+        CHECK(controller.on_pushed(1));
+
+        CHECK_FALSE(controller.on_popped(1));
+        CHECK_FALSE(controller.on_popped(1));
+        CHECK(controller.on_popped(1));
+    }
+
+    SECTION("treat low watermarks larger than high watermarks") {
+        FlowControlConfig config;
+        config.high_watermark_bytes(100).low_watermark_bytes(200);
+        FlowController controller{config};
+
+        CHECK(controller.on_pushed(150));
+        CHECK_FALSE(controller.on_popped(0));
+        CHECK(controller.on_popped(50));
+    }
+
+    SECTION("check whether messages can be pushed") {
+        FlowControlConfig config;
+        config.high_watermark_bytes(100)
+            .low_watermark_bytes(50)
+            .high_watermark_messages(3)
+            .low_watermark_messages(0);
+        FlowController controller{config};
+
+        CHECK(controller.can_push(150));
+        CHECK_FALSE(controller.on_pushed(60));
+        CHECK(controller.can_push(40));
+        CHECK_FALSE(controller.can_push(41));
+        CHECK_FALSE(controller.on_pushed(20));
+        CHECK(controller.can_push(1));
+        CHECK_FALSE(controller.on_pushed(1));
+        CHECK_FALSE(controller.can_push(1));
+    }
+
+    SECTION("apply no backpressure without limits") {
+        FlowControlConfig config;
+        config.high_watermark_bytes(0).high_watermark_messages(0);
+        FlowController controller{config};
+
+        CHECK_FALSE(controller.on_pushed(1000000000));
+        CHECK_FALSE(controller.is_paused());
+    }
+}
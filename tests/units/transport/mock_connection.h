@@ -32,11 +32,20 @@ public:
             ConnectionClosedCallback),
         override);
 
+    MAKE_MOCK3(start_raw,
+        void(RawMessageReceivedCallback, MessageSentCallback,
+            ConnectionClosedCallback),
+        override);
+
     MAKE_MOCK1(async_send,
         void(const msgpack_rpc::messages::SerializedMessage&), override);
 
     MAKE_MOCK0(async_close, void(), override);
 
+    MAKE_MOCK0(pause_reading, void(), override);
+
+    MAKE_MOCK0(resume_reading, void(), override);
+
     MAKE_CONST_MOCK0(local_address, const msgpack_rpc::addresses::IAddress&(),
         noexcept override);
 
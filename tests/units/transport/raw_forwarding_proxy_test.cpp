@@ -0,0 +1,452 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of RawForwardingProxy class.
+ */
+#include "msgpack_rpc/transport/raw_forwarding_proxy_impl.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../create_test_logger.h"
+#include "mock_connection.h"
+#include "msgpack_rpc/addresses/tcp_address.h"
+#include "msgpack_rpc/common/status.h"
+#include "msgpack_rpc/config/flow_control_config.h"
+#include "msgpack_rpc/messages/impl/raw_message_scanner.h"
+#include "msgpack_rpc/messages/message_id.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/raw_message.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/transport/i_connection.h"
+#include "msgpack_rpc_test/parse_messages.h"
+#include "trompeloeil_catch2.h"
+
+TEST_CASE("msgpack_rpc::transport::RawForwardingProxy") {
+    using msgpack_rpc::addresses::TCPAddress;
+    using msgpack_rpc::messages::MessageID;
+    using msgpack_rpc::messages::MessageSerializer;
+    using msgpack_rpc::messages::MethodNameView;
+    using msgpack_rpc::messages::RawMessage;
+    using msgpack_rpc::messages::SerializedMessage;
+    using msgpack_rpc::transport::IConnection;
+    using msgpack_rpc::transport::RawForwardingProxy;
+    using msgpack_rpc_test::MockConnection;
+    using msgpack_rpc_test::parse_notification;
+    using msgpack_rpc_test::parse_request;
+    using msgpack_rpc_test::parse_response;
+    using trompeloeil::_;
+
+    const auto to_raw = [](const SerializedMessage& message) {
+        const auto flattened = message.flatten();
+        const auto buffer = std::make_shared<const std::vector<char>>(
+            flattened.data(), flattened.data() + flattened.size());
+        return msgpack_rpc::messages::impl::scan_raw_message(
+            buffer, 0, buffer->size());
+    };
+
+    const auto logger = msgpack_rpc_test::create_test_logger();
+    const auto request_timeout = std::chrono::milliseconds(500);
+    constexpr std::size_t high_watermark_messages = 3;
+    constexpr std::size_t low_watermark_messages = 1;
+    msgpack_rpc::config::FlowControlConfig flow_control_config;
+    flow_control_config.high_watermark_messages(high_watermark_messages)
+        .low_watermark_messages(low_watermark_messages);
+    const auto remote_address = TCPAddress("127.0.0.1", 20000);
+
+    const auto upstream1 = std::make_shared<MockConnection>();
+    const auto upstream2 = std::make_shared<MockConnection>();
+    IConnection::RawMessageReceivedCallback on_upstream1_received;
+    IConnection::RawMessageReceivedCallback on_upstream2_received;
+    IConnection::MessageSentCallback on_upstream1_sent;
+    IConnection::MessageSentCallback on_upstream2_sent;
+    IConnection::ConnectionClosedCallback on_upstream1_closed;
+    REQUIRE_CALL(*upstream1, start_raw(_, _, _))
+        .TIMES(1)
+        .LR_SIDE_EFFECT(on_upstream1_received = _1)
+        .LR_SIDE_EFFECT(on_upstream1_sent = _2)
+        .LR_SIDE_EFFECT(on_upstream1_closed = _3);
+    REQUIRE_CALL(*upstream2, start_raw(_, _, _))
+        .TIMES(1)
+        .LR_SIDE_EFFECT(on_upstream2_received = _1)
+        .LR_SIDE_EFFECT(on_upstream2_sent = _2);
+
+    const auto proxy = std::make_shared<RawForwardingProxy>(
+        std::vector<std::shared_ptr<IConnection>>{upstream1, upstream2},
+        [](MethodNameView method_name) -> std::size_t {
+            if (method_name.name() == "method1") {
+                return 0;
+            }
+            if (method_name.name() == "method2") {
+                return 1;
+            }
+            return 2;
+        },
+        request_timeout, flow_control_config, logger);
+    proxy->start();
+
+    const auto downstream1 = std::make_shared<MockConnection>();
+    ALLOW_CALL(*downstream1, remote_address()).LR_RETURN(remote_address);
+    IConnection::RawMessageReceivedCallback on_downstream1_received;
+    IConnection::MessageSentCallback on_downstream1_sent;
+    IConnection::ConnectionClosedCallback on_downstream1_closed;
+    REQUIRE_CALL(*downstream1, start_raw(_, _, _))
+        .TIMES(1)
+        .LR_SIDE_EFFECT(on_downstream1_received = _1)
+        .LR_SIDE_EFFECT(on_downstream1_sent = _2)
+        .LR_SIDE_EFFECT(on_downstream1_closed = _3);
+    proxy->add_downstream(downstream1);
+
+    const MessageID downstream_id = 12345;
+
+    SECTION("forward a request and the response") {
+        std::optional<SerializedMessage> forwarded_request;
+        REQUIRE_CALL(*upstream2, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(forwarded_request.emplace(_1));
+        on_downstream1_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("method2"), downstream_id, 1, "abc")));
+
+        REQUIRE(forwarded_request.has_value());
+        const auto request = parse_request(forwarded_request->flatten());
+        CHECK(request.method_name().name() == "method2");
+        CHECK(request.parameters().as<int, std::string>() ==
+            std::make_tuple(1, std::string("abc")));
+        const MessageID upstream_id = request.id();
+
+        std::optional<SerializedMessage> forwarded_response;
+        REQUIRE_CALL(*downstream1, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(forwarded_response.emplace(_1));
+        on_upstream2_received(to_raw(
+            MessageSerializer::serialize_successful_response(
+                upstream_id, "result")));
+
+        REQUIRE(forwarded_response.has_value());
+        const auto response = parse_response(forwarded_response->flatten());
+        CHECK(response.id() == downstream_id);
+        REQUIRE(response.result().is_success());
+        CHECK(response.result().result_as<std::string>() == "result");
+    }
+
+    SECTION("forward requests with the same ID from different connections") {
+        const auto downstream2 = std::make_shared<MockConnection>();
+        ALLOW_CALL(*downstream2, remote_address()).LR_RETURN(remote_address);
+        IConnection::RawMessageReceivedCallback on_downstream2_received;
+        REQUIRE_CALL(*downstream2, start_raw(_, _, _))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(on_downstream2_received = _1);
+        proxy->add_downstream(downstream2);
+
+        std::vector<SerializedMessage> forwarded_requests;
+        REQUIRE_CALL(*upstream1, async_send(_))
+            .TIMES(2)
+            .LR_SIDE_EFFECT(forwarded_requests.push_back(_1));
+        on_downstream1_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("method1"), downstream_id, 1)));
+        on_downstream2_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("method1"), downstream_id, 2)));
+        on_upstream1_sent();
+
+        REQUIRE(forwarded_requests.size() == 2U);
+        const auto request1 = parse_request(forwarded_requests[0].flatten());
+        const auto request2 = parse_request(forwarded_requests[1].flatten());
+        CHECK(request1.id() != request2.id());
+
+        std::optional<SerializedMessage> forwarded_response;
+        REQUIRE_CALL(*downstream2, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(forwarded_response.emplace(_1));
+        on_upstream1_received(
+            to_raw(MessageSerializer::serialize_error_response(
+                request2.id(), "error")));
+
+        REQUIRE(forwarded_response.has_value());
+        const auto response = parse_response(forwarded_response->flatten());
+        CHECK(response.id() == downstream_id);
+        REQUIRE_FALSE(response.result().is_success());
+        CHECK(response.result().error_as<std::string>() == "error");
+    }
+
+    SECTION("respond an error to a request without upstream connections") {
+        std::optional<SerializedMessage> response_message;
+        REQUIRE_CALL(*downstream1, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(response_message.emplace(_1));
+        on_downstream1_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("unknown"), downstream_id, 1)));
+
+        REQUIRE(response_message.has_value());
+        const auto response = parse_response(*response_message);
+        CHECK(response.id() == downstream_id);
+        CHECK_FALSE(response.result().is_success());
+    }
+
+    SECTION("forward a notification") {
+        const auto notification =
+            MessageSerializer::serialize_notification("method1", 1, "abc");
+        std::optional<SerializedMessage> forwarded;
+        REQUIRE_CALL(*upstream1, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(forwarded.emplace(_1));
+        on_downstream1_received(to_raw(notification));
+
+        REQUIRE(forwarded.has_value());
+        const auto flattened = forwarded->flatten();
+        CHECK(std::string(flattened.data(), flattened.size()) ==
+            std::string(notification.data(), notification.size()));
+    }
+
+    SECTION("forward chunks and cancellation of a request") {
+        std::optional<SerializedMessage> forwarded_request;
+        REQUIRE_CALL(*upstream1, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(forwarded_request.emplace(_1));
+        on_downstream1_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("method1"), downstream_id, 1)));
+        REQUIRE(forwarded_request.has_value());
+        const MessageID upstream_id =
+            parse_request(forwarded_request->flatten()).id();
+        on_upstream1_sent();
+
+        std::optional<SerializedMessage> forwarded_chunk;
+        REQUIRE_CALL(*downstream1, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(forwarded_chunk.emplace(_1));
+        on_upstream1_received(
+            to_raw(MessageSerializer::serialize_notification(
+                "$/streamChunk", upstream_id, "chunk")));
+        REQUIRE(forwarded_chunk.has_value());
+        const auto chunk = parse_notification(forwarded_chunk->flatten());
+        CHECK(chunk.method_name().name() == "$/streamChunk");
+        CHECK(chunk.parameters().as<MessageID, std::string>() ==
+            std::make_tuple(downstream_id, std::string("chunk")));
+
+        std::optional<SerializedMessage> forwarded_cancel;
+        REQUIRE_CALL(*upstream1, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(forwarded_cancel.emplace(_1));
+        on_downstream1_received(
+            to_raw(MessageSerializer::serialize_notification(
+                "$/cancelRequest", downstream_id)));
+        REQUIRE(forwarded_cancel.has_value());
+        const auto cancel = parse_notification(forwarded_cancel->flatten());
+        CHECK(cancel.method_name().name() == "$/cancelRequest");
+        CHECK(cancel.parameters().as<MessageID>() ==
+            std::make_tuple(upstream_id));
+        on_upstream1_sent();
+
+        // The request is forgotten, so the response is dropped.
+        on_upstream1_received(to_raw(
+            MessageSerializer::serialize_error_response(upstream_id, "error")));
+    }
+
+    SECTION("fail requests without responses within the timeout") {
+        std::optional<SerializedMessage> forwarded_request;
+        REQUIRE_CALL(*upstream1, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(forwarded_request.emplace(_1));
+        on_downstream1_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("method1"), downstream_id, 1)));
+        REQUIRE(forwarded_request.has_value());
+        const MessageID upstream_id =
+            parse_request(forwarded_request->flatten()).id();
+        on_upstream1_sent();
+
+        std::this_thread::sleep_for(request_timeout * 2);
+
+        std::vector<SerializedMessage> upstream_messages;
+        REQUIRE_CALL(*upstream1, async_send(_))
+            .TIMES(2)
+            .LR_SIDE_EFFECT(upstream_messages.push_back(_1));
+        std::optional<SerializedMessage> response_message;
+        REQUIRE_CALL(*downstream1, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(response_message.emplace(_1));
+        on_downstream1_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("method1"), downstream_id + 1U, 1)));
+        on_upstream1_sent();
+
+        REQUIRE(response_message.has_value());
+        const auto response = parse_response(*response_message);
+        CHECK(response.id() == downstream_id);
+        REQUIRE_FALSE(response.result().is_success());
+        CHECK(response.result().error_as<std::string>() == "TIMEOUT");
+
+        REQUIRE(upstream_messages.size() == 2U);
+        const auto cancel = parse_notification(upstream_messages[0]);
+        CHECK(cancel.method_name().name() == "$/cancelRequest");
+        CHECK(cancel.parameters().as<MessageID>() ==
+            std::make_tuple(upstream_id));
+        const auto next_request = parse_request(upstream_messages[1]);
+        CHECK(next_request.method_name().name() == "method1");
+
+        // The response is dropped.
+        on_upstream1_received(to_raw(
+            MessageSerializer::serialize_successful_response(
+                upstream_id, "result")));
+    }
+
+    SECTION("fail requests when an upstream connection is closed") {
+        REQUIRE_CALL(*upstream1, async_send(_)).TIMES(1);
+        on_downstream1_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("method1"), downstream_id, 1)));
+
+        std::vector<SerializedMessage> responses;
+        REQUIRE_CALL(*downstream1, async_send(_))
+            .TIMES(2)
+            .LR_SIDE_EFFECT(responses.push_back(_1));
+        on_upstream1_closed(msgpack_rpc::Status());
+        on_downstream1_sent();
+        on_downstream1_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("method1"), downstream_id + 1U, 1)));
+
+        REQUIRE(responses.size() == 2U);
+        const auto response1 = parse_response(responses[0]);
+        CHECK(response1.id() == downstream_id);
+        CHECK_FALSE(response1.result().is_success());
+        const auto response2 = parse_response(responses[1]);
+        CHECK(response2.id() == downstream_id + 1U);
+        CHECK_FALSE(response2.result().is_success());
+    }
+
+    SECTION("cancel requests when a downstream connection is closed") {
+        std::optional<SerializedMessage> forwarded_request;
+        REQUIRE_CALL(*upstream2, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(forwarded_request.emplace(_1));
+        on_downstream1_received(to_raw(MessageSerializer::serialize_request(
+            MethodNameView("method2"), downstream_id, 1)));
+        REQUIRE(forwarded_request.has_value());
+        const MessageID upstream_id =
+            parse_request(forwarded_request->flatten()).id();
+        on_upstream2_sent();
+
+        std::optional<SerializedMessage> cancel_message;
+        REQUIRE_CALL(*upstream2, async_send(_))
+            .TIMES(1)
+            .LR_SIDE_EFFECT(cancel_message.emplace(_1));
+        on_downstream1_closed(msgpack_rpc::Status());
+
+        REQUIRE(cancel_message.has_value());
+        const auto cancel = parse_notification(*cancel_message);
+        CHECK(cancel.method_name().name() == "$/cancelRequest");
+        CHECK(cancel.parameters().as<MessageID>() ==
+            std::make_tuple(upstream_id));
+
+        // The response is dropped.
+        on_upstream2_received(to_raw(
+            MessageSerializer::serialize_successful_response(
+                upstream_id, "result")));
+    }
+
+    SECTION("send messages to a connection one by one") {
+        std::vector<SerializedMessage> forwarded;
+        {
+            REQUIRE_CALL(*upstream1, async_send(_))
+                .TIMES(1)
+                .LR_SIDE_EFFECT(forwarded.push_back(_1));
+            on_downstream1_received(
+                to_raw(MessageSerializer::serialize_notification(
+                    "method1", 1)));
+            on_downstream1_received(
+                to_raw(MessageSerializer::serialize_notification(
+                    "method1", 2)));
+            on_downstream1_received(
+                to_raw(MessageSerializer::serialize_notification(
+                    "method1", 3)));
+        }
+        REQUIRE(forwarded.size() == 1U);
+
+        {
+            REQUIRE_CALL(*upstream1, async_send(_))
+                .TIMES(1)
+                .LR_SIDE_EFFECT(forwarded.push_back(_1));
+            on_upstream1_sent();
+        }
+        REQUIRE(forwarded.size() == 2U);
+
+        {
+            REQUIRE_CALL(*upstream1, async_send(_))
+                .TIMES(1)
+                .LR_SIDE_EFFECT(forwarded.push_back(_1));
+            on_upstream1_sent();
+        }
+        REQUIRE(forwarded.size() == 3U);
+
+        // No message is sent when the queue is empty.
+        on_upstream1_sent();
+
+        for (std::size_t i = 0; i < forwarded.size(); ++i) {
+            const auto notification = parse_notification(forwarded[i]);
+            CHECK(notification.parameters().as<int>() ==
+                std::make_tuple(static_cast<int>(i) + 1));
+        }
+    }
+
+    SECTION("pause reading from connections sending to a full queue") {
+        const auto send_notifications = [&] {
+            REQUIRE_CALL(*upstream1, async_send(_)).TIMES(1);
+            for (std::size_t i = 0; i < high_watermark_messages; ++i) {
+                on_downstream1_received(
+                    to_raw(MessageSerializer::serialize_notification(
+                        "method1", static_cast<int>(i))));
+            }
+            REQUIRE_CALL(*downstream1, pause_reading()).TIMES(1);
+            on_downstream1_received(to_raw(
+                MessageSerializer::serialize_notification("method1", 0)));
+        };
+
+        SECTION("resume reading when the queue is drained") {
+            send_notifications();
+
+            {
+                REQUIRE_CALL(*upstream1, async_send(_)).TIMES(2);
+                on_upstream1_sent();
+                on_upstream1_sent();
+            }
+
+            REQUIRE_CALL(*upstream1, async_send(_)).TIMES(1);
+            REQUIRE_CALL(*downstream1, resume_reading()).TIMES(1);
+            on_upstream1_sent();
+        }
+
+        SECTION("resume reading when the queue is closed") {
+            send_notifications();
+
+            REQUIRE_CALL(*downstream1, resume_reading()).TIMES(1);
+            on_upstream1_closed(msgpack_rpc::Status());
+        }
+    }
+
+    SECTION("stop") {
+        REQUIRE_CALL(*upstream1, async_close()).TIMES(1);
+        REQUIRE_CALL(*upstream2, async_close()).TIMES(1);
+        REQUIRE_CALL(*downstream1, async_close()).TIMES(1);
+
+        proxy->stop();
+    }
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2023 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of classes to capture traffic.
+ */
+#include "msgpack_rpc/transport/traffic_capture.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "msgpack_rpc/common/msgpack_rpc_exception.h"
+#include "msgpack_rpc/messages/message_serializer.h"
+#include "msgpack_rpc/messages/method_name_view.h"
+#include "msgpack_rpc/messages/serialized_message.h"
+#include "msgpack_rpc/transport/traffic_recorder.h"
+
+TEST_CASE("msgpack_rpc::transport::TrafficCapture") {
+    using msgpack_rpc::messages::MessageSerializer;
+    using msgpack_rpc::messages::MethodNameView;
+    using msgpack_rpc::transport::TrafficCapture;
+    using msgpack_rpc::transport::TrafficCaptureReader;
+    using msgpack_rpc::transport::TrafficDirection;
+
+    const std::string file_path = "traffic_capture_test.bin";
+    std::filesystem::remove(file_path);
+
+    SECTION("write and read messages") {
+        const auto request = MessageSerializer::serialize_request(
+            MethodNameView("method"), 123, std::string("abc"));
+        const auto response =
+            MessageSerializer::serialize_successful_response(123, 456);
+        {
+            TrafficCapture capture(file_path);
+            const std::uint32_t connection_id1 = capture.register_connection();
+            const std::uint32_t connection_id2 = capture.register_connection();
+            CHECK(connection_id1 != connection_id2);
+
+            capture.record(connection_id1, TrafficDirection::INBOUND,
+                request.data(), request.size());
+            capture.record(
+                connection_id2, TrafficDirection::OUTBOUND, response);
+        }
+
+        TrafficCaptureReader reader(file_path);
+        const auto message1 = reader.next();
+        REQUIRE(message1);
+        CHECK(message1->connection_id == 0U);
+        CHECK(message1->direction == TrafficDirection::INBOUND);
+        CHECK(message1->data ==
+            std::vector<char>(
+                request.data(), request.data() + request.size()));
+        const auto message2 = reader.next();
+        REQUIRE(message2);
+        CHECK(message2->connection_id == 1U);
+        CHECK(message2->direction == TrafficDirection::OUTBOUND);
+        CHECK(message2->data ==
+            std::vector<char>(
+                response.data(), response.data() + response.size()));
+        CHECK(message1->timestamp <= message2->timestamp);
+        CHECK_FALSE(reader.next());
+    }
+
+    SECTION("overwrite an existing file") {
+        const auto notification = MessageSerializer::serialize_notification(
+            MethodNameView("method"), 1);
+        for (int i = 0; i < 2; ++i) {
+            TrafficCapture capture(file_path);
+            capture.record(capture.register_connection(),
+                TrafficDirection::INBOUND, notification);
+        }
+
+        TrafficCaptureReader reader(file_path);
+        const auto message = reader.next();
+        REQUIRE(message);
+        CHECK(message->connection_id == 0U);
+        CHECK_FALSE(reader.next());
+    }
+
+    SECTION("reject a file used by another object") {
+        TrafficCapture capture(file_path);
+
+        CHECK_THROWS_AS(TrafficCapture(file_path),
+            msgpack_rpc::MsgpackRPCException);
+        CHECK_THROWS_AS(TrafficCapture("./" + file_path),
+            msgpack_rpc::MsgpackRPCException);
+    }
+
+    SECTION("read a file of another format") {
+        {
+            std::ofstream file(file_path);
+            file << "invalid file";
+        }
+
+        CHECK_THROWS_AS(TrafficCaptureReader(file_path),
+            msgpack_rpc::MsgpackRPCException);
+    }
+
+    std::filesystem::remove(file_path);
+}
+
+TEST_CASE("msgpack_rpc::transport::TrafficRecorder") {
+    using msgpack_rpc::messages::MessageSerializer;
+    using msgpack_rpc::messages::MethodNameView;
+    using msgpack_rpc::transport::TrafficCapture;
+    using msgpack_rpc::transport::TrafficCaptureReader;
+    using msgpack_rpc::transport::TrafficDirection;
+    using msgpack_rpc::transport::TrafficRecorder;
+
+    const std::string file_path = "traffic_recorder_test.bin";
+    std::filesystem::remove(file_path);
+
+    SECTION("record received and sent messages") {
+        const auto request = MessageSerializer::serialize_request(
+            MethodNameView("method"), 1, std::string(100, 'a'));
+        const auto response =
+            MessageSerializer::serialize_successful_response(1, 2);
+
+        {
+            TrafficRecorder recorder(
+                std::make_shared<TrafficCapture>(file_path));
+            recorder.record_received(request.data(), request.size());
+            recorder.record_sent(response);
+        }
+
+        TrafficCaptureReader reader(file_path);
+        const auto message1 = reader.next();
+        REQUIRE(message1);
+        CHECK(message1->direction == TrafficDirection::INBOUND);
+        CHECK(message1->data ==
+            std::vector<char>(request.data(), request.data() + request.size()));
+        const auto message2 = reader.next();
+        REQUIRE(message2);
+        CHECK(message2->direction == TrafficDirection::OUTBOUND);
+        CHECK(message2->data ==
+            std::vector<char>(
+                response.data(), response.data() + response.size()));
+        CHECK(message2->timestamp >= message1->timestamp);
+        CHECK_FALSE(reader.next());
+    }
+
+    std::filesystem::remove(file_path);
+}